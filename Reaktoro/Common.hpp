@@ -37,6 +37,7 @@
 #include <Reaktoro/Common/ParseUtils.hpp>
 #include <Reaktoro/Common/Profiling.hpp>
 #include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Common/Span.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
 #include <Reaktoro/Common/Table.hpp>
@@ -140,6 +140,12 @@ using MatrixXdConstRef        = Eigen::Ref<const MatrixXd>; ///< Convenient alia
 using MatrixXdMap             = Eigen::Map<MatrixXd>;       ///< Convenient alias to Eigen type.
 using MatrixXdConstMap        = Eigen::Map<const MatrixXd>; ///< Convenient alias to Eigen type.
 
+using MatrixXdRowMajor                = Eigen::Matrix<double, -1, -1, Eigen::RowMajor>;                ///< Convenient alias to Eigen type.
+using MatrixXdRowMajorRef             = Eigen::Ref<MatrixXdRowMajor, 0, Eigen::OuterStride<>>;         ///< Convenient alias to Eigen type.
+using MatrixXdRowMajorConstRef        = Eigen::Ref<const MatrixXdRowMajor, 0, Eigen::OuterStride<>>;   ///< Convenient alias to Eigen type.
+using MatrixXdRowMajorMap             = Eigen::Map<MatrixXdRowMajor, 0, Eigen::OuterStride<>>;         ///< Convenient alias to Eigen type.
+using MatrixXdRowMajorConstMap        = Eigen::Map<const MatrixXdRowMajor, 0, Eigen::OuterStride<>>;   ///< Convenient alias to Eigen type.
+
 //---------------------------------------------------------------------------------------------------------------------
 // == ROW VECTOR TYPE ALIASES ==
 //---------------------------------------------------------------------------------------------------------------------
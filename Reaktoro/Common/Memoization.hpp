@@ -17,6 +17,9 @@
 
 #pragma once
 
+// C++ includes
+#include <algorithm>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Meta.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
@@ -67,6 +70,28 @@ struct MemoizationTraits
     }
 };
 
+/// Used to enable function arguments of type `real` to be cached in a memoized version of the function.
+/// The derivative seed of the argument is also compared, so that a result
+/// computed with an unseeded argument is not reused when derivatives with
+/// respect to this argument are needed (and vice versa).
+template<>
+struct MemoizationTraits<real>
+{
+    using Type = real;
+
+    using CacheType = real;
+
+    static auto equal(const CacheType& a, const Type& b)
+    {
+        return sameValueAndSeed(a, b);
+    }
+
+    static auto assign(CacheType& a, const Type& b)
+    {
+        a = b;
+    }
+};
+
 namespace detail {
 
 /// Return true if `a` and `b` have the same value using `MemoizationTraits::equal`.
@@ -139,6 +164,16 @@ public:
     Memoization() = delete;
 };
 
+/// Used to count the cache hits and misses of a memoized function.
+struct MemoizationStats
+{
+    /// The number of calls whose result was found in the cache.
+    Index hits = 0;
+
+    /// The number of calls in which the function had to be evaluated.
+    Index misses = 0;
+};
+
 /// Return a memoized version of given function `f`.
 template<typename Ret, typename... Args>
 auto memoize(Fn<Ret(Args...)> f) -> Fn<Ret(Args...)>
@@ -188,6 +223,56 @@ auto memoizeLast(Fun f)
     return memoizeLast(asFunction(f));
 }
 
+/// Return a memoized version of given function `f` that caches the arguments and results of its `capacity` most recently used calls.
+/// The cache is searched from the most to the least recently used entry, and
+/// when full, the least recently used entry is replaced. A capacity of one
+/// is equivalent to @ref memoizeLast, whereas a capacity of zero disables
+/// caching. Unlike @ref memoize, the memory used by the cache is bounded,
+/// and unlike @ref memoizeLast, alternating calls with a few different
+/// arguments (e.g., the temperatures of neighbouring cells in a thermal
+/// gradient) do not miss the cache every time.
+/// @param f The function to be memoized
+/// @param capacity The maximum number of calls cached
+/// @param stats The optional counters of cache hits and misses updated on each call
+template<typename Ret, typename... Args>
+auto memoizeLRU(Fn<Ret(Args...)> f, Index capacity, SharedPtr<MemoizationStats> stats = {}) -> Fn<Ret(Args...)>
+{
+    using Entry = Pair<Tuple<detail::CacheType<Args>...>, Ret>;
+    Vec<Entry> entries;
+    entries.reserve(capacity);
+    return [=](Args... args) mutable -> Ret
+    {
+        if(Memoization::isDisabled())
+            return f(args...);
+        for(auto it = entries.begin(); it != entries.end(); ++it)
+        {
+            if(detail::sameValues(it->first, std::tie(args...)))
+            {
+                std::rotate(entries.begin(), it, it + 1); // move the found entry to the front, as the most recently used
+                if(stats) stats->hits += 1;
+                return Ret(entries.front().second);
+            }
+        }
+        if(stats) stats->misses += 1;
+        if(capacity == 0)
+            return f(args...);
+        Ret result = f(args...); // evaluate before changing the cache in case f throws
+        if(entries.size() < capacity)
+            entries.emplace_back();
+        std::rotate(entries.begin(), entries.end() - 1, entries.end()); // move the least recently used (or new) entry to the front
+        detail::assignValues(entries.front().first, std::tie(args...));
+        entries.front().second = result;
+        return result;
+    };
+}
+
+/// Return a memoized version of given function `f` that caches the arguments and results of its `capacity` most recently used calls.
+template<typename Fun, Requires<!isFunction<Fun>> = true>
+auto memoizeLRU(Fun f, Index capacity, SharedPtr<MemoizationStats> stats = {})
+{
+    return memoizeLRU(asFunction(f), capacity, stats);
+}
+
 /// Return a memoized version of given function `f` that caches only the arguments used in the last call.
 template<typename Ret, typename RetRef, typename... Args>
 auto memoizeLastUsingRef(Fn<void(RetRef, Args...)> f) -> Fn<void(RetRef, Args...)>
@@ -237,4 +322,70 @@ auto memoizeLastUsingRef(Fun f)
     return memoizeLastUsingRef(asFunction(f));
 }
 
+/// Used to represent a memoized function whose cache capacity can be selected after construction.
+/// This is intended for call sites that keep a memoized function in a static
+/// (or thread-local) variable, so that its cache can be chosen to fit the
+/// calculations at hand (e.g., a larger capacity when many temperatures are
+/// visited alternately) and its cache hits and misses can be inspected.
+/// The cache is managed with @ref memoizeLRU, so that the default capacity of
+/// one is equivalent to @ref memoizeLast.
+template<typename Signature>
+class MemoizedFn;
+
+template<typename Ret, typename... Args>
+class MemoizedFn<Ret(Args...)>
+{
+public:
+    /// Construct a MemoizedFn object with given function and cache capacity.
+    explicit MemoizedFn(Fn<Ret(Args...)> f, Index capacity = 1)
+    : m_f(f)
+    {
+        setCapacity(capacity);
+    }
+
+    /// Set the maximum number of calls cached (the current cache is discarded).
+    auto setCapacity(Index capacity) -> void
+    {
+        m_capacity = capacity;
+        m_memoized = memoizeLRU(m_f, capacity, m_stats);
+    }
+
+    /// Return the maximum number of calls cached.
+    auto capacity() const -> Index
+    {
+        return m_capacity;
+    }
+
+    /// Return the counters of cache hits and misses since construction or the last call to @ref resetStats.
+    auto stats() const -> const MemoizationStats&
+    {
+        return *m_stats;
+    }
+
+    /// Reset the counters of cache hits and misses.
+    auto resetStats() -> void
+    {
+        *m_stats = {};
+    }
+
+    /// Evaluate the memoized function.
+    auto operator()(Args... args) const -> Ret
+    {
+        return m_memoized(args...);
+    }
+
+private:
+    /// The function being memoized.
+    Fn<Ret(Args...)> m_f;
+
+    /// The memoized version of the function.
+    Fn<Ret(Args...)> m_memoized;
+
+    /// The maximum number of calls cached.
+    Index m_capacity = 1;
+
+    /// The counters of cache hits and misses.
+    SharedPtr<MemoizationStats> m_stats = std::make_shared<MemoizationStats>();
+};
+
 } // namespace Reaktoro
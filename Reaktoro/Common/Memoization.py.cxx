@@ -30,4 +30,10 @@ void exportMemoization(py::module& m)
         .def_static("enable" , &Memoization::enable , "Enable memoization optimization.")
         .def_static("disable", &Memoization::disable, "Disable memoization optimization.")
         ;
+
+    py::class_<MemoizationStats>(m, "MemoizationStats")
+        .def(py::init<>())
+        .def_readwrite("hits", &MemoizationStats::hits, "The number of calls whose result was found in the cache.")
+        .def_readwrite("misses", &MemoizationStats::misses, "The number of calls in which the function had to be evaluated.")
+        ;
 }
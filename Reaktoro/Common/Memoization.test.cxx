@@ -63,6 +63,13 @@ TEST_CASE("Testing Memoization - memoizeLast with return", "[Memoization]")
     CHECK( f1(3.0, 7, 1.0) == f2(3.0, 7, 1.0) );
 
     CHECK( counter == 5 ); // two increments above, in f1 and f2, because of different arguments
+
+    real z = 1.0;
+    z[1] = 1.0; // seed z for computing derivatives with respect to it
+
+    CHECK( f2(3.0, 7, z)[1] == 21.0 ); // same argument values as before, but z is now seeded
+
+    CHECK( counter == 6 ); // one increment in last f2 call, because the cached result has no derivative with respect to z
 }
 
 /// The result of the function tested in the next test case.
@@ -126,3 +133,106 @@ TEST_CASE("Testing Memoization - memoizeLast without return", "[Memoization]")
 
     CHECK( counter == 5 ); // two increments above, in f1 and f2, because of different arguments
 }
+
+TEST_CASE("Testing Memoization - memoizeLRU", "[Memoization]")
+{
+    int counter = 0; // a counter for how many times f1 below has been fully evaluated
+
+    auto f1 = [&](double x, real z)
+    {
+        ++counter;
+        return x * z;
+    };
+
+    auto stats = std::make_shared<MemoizationStats>();
+
+    auto f2 = memoizeLRU(f1, 2, stats); // f2 is the memoized version of f1 caching its two most recently used calls
+
+    CHECK( f2(2.0, 3.0) == 6.0 );
+    CHECK( f2(4.0, 3.0) == 12.0 );
+
+    CHECK( counter == 2 );
+
+    // Alternating between the two cached arguments should never evaluate f1 again (unlike memoizeLast)
+    for(auto i = 0; i < 5; ++i)
+    {
+        CHECK( f2(2.0, 3.0) == 6.0 );
+        CHECK( f2(4.0, 3.0) == 12.0 );
+    }
+
+    CHECK( counter == 2 );
+    CHECK( stats->hits == 10 );
+    CHECK( stats->misses == 2 );
+
+    CHECK( f2(5.0, 3.0) == 15.0 ); // this evicts the least recently used entry, (2.0, 3.0)
+
+    CHECK( counter == 3 );
+
+    CHECK( f2(4.0, 3.0) == 12.0 ); // still cached
+
+    CHECK( counter == 3 );
+
+    CHECK( f2(2.0, 3.0) == 6.0 ); // evicted above, so evaluated again
+
+    CHECK( counter == 4 );
+    CHECK( stats->hits == 11 );
+    CHECK( stats->misses == 4 );
+
+    real z = 3.0;
+    autodiff::seed(z);
+
+    CHECK( grad(f2(2.0, z)) == 2.0 ); // same value of z but with a different derivative seed, so not a cache hit
+
+    CHECK( counter == 5 );
+
+    auto f3 = memoizeLRU(f1, 0); // a capacity of zero disables caching
+
+    f3(2.0, 3.0);
+    f3(2.0, 3.0);
+
+    CHECK( counter == 7 );
+
+    Memoization::disable();
+
+    f2(4.0, 3.0); // memoization is disabled, so counter will be incremented, even though same arguments used here again
+
+    CHECK( counter == 8 );
+
+    Memoization::enable();
+}
+
+TEST_CASE("Testing Memoization - MemoizedFn", "[Memoization]")
+{
+    int counter = 0; // a counter for how many times f below has been fully evaluated
+
+    Fn<real(const real&, const real&)> f = [&](const real& T, const real& P)
+    {
+        ++counter;
+        return T * P;
+    };
+
+    MemoizedFn<real(const real&, const real&)> g(f);
+
+    CHECK( g.capacity() == 1 ); // the default capacity is equivalent to memoizeLast
+
+    g(300.0, 1.0);
+    g(310.0, 1.0);
+    g(300.0, 1.0);
+
+    CHECK( counter == 3 );
+    CHECK( g.stats().hits == 0 );
+    CHECK( g.stats().misses == 3 );
+
+    g.setCapacity(4);
+    g.resetStats();
+
+    CHECK( g.capacity() == 4 );
+
+    for(auto i = 0; i < 3; ++i)
+        for(auto T : { 300.0, 310.0, 320.0, 330.0 })
+            CHECK( g(T, 2.0) == T * 2.0 );
+
+    CHECK( counter == 7 );
+    CHECK( g.stats().hits == 8 );
+    CHECK( g.stats().misses == 4 );
+}
@@ -25,4 +25,13 @@ namespace Reaktoro {
 /// The number type used throughout the library.
 using real = autodiff::real;
 
+/// Return true if two real numbers have the same value and the same derivative seed.
+/// Use this function instead of `a == b`, which compares only the values, to
+/// check if quantities computed with `b` (including their derivatives) can be
+/// reused for `a`.
+inline auto sameValueAndSeed(real const& a, real const& b) -> bool
+{
+    return a[0] == b[0] && a[1] == b[1];
+}
+
 } // namespace Reaktoro
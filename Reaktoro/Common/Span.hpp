@@ -0,0 +1,91 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// C++ includes
+#include <iterator>
+#include <type_traits>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+/// Used to view a contiguous sequence of values without owning them.
+/// This is a minimal replacement of `std::span` (available only in C++20). The
+/// viewed values can be changed via a Span object, but not their number.
+template<typename T>
+class Span
+{
+public:
+    /// Construct a default (empty) Span object.
+    Span() = default;
+
+    /// Construct a Span object viewing `size` values starting at `data`.
+    Span(T* data, Index size) : mdata(data), msize(size) {}
+
+    /// Construct a Span object of constant values from a Span object of mutable values.
+    template<typename U, typename = std::enable_if_t<std::is_same_v<T, const U>>>
+    Span(Span<U> const& other) : mdata(other.data()), msize(other.size()) {}
+
+    /// Return a pointer to the first viewed value.
+    auto data() const -> T* { return mdata; }
+
+    /// Return the number of viewed values.
+    auto size() const -> Index { return msize; }
+
+    /// Return true if there are no viewed values.
+    auto empty() const -> bool { return msize == 0; }
+
+    /// Return a reference to the viewed value with given index.
+    auto operator[](Index i) const -> T& { return mdata[i]; }
+
+    /// Return a reference to the first viewed value.
+    auto front() const -> T& { return mdata[0]; }
+
+    /// Return a reference to the last viewed value.
+    auto back() const -> T& { return mdata[msize - 1]; }
+
+    /// Return an iterator to the first viewed value.
+    auto begin() const -> T* { return mdata; }
+
+    /// Return an iterator past the last viewed value.
+    auto end() const -> T* { return mdata + msize; }
+
+private:
+    /// The pointer to the first viewed value.
+    T* mdata = nullptr;
+
+    /// The number of viewed values.
+    Index msize = 0;
+};
+
+/// Return true if the values viewed by a Span object are equal to the values in a container.
+template<typename T, typename Container>
+auto operator==(Span<T> const& span, Container const& values) -> decltype(std::begin(values), bool())
+{
+    if(span.size() != std::size(values))
+        return false;
+    auto it = std::begin(values);
+    for(auto const& value : span)
+        if(!(value == *it++))
+            return false;
+    return true;
+}
+
+} // namespace Reaktoro
@@ -33,6 +33,13 @@ namespace {
 // Convenient alias for this translation unit.
 using DataType = TableColumn::DataType;
 
+// Convenient alias for the block of values in a table column.
+template<typename T>
+using Block = TableColumnBlock<T>;
+
+/// The minimum number of values that can be stored in a new block of a table column.
+const Index minblocksize = 256;
+
 /// Return true if type `T` is consistent with given column data type.
 template<typename T>
 auto isTypeConsistent(DataType datatype) -> bool
@@ -61,41 +68,140 @@ auto strColumnDataType(DataType datatype) -> String
     }
 }
 
-/// General implementation of an append function to add a new value to a table column.
+/// Call a function with a default value of the type of the values in a table column with given data type (which cannot be DataType::Undefined).
+template<typename Function>
+auto applyWithValueType(DataType datatype, Function const& f)
+{
+    switch(datatype)
+    {
+        case DataType::Integer: return f(long());
+        case DataType::String:  return f(String());
+        case DataType::Boolean: return f(bool());
+        default:                return f(double());
+    }
+}
+
+/// Return a new block of a table column that can store a given number of values.
+template<typename T>
+auto createBlock(Index capacity) -> Block<T>
+{
+    return { SharedPtr<T[]>(new T[capacity]), 0, capacity };
+}
+
+/// Return the block of a table column to which values of type `T` are appended.
 template<DataType type, typename T>
-auto appendNewValue(Any& data, DataType& datatype, T const& value, Chars strvaluetype)
+auto blockForAppend(Any& data, DataType& datatype, Chars strvaluetype) -> Block<T>&
 {
     if(!data.has_value())
     {
-        data = Deque<T>();
+        data = Block<T>();
         datatype = type;
     }
 
-    errorifnot(isTypeConsistent<T>(type),
-        "You cannot append a value of ", strvaluetype, " type to a table column that store values of ", strColumnDataType(type), " type. "
+    errorifnot(datatype == type && isTypeConsistent<T>(type),
+        "You cannot append a value of ", strvaluetype, " type to a table column that store values of ", strColumnDataType(datatype), " type. "
         "Make sure that after inserting the first value into a table column, the **same value type** is used for all subsequent inserts. "
         "Note that integer values can be stored as floating-point values in a table column of floats. No other conversion is supported.");
 
-    auto& deque = std::any_cast<Deque<T>&>(data);
-    deque.push_back(value);
+    return std::any_cast<Block<T>&>(data);
+}
+
+/// Move the values in the block of a table column into a new block, with capacity for at least a given number of values.
+template<typename T>
+auto reserveValues(Block<T>& block, Index capacity) -> void
+{
+    if(capacity <= block.capacity)
+        return;
+    auto grown = createBlock<T>(std::max({ capacity, 2 * block.capacity, minblocksize })); // spare capacity so that appending values moves them only a logarithmic number of times
+    if(block.values.use_count() == 1)
+        std::move(block.values.get(), block.values.get() + block.size, grown.values.get());
+    else std::copy_n(block.values.get(), block.size, grown.values.get()); // do not change values still viewed elsewhere (e.g., in NumPy arrays)
+    grown.size = block.size;
+    block = grown;
+}
+
+/// General implementation of an append function to add a new value to a table column.
+template<DataType type, typename T>
+auto appendNewValue(Any& data, DataType& datatype, T const& value, Chars strvaluetype)
+{
+    auto& block = blockForAppend<type, T>(data, datatype, strvaluetype);
+    reserveValues(block, block.size + 1);
+    block.values[block.size++] = value;
+}
+
+/// General implementation of an append function to add many new values to a table column.
+template<DataType type, typename T>
+auto appendNewValues(Any& data, DataType& datatype, Span<T const> values, Chars strvaluetype)
+{
+    auto& block = blockForAppend<type, T>(data, datatype, strvaluetype);
+    reserveValues(block, block.size + values.size());
+    std::copy_n(values.begin(), values.size(), block.values.get() + block.size);
+    block.size += values.size();
+}
+
+/// Return a view to the contiguous values in a table column.
+template<typename T>
+auto contiguousValues(Any const& data) -> Span<T const>
+{
+    auto const& block = std::any_cast<Block<T> const&>(data);
+    return Span<T const>(block.values.get(), block.size);
+}
+
+/// Return a mutable view to the contiguous values in a table column.
+template<typename T>
+auto contiguousValues(Any& data) -> Span<T>
+{
+    auto const& block = std::any_cast<Block<T> const&>(data);
+    return Span<T>(block.values.get(), block.size);
+}
+
+/// Remove the first values in a table column.
+template<typename T>
+auto removeFrontValues(Any& data, Index count)
+{
+    auto& block = std::any_cast<Block<T>&>(data);
+    auto kept = block.values.use_count() == 1 ? block : createBlock<T>(block.capacity); // do not change values still viewed elsewhere (e.g., in NumPy arrays)
+    std::move(block.values.get() + count, block.values.get() + block.size, kept.values.get());
+    kept.size = block.size - count;
+    block = kept;
+}
+
+/// Return a copy of the block of values in a table column that does not share memory with the original block.
+template<typename T>
+auto cloneBlock(Any const& data) -> Any
+{
+    auto const& block = std::any_cast<Block<T> const&>(data);
+    auto clone = createBlock<T>(block.capacity);
+    std::copy_n(block.values.get(), block.size, clone.values.get());
+    clone.size = block.size;
+    return clone;
+}
+
+/// Return the column name, between quotes if it contains the delimiter used in the output (e.g., delimiter is `,` and column name is `alpha,beta`; name becomes "alpha,beta" in the output).
+auto quotedColumnName(String const& colname, String const& delimiter) -> String
+{
+    return colname.find(delimiter) != String::npos ? "\"" + colname + "\"" : colname;
+}
+
+/// Configure a stream object to output floating-point values with given formatting options.
+auto configureStream(std::ostream& stream, Table::OutputOptions const& outputopts)
+{
+    if(outputopts.scientific) stream << std::scientific;
+    if(outputopts.fixed) stream << std::fixed;
+    stream << std::showpoint;
+    stream << std::setprecision(outputopts.precision);
 }
 
 /// Convert a TableColumn object to a vector of strings representing the column's data along its rows.
 auto stringfyTableColumn(String colname, TableColumn const& column, Table::OutputOptions const& outputopts) -> Strings
 {
-    auto const& [delimiter, precision, scientific, fixed] = outputopts;
-
     Strings rows;
     rows.reserve(1 + column.rows()); // extra entry for column's name (first entry!)
 
-    auto columnname_has_delimiter = colname.find(delimiter) != String::npos;
-    rows.push_back(columnname_has_delimiter ? "\"" + colname + "\"" : colname); // e.g., delimiter is `,` and column name is `alpha,beta`; name becomes "alpha,beta" in the output
+    rows.push_back(quotedColumnName(colname, outputopts.delimiter));
 
     std::ostringstream ss;
-    if(scientific) ss << std::scientific;
-    if(fixed) ss << std::fixed;
-    ss << std::showpoint;
-    ss << std::setprecision(precision);
+    configureStream(ss, outputopts);
 
     for(auto i = 0; i < column.rows(); ++i)
     {
@@ -144,11 +250,80 @@ auto outputTable(Stream& stream, Table const& table, Table::OutputOptions const&
     }
 }
 
+/// Return the number of complete rows in the columns of a table (i.e., rows with values in all columns).
+auto completeRows(Dict<String, TableColumn> const& columns) -> Index
+{
+    if(columns.empty())
+        return 0;
+    Index complete = columns.begin()->second.rows();
+    for(auto const& [name, column] : columns)
+        complete = std::min(complete, column.rows());
+    return complete;
+}
+
+/// Output the names of the columns of a table to a stream object, in a single line without alignment.
+auto outputTableHeader(std::ostream& stream, Dict<String, TableColumn> const& columns, Table::OutputOptions const& outputopts)
+{
+    auto j = 0;
+    for(auto const& [name, column] : columns)
+        stream << (j++ > 0 ? outputopts.delimiter : "") << quotedColumnName(name, outputopts.delimiter);
+    stream << "\n";
+}
+
+/// Output the first rows of the columns of a table to a stream object, one line per row without alignment.
+auto outputTableRows(std::ostream& stream, Dict<String, TableColumn> const& columns, Index numrows, Table::OutputOptions const& outputopts)
+{
+    using ColumnValues = std::variant<Span<double const>, Span<long const>, Span<String const>, Span<bool const>>;
+
+    Vec<ColumnValues> values; // the contiguous values of each column, so that the values along a row are found without search
+    values.reserve(columns.size());
+    for(auto const& [name, column] : columns)
+    {
+        switch(column.dataType())
+        {
+            case DataType::Float:   values.push_back(column.floats()); break;
+            case DataType::Integer: values.push_back(column.integers()); break;
+            case DataType::String:  values.push_back(column.strings()); break;
+            case DataType::Boolean: values.push_back(column.booleans()); break;
+            default:                values.push_back(Span<double const>()); break;
+        }
+    }
+
+    std::ostringstream ss; // the rows are assembled in memory first and then written to the stream at once
+    configureStream(ss, outputopts);
+
+    for(auto i = 0; i < numrows; ++i)
+    {
+        for(auto j = 0; j < values.size(); ++j)
+        {
+            if(j > 0) ss << outputopts.delimiter;
+            std::visit([&](auto const& span) { if(i < span.size()) ss << span[i]; }, values[j]);
+        }
+        ss << "\n";
+    }
+
+    stream << ss.str();
+}
+
 } // anonymous namespace
 
 TableColumn::TableColumn()
 {}
 
+TableColumn::TableColumn(TableColumn const& other)
+: mrows(other.mrows), datatype(other.datatype)
+{
+    if(datatype != DataType::Undefined)
+        data = applyWithValueType(datatype, [&](auto value) { return cloneBlock<decltype(value)>(other.data); });
+}
+
+auto TableColumn::operator=(TableColumn const& other) -> TableColumn&
+{
+    if(this != &other)
+        *this = TableColumn(other);
+    return *this;
+}
+
 auto TableColumn::appendFloat(double value) -> void
 {
     appendNewValue<DataType::Float>(data, datatype, value, "floating-point");
@@ -173,57 +348,76 @@ auto TableColumn::appendBoolean(bool value) -> void
     ++mrows;
 }
 
+auto TableColumn::appendFloats(Span<double const> values) -> void
+{
+    appendNewValues<DataType::Float>(data, datatype, values, "floating-point");
+    mrows += values.size();
+}
+
+auto TableColumn::appendIntegers(Span<long const> values) -> void
+{
+    appendNewValues<DataType::Integer>(data, datatype, values, "integer");
+    mrows += values.size();
+}
+
 auto TableColumn::dataType() const -> DataType
 {
     return datatype;
 }
 
-auto TableColumn::floats() const -> Deque<double> const&
+auto TableColumn::floats() const -> Span<double const>
 {
     errorif(datatype != DataType::Float, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to values a list of of floating-point type.");
-    return std::any_cast<Deque<double> const&>(data);
+    return contiguousValues<double>(data);
 }
 
-auto TableColumn::floats() -> Deque<double>&
+auto TableColumn::floats() -> Span<double>
 {
     errorif(datatype != DataType::Float, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to values a list of of floating-point type.");
-    return std::any_cast<Deque<double>&>(data);
+    return contiguousValues<double>(data);
 }
 
-auto TableColumn::integers() const -> Deque<long> const&
+auto TableColumn::integers() const -> Span<long const>
 {
     errorif(datatype != DataType::Integer, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of integer type.");
-    return std::any_cast<Deque<long> const&>(data);
+    return contiguousValues<long>(data);
 }
 
-auto TableColumn::integers() -> Deque<long>&
+auto TableColumn::integers() -> Span<long>
 {
     errorif(datatype != DataType::Integer, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of integer type.");
-    return std::any_cast<Deque<long>&>(data);
+    return contiguousValues<long>(data);
 }
 
-auto TableColumn::strings() const -> Deque<String> const&
+auto TableColumn::strings() const -> Span<String const>
 {
     errorif(datatype != DataType::String, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of string type.");
-    return std::any_cast<Deque<String> const&>(data);
+    return contiguousValues<String>(data);
 }
 
-auto TableColumn::strings() -> Deque<String>&
+auto TableColumn::strings() -> Span<String>
 {
     errorif(datatype != DataType::String, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of string type.");
-    return std::any_cast<Deque<String>&>(data);
+    return contiguousValues<String>(data);
 }
 
-auto TableColumn::booleans() const -> Deque<bool> const&
+auto TableColumn::booleans() const -> Span<bool const>
 {
     errorif(datatype != DataType::Boolean, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of boolean type.");
-    return std::any_cast<Deque<bool> const&>(data);
+    return contiguousValues<bool>(data);
 }
 
-auto TableColumn::booleans() -> Deque<bool>&
+auto TableColumn::booleans() -> Span<bool>
 {
     errorif(datatype != DataType::Boolean, "You cannot convert a table column with values of ", strColumnDataType(datatype), " type to a list of values of boolean type.");
-    return std::any_cast<Deque<bool>&>(data);
+    return contiguousValues<bool>(data);
+}
+
+auto TableColumn::capacity() const -> Index
+{
+    if(datatype == DataType::Undefined)
+        return 0;
+    return applyWithValueType(datatype, [&](auto value) { return block<decltype(value)>().capacity; });
 }
 
 auto TableColumn::rows() const -> Index
@@ -231,24 +425,103 @@ auto TableColumn::rows() const -> Index
     return mrows;
 }
 
+auto TableColumn::removeFront(Index count) -> void
+{
+    errorif(count > mrows, "Cannot remove ", count, " rows from a table column with only ", mrows, " rows.");
+    if(count == 0)
+        return;
+    applyWithValueType(datatype, [&](auto value) { removeFrontValues<decltype(value)>(data, count); });
+    mrows -= count;
+}
+
 auto TableColumn::operator[](Index row) const -> std::variant<double, long, String, bool>
 {
     errorifnot(row < mrows, "Given row index, ", row, ", is greater than number of rows in the table column, ", mrows, ".");
     switch(datatype)
     {
-        case DataType::Float:     return std::any_cast<Deque<double> const&>(data)[row];
-        case DataType::Integer:   return std::any_cast<Deque<long> const&>(data)[row];
-        case DataType::String:    return std::any_cast<Deque<String> const&>(data)[row];
-        case DataType::Boolean:   return std::any_cast<Deque<bool> const&>(data)[row];
+        case DataType::Float:     return block<double>().values[row];
+        case DataType::Integer:   return block<long>().values[row];
+        case DataType::String:    return block<String>().values[row];
+        case DataType::Boolean:   return block<bool>().values[row];
         default: return NaN;
     }
 }
 
+/// The state of the file to which a Table object streams its rows.
+struct Table::Stream
+{
+    /// The file to which the rows are written.
+    std::ofstream file;
+
+    /// The path to the file.
+    String filepath;
+
+    /// The formatting options for the output of the rows.
+    OutputOptions outputopts;
+
+    /// The number of complete rows kept in the table before they are written to the file.
+    Index buffersize = 0;
+
+    /// The number of rows already written to the file.
+    Index streamed = 0;
+
+    /// The boolean flag indicating if the header of the file has already been written.
+    bool header = false;
+
+    /// Write the first rows in the columns of the table to the file and remove them from the columns.
+    auto write(Dict<String, TableColumn>& columns, Index numrows) -> void
+    {
+        if(!header && (numrows > 0 || !columns.empty()))
+        {
+            outputTableHeader(file, columns, outputopts);
+            header = true;
+        }
+
+        outputTableRows(file, columns, numrows, outputopts);
+        file.flush();
+
+        errorif(!file, "Could not write the rows of the Table object to file `", filepath, "`.");
+
+        for(auto it = columns.begin(); it != columns.end(); ++it)
+            it.value().removeFront(std::min(numrows, it->second.rows()));
+
+        streamed += numrows;
+    }
+};
+
 Table::Table()
 {
 
 }
 
+Table::Table(Table const& other)
+: mcolumns(other.mcolumns)
+{}
+
+Table::Table(Table&& other) = default;
+
+Table::~Table()
+{
+    try { close(); } catch(...) {} // errors cannot be reported from a destructor; use method Table::close to detect them
+}
+
+auto Table::operator=(Table const& other) -> Table&
+{
+    mcolumns = other.mcolumns;
+    return *this;
+}
+
+auto Table::operator=(Table&& other) -> Table&
+{
+    if(this != &other)
+    {
+        close();
+        mcolumns = std::move(other.mcolumns);
+        mstream = std::move(other.mstream);
+    }
+    return *this;
+}
+
 auto Table::columns() const -> Dict<String, TableColumn> const&
 {
     return mcolumns;
@@ -263,10 +536,12 @@ auto Table::column(String const& columnname) const -> TableColumn const&
 
 auto Table::column(String const& columnname) -> TableColumn&
 {
+    errorif(mstream && mstream->file.is_open() && mstream->header && mcolumns.find(columnname) == mcolumns.end(),
+        "You cannot add column `", columnname, "` to a Table object that has already written the header of file `", mstream->filepath, "` to which it streams its rows.");
     return mcolumns[columnname];
 }
 
-auto Table::operator[](String const& columnname) const -> Deque<double> const&
+auto Table::operator[](String const& columnname) const -> Span<double const>
 {
     auto& col = column(columnname);
     auto const& datatype = col.dataType();
@@ -276,9 +551,10 @@ auto Table::operator[](String const& columnname) const -> Deque<double> const&
     return col.floats();
 }
 
-auto Table::operator[](String const& columnname) -> Deque<double>&
+auto Table::operator[](String const& columnname) -> Span<double>
 {
-    return const_cast<Deque<double>&>(std::as_const(*this)[columnname]);
+    const auto values = std::as_const(*this)[columnname];
+    return Span<double>(const_cast<double*>(values.data()), values.size());
 }
 
 auto Table::rows() const -> Index
@@ -307,6 +583,47 @@ auto Table::save(String const& filepath, OutputOptions const& outputopts) const
     outputTable(file, *this, outputopts);
 }
 
+auto Table::stream(String const& filepath, OutputOptions const& outputopts, Index buffersize) -> void
+{
+    close();
+
+    mstream = std::make_unique<Stream>();
+    mstream->file.open(filepath);
+    mstream->filepath = filepath;
+    mstream->outputopts = outputopts;
+    mstream->buffersize = buffersize;
+
+    errorif(!mstream->file, "Could not create the file `", filepath, "` to which the Table object streams its rows. Ensure the directory exists and is writable.");
+}
+
+auto Table::endRow() -> void
+{
+    if(!mstream || !mstream->file.is_open())
+        return;
+    const auto complete = completeRows(mcolumns);
+    if(complete >= mstream->buffersize)
+        mstream->write(mcolumns, complete);
+}
+
+auto Table::flush() -> void
+{
+    errorif(!mstream || !mstream->file.is_open(), "You cannot flush the rows of a Table object that is not streaming them to a file. Use method Table::stream first.");
+    mstream->write(mcolumns, completeRows(mcolumns));
+}
+
+auto Table::close() -> void
+{
+    if(!mstream || !mstream->file.is_open())
+        return;
+    mstream->write(mcolumns, rows());
+    mstream->file.close();
+}
+
+auto Table::streamed() const -> Index
+{
+    return mstream ? mstream->streamed : 0;
+}
+
 Table::OutputOptions::OutputOptions()
 : delimiter(" | "), precision(6), scientific(false), fixed(false)
 {}
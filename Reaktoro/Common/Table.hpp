@@ -19,12 +19,36 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Span.hpp>
 #include <Reaktoro/Common/TraitsUtils.hpp>
 #include <Reaktoro/Common/Types.hpp>
 
 namespace Reaktoro {
 
+/// Used to store the contiguous values in a table column.
+/// @see TableColumn
+template<typename T>
+struct TableColumnBlock
+{
+    /// The memory of the block, whose ownership can be shared with views that outlive changes in the column (e.g., NumPy arrays).
+    SharedPtr<T[]> values;
+
+    /// The number of values stored in the block.
+    Index size = 0;
+
+    /// The number of values that can be stored in the block.
+    Index capacity = 0;
+};
+
 /// Used to represent the data stored in a table column.
+/// The values in a table column are stored in a single block of contiguous
+/// memory with spare capacity. When an append exceeds this capacity, the
+/// values are moved into a new block with twice as many rows. Thus, methods
+/// such as @ref floats never change the column and can be called from
+/// multiple threads at the same time, as long as no values are appended. A
+/// view to the values (e.g., a NumPy array) remains valid after the column
+/// changes, since it shares ownership of the block, but it no longer sees
+/// changes to the column once its values have been moved to a new block.
 /// @see Table
 class TableColumn
 {
@@ -42,6 +66,18 @@ public:
     /// Construct a default TableColumn object.
     TableColumn();
 
+    /// Construct a copy of a TableColumn object (values are copied, not shared).
+    TableColumn(TableColumn const& other);
+
+    /// Construct a TableColumn object by moving the values of another.
+    TableColumn(TableColumn&& other) = default;
+
+    /// Assign a copy of a TableColumn object to this one (values are copied, not shared).
+    auto operator=(TableColumn const& other) -> TableColumn&;
+
+    /// Assign a TableColumn object to this one by moving its values.
+    auto operator=(TableColumn&& other) -> TableColumn& = default;
+
     /// Append a new floating-point value to the TableColumn object.
     /// @warning By appending a floating-point value, the column data type must be DataType::Float, otherwise a runtime error is thrown.
     auto appendFloat(double value) -> void;
@@ -58,44 +94,72 @@ public:
     /// @warning By appending a boolean value, the column data type must be DataType::Bool, otherwise a runtime error is thrown.
     auto appendBoolean(bool value) -> void;
 
+    /// Append many floating-point values to the TableColumn object at once.
+    /// @warning By appending floating-point values, the column data type must be DataType::Float, otherwise a runtime error is thrown.
+    auto appendFloats(Span<double const> values) -> void;
+
+    /// Append many integer values to the TableColumn object at once.
+    /// @warning By appending integer values, the column data type must be DataType::Integer, otherwise a runtime error is thrown.
+    auto appendIntegers(Span<long const> values) -> void;
+
     /// Get the data type of the column.
     auto dataType() const -> DataType;
 
-    /// Convert this TableColumn object to a constant reference to its underlying `Deque<double>` object.
+    /// Return a view to the contiguous floating-point values in the column.
     /// @warning If the column data type is not DataType::Float, a runtime error is thrown.
-    auto floats() const -> Deque<double> const&;
+    auto floats() const -> Span<double const>;
 
-    /// Convert this TableColumn object to a mutable reference to its underlying `Deque<double>` object.
+    /// Return a view to the contiguous floating-point values in the column, which can be changed but not resized.
     /// @warning If the column data type is not DataType::Float, a runtime error is thrown.
-    auto floats() -> Deque<double>&; // TODO: These methods in Table that return Deque<T>& are dangerous in which the user can change its length, and this will not be reflected in mrows. Replace this by std::span when migrating to C++20.
+    auto floats() -> Span<double>;
 
-    /// Convert this TableColumn object to a constant reference to its underlying `Deque<long>` object.
+    /// Return a view to the contiguous integer values in the column.
     /// @warning If the column data type is not DataType::Integer, a runtime error is thrown.
-    auto integers() const -> Deque<long> const&;
+    auto integers() const -> Span<long const>;
 
-    /// Convert this TableColumn object to a mutable reference to its underlying `Deque<long>` object.
+    /// Return a view to the contiguous integer values in the column, which can be changed but not resized.
     /// @warning If the column data type is not DataType::Integer, a runtime error is thrown.
-    auto integers() -> Deque<long>&;
+    auto integers() -> Span<long>;
 
-    /// Convert this TableColumn object to a constant reference to its underlying `Deque<String>` object.
+    /// Return a view to the contiguous string values in the column.
     /// @warning If the column data type is not DataType::String, a runtime error is thrown.
-    auto strings() const -> Deque<String> const&;
+    auto strings() const -> Span<String const>;
 
-    /// Convert this TableColumn object to a mutable reference to its underlying `Deque<String>` object.
+    /// Return a view to the contiguous string values in the column, which can be changed but not resized.
     /// @warning If the column data type is not DataType::String, a runtime error is thrown.
-    auto strings() -> Deque<String>&;
+    auto strings() -> Span<String>;
 
-    /// Convert this TableColumn object to a constant reference to its underlying `Deque<bool>` object.
+    /// Return a view to the contiguous boolean values in the column.
     /// @warning If the column data type is not DataType::Bool, a runtime error is thrown.
-    auto booleans() const -> Deque<bool> const&;
+    auto booleans() const -> Span<bool const>;
 
-    /// Convert this TableColumn object to a mutable reference to its underlying `Deque<bool>` object.
+    /// Return a view to the contiguous boolean values in the column, which can be changed but not resized.
     /// @warning If the column data type is not DataType::Bool, a runtime error is thrown.
-    auto booleans() -> Deque<bool>&;
+    auto booleans() -> Span<bool>;
+
+    /// Get the number of values that can be stored in the column before its values are moved to a larger block.
+    auto capacity() const -> Index;
+
+    /// Get the block of contiguous values in the column.
+    /// @tparam T The type of the values in the column (i.e., `double`, `long`, `String`, or `bool`).
+    /// @warning If the column data type does not correspond to type `T`, a runtime error is thrown.
+    template<typename T>
+    auto block() const -> TableColumnBlock<T> const&
+    {
+        static const TableColumnBlock<T> noblock;
+        if(datatype == DataType::Undefined)
+            return noblock;
+        errorif(!data.has_value() || data.type() != typeid(TableColumnBlock<T>), "You cannot get the values of a table column with a value type different from the one in the column.");
+        return std::any_cast<TableColumnBlock<T> const&>(data);
+    }
 
     /// Get the number of rows in the column.
     auto rows() const -> Index;
 
+    /// Remove the first rows in the column (e.g., after they have been written to a file).
+    /// @param count The number of rows to be removed.
+    auto removeFront(Index count) -> void;
+
     /// Get the value stored in the column at the given row index.
     auto operator[](Index row) const -> std::variant<double, long, String, bool>;
 
@@ -140,16 +204,24 @@ public:
         return *this;
     }
 
-    /// Cast this TableColumn object to a mutable reference to a list of values with type compatible with given one.
+    /// Cast this TableColumn object to a view to its contiguous values, with type compatible with given one.
     template<typename T>
-    auto cast() -> Deque<T>&
+    auto cast() -> decltype(auto)
     {
-        return const_cast<Deque<T>&>(std::as_const(*this).cast<T>());
+        if constexpr(isSame<T, bool>)
+            return booleans();
+        else if constexpr(isFloatingPoint<T>)
+            return floats();
+        else if constexpr(isInteger<T>) // keep integer check after booleans, as isInteger<bool> is true!
+            return integers();
+        else if constexpr(isSame<T, String> || isSame<T, Chars>)
+            return strings();
+        else errorif(true, "You cannot cast this table column to a list of values with an unsupported type.");
     }
 
-    /// Cast this TableColumn object to a constant reference to a list of values with type compatible with given one.
+    /// Cast this TableColumn object to a constant view to its contiguous values, with type compatible with given one.
     template<typename T>
-    auto cast() const -> Deque<T> const&
+    auto cast() const -> decltype(auto)
     {
         if constexpr(isSame<T, bool>)
             return booleans();
@@ -163,7 +235,7 @@ public:
     }
 
 private:
-    /// The values stored in this table column (e.g., `Deque<double>`, `Deque<long>`, `Deque<String>`, `Deque<bool>`).
+    /// The block of values stored in this table column (e.g., `TableColumnBlock<double>`, `TableColumnBlock<String>`).
     Any data;
 
     /// The number of rows in the column.
@@ -174,12 +246,33 @@ private:
 };
 
 /// Used to store computed data in columns.
+/// A Table object can also stream its rows to a file as they are appended
+/// (see @ref stream). In this mode, every time a row is completed with
+/// @ref endRow and the table has accumulated a given number of complete
+/// rows, these rows are appended to the file and removed from the table.
+/// This permits long simulations to record many rows while keeping a
+/// bounded amount of them in memory.
 class Table
 {
 public:
     /// Construct a default Table object.
     Table();
 
+    /// Construct a copy of a Table object (only its columns are copied; the copy does not stream rows to a file).
+    Table(Table const& other);
+
+    /// Construct a Table object by moving another.
+    Table(Table&& other);
+
+    /// Destroy this Table object after writing its remaining rows to the file it may be streaming to.
+    ~Table();
+
+    /// Assign a copy of a Table object to this one (only its columns are copied; this does not change the file this table may be streaming to).
+    auto operator=(Table const& other) -> Table&;
+
+    /// Assign a Table object to this one by moving it.
+    auto operator=(Table&& other) -> Table&;
+
     /// Get the columns in the Table object.
     auto columns() const -> Dict<String, TableColumn> const&;
 
@@ -189,13 +282,14 @@ public:
     /// Get a mutable reference to a column in the table with given name.
     auto column(String const& columnname) -> TableColumn&;
 
-    /// Get a constant reference to a column in the table with given name.
-    auto operator[](String const& columnname) const -> Deque<double> const&;
+    /// Get a view to the contiguous values of a column of floating-point values in the table with given name.
+    auto operator[](String const& columnname) const -> Span<double const>;
 
-    /// Get a mutable reference to a column in the table with given name.
-    auto operator[](String const& columnname) -> Deque<double>&;
+    /// Get a mutable view to the contiguous values of a column of floating-point values in the table with given name.
+    auto operator[](String const& columnname) -> Span<double>;
 
     /// Get the number of rows in the table (i.e., the length of the longest column in the table).
+    /// If the table is streaming its rows to a file, this is the number of rows not yet written to the file.
     auto rows() const -> Index;
 
     /// Get the number of columns in the table.
@@ -230,9 +324,40 @@ public:
     /// @warning Ensure that the path given exists; no directories are created in this method call.
     auto save(String const& filepath, OutputOptions const& outputopts = {}) const -> void;
 
+    /// Start streaming the rows of the table to a file.
+    /// The rows are written as they are completed with @ref endRow (or with
+    /// @ref flush and @ref close). The header of the file, with the names of the columns, is written with
+    /// the first rows. Because column values are not padded for alignment (as
+    /// done in @ref save), consider using a delimiter such as `","`. No columns
+    /// can be added to the table after its header has been written.
+    /// @param filepath The path to the file that will be created, including its file name.
+    /// @param outputopts The formatting options for the output operation.
+    /// @param buffersize The number of complete rows kept in the table before they are written to the file.
+    auto stream(String const& filepath, OutputOptions const& outputopts = {}, Index buffersize = 65536) -> void;
+
+    /// Indicate that the values of a new row have been appended to the columns of the table.
+    /// If the table is streaming its rows to a file, the complete rows in the
+    /// table are written to the file once they reach the buffer size
+    /// specified in @ref stream. Otherwise, this method does nothing.
+    auto endRow() -> void;
+
+    /// Write the complete rows in the table (i.e., rows with values in all columns) to the file it is streaming to, and remove them from the table.
+    auto flush() -> void;
+
+    /// Write all remaining rows in the table to the file it is streaming to, remove them from the table, and close the file.
+    auto close() -> void;
+
+    /// Get the number of rows already written to the file the table is streaming to.
+    auto streamed() const -> Index;
+
 private:
     /// The named columns and their stored values in the table.
     Dict<String, TableColumn> mcolumns;
+
+    struct Stream;
+
+    /// The state of the file the table is streaming to (if any).
+    Ptr<Stream> mstream;
 };
 
 } // namespace Reaktoro
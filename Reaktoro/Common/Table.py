@@ -17,6 +17,7 @@
 
 
 from reaktoro import *
+import numpy as np
 import os
 import pytest
 
@@ -239,3 +240,68 @@ def testTable():
             "50.0000 |        5 |         |         \n"
             "60.0000 |          |         |         \n"
             "70.0000 |          |         |         ")
+
+
+def testTableNumPyArraysAndStreaming(tmp_path):
+
+    # =======================================================================================================
+    # Testing zero-copy conversion of Table columns into NumPy arrays
+    # =======================================================================================================
+    table = Table()
+
+    for i in range(1000):
+        table.column("Floats") << 0.5 * i
+        table.column("Integers") << i
+        table.column("Booleans") << (i % 2 == 0)
+
+    floats = table["Floats"]
+
+    assert floats.shape == (1000,)
+    assert floats[10] == 5.0
+
+    floats[0] = 10.0  # the NumPy array shares memory with the column
+    assert table["Floats"][0] == 10.0
+
+    assert table.column("Integers").array()[999] == 999
+    assert table.column("Booleans").array()[1] == False
+
+    table.column("Strings") << "Hello"
+    with pytest.raises(Exception): table.column("Strings").array()
+
+    table.column("Floats").appendFloats(np.linspace(1.0, 2.0, 5))
+    assert table.column("Floats").rows() == 1005
+    assert table["Floats"][-1] == 2.0
+
+    del table
+    assert floats[0] == 10.0  # the NumPy array keeps the values alive
+
+    # =======================================================================================================
+    # Testing streaming of Table rows to a file
+    # =======================================================================================================
+    path = str(tmp_path / "table.txt")
+
+    opts = Table.OutputOptions()
+    opts.delimiter = ","
+
+    table = Table()
+    table.stream(path, opts, 10)
+
+    for i in range(25):
+        table.column("Step") << i
+        table.column("Time") << 2.0 * i
+        table.endRow()
+
+    assert table.streamed() == 20
+    assert table.rows() == 5
+
+    table.close()
+
+    assert table.streamed() == 25
+    assert table.rows() == 0
+
+    with open(path) as file:
+        lines = file.read().splitlines()
+
+    assert len(lines) == 26
+    assert lines[0] == "Step,Time"
+    assert lines[25] == "24,48.0000"
@@ -28,6 +28,31 @@ auto __lshift__(TableColumn& self, T const& value) -> TableColumn&
     return self << value;
 }
 
+/// Return the values in a table column of numbers as a NumPy array that shares memory with the column (i.e., no copy).
+template<typename T>
+auto toNumPyArray(TableColumn const& self) -> py::array
+{
+    const auto values = self.cast<T>();
+    if(values.empty())
+        return py::array_t<T>(py::ssize_t(0));
+    auto owner = new SharedPtr<T[]>(self.block<T>().values); // the NumPy array shares ownership of the values, so that it remains valid even if the column is changed or destroyed
+    py::capsule base(owner, [](void* ptr) { delete reinterpret_cast<SharedPtr<T[]>*>(ptr); });
+    return py::array_t<T>(py::ssize_t(values.size()), values.data(), base);
+}
+
+/// Return the values in a table column as a NumPy array that shares memory with the column, if the column stores numbers.
+auto toNumPyArray(TableColumn const& self) -> py::array
+{
+    switch(self.dataType())
+    {
+        case TableColumn::DataType::Float:   return toNumPyArray<double>(self);
+        case TableColumn::DataType::Integer: return toNumPyArray<long>(self);
+        case TableColumn::DataType::Boolean: return toNumPyArray<bool>(self);
+        default: errorif(true, "You cannot convert a table column of strings or without values into a NumPy array. Use method TableColumn.strings instead.");
+    }
+    return py::array();
+}
+
 void exportTable(py::module& m)
 {
     // Create a module object for TableColumn
@@ -50,14 +75,15 @@ void exportTable(py::module& m)
         .def("appendString", &TableColumn::appendString, "Append a new string value to the TableColumn object.")
         .def("appendBoolean", &TableColumn::appendBoolean, "Append a new boolean value to the TableColumn object.")
         .def("dataType", &TableColumn::dataType, "Get the data type of the column.")
-        .def("floats", py::overload_cast<>(&TableColumn::floats, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Deque<double>` object.")
-        .def("floats", py::overload_cast<>(&TableColumn::floats), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Deque<double>` object.")
-        .def("integers", py::overload_cast<>(&TableColumn::integers, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Deque<long>` object.")
-        .def("integers", py::overload_cast<>(&TableColumn::integers), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Deque<long>` object.")
-        .def("strings", py::overload_cast<>(&TableColumn::strings, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Deque<String>` object.")
-        .def("strings", py::overload_cast<>(&TableColumn::strings), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Deque<String>` object.")
-        .def("booleans", py::overload_cast<>(&TableColumn::booleans, py::const_), return_internal_ref, "Convert this TableColumn object to a constant reference to its underlying `Deque<bool>` object.")
-        .def("booleans", py::overload_cast<>(&TableColumn::booleans), return_internal_ref, "Convert this TableColumn object to a mutable reference to its underlying `Deque<bool>` object.")
+        .def("appendFloats", [](TableColumn& self, py::array_t<double, py::array::c_style | py::array::forcecast> const& values) { self.appendFloats(Span<double const>(values.data(), values.size())); }, "Append many floating-point values to the TableColumn object at once.")
+        .def("appendIntegers", [](TableColumn& self, py::array_t<long, py::array::c_style | py::array::forcecast> const& values) { self.appendIntegers(Span<long const>(values.data(), values.size())); }, "Append many integer values to the TableColumn object at once.")
+        .def("floats", [](TableColumn const& self) { auto values = self.floats(); return Vec<double>(values.begin(), values.end()); }, "Return a copy of the floating-point values in the column as a list.")
+        .def("integers", [](TableColumn const& self) { auto values = self.integers(); return Vec<long>(values.begin(), values.end()); }, "Return a copy of the integer values in the column as a list.")
+        .def("strings", [](TableColumn const& self) { auto values = self.strings(); return Vec<String>(values.begin(), values.end()); }, "Return a copy of the string values in the column as a list.")
+        .def("booleans", [](TableColumn const& self) { auto values = self.booleans(); return Vec<bool>(values.begin(), values.end()); }, "Return a copy of the boolean values in the column as a list.")
+        .def("array", [](TableColumn const& self) { return toNumPyArray(self); }, "Return the values in the column as a NumPy array that shares memory with the column (for columns of floating-point, integer, and boolean values).")
+        .def("capacity", &TableColumn::capacity, "Get the number of values that can be stored in the column before its values are moved to a larger block.")
+        .def("removeFront", &TableColumn::removeFront, "Remove the first rows in the column (e.g., after they have been written to a file).")
         .def("rows", &TableColumn::rows, "Get the number of rows in the column.")
         .def("__getitem__", [](TableColumn const& self, int irow) { return self[irow]; } )
         .def("append", [](TableColumn& self, bool value) { self.append(value); }, "Append a new value to the TableColumn object.")
@@ -87,11 +113,16 @@ void exportTable(py::module& m)
         .def(py::init<>())
         .def("columns", &Table::columns, "Get the columns in the Table object.")
         .def("column", py::overload_cast<String const&>(&Table::column), return_internal_ref, "Get a mutable reference to a column in the table with given name.")
-        .def("__getitem__", [](Table& self, String const& colname) { return self[colname]; }, return_internal_ref, "Get a mutable reference to a column in the table with given name.")
+        .def("__getitem__", [](Table const& self, String const& colname) { self[colname]; return toNumPyArray<double>(self.column(colname)); }, "Get the values of a column of floating-point values in the table with given name as a NumPy array that shares memory with the column.")
         .def("rows", &Table::rows, "Get the number of rows in the table (i.e., the length of the longest column in the table).")
         .def("cols", &Table::cols, "Get the number of columns in the table.")
         .def("dump", &Table::dump, "Assemble a string representation of the Table object.", "outputopts"_a = Table::OutputOptions())
         .def("save", &Table::save, "Save the Table object to a file.", "filepath"_a, "outputopts"_a = Table::OutputOptions())
+        .def("stream", &Table::stream, "Start streaming the rows of the table to a file.", "filepath"_a, "outputopts"_a = Table::OutputOptions(), "buffersize"_a = 65536)
+        .def("endRow", &Table::endRow, "Indicate that the values of a new row have been appended to the columns of the table, writing the complete rows to the file the table is streaming to once they reach the buffer size.")
+        .def("flush", &Table::flush, "Write the complete rows in the table to the file it is streaming to, and remove them from the table.")
+        .def("close", &Table::close, "Write all remaining rows in the table to the file it is streaming to, remove them from the table, and close the file.")
+        .def("streamed", &Table::streamed, "Get the number of rows already written to the file the table is streaming to.")
         .def("__str__", [](Table const& self) { return self.dump(); })
         ;
 }
@@ -18,6 +18,11 @@
 // Catch includes
 #include <catch2/catch.hpp>
 
+// C++ includes
+#include <cstdio>
+#include <fstream>
+#include <utility>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Common/Table.hpp>
@@ -233,4 +238,149 @@ TEST_CASE("Testing class Table", "[Table]")
             "70.0000 |          |         |         ");
 #endif
     }
+
+    SECTION("Testing contiguous storage of values in TableColumn")
+    {
+        Table table;
+
+        const auto numrows = 5000;
+
+        for(auto i = 0; i < numrows; ++i)
+        {
+            table.column("Floats") << 0.5 * i;
+            table.column("Integers") << i;
+        }
+
+        auto const& block = std::as_const(table).column("Floats").block<double>();
+
+        CHECK( block.size == numrows );
+        CHECK( block.capacity == table.column("Floats").capacity() );
+        CHECK( table.column("Floats").capacity() >= numrows );
+
+        CHECK( table.column("Floats")[4321] == std::variant<double, long, String, bool>(0.5 * 4321) );
+
+        auto floats = table["Floats"];
+        CHECK( floats.size() == numrows );
+        for(auto i = 0; i < numrows; ++i)
+            CHECK( floats[i] == 0.5 * i );
+
+        const auto capacity = table.column("Floats").capacity();
+
+        table.column("Floats") << 1.0;
+        CHECK( table["Floats"].data() == floats.data() ); // the block has spare capacity for new values
+
+        floats[0] = 10.0; // values can be changed via a mutable view
+        CHECK( table["Floats"][0] == 10.0 );
+
+        while(table.column("Floats").rows() <= capacity)
+            table.column("Floats") << 2.0;
+
+        CHECK( table.column("Floats").capacity() > capacity ); // the values have been moved to a larger block
+        CHECK( table["Floats"].data() != floats.data() );
+        CHECK( floats[0] == 10.0 ); // but the old view remains valid
+        CHECK( table["Floats"][0] == 10.0 );
+
+        CHECK_THROWS( table.column("Floats").block<long>() );
+
+        Vec<long> integers = { 7, 8, 9 };
+        table.column("Integers").appendIntegers(Span<long const>(integers.data(), integers.size()));
+        CHECK( table.column("Integers").rows() == numrows + 3 );
+        CHECK( table.column("Integers").integers().back() == 9 );
+        CHECK_THROWS( table.column("Floats").appendIntegers(Span<long const>(integers.data(), integers.size())) );
+
+        Table copy = table; // values are copied, not shared
+        copy["Floats"][1] = 20.0;
+        CHECK( table["Floats"][1] == 0.5 );
+
+        table.column("Integers").removeFront(numrows);
+        CHECK( table.column("Integers").rows() == 3 );
+        CHECK( table.column("Integers").integers() == Vec<long>{ 7, 8, 9 } );
+        CHECK_THROWS( table.column("Integers").removeFront(4) );
+    }
+
+    SECTION("Testing streaming of rows of Table to a file")
+    {
+        const auto path = "temporary.txt";
+
+        Table::OutputOptions opts;
+        opts.delimiter = ",";
+        opts.precision = 3;
+
+        Table table;
+        table.stream(path, opts, 4);
+
+        for(auto i = 0; i < 10; ++i)
+        {
+            table.column("Time") << 1.0 * i;
+            table.column("Step") << i;
+            table.column("Name, Label") << "Row" + std::to_string(i);
+            table.endRow();
+            CHECK( table.streamed() == (i + 1) / 4 * 4 ); // rows are written when a row is completed and there are at least 4 complete rows
+        }
+
+        CHECK( table.streamed() == 8 );
+        CHECK( table.rows() == 2 );
+        CHECK( table["Time"] == Vec<double>{ 8.0, 9.0 } );
+
+        CHECK_THROWS( table.column("Extra") ); // no new columns after the header has been written
+
+        table.column("Time") << 10.0; // an incomplete row
+        table.flush();
+        CHECK( table.streamed() == 10 );
+        CHECK( table.rows() == 1 );
+
+        table.close();
+        CHECK( table.streamed() == 11 );
+        CHECK( table.rows() == 0 );
+
+        std::ifstream file(path);
+        Strings lines;
+        for(String line; std::getline(file, line);)
+            lines.push_back(line);
+
+        REQUIRE( lines.size() == 12 );
+        CHECK( lines[0] == "Time,Step,\"Name, Label\"" );
+        CHECK( lines[1] == "0.00,0,Row0" );
+        CHECK( lines[10] == "9.00,9,Row9" );
+        CHECK( lines[11] == "10.0,," );
+
+        std::remove(path);
+    }
+}
+
+TEST_CASE("Benchmarking class Table", "[.benchmark]")
+{
+    const auto numrows = 1000000;
+
+    BENCHMARK("Appending values to Deque<double> objects and summing them")
+    {
+        Deque<double> time, temperature;
+        for(auto i = 0; i < numrows; ++i)
+        {
+            time.push_back(1.0 * i);
+            temperature.push_back(300.0 + 1e-6 * i);
+        }
+        auto sum = 0.0;
+        for(auto i = 0; i < numrows; ++i)
+            sum += time[i] * temperature[i];
+        return sum;
+    };
+
+    BENCHMARK("Appending values to Table columns and summing them")
+    {
+        Table table;
+        auto& timecol = table.column("Time");
+        auto& temperaturecol = table.column("Temperature");
+        for(auto i = 0; i < numrows; ++i)
+        {
+            timecol << 1.0 * i;
+            temperaturecol << 300.0 + 1e-6 * i;
+        }
+        auto const& time = table["Time"];
+        auto const& temperature = table["Temperature"];
+        auto sum = 0.0;
+        for(auto i = 0; i < numrows; ++i)
+            sum += time[i] * temperature[i];
+        return sum;
+    };
 }
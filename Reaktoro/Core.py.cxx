@@ -22,9 +22,11 @@ void exportActivityModel(py::module& m);
 void exportActivityProps(py::module& m);
 void exportAggregateState(py::module& m);
 void exportChemicalFormula(py::module& m);
+void exportChemicalOutput(py::module& m);
 void exportChemicalProps(py::module& m);
 void exportChemicalPropsPhase(py::module& m);
 void exportChemicalState(py::module& m);
+void exportChemicalStateCheckpoint(py::module& m);
 void exportChemicalSystem(py::module& m);
 void exportData(py::module& m);
 void exportDatabase(py::module& m);
@@ -37,6 +39,7 @@ void exportPhase(py::module& m);
 void exportPhaseList(py::module& m);
 void exportPhases(py::module& m);
 void exportParams(py::module& m);
+void exportProp(py::module& m);
 void exportReaction(py::module& m);
 void exportReactions(py::module& m);
 void exportReactionEquation(py::module& m);
@@ -104,6 +107,9 @@ void exportCore(py::module& m)
     exportCoreUtils(m);
     exportChemicalSystem(m);
     exportChemicalState(m);
+    exportProp(m);
+    exportChemicalOutput(m);
+    exportChemicalStateCheckpoint(m);
     exportChemicalPropsPhase(m);
     exportChemicalProps(m);
 }
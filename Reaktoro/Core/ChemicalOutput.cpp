@@ -1,325 +1,443 @@
-// // Reaktoro is a unified framework for modeling chemically reactive systems.
-// //
-// // Copyright © 2014-2024 Allan Leal
-// //
-// // This library is free software; you can redistribute it and/or
-// // modify it under the terms of the GNU Lesser General Public
-// // License as published by the Free Software Foundation; either
-// // version 2.1 of the License, or (at your option) any later version.
-// //
-// // This library is distributed in the hope that it will be useful,
-// // but WITHOUT ANY WARRANTY; without even the implied warranty of
-// // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
-// // Lesser General Public License for more details.
-// //
-// // You should have received a copy of the GNU Lesser General Public License
-// // along with this library. If not, see <http://www.gnu.org/licenses/>.
-
-// #include "ChemicalOutput.hpp"
-
-// // C++ includes
-// #include <fstream>
-// #include <iomanip>
-// #include <iostream>
-// #include <cmath>
-
-// // Reaktoro includes
-// #include <Reaktoro/Common/Exception.hpp>
-// #include <Reaktoro/Common/StringList.hpp>
-// #include <Reaktoro/Common/StringUtils.hpp>
-// #include <Reaktoro/Common/Units.hpp>
-// #include <Reaktoro/Core/ChemicalQuantity.hpp>
-// #include <Reaktoro/Core/ChemicalState.hpp>
-// #include <Reaktoro/Core/ChemicalSystem.hpp>
-// #include <Reaktoro/Core/ReactionSystem.hpp>
-
-// namespace Reaktoro {
-
-// struct ChemicalOutput::Impl
-// {
-//     /// The chemical system instance
-//     ChemicalSystem system;
-
-//     /// The reaction system instance
-//     ReactionSystem reactions;
-
-//     /// The chemical quantity instance
-//     ChemicalQuantity quantity;
-
-//     /// The flag that indicates if output should be done at the terminal.
-//     bool terminal = false;
-
-//     /// The name of the output file.
-//     std::string filename;
-
-//     /// The base name of the output file.
-//     std::string basename;
-
-//     /// The extension name of the output file.
-//     std::string extension;
-
-//     /// The suffix word of the output file name.
-//     std::string suffix;
-
-//     /// The names of the quantities to be output.
-//     std::vector<std::string> data;
-
-//     /// The names of the quantities to appear as column header in the output.
-//     std::vector<std::string> headings;
-
-//     /// The floating-point precision in the output.
-//     int precision = 6;
-
-//     /// The flag that indicates if scientific format should be used.
-//     bool scientific = false;
-
-//     /// The output stream of the data file.
-//     std::ofstream datafile;
-
-//     /// The iteration number for every update call
-//     Index iteration = 0;
-
-//     /// The extra attachments to the output file.
-//     std::vector<std::string> attachments;
-
-//     /// The index of the active column
-//     Index icolumn = 0;
-
-//     /// The spacings between the columns
-//     std::vector<int> spacings;
-
-//     Impl()
-//     : quantity(system)
-//     {}
-
-//     Impl(const ChemicalSystem& system)
-//     : system(system), quantity(system)
-//     {}
-
-//     Impl(const ReactionSystem& reactions)
-//     : system(reactions.system()), reactions(reactions), quantity(reactions)
-//     {}
-
-//     ~Impl()
-//     {
-//         close();
-//     }
-
-//     auto spacing(std::string word) const -> std::size_t
-//     {
-//         return word.size() + std::max(5, 25 - static_cast<int>(word.size()));
-//     }
-
-//     auto open() -> void
-//     {
-//         // Ensure the output file is closed
-//         close();
-
-//         // Ensure output is done either to a file and/or terminal
-//         Assert(!filename.empty() || terminal,
-//             "Cannot open the ChemicalOutput instance for output.",
-//             "The instance has not been configured to output to the terminal or file.");
-
-//         // Make sure header is not empty
-//         if(headings.empty())
-//             headings = data;
-
-//         // Open the data file
-//         if(!filename.empty())
-//             datafile.open(filename, std::ofstream::out | std::ofstream::trunc);
-
-//         // Check if scientific format should be used
-//         if(scientific)
-//             datafile << std::scientific;
-
-//         // Set the floating-point precision in the output.
-//         datafile << std::setprecision(precision);
-
-//         // Determine the spacings between the columns
-//         spacings.clear();
-//         for(auto word : headings)
-//             spacings.push_back(spacing(word));
-
-//         // Output the header of the data file
-//         icolumn = 0;
-//         for(auto word : headings)
-//         {
-//             auto space = spacings[icolumn];
-//             if(datafile.is_open()) datafile << std::left << std::setw(space) << word;
-//             if(terminal)
-//             {
-//                 std::ios::fmtflags flags(std::cout.flags());
-//                 if(scientific) std::cout << std::scientific;
-//                 std::cout << std::setprecision(precision);
-//                 std::cout << std::left << std::setw(space) << word;
-//                 std::cout.flags(flags);
-//             }
-//             ++icolumn;
-//         }
-//     }
-
-//     auto close() -> void
-//     {
-//         datafile.close();
-//     }
-
-//     auto update(const ChemicalState& state, double t) -> void
-//     {
-//         // Output values on a new line
-//         if(datafile.is_open()) datafile << std::endl;
-//         if(terminal) std::cout << std::endl;
-
-//         // Output the current chemical state to the data file.
-//         quantity.update(state, t);
-
-//         // For each quantity, ouput its value on each column
-//         icolumn = 0;
-//         for(auto word : data)
-//         {
-//             auto space = spacings[icolumn];
-//             auto val = (word == "i") ? iteration : quantity.value(word);
-//             if(datafile.is_open()) datafile << std::left << std::setw(space) << val;
-//             if(terminal) std::cout << std::left << std::setw(space) << val;
-//             ++icolumn;
-//         }
-
-//         // Update the iteration number
-//         ++iteration;
-//     }
-
-//     template<typename ValueType>
-//     auto attach(ValueType value) -> void
-//     {
-//         auto space = spacings[icolumn];
-//         if(datafile.is_open()) datafile << std::left << std::setw(space) << value;
-//         if(terminal) std::cout << std::left << std::setw(space) << value;
-//         ++icolumn;
-//     }
-// };
-
-// ChemicalOutput::ChemicalOutput()
-// : pimpl(new Impl())
-// {}
-
-// ChemicalOutput::ChemicalOutput(const ChemicalSystem& system)
-// : pimpl(new Impl(system))
-// {}
-
-// ChemicalOutput::ChemicalOutput(const ReactionSystem& reactions)
-// : pimpl(new Impl(reactions))
-// {}
-
-// ChemicalOutput::~ChemicalOutput()
-// {}
-
-// auto ChemicalOutput::filename(std::string filename) -> void
-// {
-//     pimpl->filename = filename;
-//     pimpl->basename = filename.substr(0, filename.rfind('.'));
-//     pimpl->extension = filename.substr(filename.rfind('.'));
-// }
-
-// auto ChemicalOutput::filename() const -> std::string
-// {
-//     return pimpl->filename;
-// }
-
-// auto ChemicalOutput::suffix(std::string word) -> void
-// {
-//     pimpl->suffix = word;
-//     pimpl->filename = pimpl->basename + pimpl->suffix + pimpl->extension;
-// }
-
-// auto ChemicalOutput::suffix() const -> std::string
-// {
-//     return pimpl->suffix;
-// }
-
-// auto ChemicalOutput::basename() const -> std::string
-// {
-//     return pimpl->basename;
-// }
-
-// auto ChemicalOutput::extension() const -> std::string
-// {
-//     return pimpl->extension;
-// }
-
-// auto ChemicalOutput::add(std::string quantity) -> void
-// {
-//     add(quantity, quantity);
-// }
-
-// auto ChemicalOutput::add(std::string quantity, std::string label) -> void
-// {
-//     pimpl->headings.insert(pimpl->headings.end() - pimpl->attachments.size(), label);
-//     pimpl->data.push_back(quantity);
-// }
-
-// auto ChemicalOutput::attachments(std::vector<std::string> titles) -> void
-// {
-//     pimpl->headings.insert(pimpl->headings.end(), titles.begin(), titles.end());
-//     pimpl->attachments.insert(pimpl->attachments.end(), titles.begin(), titles.end());
-// }
-
-// auto ChemicalOutput::attach(int value) -> void
-// {
-//     pimpl->attach(value);
-// }
-
-// auto ChemicalOutput::attach(double value) -> void
-// {
-//     pimpl->attach(value);
-// }
-
-// auto ChemicalOutput::attach(std::string value) -> void
-// {
-//     pimpl->attach(value);
-// }
-
-// auto ChemicalOutput::precision(int val) -> void
-// {
-//     pimpl->precision = std::abs(val);
-// }
-
-// auto ChemicalOutput::scientific(bool enable) -> void
-// {
-//     pimpl->scientific = enable;
-// }
-
-// auto ChemicalOutput::terminal(bool enabled) -> void
-// {
-//     pimpl->terminal = enabled;
-// }
-
-// auto ChemicalOutput::quantities() const -> std::vector<std::string>
-// {
-//     return pimpl->data;
-// }
-
-// auto ChemicalOutput::headings() const -> std::vector<std::string>
-// {
-//     return pimpl->headings;
-// }
-
-// auto ChemicalOutput::open() -> void
-// {
-//     pimpl->open();
-// }
-
-// auto ChemicalOutput::update(const ChemicalState& state, double t) -> void
-// {
-//     pimpl->update(state, t);
-// }
-
-// auto ChemicalOutput::close() -> void
-// {
-//     pimpl->close();
-// }
-
-// ChemicalOutput::operator bool() const
-// {
-//     return pimpl->terminal || pimpl->filename.size();
-// }
-
-// } // namespace Reaktoro
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ChemicalOutput.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <charconv>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Table.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/Prop.hpp>
+
+namespace Reaktoro {
+namespace {
+
+// A binary output file consists of:
+//   1. the 8-byte signature `binary_signature`;
+//   2. a 32-bit integer with value 1 written in the byte order of the machine that created it;
+//   3. a 32-bit integer with the version of the format;
+//   4. a 32-bit integer with the number of columns, followed by the size and characters of the name of each column;
+//   5. the blocks of rows, each with a 64-bit integer with the number of rows in the block, followed by the values of each column in these rows.
+// All values are stored as double, including those in the `cell` column.
+
+/// The signature at the beginning of every binary output file.
+const char binary_signature[8] = { 'R', 'K', 'T', 'O', 'U', 'T', 'P', 'T' };
+
+/// The version of the format of the binary output files.
+const std::uint32_t binary_version = 1;
+
+/// The number of columns output for every row before the registered quantities (i.e., `t` and `cell`).
+const Index numfixedcolumns = 2;
+
+/// Used to store the values of the rows output so far in column-major order.
+struct Buffer
+{
+    /// The number of rows in the buffer.
+    Index rows = 0;
+
+    /// The values of the columns, each column with room for a fixed number of rows.
+    Vec<double> values;
+};
+
+/// Append the bytes of a value of trivial type to a file.
+template<typename T>
+auto write(std::ostream& file, T const& value) -> void
+{
+    file.write(reinterpret_cast<Chars>(&value), sizeof(T));
+}
+
+/// Read a value of trivial type from a file.
+template<typename T>
+auto read(std::istream& file, String const& path) -> T
+{
+    T value;
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    errorif(!file, "Could not read the output file `", path, "` because it ended unexpectedly. Ensure it has not been truncated.");
+    return value;
+}
+
+/// Read a size (e.g., a number of names) from a binary output file of given size, ensuring it does not exceed the number of its entries that fit in the bytes left.
+template<typename T>
+auto readSize(std::istream& file, String const& path, std::uint64_t filesize, std::uint64_t entrybytes) -> T
+{
+    const auto size = read<T>(file, path);
+    const auto remaining = filesize - static_cast<std::uint64_t>(file.tellg());
+    errorif(remaining / entrybytes < size, "Could not read the output file `", path, "` because it ended unexpectedly. Ensure it has not been truncated.");
+    return size;
+}
+
+/// Write a floating-point value with given number of significant digits into a character buffer and return the number of characters written.
+auto formatFloat(char* chars, Index size, double value, int precision) -> Index
+{
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    return std::to_chars(chars, chars + size, value, std::chars_format::general, precision).ptr - chars;
+#else
+    return std::snprintf(chars, size, "%.*g", precision, value); // floating-point std::to_chars is not available in older standard libraries
+#endif
+}
+
+} // namespace
+
+struct ChemicalOutput::Impl
+{
+    /// The path to the output file.
+    String path;
+
+    /// The options for the output.
+    ChemicalOutputOptions options;
+
+    /// The names of the columns in the output file.
+    Strings names = { "t", "cell" };
+
+    /// The functions that evaluate the registered quantities.
+    Vec<ChemicalOutputFn> fns;
+
+    /// The output file.
+    std::ofstream file;
+
+    /// The buffer being filled with new rows.
+    Buffer current;
+
+    /// The filled buffers waiting to be written by the writer thread.
+    std::deque<Buffer> queue;
+
+    /// The buffers already written, kept for reuse.
+    Vec<Buffer> pool;
+
+    /// The flag that indicates whether the writer thread is writing a buffer.
+    bool writing = false;
+
+    /// The flag that indicates whether the writer thread should stop after writing the queued buffers.
+    bool stopping = false;
+
+    /// The exception thrown in the writer thread, to be rethrown in the thread producing the rows.
+    std::exception_ptr error;
+
+    /// The mutex used to protect the queue of buffers shared with the writer thread.
+    std::mutex mutex;
+
+    /// The condition variable used to wake up the writer thread when a buffer is queued.
+    std::condition_variable queued;
+
+    /// The condition variable used to wake up the producing thread when a buffer has been written.
+    std::condition_variable written;
+
+    /// The writer thread, started with the first row output.
+    std::thread writer;
+
+    /// Construct a ChemicalOutput::Impl object.
+    Impl(String const& path, ChemicalOutputOptions const& options)
+    : path(path), options(options)
+    {
+        errorif(options.buffersize == 0, "Could not create the output file `", path, "` because the buffer size in ChemicalOutputOptions is zero.");
+        errorif(options.maxbuffers == 0, "Could not create the output file `", path, "` because the maximum number of buffers in ChemicalOutputOptions is zero.");
+        const auto mode = options.format == ChemicalOutputFormat::Binary ? std::ios::binary | std::ios::trunc : std::ios::trunc;
+        file.open(path, mode);
+        errorif(!file, "Could not create the output file `", path, "`. Ensure the directory exists and is writable.");
+    }
+
+    /// Register a quantity to be output.
+    auto add(String const& name, ChemicalOutputFn const& fn) -> void
+    {
+        errorif(writer.joinable() || !file.is_open(), "Could not add quantity `", name, "` to the output file `", path, "` because rows have already been output.");
+        names.push_back(name);
+        fns.push_back(fn);
+    }
+
+    /// Write the header of the output file and start the writer thread.
+    auto start() -> void
+    {
+        errorif(!file.is_open(), "Could not output rows to the output file `", path, "` because it has been closed.");
+
+        if(options.format == ChemicalOutputFormat::Binary)
+        {
+            file.write(binary_signature, sizeof(binary_signature));
+            write(file, std::uint32_t(1));
+            write(file, binary_version);
+            write(file, std::uint32_t(names.size()));
+            for(auto const& name : names)
+            {
+                write(file, std::uint32_t(name.size()));
+                file.write(name.data(), name.size());
+            }
+        }
+        else
+        {
+            for(auto i = 0; i < names.size(); ++i)
+                file << (i ? options.delimiter : "") << names[i];
+            file << '\n';
+        }
+
+        current = createBuffer();
+        writer = std::thread([this] { run(); });
+    }
+
+    /// Return an empty buffer, reusing a previously written one if possible.
+    auto createBuffer() -> Buffer
+    {
+        if(pool.empty())
+            return Buffer{ 0, Vec<double>(options.buffersize * names.size()) };
+        Buffer buffer = std::move(pool.back());
+        pool.pop_back();
+        buffer.rows = 0;
+        return buffer;
+    }
+
+    /// Output the registered quantities of a chemical state in a new row.
+    auto update(ChemicalState const& state, double t, Index icell) -> void
+    {
+        if(!writer.joinable())
+            start();
+
+        const auto row = current.rows;
+        const auto size = options.buffersize;
+        auto values = current.values.data() + row;
+
+        values[0] = t;
+        values[size] = icell;
+        for(auto i = 0; i < fns.size(); ++i)
+            values[(numfixedcolumns + i) * size] = double(fns[i](state));
+
+        if(++current.rows == size)
+            submit();
+    }
+
+    /// Hand over the current buffer to the writer thread, waiting if too many buffers are already waiting.
+    auto submit() -> void
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        written.wait(lock, [&] { return queue.size() < options.maxbuffers || error; });
+        if(error)
+            std::rethrow_exception(error);
+        queue.push_back(std::move(current));
+        current = createBuffer();
+        queued.notify_one();
+    }
+
+    /// Wait until all rows output so far have been written to the file.
+    auto flush() -> void
+    {
+        if(!writer.joinable())
+            return;
+        if(current.rows > 0)
+            submit();
+        std::unique_lock<std::mutex> lock(mutex);
+        written.wait(lock, [&] { return (queue.empty() && !writing) || error; });
+        if(error)
+            std::rethrow_exception(error);
+    }
+
+    /// Write all remaining rows, stop the writer thread and close the output file.
+    auto close() -> void
+    {
+        if(!file.is_open())
+            return;
+
+        if(!writer.joinable())
+            start();
+
+        auto finish = [&]
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            queued.notify_one();
+            writer.join();
+            file.close();
+        };
+
+        try { flush(); }
+        catch(...) { finish(); throw; }
+
+        finish();
+        errorif(error, "Could not write the output file `", path, "`. Ensure there is enough space in the disk.");
+        errorif(!file, "Could not write the output file `", path, "`. Ensure there is enough space in the disk.");
+    }
+
+    /// Run the writer thread, which writes the queued buffers until it is stopped.
+    auto run() -> void
+    {
+        while(true)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            queued.wait(lock, [&] { return !queue.empty() || stopping; });
+            if(queue.empty())
+                return;
+            Buffer buffer = std::move(queue.front());
+            queue.pop_front();
+            writing = true;
+            lock.unlock();
+
+            try
+            {
+                if(options.format == ChemicalOutputFormat::Binary)
+                    writeBinary(buffer);
+                else writeCsv(buffer);
+                file.flush();
+                errorif(!file, "Could not write the output file `", path, "`. Ensure there is enough space in the disk.");
+            }
+            catch(...)
+            {
+                lock.lock();
+                error = std::current_exception();
+                writing = false;
+                written.notify_all();
+                return;
+            }
+
+            lock.lock();
+            pool.push_back(std::move(buffer));
+            writing = false;
+            written.notify_all();
+        }
+    }
+
+    /// Write the rows in a buffer to a binary output file.
+    auto writeBinary(Buffer const& buffer) -> void
+    {
+        write(file, std::uint64_t(buffer.rows));
+        for(auto j = 0; j < names.size(); ++j)
+            file.write(reinterpret_cast<Chars>(buffer.values.data() + j * options.buffersize), buffer.rows * sizeof(double));
+    }
+
+    /// Write the rows in a buffer to a CSV output file.
+    auto writeCsv(Buffer const& buffer) -> void
+    {
+        String text;
+        char chars[64];
+        for(auto i = 0; i < buffer.rows; ++i)
+        {
+            for(auto j = 0; j < names.size(); ++j)
+            {
+                const auto value = buffer.values[j * options.buffersize + i];
+                if(j > 0)
+                    text += options.delimiter;
+                if(j == 1) // the `cell` column with integer values
+                    text.append(chars, std::to_chars(chars, chars + sizeof(chars), std::uint64_t(value)).ptr);
+                else text.append(chars, formatFloat(chars, sizeof(chars), value, options.precision));
+            }
+            text += '\n';
+        }
+        file.write(text.data(), text.size());
+    }
+};
+
+ChemicalOutput::ChemicalOutput(String const& path, ChemicalOutputOptions const& options)
+: pimpl(new Impl(path, options))
+{}
+
+ChemicalOutput::~ChemicalOutput()
+{
+    try { pimpl->close(); } catch(...) {} // destructors must not throw; call close explicitly to be notified of errors
+}
+
+auto ChemicalOutput::add(String const& name, ChemicalOutputFn const& fn) -> void
+{
+    pimpl->add(name, fn);
+}
+
+auto ChemicalOutput::add(String const& name, Prop const& prop) -> void
+{
+    pimpl->add(name, [prop](ChemicalState const& state) { return prop(state.props()); });
+}
+
+auto ChemicalOutput::columns() const -> Strings
+{
+    return pimpl->names;
+}
+
+auto ChemicalOutput::update(ChemicalState const& state, double t, Index icell) -> void
+{
+    pimpl->update(state, t, icell);
+}
+
+auto ChemicalOutput::update(Vec<ChemicalState> const& states, double t) -> void
+{
+    for(auto i = 0; i < states.size(); ++i)
+        pimpl->update(states[i], t, i);
+}
+
+auto ChemicalOutput::flush() -> void
+{
+    pimpl->flush();
+}
+
+auto ChemicalOutput::close() -> void
+{
+    pimpl->close();
+}
+
+auto ChemicalOutput::loadBinary(String const& path) -> Table
+{
+    std::ifstream file(path, std::ios::binary);
+    errorif(!file, "Could not open the output file `", path, "`. Ensure the file exists.");
+
+    file.seekg(0, std::ios::end);
+    const std::uint64_t filesize = file.tellg();
+    file.seekg(0, std::ios::beg);
+
+    char signature[sizeof(binary_signature)] = {};
+    file.read(signature, sizeof(signature));
+    errorif(!file || std::memcmp(signature, binary_signature, sizeof(signature)) != 0, "Could not read the output file `", path, "` because it is not a binary file created by ChemicalOutput.");
+    errorif(read<std::uint32_t>(file, path) != 1, "Could not read the output file `", path, "` because it was created on a machine with different byte order.");
+    errorif(read<std::uint32_t>(file, path) != binary_version, "Could not read the output file `", path, "` because it was created with an unsupported version of the binary format.");
+
+    // Sizes are checked against the bytes left in the file before allocating memory, since a corrupted file can contain any size
+    Strings names(readSize<std::uint32_t>(file, path, filesize, sizeof(std::uint32_t))); // each name with at least its length
+    for(auto& name : names)
+    {
+        name.resize(readSize<std::uint32_t>(file, path, filesize, 1));
+        file.read(name.data(), name.size());
+    }
+
+    Table table;
+    Vec<double> values;
+    while(file.peek() != std::ifstream::traits_type::eof())
+    {
+        const auto rows = readSize<std::uint64_t>(file, path, filesize, sizeof(double) * std::max<std::uint64_t>(names.size(), 1)); // each row with a value in every column
+        values.resize(rows);
+        for(auto j = 0; j < names.size(); ++j)
+        {
+            file.read(reinterpret_cast<char*>(values.data()), rows * sizeof(double));
+            errorif(!file, "Could not read the output file `", path, "` because it ended unexpectedly. Ensure it has not been truncated.");
+            auto& column = table.column(names[j]);
+            if(j == 1) // the `cell` column with integer values
+                for(auto const& value : values)
+                    column.appendInteger(value);
+            else column.appendFloats(Span<double const>(values.data(), values.size()));
+        }
+    }
+
+    return table;
+}
+
+} // namespace Reaktoro
@@ -1,122 +1,121 @@
-// // Reaktoro is a unified framework for modeling chemically reactive systems.
-// //
-// // Copyright © 2014-2024 Allan Leal
-// //
-// // This library is free software; you can redistribute it and/or
-// // modify it under the terms of the GNU Lesser General Public
-// // License as published by the Free Software Foundation; either
-// // version 2.1 of the License, or (at your option) any later version.
-// //
-// // This library is distributed in the hope that it will be useful,
-// // but WITHOUT ANY WARRANTY; without even the implied warranty of
-// // MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
-// // Lesser General Public License for more details.
-// //
-// // You should have received a copy of the GNU Lesser General Public License
-// // along with this library. If not, see <http://www.gnu.org/licenses/>.
-
-// #pragma once
-
-// // C++ includes
-// #include <memory>
-// #include <vector>
-// #include <sstream>
-// #include <string>
-
-// namespace Reaktoro {
-
-// // Forward declarations
-// class ChemicalState;
-// class ChemicalSystem;
-// class ReactionSystem;
-// class StringList;
-
-// /// A type used to output sequence of chemical states to a file or terminal.
-// class ChemicalOutput
-// {
-// public:
-//     /// Construct a default ChemicalOutput instance.
-//     ChemicalOutput();
-
-//     /// Construct a ChemicalOutput instance with given ChemicalSystem instance.
-//     explicit ChemicalOutput(const ChemicalSystem& system);
-
-//     /// Construct a ChemicalOutput instance with given ReactionSystem instance.
-//     explicit ChemicalOutput(const ReactionSystem& reactions);
-
-//     /// Destroy this ChemicalOutput instance.
-//     virtual ~ChemicalOutput();
-
-//     /// Set the name of the output file.
-//     auto filename(std::string filename) -> void;
-
-//     /// Return the name of the output file.
-//     auto filename() const -> std::string;
-
-//     /// Set a sufix word to the output file name.
-//     auto suffix(std::string name) -> void;
-
-//     /// Return the suffix word of the output file name.
-//     auto suffix() const -> std::string;
-
-//     /// Return the base name of output file name.
-//     auto basename() const -> std::string;
-
-//     /// Return the extension name of output file name.
-//     auto extension() const -> std::string;
-
-//     /// Add a quantity to be output.
-//     /// @param quantity The quantity name.
-//     auto add(std::string quantity) -> void;
-
-//     /// Add a quantity to be output.
-//     /// @param quantity The quantity name.
-//     /// @param label The label to be used in the headings.
-//     auto add(std::string quantity, std::string label) -> void;
-
-//     /// Set the titles of extra columns in the output file.
-//     auto attachments(std::vector<std::string> titles) -> void;
-
-//     /// Attach value to extra column data in the output file.
-//     auto attach(int value) -> void;
-
-//     /// Attach extra column data in the output file.
-//     auto attach(double value) -> void;
-
-//     /// Attach extra column data in the output file.
-//     auto attach(std::string value) -> void;
-
-//     /// Set the floating-point precision in the output.
-//     auto precision(int val) -> void;
-
-//     /// Enable or disable output in scientific format.
-//     auto scientific(bool enable) -> void;
-
-//     /// Enable or disable the output to the terminal.
-//     auto terminal(bool enabled) -> void;
-
-//     /// Return the name of the quantities in the output file.
-//     auto quantities() const -> std::vector<std::string>;
-
-//     /// Return the headings of the output file.
-//     auto headings() const -> std::vector<std::string>;
-
-//     /// Open the output file.
-//     auto open() -> void;
-
-//     /// Update the output with a new chemical state and its tag.
-//     auto update(const ChemicalState& state, double t) -> void;
-
-//     /// Close the output file.
-//     auto close() -> void;
-
-//     /// Convert this ChemicalOutput instance to bool.
-//     operator bool() const;
-
-// private:
-//     struct Impl;
-
-//     std::shared_ptr<Impl> pimpl;
-// };
-
-// } // namespace Reaktoro
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Real.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class Prop;
+class Table;
+
+/// The function type for the evaluation of a quantity of a chemical state to be output.
+using ChemicalOutputFn = Fn<real(ChemicalState const& state)>;
+
+/// The formats of the files created by ChemicalOutput.
+enum class ChemicalOutputFormat
+{
+    Csv,    ///< The format of text files with comma-separated values (or values separated by ChemicalOutputOptions::delimiter).
+    Binary, ///< The format of binary files with the values of each column stored contiguously in blocks of rows (see ChemicalOutput::loadBinary).
+};
+
+/// The options for the output of quantities of chemical states with ChemicalOutput.
+struct ChemicalOutputOptions
+{
+    /// The format of the output file.
+    ChemicalOutputFormat format = ChemicalOutputFormat::Csv;
+
+    /// The number of rows in each buffer handed over to the writer thread.
+    Index buffersize = 16384;
+
+    /// The maximum number of filled buffers waiting for the writer thread before ChemicalOutput::update blocks.
+    Index maxbuffers = 4;
+
+    /// The symbol used to separate the values on each row of a CSV file.
+    String delimiter = ",";
+
+    /// The number of significant digits of the floating-point values in a CSV file.
+    int precision = 6;
+};
+
+/// Used to output quantities of chemical states (e.g., of many cells along a simulation) to a file.
+/// The quantities to be output are registered once with ChemicalOutput::add,
+/// before the first call to ChemicalOutput::update. Every call to
+/// ChemicalOutput::update evaluates these quantities and stores them in the
+/// next row of a columnar buffer, together with the given time and cell
+/// index (in columns `t` and `cell`). Filled buffers are written to the file
+/// by a background thread, so that formatting and writing values do not
+/// stall the calculations producing the chemical states. The file is
+/// complete only after ChemicalOutput::close is called, which is also done
+/// when the ChemicalOutput object is destroyed.
+class ChemicalOutput
+{
+public:
+    /// Construct a ChemicalOutput object that creates an output file.
+    /// @param path The path, including file name, to the output file.
+    /// @param options The options for the output.
+    explicit ChemicalOutput(String const& path, ChemicalOutputOptions const& options = {});
+
+    /// Destroy this ChemicalOutput object after closing the output file.
+    ~ChemicalOutput();
+
+    /// Register a quantity to be output.
+    /// @param name The name of the column of the quantity in the output file.
+    /// @param fn The function that evaluates the quantity for a chemical state.
+    auto add(String const& name, ChemicalOutputFn const& fn) -> void;
+
+    /// Register a property to be output, evaluated from the chemical properties of the chemical states.
+    /// @param name The name of the column of the property in the output file.
+    /// @param prop The property evaluator.
+    auto add(String const& name, Prop const& prop) -> void;
+
+    /// Return the names of the columns in the output file.
+    auto columns() const -> Strings;
+
+    /// Output the registered quantities of a chemical state in a new row.
+    /// @param state The chemical state.
+    /// @param t The time (or any other value of the independent variable) in column `t`.
+    /// @param icell The index of the cell in column `cell`.
+    auto update(ChemicalState const& state, double t, Index icell = 0) -> void;
+
+    /// Output the registered quantities of the chemical states of many cells, one row per cell.
+    /// @param states The chemical states of the cells.
+    /// @param t The time (or any other value of the independent variable) in column `t`.
+    auto update(Vec<ChemicalState> const& states, double t) -> void;
+
+    /// Wait until all rows output so far have been written to the file.
+    auto flush() -> void;
+
+    /// Write all remaining rows and close the output file.
+    auto close() -> void;
+
+    /// Return a Table object with the contents of a file created with ChemicalOutputFormat::Binary format.
+    /// @param path The path, including file name, to the output file.
+    static auto loadBinary(String const& path) -> Table;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
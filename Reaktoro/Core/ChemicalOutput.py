@@ -0,0 +1,58 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright © 2014-2024 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+from reaktoro import *
+
+
+def testChemicalOutput(tmp_path):
+    db = SupcrtDatabase("supcrtbl")
+
+    system = ChemicalSystem(db, AqueousPhase("H2O(aq) H+ OH- Na+ Cl-"))
+
+    states = []
+    for i in range(3):
+        state = ChemicalState(system)
+        state.temperature(25.0 + i, "celsius")
+        state.set("H2O(aq)", 1.0, "kg")
+        state.set("Na+", 0.1, "mol")
+        state.set("Cl-", 0.1, "mol")
+        states.append(state)
+
+    path = str(tmp_path / "output.bin")
+
+    options = ChemicalOutputOptions()
+    options.format = ChemicalOutputFormat.Binary
+    options.buffersize = 2
+
+    output = ChemicalOutput(path, options)
+    output.add("T", lambda state: state.temperature())
+    output.add("n[Na+]", lambda state: state.speciesAmount("Na+"))
+
+    assert output.columns() == ["t", "cell", "T", "n[Na+]"]
+
+    for step in range(4):
+        output.update(states, 0.5 * step)
+
+    output.close()
+
+    table = ChemicalOutput.loadBinary(path)
+
+    assert table.rows() == 12
+    assert table["t"][11] == 1.5
+    assert table["T"][5] == states[2].temperature()
+    assert table["n[Na+]"][0] == states[0].speciesAmount("Na+")
@@ -0,0 +1,55 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Table.hpp>
+#include <Reaktoro/Core/ChemicalOutput.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/Prop.hpp>
+using namespace Reaktoro;
+
+void exportChemicalOutput(py::module& m)
+{
+    py::enum_<ChemicalOutputFormat>(m, "ChemicalOutputFormat")
+        .value("Csv", ChemicalOutputFormat::Csv)
+        .value("Binary", ChemicalOutputFormat::Binary)
+        ;
+
+    py::class_<ChemicalOutputOptions>(m, "ChemicalOutputOptions")
+        .def(py::init<>())
+        .def_readwrite("format", &ChemicalOutputOptions::format)
+        .def_readwrite("buffersize", &ChemicalOutputOptions::buffersize)
+        .def_readwrite("maxbuffers", &ChemicalOutputOptions::maxbuffers)
+        .def_readwrite("delimiter", &ChemicalOutputOptions::delimiter)
+        .def_readwrite("precision", &ChemicalOutputOptions::precision)
+        ;
+
+    py::class_<ChemicalOutput>(m, "ChemicalOutput")
+        .def(py::init<String const&, ChemicalOutputOptions const&>(), "path"_a, "options"_a = ChemicalOutputOptions{})
+        .def("add", py::overload_cast<String const&, Prop const&>(&ChemicalOutput::add))
+        .def("add", py::overload_cast<String const&, ChemicalOutputFn const&>(&ChemicalOutput::add))
+        .def("columns", &ChemicalOutput::columns)
+        .def("update", py::overload_cast<ChemicalState const&, double, Index>(&ChemicalOutput::update), "state"_a, "t"_a, "icell"_a = 0)
+        .def("update", py::overload_cast<Vec<ChemicalState> const&, double>(&ChemicalOutput::update))
+        .def("flush", &ChemicalOutput::flush)
+        .def("close", &ChemicalOutput::close)
+        .def_static("loadBinary", &ChemicalOutput::loadBinary)
+        ;
+}
@@ -0,0 +1,229 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Table.hpp>
+#include <Reaktoro/Core/ChemicalOutput.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Prop.hpp>
+using namespace Reaktoro;
+
+namespace test {
+
+/// Return a mock ChemicalSystem object for test reasons.
+auto createChemicalSystem() -> ChemicalSystem;
+
+} // namespace test
+
+TEST_CASE("Testing ChemicalOutput class", "[ChemicalOutput]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    Vec<ChemicalState> states(5, ChemicalState(system));
+    for(auto i = 0; i < states.size(); ++i)
+    {
+        states[i].setTemperature(300.0 + i);
+        states[i].setPressure(1.0e5);
+        states[i].setSpeciesAmounts(1.0 + i);
+        states[i].props().update(states[i]);
+    }
+
+    const auto numsteps = 7;
+
+    auto addQuantities = [](ChemicalOutput& output)
+    {
+        output.add("T", [](ChemicalState const& state) { return state.temperature(); });
+        output.add("n[H2O(aq)]", [](ChemicalState const& state) { return state.speciesAmount("H2O(aq)"); });
+        output.add("V", Prop([](ChemicalProps const& props) { return props.volume(); }));
+    };
+
+    const auto path = "temporary.out";
+
+    SECTION("Testing output in CSV format")
+    {
+        ChemicalOutputOptions options;
+        options.buffersize = 3; // ensure many buffers are handed over to the writer thread
+        options.maxbuffers = 2;
+        options.delimiter = ";";
+        options.precision = 4;
+
+        ChemicalOutput output(path, options);
+        addQuantities(output);
+
+        CHECK( output.columns() == Strings{ "t", "cell", "T", "n[H2O(aq)]", "V" } );
+
+        for(auto step = 0; step < numsteps; ++step)
+            output.update(states, 0.5 * step);
+
+        CHECK_THROWS( output.add("P", [](ChemicalState const& state) { return state.pressure(); }) ); // quantities cannot be added after rows have been output
+
+        output.close();
+
+        std::ifstream file(path);
+        String line;
+
+        std::getline(file, line);
+        CHECK( line == "t;cell;T;n[H2O(aq)];V" );
+
+        std::getline(file, line);
+        CHECK( line.substr(0, 10) == "0;0;300;1;" );
+
+        Index numrows = 0;
+        while(std::getline(file, line))
+            ++numrows;
+
+        CHECK( numrows == numsteps * states.size() - 1 );
+    }
+
+    SECTION("Testing output in binary format")
+    {
+        ChemicalOutputOptions options;
+        options.format = ChemicalOutputFormat::Binary;
+        options.buffersize = 4;
+
+        ChemicalOutput output(path, options);
+        addQuantities(output);
+
+        for(auto step = 0; step < numsteps; ++step)
+        {
+            output.update(states, 0.5 * step);
+            if(step == 2)
+                output.flush();
+        }
+
+        output.close();
+
+        const auto table = ChemicalOutput::loadBinary(path);
+
+        CHECK( table.rows() == numsteps * states.size() );
+        CHECK( table.cols() == 5 );
+
+        auto const& t = table["t"];
+        auto const& cell = table.column("cell").integers();
+        auto const& T = table["T"];
+        auto const& n = table["n[H2O(aq)]"];
+        auto const& V = table["V"];
+
+        for(auto step = 0; step < numsteps; ++step)
+        {
+            for(auto i = 0; i < states.size(); ++i)
+            {
+                const auto row = step * states.size() + i;
+                CHECK( t[row] == 0.5 * step );
+                CHECK( cell[row] == i );
+                CHECK( T[row] == states[i].temperature() );
+                CHECK( n[row] == states[i].speciesAmount("H2O(aq)") );
+                CHECK( V[row] == states[i].props().volume() );
+            }
+        }
+
+        // Corrupt the number of names (after the signature, byte order mark and version) and the number of rows in the first block
+        std::ifstream input(path, std::ios::binary);
+        String bytes((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+        input.close();
+
+        auto corrupt = [&](std::size_t offset, auto size)
+        {
+            String corrupted = bytes;
+            std::memcpy(corrupted.data() + offset, &size, sizeof(size));
+            std::ofstream(path, std::ios::binary).write(corrupted.data(), corrupted.size());
+            CHECK_THROWS_WITH( ChemicalOutput::loadBinary(path), Catch::Contains("ended unexpectedly") );
+        };
+
+        const auto header = 8 + 4 + 4;
+        auto namesbytes = 4;
+        for(auto const& name : { "t", "cell", "T", "n[H2O(aq)]", "V" })
+            namesbytes += 4 + std::strlen(name);
+
+        corrupt(header, std::uint32_t(0xFFFFFFFF));
+        corrupt(header + 4, std::uint32_t(0xFFFFFFFF));
+        corrupt(header + namesbytes, std::uint64_t(1) << 60);
+    }
+
+    std::remove(path);
+}
+
+TEST_CASE("Benchmarking ChemicalOutput class", "[.benchmark]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    const auto numcells = 1000; // each benchmark iteration outputs one step of all cells (i.e., 1000 rows)
+
+    Vec<ChemicalState> states(numcells, ChemicalState(system));
+    for(auto i = 0; i < numcells; ++i)
+    {
+        states[i].setTemperature(300.0 + 0.01 * i);
+        states[i].setSpeciesAmounts(1.0 + 0.001 * i);
+    }
+
+    Strings species = { "H2O(aq)", "H+(aq)", "OH-(aq)", "Na+(aq)", "Cl-(aq)", "CO2(g)" };
+
+    Indices ispecies;
+    for(auto const& name : species)
+        ispecies.push_back(system.species().index(name));
+
+    auto t = 0.0;
+
+    std::ofstream file("temporary.csv");
+
+    BENCHMARK("Per-step output with std::ofstream")
+    {
+        for(auto i = 0; i < numcells; ++i)
+        {
+            file << t << "," << i << "," << states[i].temperature();
+            for(auto const& j : ispecies)
+                file << "," << states[i].speciesAmounts()[j];
+            file << "\n";
+        }
+        return t += 1.0;
+    };
+
+    file.close();
+
+    for(auto format : { ChemicalOutputFormat::Csv, ChemicalOutputFormat::Binary })
+    {
+        ChemicalOutputOptions options;
+        options.format = format;
+
+        ChemicalOutput output("temporary.out", options);
+        output.add("T", [](ChemicalState const& state) { return state.temperature(); });
+        for(auto k = 0; k < species.size(); ++k)
+            output.add("n[" + species[k] + "]", [j = ispecies[k]](ChemicalState const& state) { return state.speciesAmounts()[j]; });
+
+        BENCHMARK(format == ChemicalOutputFormat::Csv ? "Buffered output with ChemicalOutput (CSV)" : "Buffered output with ChemicalOutput (binary)")
+        {
+            output.update(states, t);
+            return t += 1.0;
+        };
+
+        output.close();
+    }
+
+    std::remove("temporary.csv");
+    std::remove("temporary.out");
+}
@@ -27,9 +27,12 @@ using namespace tabulate;
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Core/ChemicalPropsPhase.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/Utils.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsBatch.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsInterpolator.hpp>
 
 namespace Reaktoro {
 
@@ -92,12 +95,14 @@ auto ChemicalProps::update(real const& T0, real const& P0, ArrayXrConstRef n0) -
     T = T0;
     P = P0;
 
+    updateStandardThermoProps();
+
     auto offset = 0;
     for(auto const& [i, phase] : enumerate(msystem.phases()))
     {
         const auto size = phase.species().size();
         const auto np = n0.segment(offset, size);
-        phasePropsRef(i).update(T, P, np, m_extra);
+        phasePropsRef(i).update(T, P, np, m_extra, false);
         offset += size;
     }
 }
@@ -105,12 +110,14 @@ auto ChemicalProps::update(real const& T0, real const& P0, ArrayXrConstRef n0) -
 auto ChemicalProps::update(ArrayXrConstRef data) -> void
 {
     mstateid += 1;
+    m_std_uptodate = false;
     ArraySerialization::deserialize(data, T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
 auto ChemicalProps::update(ArrayXdConstRef data) -> void
 {
     mstateid += 1;
+    m_std_uptodate = false;
     ArraySerialization::deserialize(data, T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
@@ -133,12 +140,14 @@ auto ChemicalProps::updateIdeal(real const& T0, real const& P0, ArrayXrConstRef
     T = T0;
     P = P0;
 
+    updateStandardThermoProps();
+
     auto offset = 0;
     for(auto const& [i, phase] : enumerate(msystem.phases()))
     {
         const auto size = phase.species().size();
         const auto np = n0.segment(offset, size);
-        phasePropsRef(i).updateIdeal(T, P, np, m_extra);
+        phasePropsRef(i).updateIdeal(T, P, np, m_extra, false);
         offset += size;
     }
 }
@@ -156,15 +165,47 @@ auto ChemicalProps::serialize(ArrayStream<double>& stream) const -> void
 auto ChemicalProps::deserialize(const ArrayStream<real>& stream) -> void
 {
     mstateid += 1;
+    m_std_uptodate = false;
     stream.to(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
 auto ChemicalProps::deserialize(const ArrayStream<double>& stream) -> void
 {
     mstateid += 1;
+    m_std_uptodate = false;
     stream.to(T, P, n, Ts, Ps, nsum, msum, x, G0, H0, V0, VT0, VP0, Cp0, Vx, VxT, VxP, Vxi, Gx, Hx, Cpx, ln_g, ln_a, u);
 }
 
+auto ChemicalProps::resetStandardThermoPropsCache() -> void
+{
+    m_std_uptodate = false;
+}
+
+auto ChemicalProps::updateStandardThermoProps() -> void
+{
+    // The standard thermodynamic properties are interpolated if enabled in the system and T and P are inside the tabulation domain
+    auto const& interpolator = msystem.standardThermoPropsInterpolator();
+    const auto interpolated = interpolator.contains(T.val(), P.val());
+
+    // Standard thermodynamic properties depend only on T and P (and on how they are evaluated), so skip them if only n has changed
+    const auto uptodate = m_std_uptodate && Memoization::isEnabled() && interpolated == m_std_interpolated && sameValueAndSeed(T, m_std_T) && sameValueAndSeed(P, m_std_P);
+
+    if(uptodate)
+        return;
+
+    m_std_uptodate = false; // in case an exception is thrown below
+
+    // Standard thermodynamic properties of all species are evaluated at once, with reactant species in formation reactions evaluated only once
+    if(interpolated)
+        interpolator.eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+    else msystem.standardThermoPropsBatch().eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+
+    m_std_T = T;
+    m_std_P = P;
+    m_std_interpolated = interpolated;
+    m_std_uptodate = true;
+}
+
 auto ChemicalProps::stateid() const -> Index
 {
     return mstateid;
@@ -47,6 +47,12 @@ public:
     auto update(ChemicalState const& state) -> void;
 
     /// Update the chemical properties of the system.
+    /// The standard thermodynamic properties of the species are only
+    /// recomputed if `T` or `P` differ, in value or derivative seed, from
+    /// those used in their last computation, or if they were last computed
+    /// by a different method (interpolation or exact models, see
+    /// ChemicalSystem::withStandardThermoPropsInterpolation and
+    /// @ref resetStandardThermoPropsCache).
     /// @param T The temperature condition (in K)
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the system (in mol)
@@ -86,6 +92,11 @@ public:
     /// @param stream The array stream containing the serialized chemical properties.
     auto deserialize(const ArrayStream<double>& stream) -> void;
 
+    /// Force the standard thermodynamic properties of the species to be recomputed in the next update.
+    /// This is needed only if the parameters of the standard thermodynamic
+    /// models have changed while temperature and pressure have not.
+    auto resetStandardThermoPropsCache() -> void;
+
     /// Return the state identification number of this ChemicalProps object.
     /// Each time this ChemicalProps object is updated, its state identification
     /// number (`stateid`) is incremented. This is useful for memorizing
@@ -560,11 +571,26 @@ private:
     /// The state of matter of the phses in the system.
     Vec<StateOfMatter> som;
 
+    /// The temperature used in the last computation of the standard thermodynamic properties of the species (in K).
+    real m_std_T;
+
+    /// The pressure used in the last computation of the standard thermodynamic properties of the species (in Pa).
+    real m_std_P;
+
+    /// The flag indicating whether the standard thermodynamic properties of the species were last computed by interpolation.
+    bool m_std_interpolated = false;
+
+    /// The flag indicating whether the standard thermodynamic properties of the species are up to date with respect to `m_std_T`, `m_std_P` and `m_std_interpolated`.
+    bool m_std_uptodate = false;
+
     /// The extra data produced during the evaluation of activity models. This
     /// extra data allows the activity model of a phase to reuse calculated
     /// data from the activity model of a previous phase if needed.
     Map<String, Any> m_extra;
 
+    /// Update the standard thermodynamic properties of the species if `T` or `P` (or the use of interpolation) changed since their last computation.
+    auto updateStandardThermoProps() -> void;
+
     /// Return a mutable view to the chemical properties of a phase with given index.
     /// @param phase The name or index of the phase in the system.
     auto phasePropsRef(StringOrIndex phase) -> ChemicalPropsPhaseRef;
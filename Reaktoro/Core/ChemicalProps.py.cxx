@@ -36,6 +36,7 @@ void exportChemicalProps(py::module& m)
         .def("update", py::overload_cast<ArrayXdConstRef>(&ChemicalProps::update), "Update the chemical properties of the system with serialized data.")
         .def("updateIdeal", py::overload_cast<ChemicalState const&>(&ChemicalProps::updateIdeal), "Update the chemical properties of the system using ideal activity models.")
         .def("updateIdeal", py::overload_cast<real const&, real const&, ArrayXrConstRef>(&ChemicalProps::updateIdeal), "Update the chemical properties of the system using ideal activity models.")
+        .def("resetStandardThermoPropsCache", &ChemicalProps::resetStandardThermoPropsCache, "Force the standard thermodynamic properties of the species to be recomputed in the next update.")
         .def("stateid", &ChemicalProps::stateid, "Return the state identification number of this ChemicalProps object")
         .def("system", &ChemicalProps::system, return_internal_ref, "Return the chemical system associated with these chemical properties.")
         .def("phaseProps", &ChemicalProps::phaseProps, py::keep_alive<0, 1>(), "Return the chemical properties of a phase with given index.")
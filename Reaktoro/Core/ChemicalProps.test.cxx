@@ -21,8 +21,10 @@
 // Reaktoro includes
 #include <Reaktoro/Common/AutoDiff.hpp>
 #include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsInterpolator.hpp>
 using namespace Reaktoro;
 
 TEST_CASE("Testing ChemicalProps class", "[ChemicalProps]")
@@ -41,8 +43,11 @@ TEST_CASE("Testing ChemicalProps class", "[ChemicalProps]")
         return props;
     };
 
-    StandardThermoModel standard_thermo_model_solid = [](real T, real P)
+    auto numcalls_solid = 0; // the number of evaluations of the standard thermodynamic model of the solid species
+
+    StandardThermoModel standard_thermo_model_solid = [&numcalls_solid](real T, real P)
     {
+        numcalls_solid += 1;
         StandardThermoProps props;
         props.G0  = 1.1 * (T*P)*(T*P);
         props.H0  = 1.2 * (T*P)*(T*P);
@@ -498,6 +503,157 @@ TEST_CASE("Testing ChemicalProps class", "[ChemicalProps]")
         CHECK_NOTHROW( props.update(T, P, n2) );
     }
 
+    SECTION("Testing reuse of standard thermodynamic properties when only species amounts change")
+    {
+        real T = 3.0;
+        real P = 5.0;
+
+        const ArrayXr n1 = ArrayXr{{ 4.0, 6.0, 5.0 }};
+        const ArrayXr n2 = ArrayXr{{ 2.0, 3.0, 7.0 }};
+
+        const ArrayXr G0 = ArrayXr{{ 0.1, 0.1, 1.1 }} * (T*P)*(T*P);
+        const ArrayXd G0_T = ArrayXd{{ 0.1, 0.1, 1.1 }} * 2*P*(T*P);
+
+        props.update(T, P, n1);
+        props.update(T, P, n2);
+
+        CHECK( props.speciesAmounts().isApprox(n2) );
+        CHECK( props.speciesStandardGibbsEnergies().isApprox(G0) );
+        CHECK( grad(props.speciesStandardGibbsEnergies()).isZero() );
+
+        // A derivative seed on T must force the standard properties to be recomputed
+        autodiff::seed(T);
+        props.update(T, P, n2);
+        autodiff::unseed(T);
+
+        CHECK( props.speciesStandardGibbsEnergies().isApprox(G0) );
+        CHECK( grad(props.speciesStandardGibbsEnergies()).isApprox(G0_T) );
+
+        // Removing the seed must force them to be recomputed again
+        props.update(T, P, n1);
+
+        CHECK( grad(props.speciesStandardGibbsEnergies()).isZero() );
+
+        // A change in the value of T must force them to be recomputed as well
+        const real T2 = 7.0;
+        props.update(T2, P, n1);
+
+        const ArrayXr G02 = ArrayXr{{ 0.1, 0.1, 1.1 }} * (T2*P)*(T2*P);
+
+        CHECK( props.speciesStandardGibbsEnergies().isApprox(G02) );
+
+        // Deserialization must not leave stale standard properties behind
+        ArrayStream<real> stream;
+        props.serialize(stream); // properties at T2
+        props.update(T, P, n1);
+        props.deserialize(stream); // back to properties at T2
+        props.update(T, P, n2);
+
+        CHECK( props.speciesStandardGibbsEnergies().isApprox(G0) );
+    }
+
+    SECTION("Testing that the standard thermodynamic models are not evaluated when only species amounts change")
+    {
+        const real T1 = 3.0;
+        const real T2 = 7.0;
+        const real P = 5.0;
+
+        const ArrayXr n1 = ArrayXr{{ 4.0, 6.0, 5.0 }};
+        const ArrayXr n2 = ArrayXr{{ 2.0, 3.0, 7.0 }};
+
+        // Another ChemicalProps object sharing the same system, and thus the same
+        // memoized species models, is updated at T2 between the updates of props
+        // at T1. The memoization of the species models then never hides an
+        // evaluation at T1, which is thus counted unless skipped by props.
+        ChemicalProps other(system);
+
+        props.update(T1, P, n1);
+        CHECK( numcalls_solid == 1 );
+
+        other.update(T2, P, n1);
+        CHECK( numcalls_solid == 2 );
+
+        props.update(T1, P, n2); // only n changed, so the standard properties of props are reused
+        CHECK( numcalls_solid == 2 );
+
+        Memoization::disable();
+        props.update(T1, P, n1); // with memoization disabled, the standard properties are always recomputed
+        Memoization::enable();
+        CHECK( numcalls_solid == 3 );
+
+        StandardThermoPropsInterpolatorOptions options;
+        options.Tmin = 1.0;
+        options.Tmax = 10.0;
+        options.Pmin = 1.0;
+        options.Pmax = 10.0;
+
+        const auto isystem = system.withStandardThermoPropsInterpolation(options);
+        const auto numcalls_after_tabulation = numcalls_solid;
+
+        ChemicalProps iprops(isystem);
+
+        iprops.update(T1, P, n2); // computed by interpolation, without calling the species models
+        CHECK( numcalls_solid == numcalls_after_tabulation );
+
+        props.update(T1, P, n1); // the system of props is unaffected by the interpolation in isystem, and its standard properties are still reused
+        CHECK( numcalls_solid == numcalls_after_tabulation );
+        CHECK( props.system().standardThermoPropsInterpolator().empty() );
+    }
+
+    SECTION("Testing interpolation of standard thermodynamic properties over a temperature-pressure domain")
+    {
+        StandardThermoPropsInterpolatorOptions options;
+        options.Tmin = 1.0;
+        options.Tmax = 10.0;
+        options.Pmin = 1.0;
+        options.Pmax = 10.0;
+        options.numcellsT = 3;
+        options.numcellsP = 2;
+        options.degreeT = 2; // the standard thermodynamic models are quadratic in both T and P
+        options.degreeP = 2;
+
+        const auto isystem = system.withStandardThermoPropsInterpolation(options);
+
+        CHECK( isystem.standardThermoPropsInterpolator().size() == 3 );
+        CHECK( isystem.id() != system.id() );
+        CHECK( system.standardThermoPropsInterpolator().empty() ); // the original system is unaffected
+
+        ChemicalProps iprops(isystem);
+
+        real T = 3.0;
+        real P = 5.0;
+
+        const ArrayXr n = ArrayXr{{ 4.0, 6.0, 5.0 }};
+
+        const ArrayXr G0 = ArrayXr{{ 0.1, 0.1, 1.1 }} * (T*P)*(T*P);
+        const ArrayXd G0_T = ArrayXd{{ 0.1, 0.1, 1.1 }} * 2*P*(T*P);
+        const ArrayXd G0_P = ArrayXd{{ 0.1, 0.1, 1.1 }} * 2*T*(T*P);
+
+        autodiff::seed(T);
+        iprops.update(T, P, n);
+        autodiff::unseed(T);
+
+        CHECK( iprops.speciesStandardGibbsEnergies().isApprox(G0) );
+        CHECK( grad(iprops.speciesStandardGibbsEnergies()).isApprox(G0_T) );
+
+        autodiff::seed(P);
+        iprops.updateIdeal(T, P, n);
+        autodiff::unseed(P);
+
+        CHECK( iprops.speciesStandardGibbsEnergies().isApprox(G0) );
+        CHECK( grad(iprops.speciesStandardGibbsEnergies()).isApprox(G0_P) );
+
+        // Outside the tabulation domain, the exact models must be used
+        const real T2 = 20.0;
+        iprops.update(T2, P, n);
+
+        const ArrayXr G02 = ArrayXr{{ 0.1, 0.1, 1.1 }} * (T2*P)*(T2*P);
+
+        CHECK( iprops.speciesStandardGibbsEnergies().isApprox(G02) );
+
+        CHECK( isystem.withoutStandardThermoPropsInterpolation().standardThermoPropsInterpolator().empty() );
+    }
+
     SECTION("Testing convenience methods")
     {
         const real T = 11.0;
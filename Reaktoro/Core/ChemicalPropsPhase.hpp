@@ -23,6 +23,7 @@
 #include <Reaktoro/Common/TypeOp.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsBatch.hpp>
 
 namespace Reaktoro {
 
@@ -216,9 +217,10 @@ public:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra properties evaluated in the activity models
-    auto update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    /// @param update_standard_props The flag indicating whether the standard thermodynamic properties of the species need to be computed (`false` if they are already up to date for the given `T` and `P`)
+    auto update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra, bool update_standard_props = true)
     {
-        _update<false>(T, P, n, extra);
+        _update<false>(T, P, n, extra, update_standard_props);
     }
 
     /// Update the chemical properties of the phase using ideal activity models.
@@ -226,9 +228,10 @@ public:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra properties evaluated in the activity models
-    auto updateIdeal(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    /// @param update_standard_props The flag indicating whether the standard thermodynamic properties of the species need to be computed (`false` if they are already up to date for the given `T` and `P`)
+    auto updateIdeal(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra, bool update_standard_props = true)
     {
-        _update<true>(T, P, n, extra);
+        _update<true>(T, P, n, extra, update_standard_props);
     }
 
     /// Update the chemical properties of the phase with given data.
@@ -657,8 +660,9 @@ private:
     /// @param P The pressure condition (in Pa)
     /// @param n The amounts of the species in the phase (in mol)
     /// @param extra The extra data mapped to activity mode
+    /// @param update_standard_props The flag indicating whether the standard thermodynamic properties of the species need to be computed
     template<bool use_ideal_activity_model>
-    auto _update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra)
+    auto _update(const real& T, const real& P, ArrayXrConstRef n, Map<String, Any>& extra, bool update_standard_props)
     {
         mdata.T = T;
         mdata.P = P;
@@ -702,18 +706,9 @@ private:
         assert(    u.size() == N );
         assert(   Vxi.size() == N );
 
-        // Compute the standard thermodynamic properties of the species in the phase.
-        StandardThermoProps aux;
-        for(auto i = 0; i < N; ++i)
-        {
-            aux = species[i].standardThermoProps(T, P);
-            G0[i]  = aux.G0;
-            H0[i]  = aux.H0;
-            V0[i]  = aux.V0;
-            VT0[i] = aux.VT0;
-            VP0[i] = aux.VP0;
-            Cp0[i] = aux.Cp0;
-        }
+        // Compute the standard thermodynamic properties of the species in the phase (grouped by model family and written directly into the arrays).
+        if(update_standard_props)
+            phase().standardThermoPropsBatch().eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
 
         // Compute the amount of the phase
         nsum = n.sum();
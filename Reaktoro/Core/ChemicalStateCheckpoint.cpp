@@ -0,0 +1,862 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "ChemicalStateCheckpoint.hpp"
+
+// C++ includes
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+
+// System includes
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// zstd includes
+#ifdef REAKTORO_ENABLE_ZSTD
+#include <zstd.h>
+#endif
+
+// Optima includes
+#include <Optima/State.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Data.hpp>
+
+namespace Reaktoro {
+namespace {
+
+// A checkpoint file consists of:
+//   1. the 8-byte signature `checkpoint_signature`;
+//   2. a 32-bit integer with value 1 written in the byte order of the machine that created it;
+//   3. a 32-bit integer with the version of the format;
+//   4. the chunks, each starting at an offset that is a multiple of 8 bytes;
+//   5. the chunk table, with a ChunkEntry object for each chunk;
+//   6. the metadata of the checkpoint (e.g., layouts of the columns, names of the species) as a Data object in binary format;
+//   7. the trailer, a Trailer object pointing to the chunk table and the metadata.
+// A chunk contains the columns of its cells one after the other, with all
+// values of a cell in a column stored contiguously. The widths of the
+// columns are determined by the cells in the chunk alone (e.g., a chunk
+// without equilibrium data has empty equilibrium columns), so every chunk
+// entry points to one of the distinct layouts stored in the metadata. All
+// values are 8 bytes long (either double or 64-bit integer), and so are all
+// values in the chunk table and the trailer.
+
+/// The signature at the beginning and at the end of every checkpoint file.
+const char checkpoint_signature[8] = { 'R', 'K', 'T', 'C', 'H', 'K', 'P', 'T' };
+
+/// The version of the format of the checkpoint files.
+const std::uint32_t checkpoint_version = 1;
+
+/// The size of the header of the checkpoint files.
+const Index header_size = sizeof(checkpoint_signature) + 2 * sizeof(std::uint32_t);
+
+/// The location of a chunk in a checkpoint file and the cells in it.
+struct ChunkEntry
+{
+    /// The index of the first cell in the chunk.
+    std::uint64_t ifirst;
+
+    /// The number of cells in the chunk.
+    std::uint64_t count;
+
+    /// The offset of the chunk in the file.
+    std::uint64_t offset;
+
+    /// The size of the chunk in the file (in bytes).
+    std::uint64_t size;
+
+    /// The size of the chunk when decompressed (in bytes).
+    std::uint64_t rawsize;
+
+    /// The index of the layout of the columns in the chunk among those in the metadata.
+    std::uint64_t ilayout;
+};
+
+/// The trailer at the end of every checkpoint file.
+struct Trailer
+{
+    /// The offset of the chunk table in the file.
+    std::uint64_t tableoffset;
+
+    /// The number of chunks in the chunk table.
+    std::uint64_t numchunks;
+
+    /// The offset of the metadata in the file.
+    std::uint64_t metaoffset;
+
+    /// The size of the metadata (in bytes).
+    std::uint64_t metasize;
+
+    /// The signature marking the end of a complete checkpoint file.
+    char signature[8];
+};
+
+/// The columns in the chunks of a checkpoint file.
+enum Column
+{
+    ColumnT,       ///< The temperatures of the cells (as double).
+    ColumnP,       ///< The pressures of the cells (as double).
+    ColumnN,       ///< The amounts of the species in the cells (as double).
+    ColumnEq,      ///< The flags indicating which cells have equilibrium data (as integer).
+    ColumnNb,      ///< The numbers of primary species in the cells (as integer).
+    ColumnW,       ///< The input variables *w* of the equilibrium calculations (as double).
+    ColumnC,       ///< The initial component amounts *c* of the equilibrium calculations (as double).
+    ColumnX,       ///< The member *x* of the Optima::State objects (as double).
+    ColumnOptP,    ///< The member *p* of the Optima::State objects (as double).
+    ColumnYe,      ///< The member *ye* of the Optima::State objects (as double).
+    ColumnS,       ///< The member *s* of the Optima::State objects (as double).
+    ColumnJ,       ///< The members *jb* and *jn* of the Optima::State objects, one after the other (as integer).
+    ColumnU,       ///< The serialized chemical properties of the states (as double).
+    NumColumns
+};
+
+/// The names of the columns in the metadata of a checkpoint file.
+const std::array<Chars, NumColumns> column_names = { "T", "P", "n", "eq", "nb", "w", "c", "x", "p", "ye", "s", "j", "u" };
+
+/// The layout of the columns in the chunks of a checkpoint file.
+struct Layout
+{
+    /// The number of values of each cell in each column.
+    std::array<Index, NumColumns> widths = {};
+
+    /// The position of each column in the values of a cell, i.e., the sum of the widths of the previous columns.
+    std::array<Index, NumColumns> starts = {};
+
+    /// The number of values of each cell in all columns.
+    Index rowsize = 0;
+
+    /// The dimensions *x*, *p*, *be* and *c* of the Optima::Dims object of the equilibrium calculations.
+    std::array<Index, 4> optdims = {};
+
+    /// The names of the input variables *w* of the equilibrium calculations.
+    Strings wnames;
+
+    /// The names of the control variables *p* of the equilibrium calculations.
+    Strings pnames;
+
+    /// The names of the control variables *q* of the equilibrium calculations.
+    Strings qnames;
+
+    /// Compute the positions of the columns and the row size after the widths have been set.
+    auto initialize() -> void
+    {
+        rowsize = 0;
+        for(auto k = 0; k < NumColumns; ++k)
+        {
+            starts[k] = rowsize;
+            rowsize += widths[k];
+        }
+    }
+
+    /// Return true if the equilibrium data of the cells is stored.
+    auto hasEquilibrium() const -> bool
+    {
+        return widths[ColumnX] > 0;
+    }
+
+    /// Return the position of the values of a cell in a column of a chunk with given number of cells.
+    auto position(Index count, Index column, Index i) const -> Index
+    {
+        return count * starts[column] + i * widths[column];
+    }
+
+    /// Return true if this layout is the same as another.
+    auto operator==(Layout const& other) const -> bool
+    {
+        return widths == other.widths
+            && optdims == other.optdims
+            && wnames == other.wnames
+            && pnames == other.pnames
+            && qnames == other.qnames;
+    }
+};
+
+/// Return the metadata of a layout of the columns in the chunks of a checkpoint file.
+auto createMetadata(Layout const& layout) -> Data
+{
+    auto strings = [](Strings const& values)
+    {
+        Data data;
+        for(auto const& value : values)
+            data.add(value);
+        return data;
+    };
+
+    Data meta;
+    for(auto k = 0; k < NumColumns; ++k)
+        meta["Columns"][column_names[k]] = int(layout.widths[k]);
+    meta["OptimaDims"]["x"] = int(layout.optdims[0]);
+    meta["OptimaDims"]["p"] = int(layout.optdims[1]);
+    meta["OptimaDims"]["be"] = int(layout.optdims[2]);
+    meta["OptimaDims"]["c"] = int(layout.optdims[3]);
+    meta["NamesInputVariables"] = strings(layout.wnames);
+    meta["NamesControlVariablesP"] = strings(layout.pnames);
+    meta["NamesControlVariablesQ"] = strings(layout.qnames);
+    return meta;
+}
+
+/// Return the metadata of a checkpoint file with given layouts of the columns in its chunks.
+auto createMetadata(Vec<Layout> const& layouts, ChemicalSystem const& system, Index numcells, ChemicalStateCheckpointOptions const& options) -> Data
+{
+    Data meta;
+    meta["NumCells"] = int(numcells);
+    meta["Compression"] = options.compression;
+    meta["Props"] = options.props;
+    for(auto const& species : system.species())
+        meta["Species"].add(species.name());
+    for(auto const& layout : layouts)
+        meta["Layouts"].add(createMetadata(layout));
+    return meta;
+}
+
+/// Return a layout of the columns in the chunks of a checkpoint file with given metadata.
+auto createLayout(Data const& meta) -> Layout
+{
+    auto strings = [](Data const& data)
+    {
+        Strings values;
+        if(data.isList())
+            for(auto const& value : data.asList())
+                values.push_back(value.asString());
+        return values;
+    };
+
+    Layout layout;
+    for(auto k = 0; k < NumColumns; ++k)
+        layout.widths[k] = meta["Columns"][column_names[k]].asInteger();
+    layout.optdims[0] = meta["OptimaDims"]["x"].asInteger();
+    layout.optdims[1] = meta["OptimaDims"]["p"].asInteger();
+    layout.optdims[2] = meta["OptimaDims"]["be"].asInteger();
+    layout.optdims[3] = meta["OptimaDims"]["c"].asInteger();
+    layout.wnames = strings(meta["NamesInputVariables"]);
+    layout.pnames = strings(meta["NamesControlVariablesP"]);
+    layout.qnames = strings(meta["NamesControlVariablesQ"]);
+    layout.initialize();
+    return layout;
+}
+
+/// Return the layout of a chunk determined from its first chemical state with equilibrium data.
+auto createLayout(ChemicalSystem const& system, Vec<ChemicalState> const& states, Index ifirst, Index count, bool props) -> Layout
+{
+    Layout layout;
+    layout.widths[ColumnT] = 1;
+    layout.widths[ColumnP] = 1;
+    layout.widths[ColumnN] = system.species().size();
+    layout.widths[ColumnEq] = 1;
+    layout.widths[ColumnNb] = 1;
+
+    if(props)
+        layout.widths[ColumnU] = VectorXd(states[ifirst].props()).size();
+
+    for(auto i = ifirst; i < ifirst + count; ++i)
+    {
+        auto const& equilibrium = states[i].equilibrium();
+        if(equilibrium.empty())
+            continue;
+        auto const& optstate = equilibrium.optimaState();
+        layout.widths[ColumnW] = equilibrium.w().size();
+        layout.widths[ColumnC] = equilibrium.c().size();
+        layout.widths[ColumnX] = optstate.x.size();
+        layout.widths[ColumnOptP] = optstate.p.size();
+        layout.widths[ColumnYe] = optstate.ye.size();
+        layout.widths[ColumnS] = optstate.s.size();
+        layout.widths[ColumnJ] = optstate.jb.size() + optstate.jn.size();
+        layout.optdims = { Index(optstate.dims.x), Index(optstate.dims.p), Index(optstate.dims.be), Index(optstate.dims.c) };
+        layout.wnames = equilibrium.namesInputVariables();
+        layout.pnames = equilibrium.namesControlVariablesP();
+        layout.qnames = equilibrium.namesControlVariablesQ();
+        break;
+    }
+
+    layout.initialize();
+    return layout;
+}
+
+/// Return true if the equilibrium data of a chemical state fits in the columns of a chunk with given layout.
+auto isCompatible(Layout const& layout, ChemicalState::Equilibrium const& equilibrium) -> bool
+{
+    auto const& optstate = equilibrium.optimaState();
+    return layout.hasEquilibrium()
+        && equilibrium.w().size() == layout.widths[ColumnW]
+        && equilibrium.c().size() == layout.widths[ColumnC]
+        && optstate.x.size() == layout.widths[ColumnX]
+        && optstate.p.size() == layout.widths[ColumnOptP]
+        && optstate.ye.size() == layout.widths[ColumnYe]
+        && optstate.s.size() == layout.widths[ColumnS]
+        && optstate.jb.size() + optstate.jn.size() == layout.widths[ColumnJ]
+        && equilibrium.namesInputVariables() == layout.wnames
+        && equilibrium.namesControlVariablesP() == layout.pnames
+        && equilibrium.namesControlVariablesQ() == layout.qnames;
+}
+
+/// Return the bytes of a chunk with the chemical states of consecutive cells.
+auto encodeChunk(Layout const& layout, Vec<ChemicalState> const& states, Index ifirst, Index count) -> String
+{
+    String chunk(8 * count * layout.rowsize, '\0');
+    auto doubles = reinterpret_cast<double*>(chunk.data());
+    auto integers = reinterpret_cast<std::int64_t*>(chunk.data());
+
+    auto const& widths = layout.widths;
+
+    for(auto i = 0; i < count; ++i)
+    {
+        auto const& state = states[ifirst + i];
+        auto at = [&](Index column) { return layout.position(count, column, i); };
+
+        doubles[at(ColumnT)] = double(state.temperature());
+        doubles[at(ColumnP)] = double(state.pressure());
+
+        auto const n = state.speciesAmounts();
+        auto const in = at(ColumnN);
+        for(auto k = 0; k < widths[ColumnN]; ++k)
+            doubles[in + k] = double(n[k]);
+
+        if(widths[ColumnU])
+        {
+            VectorXd const u = state.props();
+            errorif(u.size() != widths[ColumnU], "Could not write the chemical state of cell ", ifirst + i, " into the checkpoint file because its serialized chemical properties have a different size than those of the other cells.");
+            std::copy(u.data(), u.data() + u.size(), doubles + at(ColumnU));
+        }
+
+        auto const& equilibrium = state.equilibrium();
+        if(equilibrium.empty())
+            continue;
+
+        errorif(!isCompatible(layout, equilibrium), "Could not write the chemical state of cell ", ifirst + i, " into the checkpoint file because its equilibrium data comes from an equilibrium calculation with different specifications than those of the other cells in the same chunk.");
+
+        auto const& optstate = equilibrium.optimaState();
+        auto copy = [&](auto const& values, Index column)
+        {
+            std::copy(values.data(), values.data() + values.size(), doubles + at(column));
+        };
+
+        integers[at(ColumnEq)] = 1;
+        integers[at(ColumnNb)] = optstate.jb.size();
+        copy(equilibrium.w(), ColumnW);
+        copy(equilibrium.c(), ColumnC);
+        copy(optstate.x, ColumnX);
+        copy(optstate.p, ColumnOptP);
+        copy(optstate.ye, ColumnYe);
+        copy(optstate.s, ColumnS);
+        std::copy(optstate.jb.data(), optstate.jb.data() + optstate.jb.size(), integers + at(ColumnJ));
+        std::copy(optstate.jn.data(), optstate.jn.data() + optstate.jn.size(), integers + at(ColumnJ) + optstate.jb.size());
+    }
+
+    return chunk;
+}
+
+/// Restore the chemical state of a cell from a chunk.
+auto decodeCell(Layout const& layout, Chars chunk, Index count, Index i, ChemicalState& state) -> void
+{
+    auto doubles = reinterpret_cast<double const*>(chunk);
+    auto integers = reinterpret_cast<std::int64_t const*>(chunk);
+
+    auto const& widths = layout.widths;
+    auto at = [&](Index column) { return layout.position(count, column, i); };
+    auto values = [&](Index column) { return ArrayXdConstMap(doubles + at(column), widths[column]); };
+
+    state.setTemperature(doubles[at(ColumnT)]);
+    state.setPressure(doubles[at(ColumnP)]);
+    state.setSpeciesAmounts(values(ColumnN));
+
+    if(widths[ColumnU])
+        state.props().update(values(ColumnU));
+
+    auto& equilibrium = state.equilibrium();
+    if(integers[at(ColumnEq)] == 0)
+    {
+        equilibrium.reset();
+        return;
+    }
+
+    Optima::Dims optdims;
+    optdims.x = layout.optdims[0];
+    optdims.p = layout.optdims[1];
+    optdims.be = layout.optdims[2];
+    optdims.c = layout.optdims[3];
+
+    Optima::State optstate(optdims);
+    optstate.x = values(ColumnX).matrix();
+    optstate.p = values(ColumnOptP).matrix();
+    optstate.ye = values(ColumnYe).matrix();
+    optstate.s = values(ColumnS).matrix();
+
+    auto const nb = integers[at(ColumnNb)];
+    auto const j = integers + at(ColumnJ);
+    optstate.jb.resize(nb);
+    optstate.jn.resize(widths[ColumnJ] - nb);
+    std::copy(j, j + nb, optstate.jb.data());
+    std::copy(j + nb, j + widths[ColumnJ], optstate.jn.data());
+
+    equilibrium.setNamesInputVariables(layout.wnames);
+    equilibrium.setNamesControlVariablesP(layout.pnames);
+    equilibrium.setNamesControlVariablesQ(layout.qnames);
+    equilibrium.setInputVariables(values(ColumnW));
+    equilibrium.setInitialComponentAmounts(values(ColumnC));
+    equilibrium.setOptimaState(optstate);
+}
+
+/// Used to map a file into memory for reading.
+class MappedFile
+{
+public:
+    /// Construct a MappedFile object that maps given file into memory.
+    explicit MappedFile(String const& path)
+    {
+        #ifdef _WIN32
+        file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        errorif(file == INVALID_HANDLE_VALUE, "Could not open the checkpoint file `", path, "`. Ensure the file exists.");
+        LARGE_INTEGER filesize;
+        GetFileSizeEx(file, &filesize);
+        size = filesize.QuadPart;
+        if(size == 0) return;
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        errorif(mapping == nullptr, "Could not map the checkpoint file `", path, "` into memory.");
+        data = static_cast<Chars>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        errorif(data == nullptr, "Could not map the checkpoint file `", path, "` into memory.");
+        #else
+        fd = ::open(path.c_str(), O_RDONLY);
+        errorif(fd < 0, "Could not open the checkpoint file `", path, "`. Ensure the file exists.");
+        struct stat filestat;
+        ::fstat(fd, &filestat);
+        size = filestat.st_size;
+        if(size == 0) return;
+        auto addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        errorif(addr == MAP_FAILED, "Could not map the checkpoint file `", path, "` into memory.");
+        data = static_cast<Chars>(addr);
+        #endif
+    }
+
+    /// Destroy this MappedFile object after unmapping the file.
+    ~MappedFile()
+    {
+        #ifdef _WIN32
+        if(data) UnmapViewOfFile(data);
+        if(mapping) CloseHandle(mapping);
+        if(file != INVALID_HANDLE_VALUE) CloseHandle(file);
+        #else
+        if(data) ::munmap(const_cast<char*>(data), size);
+        if(fd >= 0) ::close(fd);
+        #endif
+    }
+
+    MappedFile(MappedFile const&) = delete;
+    auto operator=(MappedFile const&) -> MappedFile& = delete;
+
+    /// The beginning of the mapped file.
+    Chars data = nullptr;
+
+    /// The size of the mapped file (in bytes).
+    Index size = 0;
+
+private:
+    #ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+    #else
+    int fd = -1;
+    #endif
+};
+
+} // namespace
+
+//=================================================================================================
+//
+// ChemicalStateCheckpointWriter
+//
+//=================================================================================================
+
+struct ChemicalStateCheckpointWriter::Impl
+{
+    /// The path to the checkpoint file.
+    String path;
+
+    /// The chemical system of the chemical states.
+    ChemicalSystem system;
+
+    /// The options for writing the checkpoint file.
+    ChemicalStateCheckpointOptions options;
+
+    /// The checkpoint file being written.
+    std::ofstream file;
+
+    /// The mutex used to protect the checkpoint file when chunks are written from multiple threads.
+    std::mutex mutex;
+
+    /// The distinct layouts of the columns in the chunks written so far.
+    Vec<Layout> layouts;
+
+    /// The chunks written so far.
+    Vec<ChunkEntry> chunks;
+
+    /// The offset of the end of the checkpoint file.
+    std::uint64_t offset = 0;
+
+    /// Construct a ChemicalStateCheckpointWriter::Impl object.
+    Impl(String const& path, ChemicalSystem const& system, ChemicalStateCheckpointOptions const& options)
+    : path(path), system(system), options(options)
+    {
+        errorif(options.chunksize == 0, "Could not create the checkpoint file `", path, "` because the chunk size in ChemicalStateCheckpointOptions is zero.");
+#ifndef REAKTORO_ENABLE_ZSTD
+        errorif(options.compression > 0, "Could not create the checkpoint file `", path, "` with compressed chunks because Reaktoro was built without zstd (with REAKTORO_ENABLE_ZSTD=OFF or zstd not found). Set the compression level in ChemicalStateCheckpointOptions to zero.");
+#endif
+        file.open(path, std::ios::binary | std::ios::trunc);
+        errorif(!file, "Could not create the checkpoint file `", path, "`. Ensure the directory exists and is writable.");
+        file.write(checkpoint_signature, sizeof(checkpoint_signature));
+        write(std::uint32_t(1));
+        write(checkpoint_version);
+        offset = header_size;
+    }
+
+    /// Append the bytes of a value of trivial type to the checkpoint file.
+    template<typename T>
+    auto write(T const& value) -> void
+    {
+        file.write(reinterpret_cast<Chars>(&value), sizeof(T));
+        offset += sizeof(T);
+    }
+
+    /// Append zero bytes to the checkpoint file so that its end is at an offset that is a multiple of 8 bytes.
+    auto pad() -> void
+    {
+        const char zeros[8] = {};
+        const auto padding = (8 - offset % 8) % 8;
+        file.write(zeros, padding);
+        offset += padding;
+    }
+
+    /// Write the chemical states of consecutive cells as a single chunk.
+    auto writeChunk(Vec<ChemicalState> const& states, Index ifirst, Index count) -> void
+    {
+        errorif(ifirst + count > states.size(), "Could not write cells from ", ifirst, " to ", ifirst + count - 1, " into the checkpoint file `", path, "` because there are only ", states.size(), " chemical states.");
+
+        if(count == 0)
+            return;
+
+        // Determine the layout of the columns from the cells in the chunk alone, so that it does not depend on the order in which chunks are written
+        const auto layout = createLayout(system, states, ifirst, count, options.props);
+
+        // Encode and compress the chunk before locking the file, so that this can be done by multiple threads at the same time
+        String chunk = encodeChunk(layout, states, ifirst, count);
+        const auto rawsize = chunk.size();
+
+#ifdef REAKTORO_ENABLE_ZSTD
+        if(options.compression > 0)
+        {
+            String compressed(ZSTD_compressBound(chunk.size()), '\0');
+            const auto size = ZSTD_compress(compressed.data(), compressed.size(), chunk.data(), chunk.size(), options.compression);
+            errorif(ZSTD_isError(size), "Could not compress cells into the checkpoint file `", path, "` due to zstd error: ", ZSTD_getErrorName(size));
+            compressed.resize(size);
+            chunk = std::move(compressed);
+        }
+#endif
+
+        std::lock_guard<std::mutex> lock(mutex);
+        errorif(!file.is_open(), "Could not write cells into the checkpoint file `", path, "` because it has been closed.");
+        const auto ilayout = std::find(layouts.begin(), layouts.end(), layout) - layouts.begin();
+        if(ilayout == layouts.size())
+            layouts.push_back(layout);
+        chunks.push_back({ ifirst, count, offset, chunk.size(), rawsize, std::uint64_t(ilayout) });
+        file.write(chunk.data(), chunk.size());
+        offset += chunk.size();
+        pad();
+        errorif(!file, "Could not write cells into the checkpoint file `", path, "`. Ensure there is enough space in the disk.");
+    }
+
+    /// Complete the checkpoint file after all cells have been written exactly once.
+    auto close() -> void
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if(!file.is_open())
+            return;
+
+        std::sort(chunks.begin(), chunks.end(), [](auto const& l, auto const& r) { return l.ifirst < r.ifirst; });
+
+        Index numcells = 0;
+        for(auto const& chunk : chunks)
+        {
+            errorif(chunk.ifirst < numcells, "Could not complete the checkpoint file `", path, "` because cell ", chunk.ifirst, " has been written more than once.");
+            errorif(chunk.ifirst > numcells, "Could not complete the checkpoint file `", path, "` because cell ", numcells, " has not been written.");
+            numcells += chunk.count;
+        }
+
+        const auto meta = createMetadata(layouts, system, numcells, options).dumpBinary();
+
+        Trailer trailer = {};
+        trailer.tableoffset = offset;
+        trailer.numchunks = chunks.size();
+        for(auto const& chunk : chunks)
+            write(chunk);
+        trailer.metaoffset = offset;
+        trailer.metasize = meta.size();
+        file.write(meta.data(), meta.size());
+        offset += meta.size();
+        pad();
+        std::memcpy(trailer.signature, checkpoint_signature, sizeof(checkpoint_signature));
+        write(trailer);
+
+        file.close();
+        errorif(!file, "Could not complete the checkpoint file `", path, "`. Ensure there is enough space in the disk.");
+    }
+};
+
+ChemicalStateCheckpointWriter::ChemicalStateCheckpointWriter(String const& path, ChemicalSystem const& system, ChemicalStateCheckpointOptions const& options)
+: pimpl(new Impl(path, system, options))
+{}
+
+ChemicalStateCheckpointWriter::~ChemicalStateCheckpointWriter()
+{
+    try { pimpl->close(); } catch(...) {} // destructors must not throw; call close explicitly to be notified of errors
+}
+
+auto ChemicalStateCheckpointWriter::write(Vec<ChemicalState> const& states) -> void
+{
+    for(Index ifirst = 0; ifirst < states.size(); ifirst += pimpl->options.chunksize)
+        pimpl->writeChunk(states, ifirst, std::min(pimpl->options.chunksize, states.size() - ifirst));
+}
+
+auto ChemicalStateCheckpointWriter::writeChunk(Vec<ChemicalState> const& states, Index ifirst, Index count) -> void
+{
+    pimpl->writeChunk(states, ifirst, count);
+}
+
+auto ChemicalStateCheckpointWriter::close() -> void
+{
+    pimpl->close();
+}
+
+//=================================================================================================
+//
+// ChemicalStateCheckpointReader
+//
+//=================================================================================================
+
+struct ChemicalStateCheckpointReader::Impl
+{
+    /// The path to the checkpoint file.
+    String path;
+
+    /// The checkpoint file mapped into memory.
+    MappedFile file;
+
+    /// The chunks in the checkpoint file, sorted by the index of their first cell.
+    Vec<ChunkEntry> chunks;
+
+    /// The distinct layouts of the columns in the chunks.
+    Vec<Layout> layouts;
+
+    /// The flag that indicates whether the chemical properties of the states are stored.
+    bool props = false;
+
+    /// The names of the species of the chemical system used to write the checkpoint file.
+    Strings species;
+
+    /// The number of cells in the checkpoint file.
+    Index numcells = 0;
+
+    /// The flag that indicates whether the chunks are compressed.
+    bool compressed = false;
+
+    /// The mutex used to protect the cached chunk and verified system when cells are read from multiple threads.
+    mutable std::mutex mutex;
+
+    /// The index of the most recently decompressed chunk.
+    mutable Index icached = Index(-1);
+
+    /// The most recently decompressed chunk.
+    mutable SharedPtr<String const> cached;
+
+    /// The id of the most recent chemical system verified to be compatible with the checkpoint file.
+    mutable Index verifiedsystemid = Index(-1);
+
+    /// Construct a ChemicalStateCheckpointReader::Impl object.
+    Impl(String const& path)
+    : path(path), file(path)
+    {
+        auto const data = file.data;
+        auto const size = file.size;
+
+        errorif(size < header_size + sizeof(Trailer) || std::memcmp(data, checkpoint_signature, sizeof(checkpoint_signature)) != 0, "Could not read the checkpoint file `", path, "` because it is not a checkpoint file written by ChemicalStateCheckpointWriter.");
+
+        std::uint32_t byteorder, version;
+        std::memcpy(&byteorder, data + sizeof(checkpoint_signature), sizeof(byteorder));
+        std::memcpy(&version, data + sizeof(checkpoint_signature) + sizeof(byteorder), sizeof(version));
+        errorif(byteorder != 1, "Could not read the checkpoint file `", path, "` because it was written on a machine with different byte order.");
+        errorif(version != checkpoint_version, "Could not read the checkpoint file `", path, "` because it was written with an unsupported version (", version, ") of the checkpoint format.");
+
+        Trailer trailer;
+        std::memcpy(&trailer, data + size - sizeof(Trailer), sizeof(Trailer));
+        errorif(std::memcmp(trailer.signature, checkpoint_signature, sizeof(checkpoint_signature)) != 0, "Could not read the checkpoint file `", path, "` because it is incomplete. Ensure ChemicalStateCheckpointWriter::close was called after all cells were written.");
+        errorif(trailer.tableoffset + trailer.numchunks * sizeof(ChunkEntry) > size || trailer.metaoffset + trailer.metasize > size, "Could not read the checkpoint file `", path, "` because it is corrupted.");
+
+        chunks.resize(trailer.numchunks);
+        std::memcpy(chunks.data(), data + trailer.tableoffset, trailer.numchunks * sizeof(ChunkEntry));
+
+        const auto meta = Data::parseBinary(data + trailer.metaoffset, trailer.metasize);
+        if(meta["Layouts"].isList())
+            for(auto const& entry : meta["Layouts"].asList())
+                layouts.push_back(createLayout(entry));
+        numcells = meta["NumCells"].asInteger();
+        compressed = meta["Compression"].asInteger() > 0;
+        props = meta["Props"].asBoolean();
+#ifndef REAKTORO_ENABLE_ZSTD
+        errorif(compressed, "Could not read the checkpoint file `", path, "` because it has compressed chunks and Reaktoro was built without zstd (with REAKTORO_ENABLE_ZSTD=OFF or zstd not found).");
+#endif
+        for(auto const& name : meta["Species"].asList())
+            species.push_back(name.asString());
+
+        for(auto const& chunk : chunks)
+        {
+            errorif(chunk.offset + chunk.size > trailer.tableoffset, "Could not read the checkpoint file `", path, "` because it is corrupted.");
+            errorif(chunk.ilayout >= layouts.size(), "Could not read the checkpoint file `", path, "` because it is corrupted.");
+            errorif(chunk.rawsize != 8 * chunk.count * layouts[chunk.ilayout].rowsize, "Could not read the checkpoint file `", path, "` because it is corrupted.");
+        }
+    }
+
+    /// Return the index of the chunk containing given cell.
+    auto findChunk(Index icell) const -> Index
+    {
+        errorif(icell >= numcells, "Could not read cell ", icell, " from the checkpoint file `", path, "` because it contains only ", numcells, " cells.");
+        auto it = std::upper_bound(chunks.begin(), chunks.end(), icell, [](Index icell, auto const& chunk) { return icell < chunk.ifirst; });
+        return (it - chunks.begin()) - 1;
+    }
+
+    /// Return the decompressed bytes of a chunk.
+    auto decompress(Index ichunk) const -> SharedPtr<String const>
+    {
+        auto const& chunk = chunks[ichunk];
+        auto raw = std::make_shared<String>(chunk.rawsize, '\0');
+#ifdef REAKTORO_ENABLE_ZSTD
+        const auto size = ZSTD_decompress(raw->data(), raw->size(), file.data + chunk.offset, chunk.size);
+        errorif(ZSTD_isError(size), "Could not decompress cells from the checkpoint file `", path, "` due to zstd error: ", ZSTD_getErrorName(size));
+        errorif(size != chunk.rawsize, "Could not read the checkpoint file `", path, "` because it is corrupted.");
+#endif
+        return raw;
+    }
+
+    /// Return the decompressed bytes of a chunk, reusing those of the most recently decompressed chunk if possible.
+    auto decompressCached(Index ichunk) const -> SharedPtr<String const>
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(icached == ichunk)
+                return cached;
+        }
+
+        auto raw = decompress(ichunk);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        icached = ichunk;
+        cached = raw;
+        return raw;
+    }
+
+    /// Check if the chemical system of a chemical state is compatible with the checkpoint file.
+    auto verify(ChemicalState const& state) const -> void
+    {
+        auto const& system = state.system();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(verifiedsystemid == system.id())
+                return;
+        }
+
+        auto const& syspecies = system.species();
+        auto same = syspecies.size() == species.size();
+        for(auto i = 0; same && i < species.size(); ++i)
+            same = syspecies[i].name() == species[i];
+        errorif(!same, "Could not read cells from the checkpoint file `", path, "` into a chemical state whose chemical system has different species than those in the checkpoint file.");
+
+        std::lock_guard<std::mutex> lock(mutex);
+        verifiedsystemid = system.id();
+    }
+};
+
+ChemicalStateCheckpointReader::ChemicalStateCheckpointReader(String const& path)
+: pimpl(new Impl(path))
+{}
+
+ChemicalStateCheckpointReader::~ChemicalStateCheckpointReader()
+{}
+
+auto ChemicalStateCheckpointReader::numCells() const -> Index
+{
+    return pimpl->numcells;
+}
+
+auto ChemicalStateCheckpointReader::numChunks() const -> Index
+{
+    return pimpl->chunks.size();
+}
+
+auto ChemicalStateCheckpointReader::hasProps() const -> bool
+{
+    return pimpl->props;
+}
+
+auto ChemicalStateCheckpointReader::read(Index icell, ChemicalState& state) const -> void
+{
+    pimpl->verify(state);
+    const auto ichunk = pimpl->findChunk(icell);
+    auto const& chunk = pimpl->chunks[ichunk];
+    auto const& layout = pimpl->layouts[chunk.ilayout];
+    if(pimpl->compressed)
+    {
+        const auto raw = pimpl->decompressCached(ichunk);
+        decodeCell(layout, raw->data(), chunk.count, icell - chunk.ifirst, state);
+    }
+    else decodeCell(layout, pimpl->file.data + chunk.offset, chunk.count, icell - chunk.ifirst, state);
+}
+
+auto ChemicalStateCheckpointReader::read(Vec<ChemicalState>& states) const -> void
+{
+    errorif(states.size() != pimpl->numcells, "Could not read the cells from the checkpoint file `", pimpl->path, "` because it contains ", pimpl->numcells, " cells but ", states.size(), " chemical states were given.");
+    for(auto const& state : states)
+        pimpl->verify(state);
+    for(auto ichunk = 0; ichunk < pimpl->chunks.size(); ++ichunk)
+    {
+        auto const& chunk = pimpl->chunks[ichunk];
+        auto const& layout = pimpl->layouts[chunk.ilayout];
+        SharedPtr<String const> raw;
+        if(pimpl->compressed)
+            raw = pimpl->decompress(ichunk);
+        Chars bytes = pimpl->compressed ? raw->data() : pimpl->file.data + chunk.offset;
+        for(auto i = 0; i < chunk.count; ++i)
+            decodeCell(layout, bytes, chunk.count, i, states[chunk.ifirst + i]);
+    }
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,137 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class ChemicalState;
+class ChemicalSystem;
+
+/// The options for writing the chemical states of many cells into a checkpoint file.
+struct ChemicalStateCheckpointOptions
+{
+    /// The number of cells in each chunk written by ChemicalStateCheckpointWriter::write.
+    Index chunksize = 4096;
+
+    /// The zstd compression level of the chunks, with zero meaning no compression.
+    /// Compression requires Reaktoro to be built with `REAKTORO_ENABLE_ZSTD` and zstd found.
+    /// Uncompressed chunks are read directly from the memory-mapped checkpoint
+    /// file, whereas compressed chunks are decompressed when first needed.
+    int compression = 0;
+
+    /// The flag that indicates whether the chemical properties of the states are also stored.
+    /// This avoids recomputing the chemical properties of the states when they are restored,
+    /// at the expense of much larger checkpoint files.
+    bool props = false;
+};
+
+/// Used to write the chemical states of many cells (e.g., in a reactive transport simulation) into a checkpoint file.
+/// The chemical states are stored column by column in chunks of consecutive
+/// cells: temperatures, pressures, species amounts, the data needed to warm
+/// start the next equilibrium calculation (i.e., the values of *w*, *c*,
+/// *p*, *q* and the Optima::State object), and optionally the chemical
+/// properties. Chunks can be written in any order and from multiple threads
+/// at the same time with ChemicalStateCheckpointWriter::writeChunk, since
+/// they are encoded and compressed before the file is locked for writing.
+/// Each chunk stores its equilibrium data in columns sized by its own cells,
+/// so the cells with equilibrium data in the same chunk must come from
+/// equilibrium calculations with the same specifications, whereas cells in
+/// different chunks need not (e.g., a chunk with no equilibrium data can be
+/// written before or after one with it). The checkpoint file
+/// is complete only after ChemicalStateCheckpointWriter::close is called,
+/// which is also done when the writer is destroyed.
+/// @see ChemicalStateCheckpointReader
+class ChemicalStateCheckpointWriter
+{
+public:
+    /// Construct a ChemicalStateCheckpointWriter object that creates a checkpoint file.
+    /// @param path The path, including file name, to the checkpoint file.
+    /// @param system The chemical system of the chemical states to be written.
+    /// @param options The options for writing the checkpoint file.
+    ChemicalStateCheckpointWriter(String const& path, ChemicalSystem const& system, ChemicalStateCheckpointOptions const& options = {});
+
+    /// Destroy this ChemicalStateCheckpointWriter object after closing the checkpoint file.
+    ~ChemicalStateCheckpointWriter();
+
+    /// Write the chemical states of all cells in chunks of ChemicalStateCheckpointOptions::chunksize cells.
+    /// @param states The chemical states of the cells.
+    auto write(Vec<ChemicalState> const& states) -> void;
+
+    /// Write the chemical states of consecutive cells as a single chunk (thread-safe).
+    /// @param states The chemical states of the cells.
+    /// @param ifirst The index of the first cell in the chunk.
+    /// @param count The number of cells in the chunk.
+    auto writeChunk(Vec<ChemicalState> const& states, Index ifirst, Index count) -> void;
+
+    /// Complete the checkpoint file after all cells have been written exactly once.
+    auto close() -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+/// Used to restore the chemical states of many cells from a checkpoint file written by ChemicalStateCheckpointWriter.
+/// The checkpoint file is memory-mapped and the chemical state of a cell is
+/// restored only when requested. The data of uncompressed chunks is copied
+/// directly from the mapped file into the chemical state, whereas
+/// compressed chunks are decompressed once and kept for subsequent cells in
+/// the same chunk. All methods can be called from multiple threads.
+/// @see ChemicalStateCheckpointWriter
+class ChemicalStateCheckpointReader
+{
+public:
+    /// Construct a ChemicalStateCheckpointReader object that opens a checkpoint file.
+    /// @param path The path, including file name, to the checkpoint file.
+    explicit ChemicalStateCheckpointReader(String const& path);
+
+    /// Destroy this ChemicalStateCheckpointReader object after unmapping the checkpoint file.
+    ~ChemicalStateCheckpointReader();
+
+    /// Return the number of cells in the checkpoint file.
+    auto numCells() const -> Index;
+
+    /// Return the number of chunks in the checkpoint file.
+    auto numChunks() const -> Index;
+
+    /// Return true if the chemical properties of the states are stored in the checkpoint file.
+    auto hasProps() const -> bool;
+
+    /// Restore the chemical state of a cell.
+    /// The chemical properties of the state are also restored if they are
+    /// stored in the checkpoint file. Otherwise, they are left unchanged.
+    /// @param icell The index of the cell.
+    /// @param[out] state The chemical state of the cell, with the same chemical system used to write the checkpoint file.
+    auto read(Index icell, ChemicalState& state) const -> void;
+
+    /// Restore the chemical states of all cells, decompressing each chunk only once.
+    /// @param[out] states The chemical states of the cells, with the same chemical system used to write the checkpoint file.
+    auto read(Vec<ChemicalState>& states) const -> void;
+
+private:
+    struct Impl;
+
+    Ptr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,72 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright © 2014-2024 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+from reaktoro import *
+import numpy as npy
+
+
+def testChemicalStateCheckpoint(tmp_path):
+    db = SupcrtDatabase("supcrtbl")
+
+    system = ChemicalSystem(db,
+        AqueousPhase("H2O(aq) H+ OH- Na+ Cl- Ca+2 HCO3- CO3-2 CO2(aq)"),
+        MineralPhase("Calcite"),
+    )
+
+    solver = EquilibriumSolver(system)
+
+    states = []
+    for i in range(10):
+        state = ChemicalState(system)
+        state.temperature(25.0 + i, "celsius")
+        state.set("H2O(aq)", 1.0, "kg")
+        state.set("Na+", 0.1 * (i + 1), "mol")
+        state.set("Cl-", 0.1 * (i + 1), "mol")
+        state.set("Calcite", 1.0, "mol")
+        solver.solve(state)
+        states.append(state)
+
+    path = str(tmp_path / "states.rkchk")
+
+    options = ChemicalStateCheckpointOptions()
+    options.chunksize = 4
+    options.compression = 3
+
+    writer = ChemicalStateCheckpointWriter(path, system, options)
+    writer.write(states)
+    writer.close()
+
+    reader = ChemicalStateCheckpointReader(path)
+
+    assert reader.numCells() == 10
+    assert reader.numChunks() == 3
+    assert reader.hasProps() == False
+
+    restored = [ChemicalState(system) for i in range(10)]
+    reader.read(restored)
+
+    for actual, expected in zip(restored, states):
+        assert actual.temperature() == expected.temperature()
+        assert npy.all(actual.speciesAmounts() == expected.speciesAmounts())
+        assert npy.all(actual.equilibrium().elementChemicalPotentials() == expected.equilibrium().elementChemicalPotentials())
+
+    state = ChemicalState(system)
+    reader.read(7, state)
+
+    assert state.temperature() == states[7].temperature()
+    assert npy.all(state.equilibrium().speciesStabilities() == states[7].equilibrium().speciesStabilities())
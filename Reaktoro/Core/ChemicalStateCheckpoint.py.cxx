@@ -0,0 +1,60 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateCheckpoint.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+using namespace Reaktoro;
+
+void exportChemicalStateCheckpoint(py::module& m)
+{
+    py::class_<ChemicalStateCheckpointOptions>(m, "ChemicalStateCheckpointOptions")
+        .def(py::init<>())
+        .def_readwrite("chunksize", &ChemicalStateCheckpointOptions::chunksize)
+        .def_readwrite("compression", &ChemicalStateCheckpointOptions::compression)
+        .def_readwrite("props", &ChemicalStateCheckpointOptions::props)
+        ;
+
+    py::class_<ChemicalStateCheckpointWriter>(m, "ChemicalStateCheckpointWriter")
+        .def(py::init<String const&, ChemicalSystem const&, ChemicalStateCheckpointOptions const&>(), "path"_a, "system"_a, "options"_a = ChemicalStateCheckpointOptions{})
+        .def("write", &ChemicalStateCheckpointWriter::write)
+        .def("writeChunk", &ChemicalStateCheckpointWriter::writeChunk)
+        .def("close", &ChemicalStateCheckpointWriter::close)
+        ;
+
+    // The chemical states in a Python list are restored one by one, since the list would otherwise be converted into a copy of type Vec<ChemicalState>
+    auto readAll = [](ChemicalStateCheckpointReader const& self, py::list states)
+    {
+        errorif(states.size() != self.numCells(), "Could not read the cells from the checkpoint file because it contains ", self.numCells(), " cells but ", states.size(), " chemical states were given.");
+        for(auto i = 0; i < states.size(); ++i)
+            self.read(i, states[i].cast<ChemicalState&>());
+    };
+
+    py::class_<ChemicalStateCheckpointReader>(m, "ChemicalStateCheckpointReader")
+        .def(py::init<String const&>())
+        .def("numCells", &ChemicalStateCheckpointReader::numCells)
+        .def("numChunks", &ChemicalStateCheckpointReader::numChunks)
+        .def("hasProps", &ChemicalStateCheckpointReader::hasProps)
+        .def("read", py::overload_cast<Index, ChemicalState&>(&ChemicalStateCheckpointReader::read, py::const_))
+        .def("read", readAll)
+        ;
+}
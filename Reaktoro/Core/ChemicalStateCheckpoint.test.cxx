@@ -0,0 +1,264 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <cstdio>
+
+// Optima includes
+#include <Optima/State.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalStateCheckpoint.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+using namespace Reaktoro;
+
+namespace test {
+
+/// Return a mock ChemicalSystem object for test reasons.
+auto createChemicalSystem() -> ChemicalSystem;
+
+} // namespace test
+
+namespace {
+
+/// Return the chemical states of many cells, with equilibrium data in every other cell.
+auto createStates(ChemicalSystem const& system, Index numcells) -> Vec<ChemicalState>
+{
+    const auto Nn = system.species().size();
+    const auto Nb = system.elements().size() + 1;
+
+    Vec<ChemicalState> states(numcells, ChemicalState(system));
+    for(auto i = 0; i < numcells; ++i)
+    {
+        auto& state = states[i];
+        state.setTemperature(300.0 + i);
+        state.setPressure(1.0e5 * (1 + i));
+        state.setSpeciesAmounts(ArrayXd::LinSpaced(Nn, i + 1.0, i + 2.0));
+        state.props().update(state);
+
+        if(i % 2)
+            continue;
+
+        Optima::Dims optdims;
+        optdims.x = Nn;
+        optdims.p = 1;
+        optdims.be = Nb;
+        optdims.c = Nb + 2;
+
+        Optima::State optstate(optdims);
+        optstate.x = VectorXd::LinSpaced(Nn, 1.0, 2.0) * i;
+        optstate.p.fill(i + 0.5);
+        optstate.ye.fill(-1.0 * i);
+        optstate.s.fill(1e-3 * i);
+        optstate.jb = ArrayXl::LinSpaced(Nb, 0, Nb - 1);
+        optstate.jn = ArrayXl::LinSpaced(Nn - Nb, Nb, Nn - 1);
+
+        auto& equilibrium = state.equilibrium();
+        equilibrium.setOptimaState(optstate);
+        equilibrium.setNamesInputVariables({ "T", "pH" });
+        equilibrium.setNamesControlVariablesP({ "[H+]" });
+        equilibrium.setInputVariables(ArrayXd::Constant(2, 1.0 * i));
+        equilibrium.setInitialComponentAmounts(ArrayXd::Constant(Nb, 2.0 * i));
+    }
+
+    return states;
+}
+
+/// Check if a restored chemical state is equal to the original one.
+auto checkRestoredState(ChemicalState const& actual, ChemicalState const& expected, bool props)
+{
+    CHECK( actual.temperature() == expected.temperature() );
+    CHECK( actual.pressure() == expected.pressure() );
+    CHECK( (actual.speciesAmounts() == expected.speciesAmounts()).all() );
+
+    if(props)
+        CHECK( VectorXd(actual.props()) == VectorXd(expected.props()) );
+
+    auto const& aeq = actual.equilibrium();
+    auto const& eeq = expected.equilibrium();
+
+    REQUIRE( aeq.empty() == eeq.empty() );
+
+    if(eeq.empty())
+        return;
+
+    CHECK( aeq.namesInputVariables() == eeq.namesInputVariables() );
+    CHECK( aeq.namesControlVariablesP() == eeq.namesControlVariablesP() );
+    CHECK( aeq.namesControlVariablesQ() == eeq.namesControlVariablesQ() );
+    CHECK( (aeq.w() == eeq.w()).all() );
+    CHECK( (aeq.c() == eeq.c()).all() );
+    CHECK( (aeq.p() == eeq.p()).all() );
+    CHECK( aeq.optimaState().x == eeq.optimaState().x );
+    CHECK( aeq.optimaState().ye == eeq.optimaState().ye );
+    CHECK( aeq.optimaState().s == eeq.optimaState().s );
+    CHECK( (aeq.indicesPrimarySpecies() == eeq.indicesPrimarySpecies()).all() );
+    CHECK( (aeq.indicesSecondarySpecies() == eeq.indicesSecondarySpecies()).all() );
+}
+
+} // namespace
+
+TEST_CASE("Testing ChemicalStateCheckpoint classes", "[ChemicalStateCheckpoint]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    const auto numcells = 50;
+
+    const auto states = createStates(system, numcells);
+
+    const auto path = "temporary.rkchk";
+
+    SECTION("Testing checkpoint files with uncompressed chunks")
+    {
+        ChemicalStateCheckpointOptions options;
+        options.chunksize = 7;
+
+        ChemicalStateCheckpointWriter writer(path, system, options);
+        writer.write(states);
+        writer.close();
+
+        ChemicalStateCheckpointReader reader(path);
+
+        CHECK( reader.numCells() == numcells );
+        CHECK( reader.numChunks() == 8 );
+        CHECK( reader.hasProps() == false );
+
+        ChemicalState state(system);
+        for(auto i : { 49, 0, 13, 14, 1, 48 })
+        {
+            reader.read(i, state);
+            checkRestoredState(state, states[i], false);
+        }
+
+        Vec<ChemicalState> restored(numcells, ChemicalState(system));
+        reader.read(restored);
+        for(auto i = 0; i < numcells; ++i)
+            checkRestoredState(restored[i], states[i], false);
+
+        CHECK_THROWS( reader.read(numcells, state) );
+    }
+
+    SECTION("Testing checkpoint files with compressed chunks and chemical properties")
+    {
+        ChemicalStateCheckpointOptions options;
+        options.chunksize = 16;
+        options.compression = 3;
+        options.props = true;
+
+#ifndef REAKTORO_ENABLE_ZSTD
+        CHECK_THROWS( ChemicalStateCheckpointWriter(path, system, options) ); // compression requires zstd
+        options.compression = 0;
+#endif
+
+        ChemicalStateCheckpointWriter writer(path, system, options);
+        writer.write(states);
+        writer.close();
+
+        ChemicalStateCheckpointReader reader(path);
+
+        CHECK( reader.numCells() == numcells );
+        CHECK( reader.numChunks() == 4 );
+        CHECK( reader.hasProps() == true );
+
+        ChemicalState state(system);
+        for(auto i : { 17, 16, 3, 49, 18 })
+        {
+            reader.read(i, state);
+            checkRestoredState(state, states[i], true);
+        }
+
+        Vec<ChemicalState> restored(numcells, ChemicalState(system));
+        reader.read(restored);
+        for(auto i = 0; i < numcells; ++i)
+            checkRestoredState(restored[i], states[i], true);
+    }
+
+    SECTION("Testing checkpoint files with chunks written out of order")
+    {
+        ChemicalStateCheckpointWriter writer(path, system);
+        writer.writeChunk(states, 30, 20);
+        writer.writeChunk(states, 0, 10);
+        writer.writeChunk(states, 10, 20);
+        writer.close();
+
+        ChemicalStateCheckpointReader reader(path);
+
+        CHECK( reader.numCells() == numcells );
+        CHECK( reader.numChunks() == 3 );
+
+        Vec<ChemicalState> restored(numcells, ChemicalState(system));
+        reader.read(restored);
+        for(auto i = 0; i < numcells; ++i)
+            checkRestoredState(restored[i], states[i], false);
+    }
+
+    SECTION("Testing checkpoint files with chunks of different layouts")
+    {
+        auto others = states;
+        for(auto i = 40; i < numcells; i += 2)
+            others[i].equilibrium().setNamesInputVariables({ "T", "P" });
+
+        for(auto reversed : { false, true })
+        {
+            ChemicalStateCheckpointWriter writer(path, system);
+            if(reversed)
+            {
+                writer.writeChunk(others, 40, 10); // equilibrium data with other specifications
+                writer.writeChunk(others, 2, 38);
+                writer.writeChunk(others, 0, 1);
+                writer.writeChunk(others, 1, 1); // no equilibrium data
+            }
+            else
+            {
+                writer.writeChunk(others, 1, 1); // no equilibrium data
+                writer.writeChunk(others, 0, 1);
+                writer.writeChunk(others, 2, 38);
+                writer.writeChunk(others, 40, 10); // equilibrium data with other specifications
+            }
+            writer.close();
+
+            ChemicalStateCheckpointReader reader(path);
+
+            CHECK( reader.numChunks() == 4 );
+
+            Vec<ChemicalState> restored(numcells, ChemicalState(system));
+            reader.read(restored);
+            for(auto i = 0; i < numcells; ++i)
+                checkRestoredState(restored[i], others[i], false);
+        }
+
+        ChemicalStateCheckpointWriter writer(path, system);
+        CHECK_THROWS( writer.writeChunk(others, 30, 20) ); // equilibrium data with different specifications in the same chunk
+    }
+
+    SECTION("Testing errors in checkpoint files")
+    {
+        ChemicalStateCheckpointWriter writer(path, system);
+        writer.writeChunk(states, 0, 10);
+        writer.writeChunk(states, 20, 10);
+
+        CHECK_THROWS( ChemicalStateCheckpointReader(path) ); // incomplete file
+        CHECK_THROWS( writer.writeChunk(states, 45, 10) ); // there are only 50 chemical states
+        CHECK_THROWS( writer.close() ); // cells 10 to 19 have not been written
+    }
+
+    std::remove(path);
+}
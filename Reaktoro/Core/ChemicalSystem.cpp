@@ -18,12 +18,18 @@
 #include "ChemicalSystem.hpp"
 
 // C++ includes
+#include <fstream>
 #include <iostream>
+#include <sstream>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Core/Data.hpp>
 #include <Reaktoro/Core/Utils.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsBatch.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsInterpolator.hpp>
+#include <Reaktoro/Serialization/Core.hpp>
 
 namespace Reaktoro {
 namespace detail {
@@ -75,6 +81,12 @@ struct ChemicalSystem::Impl
     /// The stoichiometric matrix of the reactions in the system with respect to its species.
     MatrixXd stoichiometric_matrix;
 
+    /// The evaluator of the standard thermodynamic properties of all species in the system.
+    StandardThermoPropsBatch standard_thermo_props_batch;
+
+    /// The interpolator of the standard thermodynamic properties of all species in the system (empty if interpolation is not used).
+    StandardThermoPropsInterpolator standard_thermo_props_interpolator;
+
     /// Construct a default ChemicalSystem::Impl object.
     Impl()
     {}
@@ -101,7 +113,7 @@ struct ChemicalSystem::Impl
     Impl(Database const& database0, PhaseList const& phases0, ReactionList const& reactions0, SurfaceList const& surfaces0)
     : database(database0), phases(phases0), reactions(reactions0), surfaces(surfaces0)
     {
-        errorif(database.species().empty(), "Expecting at least one species in the Database object provided when creating a ChemicalSystem object.");
+        errorif(database.speciesInfo().empty(), "Expecting at least one species in the Database object provided when creating a ChemicalSystem object.");
         errorif(phases.empty(), "Expecting at least one phase when creating a ChemicalSystem object, but none was provided.");
 
         species = phases.species();
@@ -113,6 +125,8 @@ struct ChemicalSystem::Impl
         detail::fixDuplicateNames(species);
         detail::fixDuplicateNames(reactions);
         detail::fixDuplicateNames(surfaces);
+
+        standard_thermo_props_batch = StandardThermoPropsBatch(species);
     }
 
     /// Construct a ChemicalSystem::Impl object with given database, phases, reactions, and surfaces.
@@ -256,6 +270,85 @@ auto ChemicalSystem::stoichiometricMatrix() const -> MatrixXdConstRef
     return pimpl->stoichiometric_matrix;
 }
 
+auto ChemicalSystem::standardThermoPropsBatch() const -> StandardThermoPropsBatch const&
+{
+    return pimpl->standard_thermo_props_batch;
+}
+
+auto ChemicalSystem::withStandardThermoPropsInterpolation(StandardThermoPropsInterpolatorOptions const& options) const -> ChemicalSystem
+{
+    ChemicalSystem copy = withoutStandardThermoPropsInterpolation();
+    copy.pimpl->standard_thermo_props_interpolator = StandardThermoPropsInterpolator(pimpl->standard_thermo_props_batch, options);
+    return copy;
+}
+
+auto ChemicalSystem::withoutStandardThermoPropsInterpolation() const -> ChemicalSystem
+{
+    ChemicalSystem copy;
+    *copy.pimpl = *pimpl;
+    copy.pimpl->id = detail::computeChemicalSystemID(); // the duplicate system computes different standard properties
+    copy.pimpl->standard_thermo_props_interpolator = StandardThermoPropsInterpolator();
+    return copy;
+}
+
+auto ChemicalSystem::standardThermoPropsInterpolator() const -> StandardThermoPropsInterpolator const&
+{
+    return pimpl->standard_thermo_props_interpolator;
+}
+
+auto ChemicalSystem::dumpBinary() const -> String
+{
+    Data doc = *this;
+    return doc.dumpBinary();
+}
+
+auto ChemicalSystem::saveBinary(String const& path) const -> void
+{
+    Data doc = *this;
+    doc.saveBinary(path);
+}
+
+auto ChemicalSystem::fromBinary(String const& bytes, Map<String, ActivityModelGenerator> const& models) -> ChemicalSystem
+{
+    auto const doc = Data::parseBinary(bytes);
+
+    // Ensure activity models are given for the phases whose activity models in the snapshot are not the default ideal ones
+    for(auto const& phase : doc.required("Phases").asList())
+    {
+        auto const& name = phase.required("Name").asString();
+        errorif(!phase.required("DefaultActivityModel").asBoolean() && models.find(name) == models.end(),
+            "Could not restore ChemicalSystem object from binary snapshot because phase ", name, " had a non-ideal activity model when the snapshot was created. "
+            "Provide its activity model in the `models` argument of ChemicalSystem::fromBinary, as activity models cannot be stored in binary snapshots.");
+    }
+
+    auto system = doc.as<ChemicalSystem>();
+
+    if(models.empty())
+        return system;
+
+    for(auto const& [name, model] : models)
+        errorif(system.phases().findWithName(name) >= system.phases().size(), "Could not restore ChemicalSystem object from binary snapshot with an activity model for phase ", name, " because there is no phase with this name in the snapshot.");
+
+    // Replace the ideal activity models in the restored phases by the given activity models
+    PhaseList phases;
+    for(auto phase : system.phases())
+    {
+        auto const it = models.find(phase.name());
+        phases.append(it == models.end() ? phase : phase.withActivityModel(it->second(phase.species())));
+    }
+
+    return ChemicalSystem(system.database(), phases);
+}
+
+auto ChemicalSystem::fromBinaryFile(String const& path, Map<String, ActivityModelGenerator> const& models) -> ChemicalSystem
+{
+    std::ifstream file(path, std::ios::binary);
+    errorif(!file.is_open(), "Could not open file `", path, "` with a binary snapshot of a ChemicalSystem object. Ensure the given path is correct.");
+    std::stringstream bytes;
+    bytes << file.rdbuf();
+    return fromBinary(bytes.str(), models);
+}
+
 auto operator<<(std::ostream& out, ChemicalSystem const& system) -> std::ostream&
 {
     // auto const& phases = system.phases();
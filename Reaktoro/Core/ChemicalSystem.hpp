@@ -41,6 +41,9 @@ namespace Reaktoro {
 
 // Forward declarations
 class ChemicalSystem;
+class StandardThermoPropsBatch;
+class StandardThermoPropsInterpolator;
+struct StandardThermoPropsInterpolatorOptions;
 
 template<typename T, typename... Ts>
 constexpr auto _arePhaseReactionOrSurfaceConvertible()
@@ -155,6 +158,59 @@ public:
     /// is given by the coefficient of the *i*th species in the *j*th reaction.
     auto stoichiometricMatrix() const -> MatrixXdConstRef;
 
+    /// Return the evaluator of the standard thermodynamic properties of all species in the system.
+    /// Species with formation reactions are evaluated in topological order of
+    /// their formation dependencies across all phases, so that each reactant
+    /// species is evaluated only once per temperature and pressure.
+    auto standardThermoPropsBatch() const -> StandardThermoPropsBatch const&;
+
+    /// Return a duplicate of this ChemicalSystem object that evaluates the standard thermodynamic properties of all species by interpolation over a temperature-pressure domain.
+    /// The standard thermodynamic properties of all species are tabulated
+    /// at once with the exact models and subsequently interpolated whenever
+    /// temperature and pressure are inside the domain (otherwise the exact
+    /// models are used). Use @ref standardThermoPropsInterpolator to assess
+    /// the accuracy of the interpolation. This ChemicalSystem object, and any
+    /// object that shares it, remains unaffected.
+    auto withStandardThermoPropsInterpolation(StandardThermoPropsInterpolatorOptions const& options) const -> ChemicalSystem;
+
+    /// Return a duplicate of this ChemicalSystem object that evaluates the standard thermodynamic properties of all species with their exact models.
+    auto withoutStandardThermoPropsInterpolation() const -> ChemicalSystem;
+
+    /// Return the interpolator of the standard thermodynamic properties of all species in the system (empty if interpolation is not used).
+    auto standardThermoPropsInterpolator() const -> StandardThermoPropsInterpolator const&;
+
+    /// Return a compact binary snapshot of the chemical system.
+    /// The snapshot contains the elements, species and phases of the system,
+    /// the parameters of the standard thermodynamic models of the species (and
+    /// of the reactant species in their formation reactions), and the formula
+    /// matrix of the system. It is meant to be created once (e.g., in a master
+    /// process) and restored with ChemicalSystem::fromBinary in a few
+    /// milliseconds (e.g., in hundreds of worker processes), without parsing a
+    /// database again. Activity models cannot be stored in a snapshot because
+    /// they are functions, so they are set again when the snapshot is
+    /// restored. The phases whose activity models are not the default ideal
+    /// ones are marked in the snapshot, so that ChemicalSystem::fromBinary
+    /// can require their activity models to be given. Chemical systems with reactions or surfaces, and species with
+    /// thermodynamic models without parameters (e.g., species from PHREEQC and
+    /// ThermoFun databases), cannot be stored in a snapshot.
+    auto dumpBinary() const -> String;
+
+    /// Save a compact binary snapshot of the chemical system into a file (see ChemicalSystem::dumpBinary).
+    /// @param path The path, including file name, to the binary snapshot file.
+    auto saveBinary(String const& path) const -> void;
+
+    /// Return a ChemicalSystem object restored from a binary snapshot produced by ChemicalSystem::dumpBinary.
+    /// @param bytes The bytes of the binary snapshot.
+    /// @param models The activity models of the phases, by phase name. The phases not in `models` use the same ideal activity models as in AqueousPhase, GaseousPhase, MineralPhase, etc.
+    /// @warning An exception is thrown if a phase whose activity model was not the default ideal one when the snapshot was created is not in `models`.
+    static auto fromBinary(String const& bytes, Map<String, ActivityModelGenerator> const& models = {}) -> ChemicalSystem;
+
+    /// Return a ChemicalSystem object restored from a binary snapshot file produced by ChemicalSystem::saveBinary.
+    /// @param path The path, including file name, to the binary snapshot file.
+    /// @param models The activity models of the phases, by phase name. The phases not in `models` use the same ideal activity models as in AqueousPhase, GaseousPhase, MineralPhase, etc.
+    /// @warning An exception is thrown if a phase whose activity model was not the default ideal one when the snapshot was created is not in `models`.
+    static auto fromBinaryFile(String const& path, Map<String, ActivityModelGenerator> const& models = {}) -> ChemicalSystem;
+
 private:
     struct Impl;
 
@@ -21,6 +21,7 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsInterpolator.hpp>
 using namespace Reaktoro;
 
 namespace rkt4py {
@@ -96,5 +97,12 @@ void exportChemicalSystem(py::module& m)
         .def("formulaMatrixElements", &ChemicalSystem::formulaMatrixElements, return_internal_ref)
         .def("formulaMatrixCharge", &ChemicalSystem::formulaMatrixCharge, return_internal_ref)
         .def("stoichiometricMatrix", &ChemicalSystem::stoichiometricMatrix, return_internal_ref)
+        .def("withStandardThermoPropsInterpolation", &ChemicalSystem::withStandardThermoPropsInterpolation)
+        .def("withoutStandardThermoPropsInterpolation", &ChemicalSystem::withoutStandardThermoPropsInterpolation)
+        .def("standardThermoPropsInterpolator", &ChemicalSystem::standardThermoPropsInterpolator, return_internal_ref)
+        .def("dumpBinary", [](ChemicalSystem const& self) { return py::bytes(self.dumpBinary()); })
+        .def("saveBinary", &ChemicalSystem::saveBinary)
+        .def_static("fromBinary", &ChemicalSystem::fromBinary, py::arg("bytes"), py::arg("models") = Map<String, ActivityModelGenerator>{})
+        .def_static("fromBinaryFile", &ChemicalSystem::fromBinaryFile, py::arg("path"), py::arg("models") = Map<String, ActivityModelGenerator>{})
         ;
 }
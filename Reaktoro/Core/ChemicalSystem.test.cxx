@@ -310,4 +310,86 @@ TEST_CASE("Testing ChemicalSystem class", "[ChemicalSystem]")
     CHECK( system.species().size() == 14 );
     CHECK( system.phases().size() == 6 );
     CHECK( system.reactions().size() == 4 );
+
+    //-------------------------------------------------------------------------
+    // TESTING METHODS: ChemicalSystem::dumpBinary and ChemicalSystem::fromBinary
+    //-------------------------------------------------------------------------
+    CHECK_THROWS( test::createChemicalSystem().dumpBinary() ); // reactions and surfaces cannot be stored in binary snapshots
+    CHECK_THROWS( ChemicalSystem(db, solution).dumpBinary() ); // species with standard thermodynamic models without parameters cannot be stored in binary snapshots
+
+    auto Caion = Species("Ca++(aq)").withStandardGibbsEnergy(-552.8e3);
+    auto CO3ion = Species("CO3--(aq)").withStandardGibbsEnergy(-527.9e3);
+
+    Database snapshotdb;
+    snapshotdb.addSpecies( Species("H2O(aq)").withStandardGibbsEnergy(-237.2e3) );
+    snapshotdb.addSpecies( Species("H+(aq)").withStandardGibbsEnergy(0.0) );
+    snapshotdb.addSpecies( Species("OH-(aq)").withStandardGibbsEnergy(-157.3e3) );
+    snapshotdb.addSpecies( Caion );
+    snapshotdb.addSpecies( CO3ion );
+    snapshotdb.addSpecies( Species("CO2(g)").withStandardGibbsEnergy(-394.4e3) );
+    snapshotdb.addSpecies( Species("H2O(g)").withStandardGibbsEnergy(-228.6e3) );
+    snapshotdb.addSpecies( Species("CaCO3(s)").withFormationReaction(
+        FormationReaction()
+            .withReactants({{ Caion, 1.0 }, { CO3ion, 1.0 }})
+            .withEquilibriumConstant(8.48)) );
+
+    system = ChemicalSystem(snapshotdb,
+        AqueousPhase("H2O(aq) H+(aq) OH-(aq) CO3--(aq)"), // Ca++(aq) is not in the system, but it is a reactant in the formation reaction of CaCO3(s)
+        GaseousPhase("CO2(g) H2O(g)"),
+        MineralPhase("CaCO3(s)"));
+
+    auto const bytes = system.dumpBinary();
+
+    auto checkRestoredSystem = [&](ChemicalSystem const& restored)
+    {
+        CHECK( restored.elements().size() == system.elements().size() );
+        for(auto i = 0; i < system.elements().size(); ++i)
+            CHECK( restored.element(i).symbol() == system.element(i).symbol() );
+
+        CHECK( restored.species().size() == system.species().size() );
+        for(auto i = 0; i < system.species().size(); ++i)
+        {
+            CHECK( restored.species(i).name() == system.species(i).name() );
+            CHECK( restored.species(i).props(300.0, 1.0e5).G0 == system.species(i).props(300.0, 1.0e5).G0 );
+        }
+
+        CHECK( restored.phases().size() == system.phases().size() );
+        for(auto i = 0; i < system.phases().size(); ++i)
+        {
+            CHECK( restored.phase(i).name() == system.phase(i).name() );
+            CHECK( restored.phase(i).stateOfMatter() == system.phase(i).stateOfMatter() );
+            CHECK( restored.phase(i).species().size() == system.phase(i).species().size() );
+        }
+
+        CHECK( restored.formulaMatrix() == system.formulaMatrix() );
+    };
+
+    checkRestoredSystem(ChemicalSystem::fromBinary(bytes));
+
+    ActivityModelGenerator aqueousmodel = [](SpeciesList const& species) { return ActivityModel(test::activityModelAqueous); };
+
+    auto restored = ChemicalSystem::fromBinary(bytes, {{ "AqueousPhase", aqueousmodel }});
+
+    checkRestoredSystem(restored);
+
+    // Phases with non-ideal activity models in the snapshot must be given activity models when restored
+    auto const nonidealsystem = ChemicalSystem(snapshotdb,
+        AqueousPhase("H2O(aq) H+(aq) OH-(aq) CO3--(aq)").set(aqueousmodel),
+        GaseousPhase("CO2(g) H2O(g)"),
+        MineralPhase("CaCO3(s)"));
+
+    auto const nonidealbytes = nonidealsystem.dumpBinary();
+
+    CHECK_THROWS( ChemicalSystem::fromBinary(nonidealbytes) );
+    CHECK_NOTHROW( ChemicalSystem::fromBinary(nonidealbytes, {{ "AqueousPhase", aqueousmodel }}) );
+
+    real T = 300.0;
+    real P = 1.0e5;
+    ArrayXr x = ArrayXr::Ones(restored.phase(0).species().size());
+    auto aprops = ActivityProps::create(x.size());
+    restored.phase(0).activityModel()(aprops, {T, P, x});
+
+    CHECK( aprops.Gx == Approx(0.4 * log(P/T)) ); // check the given activity model is used in the restored aqueous phase
+
+    CHECK_THROWS( ChemicalSystem::fromBinary(bytes, {{ "SomePhase", aqueousmodel }}) );
 }
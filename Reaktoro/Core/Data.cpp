@@ -18,10 +18,15 @@
 #include "Data.hpp"
 
 // C++ includes
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <iterator>
+#include <sstream>
 
 // Third-party includes
 #include <nlohmann/json.hpp>
+#include <yaml-cpp/eventhandler.h>
 #include <yaml-cpp/yaml.h>
 using yaml = YAML::Node;
 using json = nlohmann::json;
@@ -70,132 +75,301 @@ bool isNumber(String const& str, double& result)
 }
 
 // ==========================================================================================
-// METHODS TO CONVERT YAML TO DATA
+// METHODS TO PARSE YAML AND JSON DIRECTLY INTO DATA
 // ==========================================================================================
 
-auto convertYamlToData(yaml const& obj) -> Data;
-
-auto convertYamlScalarToData(yaml const& obj) -> Data
+/// Used to build a Data object from the events of a streaming YAML or JSON parser.
+/// The Data object is built directly, without an intermediate YAML or JSON document tree.
+/// Empty lists and dictionaries result in null Data objects, as when converting such trees.
+struct DataBuilder
 {
-    auto const& word = obj.Scalar();
-    auto number = 0.0;
-    if(isNumber(word, number))
-        return number;
-    else {
-        if(word == "true" || word == "True")
-            return true;
-        if(word == "false" || word == "False")
-            return false;
-        return word;
+    /// A list or dictionary whose children are still being parsed.
+    struct Frame
+    {
+        /// True if the container is a dictionary.
+        bool isdict = false;
+
+        /// The anchor of the container if it is referred to by aliases (YAML only).
+        YAML::anchor_t anchor = YAML::NullAnchor;
+
+        /// The key of the next child if the container is a dictionary.
+        String key;
+
+        /// True if the next event in the dictionary is its key (YAML only).
+        bool expecting_key = true;
+
+        /// The children parsed so far if the container is a list.
+        Vec<Data> items;
+
+        /// The key-value pairs parsed so far if the container is a dictionary.
+        Vec<Pair<String, Data>> members;
+    };
+
+    /// The containers whose children are still being parsed, from the outermost to the innermost.
+    Vec<Frame> frames;
+
+    /// The parsed Data object.
+    Data root;
+
+    /// The parsed values referred to by YAML aliases.
+    Map<YAML::anchor_t, Data> anchors;
+
+    /// True if the keys of dictionaries are sorted as in nlohmann::json objects.
+    bool sortkeys = false;
+
+    /// Return `i` or `f` if the key of the next value ends with `|i` or `|f`, and zero otherwise.
+    auto suffix() const -> char
+    {
+        if(frames.empty() || !frames.back().isdict)
+            return 0;
+        auto const& key = frames.back().key;
+        if(key.size() > 2 && key[key.size() - 2] == '|' && (key.back() == 'i' || key.back() == 'f'))
+            return key.back();
+        return 0;
     }
-}
 
-auto convertYamlSequenceToData(yaml const& obj) -> Data
-{
-    Data result;
-    for(auto i = 0; i < obj.size(); ++i)
-        result.add(convertYamlToData(obj[i]));
-    return result;
-}
+    /// Return the key of the next value.
+    auto key() const -> String const&
+    {
+        return frames.back().key;
+    }
 
-auto convertYamlMapToData(yaml const& obj) -> Data
-{
-    Data result;
-    for(auto const& child : obj)
+    /// Set the key of the next value in the innermost dictionary.
+    auto setKey(String key) -> void
     {
-        const auto key = child.first.as<String>();
-        if(key.size() > 2 && key.substr(key.size() - 2) == "|i")
-        {
-            int num = 0;
-            try { num = child.second.as<int>(); }
-            catch(...) errorif(true, "Expecting an integer value for key-value pair with key `", key, "` because it ends with `|i`.");
-            result.add(key, num);
-        }
-        else if(key.size() > 2 && key.substr(key.size() - 2) == "|f")
+        frames.back().key = std::move(key);
+        frames.back().expecting_key = false;
+    }
+
+    /// Add a parsed value to the innermost container (or set it as the parsed Data object).
+    auto add(Data value, YAML::anchor_t anchor = YAML::NullAnchor) -> void
+    {
+        if(anchor != YAML::NullAnchor)
+            anchors[anchor] = value;
+        if(frames.empty())
+            root = std::move(value);
+        else if(frames.back().isdict)
         {
-            double num = 0;
-            try { num = child.second.as<double>(); }
-            catch(...) errorif(true, "Expecting a floating-point value for key-value pair with key `", key, "` because it ends with `|f`.");
-            result.add(key, num);
+            frames.back().members.emplace_back(std::move(frames.back().key), std::move(value));
+            frames.back().expecting_key = true;
         }
-        else result.add(key, convertYamlToData(child.second));
+        else frames.back().items.push_back(std::move(value));
     }
-    return result;
-}
 
-auto convertYamlToData(yaml const& obj) -> Data
-{
-    switch(obj.Type())
+    /// Start parsing the children of a list or dictionary.
+    auto begin(bool isdict, YAML::anchor_t anchor = YAML::NullAnchor) -> void
     {
-        case YAML::NodeType::Scalar: return convertYamlScalarToData(obj);
-        case YAML::NodeType::Sequence: return convertYamlSequenceToData(obj);
-        case YAML::NodeType::Map: return convertYamlMapToData(obj);
-        case YAML::NodeType::Null: return {};
-        case YAML::NodeType::Undefined: return {};
+        errorif(suffix(), "Expecting a number for key-value pair with key `", key(), "` because it ends with `|", suffix(), "`.");
+        frames.emplace_back();
+        frames.back().isdict = isdict;
+        frames.back().anchor = anchor;
     }
 
-    errorif(true, "Could not convert YAML node to Data object: ", YAML::Dump(obj));
+    /// Finish parsing the children of the innermost list or dictionary.
+    auto end() -> void
+    {
+        auto frame = std::move(frames.back());
+        frames.pop_back();
 
-    return {};
-}
+        Data value;
 
-// ==========================================================================================
-// METHODS TO CONVERT JSON TO DATA
-// ==========================================================================================
+        if(frame.isdict && frame.members.size())
+        {
+            if(sortkeys)
+                std::stable_sort(frame.members.begin(), frame.members.end(), [](auto const& l, auto const& r) { return l.first < r.first; });
+            Dict<String, Data> dict;
+            dict.reserve(frame.members.size());
+            for(auto& [key, child] : frame.members)
+                dict.insert_or_assign(std::move(key), std::move(child));
+            value = Data(std::move(dict));
+        }
+        else if(!frame.isdict && frame.items.size())
+            value = Data(std::move(frame.items));
 
-auto convertJsonToData(json const& obj) -> Data;
+        add(std::move(value), frame.anchor);
+    }
+};
 
-auto convertJsonObjectToData(json const& obj) -> Data
+/// Used to parse YAML into a Data object with the event-based parser of yaml-cpp.
+struct YamlDataHandler : YAML::EventHandler
 {
-    Data result;
-    for(auto const& [key, value] : obj.items())
+    /// The builder of the parsed Data object.
+    DataBuilder builder;
+
+    auto OnDocumentStart(YAML::Mark const& mark) -> void override {}
+
+    auto OnDocumentEnd() -> void override {}
+
+    auto OnNull(YAML::Mark const& mark, YAML::anchor_t anchor) -> void override
+    {
+        errorif(expectingKey(), "Could not parse YAML because of a null key at line ", mark.line + 1, ".");
+        errorif(builder.suffix(), "Expecting a number for key-value pair with key `", builder.key(), "` because it ends with `|", builder.suffix(), "`.");
+        builder.add({}, anchor);
+    }
+
+    auto OnAlias(YAML::Mark const& mark, YAML::anchor_t anchor) -> void override
     {
-        if(key.size() > 2 && key.substr(key.length() - 2) == "|i")
+        auto const it = builder.anchors.find(anchor);
+        errorif(it == builder.anchors.end(), "Could not parse YAML because of an alias to an unknown anchor at line ", mark.line + 1, ".");
+        if(expectingKey())
+            builder.setKey(it->second.asString());
+        else builder.add(it->second);
+    }
+
+    auto OnScalar(YAML::Mark const& mark, std::string const& tag, YAML::anchor_t anchor, std::string const& value) -> void override
+    {
+        if(expectingKey())
+        {
+            if(anchor != YAML::NullAnchor)
+                builder.anchors[anchor] = value;
+            builder.setKey(value);
+            return;
+        }
+        if(builder.suffix() == 'i')
         {
             int num = 0;
-            try { num = value.get<int>(); }
-            catch(...) errorif(true, "Expecting an integer value for key-value pair with key `", key, "` because it ends with `|i`.");
-            result.add(key, num);
+            try { num = YAML::Node(value).as<int>(); }
+            catch(...) errorif(true, "Expecting an integer value for key-value pair with key `", builder.key(), "` because it ends with `|i`.");
+            builder.add(num, anchor);
         }
-        else if(key.size() > 2 && key.substr(key.length() - 2) == "|f")
+        else if(builder.suffix() == 'f')
         {
             double num = 0;
-            try { num = value.get<double>(); }
-            catch(...) errorif(true, "Expecting a floating-point value for key-value pair with key `", key, "` because it ends with `|f`.");
-            result.add(key, num);
+            try { num = YAML::Node(value).as<double>(); }
+            catch(...) errorif(true, "Expecting a floating-point value for key-value pair with key `", builder.key(), "` because it ends with `|f`.");
+            builder.add(num, anchor);
         }
-        else result.add(key, convertJsonToData(value));
+        else builder.add(convertYamlScalarToData(value), anchor);
     }
-    return result;
-}
 
-auto convertJsonArrayToData(json const& obj) -> Data
+    auto OnSequenceStart(YAML::Mark const& mark, std::string const& tag, YAML::anchor_t anchor, YAML::EmitterStyle::value style) -> void override
+    {
+        errorif(expectingKey(), "Could not parse YAML because of a list used as key at line ", mark.line + 1, ".");
+        builder.begin(false, anchor);
+    }
+
+    auto OnSequenceEnd() -> void override
+    {
+        builder.end();
+    }
+
+    auto OnMapStart(YAML::Mark const& mark, std::string const& tag, YAML::anchor_t anchor, YAML::EmitterStyle::value style) -> void override
+    {
+        errorif(expectingKey(), "Could not parse YAML because of a dictionary used as key at line ", mark.line + 1, ".");
+        builder.begin(true, anchor);
+    }
+
+    auto OnMapEnd() -> void override
+    {
+        builder.end();
+    }
+
+    /// Return true if the next event is the key of a key-value pair in a dictionary.
+    auto expectingKey() const -> bool
+    {
+        return builder.frames.size() && builder.frames.back().isdict && builder.frames.back().expecting_key;
+    }
+
+    /// Convert a YAML scalar into a number, boolean, or string.
+    static auto convertYamlScalarToData(String const& word) -> Data
+    {
+        auto number = 0.0;
+        if(isNumber(word, number))
+            return number;
+        if(word == "true" || word == "True")
+            return true;
+        if(word == "false" || word == "False")
+            return false;
+        return word;
+    }
+};
+
+/// Return the Data object parsed from given YAML input stream.
+auto parseYamlIntoData(std::istream& stream) -> Data
 {
-    Data result;
-    for(auto const& value : obj)
-        result.add(convertJsonToData(value));
-    return result;
+    YamlDataHandler handler;
+    YAML::Parser parser(stream);
+    parser.HandleNextDocument(handler); // only the first document is parsed, as in YAML::Load
+    return std::move(handler.builder.root);
 }
 
-auto convertJsonToData(json const& obj) -> Data
+/// Used to parse JSON into a Data object with the SAX interface of nlohmann::json.
+struct JsonDataHandler : nlohmann::json_sax<json>
 {
-    switch(obj.type())
+    /// The builder of the parsed Data object.
+    DataBuilder builder;
+
+    /// Construct a JsonDataHandler object.
+    JsonDataHandler()
     {
-        case json::value_t::null: return {};
-        case json::value_t::object: return convertJsonObjectToData(obj);
-        case json::value_t::array: return convertJsonArrayToData(obj);
-        case json::value_t::string: return obj.get<String>();
-        case json::value_t::boolean: return obj.get<bool>();
-        case json::value_t::number_integer: return obj.get<int>();
-        case json::value_t::number_unsigned: return obj.get<int>();
-        case json::value_t::number_float: return obj.get<double>();
-        case json::value_t::binary: break;
-        case json::value_t::discarded: break;
+        builder.sortkeys = true; // for consistency with the key order in nlohmann::json objects
     }
 
-    errorif(true, "Could not convert JSON node to Data object: ", obj.dump());
+    /// Add a parsed number to the Data object, converting it if its key ends with `|i` or `|f`.
+    template<typename T>
+    auto addNumber(T value) -> bool
+    {
+        if(builder.suffix() == 'i') builder.add(static_cast<int>(value));
+        else if(builder.suffix() == 'f') builder.add(static_cast<double>(value));
+        else if constexpr(std::is_floating_point_v<T>) builder.add(static_cast<double>(value));
+        else builder.add(static_cast<int>(value));
+        return true;
+    }
 
-    return {};
+    /// Ensure the value of the next key-value pair is not expected to be a number.
+    auto checkNotNumber() const -> void
+    {
+        errorif(builder.suffix() == 'i', "Expecting an integer value for key-value pair with key `", builder.key(), "` because it ends with `|i`.");
+        errorif(builder.suffix() == 'f', "Expecting a floating-point value for key-value pair with key `", builder.key(), "` because it ends with `|f`.");
+    }
+
+    auto null() -> bool override { checkNotNumber(); builder.add({}); return true; }
+
+    auto boolean(bool value) -> bool override
+    {
+        if(builder.suffix()) return addNumber(value);
+        builder.add(value);
+        return true;
+    }
+
+    auto number_integer(number_integer_t value) -> bool override { return addNumber(value); }
+
+    auto number_unsigned(number_unsigned_t value) -> bool override { return addNumber(value); }
+
+    auto number_float(number_float_t value, string_t const& str) -> bool override { return addNumber(value); }
+
+    auto string(string_t& value) -> bool override { checkNotNumber(); builder.add(std::move(value)); return true; }
+
+    auto binary(binary_t& value) -> bool override
+    {
+        errorif(true, "Could not convert JSON binary values to Data objects.");
+        return false;
+    }
+
+    auto start_object(std::size_t) -> bool override { builder.begin(true); return true; }
+
+    auto key(string_t& value) -> bool override { builder.setKey(std::move(value)); return true; }
+
+    auto end_object() -> bool override { builder.end(); return true; }
+
+    auto start_array(std::size_t) -> bool override { builder.begin(false); return true; }
+
+    auto end_array() -> bool override { builder.end(); return true; }
+
+    auto parse_error(std::size_t, std::string const&, nlohmann::detail::exception const& ex) -> bool override
+    {
+        errorif(true, "Could not parse JSON. ", ex.what());
+        return false;
+    }
+};
+
+/// Return the Data object parsed from given JSON input, which can be a string or an input stream.
+template<typename Input>
+auto parseJsonIntoData(Input&& input) -> Data
+{
+    JsonDataHandler handler;
+    json::sax_parse(std::forward<Input>(input), &handler);
+    return std::move(handler.builder.root);
 }
 
 // ==========================================================================================
@@ -249,6 +423,196 @@ auto convertDataToJson(Data const& data) -> json
     return convertDataTo<json>(data);
 }
 
+// ==========================================================================================
+// METHODS TO CONVERT DATA TO AND FROM BINARY FORMAT
+// ==========================================================================================
+
+// The binary format of a Data object consists of:
+//   1. the 8-byte signature `binary_signature`;
+//   2. a 32-bit integer with value 1 written in the byte order of the machine that created it;
+//   3. a string table with all dictionary keys and string values (each stored only once);
+//   4. the tree of values, in depth-first order, with every string replaced by its index in the string table.
+// Sizes and string indices are unsigned 32-bit integers and integer values are signed 32-bit integers.
+
+/// The signature at the beginning of every Data object in binary format.
+const char binary_signature[8] = { 'R', 'K', 'T', 'D', 'A', 'T', 'A', '1' };
+
+/// The tags identifying the type of each value in the binary format.
+enum class BinaryTag : std::uint8_t { Null, Boolean, Integer, Float, String, List, Dict };
+
+/// Used to convert a Data object into binary format.
+struct BinaryWriter
+{
+    /// The index of each string in the string table.
+    Map<String, std::uint32_t> indices;
+
+    /// The strings in the string table in the order they were first found.
+    Vec<String const*> strings;
+
+    /// The bytes of the tree of values.
+    String tree;
+
+    /// Append the bytes of a value of trivial type to the given buffer.
+    template<typename T>
+    static auto write(String& buffer, T const& value) -> void
+    {
+        buffer.append(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    /// Append the index of a string in the string table to the tree of values.
+    auto writeString(String const& str) -> void
+    {
+        auto [it, inserted] = indices.emplace(str, strings.size());
+        if(inserted)
+            strings.push_back(&it->first);
+        write(tree, it->second);
+    }
+
+    /// Append a value and its children to the tree of values.
+    auto writeData(Data const& data) -> void
+    {
+        if(data.isNull()) { write(tree, BinaryTag::Null); }
+        else if(data.isBoolean()) { write(tree, BinaryTag::Boolean); write(tree, std::uint8_t(data.asBoolean())); }
+        else if(data.isInteger()) { write(tree, BinaryTag::Integer); write(tree, std::int32_t(data.asInteger())); }
+        else if(data.isFloat()) { write(tree, BinaryTag::Float); write(tree, data.asFloat()); }
+        else if(data.isString()) { write(tree, BinaryTag::String); writeString(data.asString()); }
+        else if(data.isList())
+        {
+            auto const& list = data.asList();
+            write(tree, BinaryTag::List);
+            write(tree, std::uint32_t(list.size()));
+            for(auto const& value : list)
+                writeData(value);
+        }
+        else if(data.isDict())
+        {
+            auto const& dict = data.asDict();
+            write(tree, BinaryTag::Dict);
+            write(tree, std::uint32_t(dict.size()));
+            for(auto const& [key, value] : dict)
+            {
+                writeString(key);
+                writeData(value);
+            }
+        }
+        else errorif(true, "Could not convert this Data object to binary format as the Data object is not in a valid state.");
+    }
+
+    /// Return the bytes of the binary format of a Data object.
+    auto dump(Data const& data) -> String
+    {
+        writeData(data);
+        String result;
+        result.append(binary_signature, sizeof(binary_signature));
+        write(result, std::uint32_t(1));
+        write(result, std::uint32_t(strings.size()));
+        for(auto const* str : strings)
+        {
+            write(result, std::uint32_t(str->size()));
+            result.append(*str);
+        }
+        result.append(tree);
+        return result;
+    }
+};
+
+/// Used to convert bytes in binary format into a Data object.
+struct BinaryReader
+{
+    /// The current position in the bytes being read.
+    char const* pos = nullptr;
+
+    /// The end of the bytes being read.
+    char const* end = nullptr;
+
+    /// The strings in the string table.
+    Vec<String> strings;
+
+    /// Read a value of trivial type from the current position.
+    template<typename T>
+    auto read() -> T
+    {
+        errorif(Index(end - pos) < sizeof(T), "Could not parse binary Data because it ended unexpectedly. Ensure it has not been truncated.");
+        T value;
+        std::memcpy(&value, pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    /// Read a number of items, each with at least `minbytes` bytes, ensuring the remaining bytes can hold them (before any allocation).
+    auto readSize(Index minbytes) -> std::uint32_t
+    {
+        auto const size = read<std::uint32_t>();
+        errorif(Index(end - pos) / minbytes < size, "Could not parse binary Data because it ended unexpectedly. Ensure it has not been truncated.");
+        return size;
+    }
+
+    /// Read the index of a string in the string table and return the string.
+    auto readString() -> String const&
+    {
+        auto const i = read<std::uint32_t>();
+        errorif(i >= strings.size(), "Could not parse binary Data because it refers to an inexistent string with index ", i, ".");
+        return strings[i];
+    }
+
+    /// Read a value and its children from the tree of values.
+    auto readData() -> Data
+    {
+        switch(read<BinaryTag>())
+        {
+            case BinaryTag::Null: return {};
+            case BinaryTag::Boolean: return bool(read<std::uint8_t>());
+            case BinaryTag::Integer: return int(read<std::int32_t>());
+            case BinaryTag::Float: return read<double>();
+            case BinaryTag::String: return readString();
+            case BinaryTag::List:
+            {
+                auto const size = readSize(sizeof(BinaryTag)); // each value has at least its tag
+                Vec<Data> list;
+                list.reserve(size);
+                for(auto i = 0; i < size; ++i)
+                    list.push_back(readData());
+                return Data(std::move(list));
+            }
+            case BinaryTag::Dict:
+            {
+                auto const size = readSize(sizeof(std::uint32_t) + sizeof(BinaryTag)); // each entry has at least a key index and a value tag
+                Dict<String, Data> dict;
+                dict.reserve(size);
+                for(auto i = 0; i < size; ++i)
+                {
+                    auto const& key = readString();
+                    dict.insert_or_assign(key, readData());
+                }
+                return Data(std::move(dict));
+            }
+        }
+        errorif(true, "Could not parse binary Data because it contains an unknown value type.");
+        return {};
+    }
+
+    /// Return the Data object in given bytes in binary format.
+    auto parse(char const* begin, char const* end) -> Data
+    {
+        this->pos = begin;
+        this->end = end;
+        errorif(!Data::isBinary(begin, end - begin), "Could not parse binary Data because it does not start with the expected signature.");
+        pos += sizeof(binary_signature);
+        errorif(read<std::uint32_t>() != 1, "Could not parse binary Data created on a machine with different byte order.");
+        strings.resize(readSize(sizeof(std::uint32_t))); // each string has at least its size
+        for(auto& str : strings)
+        {
+            auto const size = read<std::uint32_t>();
+            errorif(Index(end - pos) < size, "Could not parse binary Data because it ended unexpectedly. Ensure it has not been truncated.");
+            str.assign(pos, size);
+            pos += size;
+        }
+        auto data = readData();
+        errorif(pos != end, "Could not parse binary Data because there are unexpected bytes after its end.");
+        return data;
+    }
+};
+
 // ==========================================================================================
 // CLASS TO ENSURE A COMMON LOCALE IS KEPT WHEN DEALING WITH YAML AND JSON
 // ==========================================================================================
@@ -281,6 +645,16 @@ Data::Data()
 {
 }
 
+Data::Data(Vec<Data>&& list)
+: tree(std::move(list))
+{
+}
+
+Data::Data(Dict<String, Data>&& dict)
+: tree(std::move(dict))
+{
+}
+
 auto Data::parse(Chars text) -> Data
 {
     return parseYaml(text);
@@ -299,39 +673,39 @@ auto Data::parse(std::istream& text) -> Data
 auto Data::parseYaml(Chars text) -> Data
 {
     const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
-    return convertYamlToData(YAML::Load(text));
+    std::istringstream stream(text);
+    return parseYamlIntoData(stream);
 }
 
 auto Data::parseYaml(String const& text) -> Data
 {
     const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
-    return convertYamlToData(YAML::Load(text));
+    std::istringstream stream(text);
+    return parseYamlIntoData(stream);
 }
 
 auto Data::parseYaml(std::istream& text) -> Data
 {
     const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
-    return convertYamlToData(YAML::Load(text));
+    return parseYamlIntoData(text);
 }
 
 auto Data::parseJson(Chars text) -> Data
 {
     const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
-    return convertJsonToData(nlohmann::json::parse(text));
+    return parseJsonIntoData(text);
 }
 
 auto Data::parseJson(String const& text) -> Data
 {
     const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
-    return convertJsonToData(nlohmann::json::parse(text));
+    return parseJsonIntoData(text);
 }
 
 auto Data::parseJson(std::istream& text) -> Data
 {
     const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
-    nlohmann::json obj;
-    text >> obj;
-    return convertJsonToData(obj);
+    return parseJsonIntoData(text);
 }
 
 auto Data::load(String const& path) -> Data
@@ -349,22 +723,52 @@ auto Data::loadYaml(String const& path) -> Data
 {
     std::ifstream f(path);
     errorif(f.fail(), "There was an error finding your YAML file at `", path, "`. Ensure this file exists and prefer global path strings such as \"/home/mary/data.json\" in Linux and macOS or \"C:\\\\Users\\\\Mary\\\\data.json\" in Windows.");
-    yaml doc;
-    try { doc = YAML::Load(f); }
+    const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
+    Data doc;
+    try { doc = parseYamlIntoData(f); }
     catch(std::exception e)
         errorif(true, "There was an error parsing your YAML file at `", path, "`. Ensure this file is properly formatted (e.g., inconsistent indentation). Try using some online YAML validator to find the error. More details about the error below:\n\n", e.what());
-    return convertYamlToData(doc);
+    return doc;
 }
 
 auto Data::loadJson(String const& path) -> Data
 {
     std::ifstream f(path);
     errorif(f.fail(), "There was an error finding your JSON file at `", path, "`. Ensure this file exists and prefer global path strings such as \"/home/mary/data.json\" in Linux and macOS or \"C:\\\\Users\\\\Mary\\\\data.json\" in Windows.");
-    json doc;
-    try { doc = json::parse(f); }
+    const auto guard = ChangeLocale("C"); // Change locale to C before parsing (this is reset at destruction of `guard`).
+    Data doc;
+    try { doc = parseJsonIntoData(f); }
     catch(std::exception e)
         errorif(true, "There was an error parsing your JSON file at `", path, "`. Ensure this file is properly formatted (e.g., missing closing brackets). Try using some online JSON validator to find the error. More details about the error below:\n\n", e.what());
-    return convertJsonToData(doc);
+    return doc;
+}
+
+auto Data::parseBinary(Chars bytes, Index size) -> Data
+{
+    return BinaryReader().parse(bytes, bytes + size);
+}
+
+auto Data::parseBinary(String const& bytes) -> Data
+{
+    return parseBinary(bytes.data(), bytes.size());
+}
+
+auto Data::parseBinary(std::istream& bytes) -> Data
+{
+    const String contents(std::istreambuf_iterator<char>(bytes), {});
+    return parseBinary(contents);
+}
+
+auto Data::loadBinary(String const& path) -> Data
+{
+    std::ifstream f(path, std::ios::binary);
+    errorif(f.fail(), "There was an error finding your binary file at `", path, "`. Ensure this file exists and prefer global path strings such as \"/home/mary/data.bin\" in Linux and macOS or \"C:\\\\Users\\\\Mary\\\\data.bin\" in Windows.");
+    return parseBinary(f);
+}
+
+auto Data::isBinary(Chars bytes, Index size) -> bool
+{
+    return size >= sizeof(binary_signature) && std::memcmp(bytes, binary_signature, sizeof(binary_signature)) == 0;
 }
 
 auto Data::asString() const -> String const&
@@ -576,7 +980,7 @@ auto Data::exists(String const& key) const -> bool
 {
     if(!isDict())
         return false;
-    auto obj = asDict();
+    auto const& obj = asDict();
     return obj.find(key) != obj.end();
 }
 
@@ -597,6 +1001,11 @@ auto Data::dumpJson() const -> String
     return doc.dump(2); // indent=2
 }
 
+auto Data::dumpBinary() const -> String
+{
+    return BinaryWriter().dump(*this);
+}
+
 auto Data::save(String const& filepath) const -> void
 {
     saveYaml(filepath);
@@ -616,6 +1025,13 @@ auto Data::saveJson(String const& filepath) const -> void
     file.close();
 }
 
+auto Data::saveBinary(String const& filepath) const -> void
+{
+    std::ofstream file(filepath, std::ios::binary);
+    file << dumpBinary();
+    file.close();
+}
+
 auto Data::repr() const -> String
 {
     return dumpYaml();
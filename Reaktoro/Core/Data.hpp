@@ -32,6 +32,12 @@ public:
     /// Construct a default Data instance with null value.
     Data();
 
+    /// Construct a Data object by moving a list of Data objects into it.
+    Data(Vec<Data>&& list);
+
+    /// Construct a Data object by moving a dictionary of Data objects into it.
+    Data(Dict<String, Data>&& dict);
+
     /// Return a Data object by parsing an YAML formatted string.
     static auto parse(Chars text) -> Data;
 
@@ -59,6 +65,17 @@ public:
     /// Return a Data object by parsing a JSON formatted string.
     static auto parseJson(std::istream& text) -> Data;
 
+    /// Return a Data object by parsing bytes in the binary format produced by Data::dumpBinary.
+    /// @param bytes The pointer to the first byte.
+    /// @param size The number of bytes.
+    static auto parseBinary(Chars bytes, Index size) -> Data;
+
+    /// Return a Data object by parsing bytes in the binary format produced by Data::dumpBinary.
+    static auto parseBinary(String const& bytes) -> Data;
+
+    /// Return a Data object by parsing bytes in the binary format produced by Data::dumpBinary.
+    static auto parseBinary(std::istream& bytes) -> Data;
+
     /// Return a Data object by parsing either an YAML or JSON formatted file at a given path.
     /// Ensure `path` terminates with extensions `.yml`, `.yaml`, or `.json`, which are used to identify the file format.
     static auto load(String const& path) -> Data;
@@ -69,6 +86,12 @@ public:
     /// Return a Data object by parsing a JSON formatted file at a given path.
     static auto loadJson(String const& path) -> Data;
 
+    /// Return a Data object by parsing a file in the binary format produced by Data::saveBinary.
+    static auto loadBinary(String const& path) -> Data;
+
+    /// Return true if given bytes start with the signature of the binary format produced by Data::dumpBinary.
+    static auto isBinary(Chars bytes, Index size) -> bool;
+
     /// Return this Data object as a boolean value.
     auto asBoolean() const -> bool;
 
@@ -187,6 +210,13 @@ public:
     /// Return a JSON formatted string representing the state of this Data object.
     auto dumpJson() const -> String;
 
+    /// Return a compact binary representation of the state of this Data object.
+    /// This binary format stores every dictionary key and string value only
+    /// once, and numbers in their native representation, so that it can be
+    /// parsed much faster than YAML and JSON. It is meant for caching data
+    /// (e.g., precompiled databases) on machines with the same byte order.
+    auto dumpBinary() const -> String;
+
     /// Save the state of this Data object into a YAML formatted file.
     auto save(String const& filepath) const -> void;
 
@@ -196,6 +226,9 @@ public:
     /// Save the state of this Data object into a JSON formatted file.
     auto saveJson(String const& filepath) const -> void;
 
+    /// Save the state of this Data object into a file in binary format (see Data::dumpBinary).
+    auto saveBinary(String const& filepath) const -> void;
+
     /// Return a YAML formatted string representing the state of this Data object.
     auto repr() const -> String;
 
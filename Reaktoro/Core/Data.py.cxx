@@ -49,9 +49,11 @@ void exportData(py::module& m)
         .def_static("parseJson", py::overload_cast<Chars>(&Data::parseJson), "Return a Data object by parsing a JSON formatted string.")
         .def_static("parseJson", py::overload_cast<String const&>(&Data::parseJson), "Return a Data object by parsing a JSON formatted string.")
         .def_static("parseJson", py::overload_cast<std::istream&>(&Data::parseJson), "Return a Data object by parsing a JSON formatted string.")
+        .def_static("parseBinary", py::overload_cast<String const&>(&Data::parseBinary), "Return a Data object by parsing bytes in the binary format produced by Data::dumpBinary.")
         .def_static("load", &Data::load, "Return a Data object by parsing either an YAML or JSON formatted file at a given path.")
         .def_static("loadYaml", &Data::loadYaml, "Return a Data object by parsing an YAML formatted file at a given path.")
         .def_static("loadJson", &Data::loadJson, "Return a Data object by parsing a JSON formatted file at a given path.")
+        .def_static("loadBinary", &Data::loadBinary, "Return a Data object by parsing a file in the binary format produced by Data::saveBinary.")
         .def("asBoolean", &Data::asBoolean, "Return this Data object as a boolean value.")
         .def("asString", &Data::asString, return_internal_ref, "Return this Data object as a string.")
         .def("asInteger", &Data::asInteger, "Return this Data object as an integer number.")
@@ -83,9 +85,11 @@ void exportData(py::module& m)
         .def("dump", &Data::dump, "Return a YAML formatted string representing the state of this Data object.")
         .def("dumpYaml", &Data::dumpYaml, "Return a YAML formatted string representing the state of this Data object.")
         .def("dumpJson", &Data::dumpJson, "Return a JSON formatted string representing the state of this Data object.")
+        .def("dumpBinary", [](Data const& self) { return py::bytes(self.dumpBinary()); }, "Return a compact binary representation of the state of this Data object.")
         .def("save", &Data::save, "Save the state of this Data object into a YAML formatted file.")
         .def("saveYaml", &Data::saveYaml, "Save the state of this Data object into a YAML formatted file.")
         .def("saveJson", &Data::saveJson, "Save the state of this Data object into a JSON formatted file.")
+        .def("saveBinary", &Data::saveBinary, "Save the state of this Data object into a file in binary format.")
         .def("repr", &Data::repr, "Return a YAML formatted string representing the state of this Data object.")
         .def("__str__", &Data::repr, "Return a YAML formatted string representing the state of this Data object.")
         .def("__repr__", &Data::repr, "Return a YAML formatted string representing the state of this Data object.")
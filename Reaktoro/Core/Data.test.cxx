@@ -18,6 +18,9 @@
 // Catch includes
 #include <catch2/catch.hpp>
 
+// C++ includes
+#include <cstring>
+
 // YAML/JSON includes
 #include <nlohmann/json.hpp>
 #include <yaml-cpp/yaml.h>
@@ -661,6 +664,57 @@ TEST_CASE("Testing Data class", "[Data]")
         CHECK_THROWS( data["Species"].with("Name", "Calcite") );
     }
 
+    SECTION("Checking special cases in the construction of Data objects using YAML and JSON formatted strings")
+    {
+        const Data fromyaml = Data::parseYaml(R"(
+            Defaults: &defaults
+              Tmax: 500.0
+              Tags: [mineral, carbonate]
+            Calcite: *defaults
+            Count|i: 3
+            Scale|f: 2
+            EmptyList: []
+            EmptyDict: {}
+            Nothing: ~
+            Ignored: 1
+            Ignored: 2
+        )");
+
+        CHECK( fromyaml["Calcite"]["Tmax"].asFloat() == 500.0 );
+        CHECK( fromyaml["Calcite"]["Tags"][1].asString() == "carbonate" );
+        CHECK( fromyaml["Count|i"].isInteger() );
+        CHECK( fromyaml["Count|i"].asInteger() == 3 );
+        CHECK( fromyaml["Scale|f"].isFloat() );
+        CHECK( fromyaml["Scale|f"].asFloat() == 2.0 );
+        CHECK( fromyaml["EmptyList"].isNull() );
+        CHECK( fromyaml["EmptyDict"].isNull() );
+        CHECK( fromyaml["Nothing"].isNull() );
+        CHECK( fromyaml["Ignored"].asFloat() == 2.0 );
+
+        CHECK_THROWS( Data::parseYaml("Count|i: 3.5") );
+        CHECK_THROWS( Data::parseYaml("Count|i: [1, 2]") );
+
+        const Data fromjson = Data::parseJson(R"({ "b": 1, "a": [1.5, "x", true, null], "c|f": 3, "d|i": 4.0, "e": {}, "b": 2 })");
+
+        // The keys of JSON objects are sorted, as in nlohmann::json objects
+        Strings keys;
+        for(auto const& [key, value] : fromjson.asDict())
+            keys.push_back(key);
+        CHECK( keys == Strings{"a", "b", "c|f", "d|i", "e"} );
+        CHECK( fromjson["a"][0].asFloat() == 1.5 );
+        CHECK( fromjson["a"][1].asString() == "x" );
+        CHECK( fromjson["a"][2].asBoolean() == true );
+        CHECK( fromjson["a"][3].isNull() );
+        CHECK( fromjson["b"].asInteger() == 2 );
+        CHECK( fromjson["c|f"].isFloat() );
+        CHECK( fromjson["d|i"].isInteger() );
+        CHECK( fromjson["d|i"].asInteger() == 4 );
+        CHECK( fromjson["e"].isNull() );
+
+        CHECK_THROWS( Data::parseJson(R"({ "a|i": "x" })") );
+        CHECK_THROWS( Data::parseJson(R"({ "a": [1, 2 })") );
+    }
+
     SECTION("Checking dumping of Data objects to YAML formatted strings")
     {
         const Data data1 = Data::parseYaml(yaml_testing_string);
@@ -705,6 +759,43 @@ TEST_CASE("Testing Data class", "[Data]")
         // CHECK( data.dumpJson() == nlohmann::json::parse(json_testing_string).dump(2) ); // indent=2
     }
 
+    SECTION("Checking dumping of Data objects to binary format")
+    {
+        Data data = Data::parseYaml(yaml_testing_string);
+        data["Extra"]["Integer"] = 42;
+        data["Extra"]["Boolean"] = true;
+        data["Extra"]["Null"] = Data();
+        data["Extra"]["Binary"] = String("a\0b", 3);
+
+        const auto bytes = data.dumpBinary();
+
+        CHECK( Data::isBinary(bytes.data(), bytes.size()) );
+        CHECK_FALSE( Data::isBinary(yaml_testing_string, std::strlen(yaml_testing_string)) );
+
+        const Data other = Data::parseBinary(bytes);
+
+        CHECK( other.dumpYaml() == data.dumpYaml() );
+        CHECK( other["Extra"]["Integer"].isInteger() );
+        CHECK( other["Extra"]["Integer"].asInteger() == 42 );
+        CHECK( other["Extra"]["Boolean"].asBoolean() == true );
+        CHECK( other["Extra"]["Null"].isNull() );
+        CHECK( other["Extra"]["Binary"].asString() == String("a\0b", 3) );
+        CHECK( other.dumpBinary() == bytes );
+
+        CHECK_THROWS( Data::parseBinary(bytes.substr(0, bytes.size() - 1)) );
+        CHECK_THROWS( Data::parseBinary(bytes + " ") );
+        CHECK_THROWS( Data::parseBinary(String(yaml_testing_string)) );
+
+        // Sizes read from corrupted bytes are checked against the remaining bytes before any allocation
+        Data list;
+        list.add(1.0);
+        String corrupted = list.dumpBinary();
+        const auto ilistsize = corrupted.size() - sizeof(double) - 1 - sizeof(std::uint32_t); // the list size precedes the tag and bytes of its single float value
+        corrupted.replace(ilistsize, sizeof(std::uint32_t), sizeof(std::uint32_t), '\xff');
+
+        CHECK_THROWS_WITH( Data::parseBinary(corrupted), Catch::Contains("ended unexpectedly") );
+    }
+
     SECTION("Checking encoding/decoding of custom types to/from Data objects")
     {
         const auto str = R"#(
@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <fstream>
+#include <mutex>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
@@ -27,6 +28,7 @@
 #include <Reaktoro/Core/Data.hpp>
 #include <Reaktoro/Core/Embedded.hpp>
 #include <Reaktoro/Core/Support/DatabaseParser.hpp>
+#include <Reaktoro/Serialization/Core.hpp>
 
 namespace Reaktoro {
 
@@ -35,6 +37,10 @@ auto createDatabaseFromContents(Source& contents)
 {
     Data doc;
 
+    if constexpr(isSame<Source, String>)
+        if(Data::isBinary(contents.data(), contents.size()))
+            return Database(DatabaseParser(Data::parseBinary(contents)));
+
     try { doc = Data::parseYaml(contents); }
     catch(...)
     {
@@ -67,14 +73,53 @@ auto createDataFromJsonOrYaml(String const& path) -> Data
     return doc;
 }
 
-struct Database::Impl
+/// A species in the database whose Species object is created on its first access.
+struct DatabaseSpecies
+{
+    /// The flag used to create the Species object only once, even if accessed from multiple threads.
+    std::once_flag created;
+
+    /// The function that creates the Species object (released after its use).
+    Fn<Species()> create;
+
+    /// The Species object, once created.
+    Species species;
+
+    /// Return the Species object, creating it first if not yet created.
+    auto get() -> Species const&
+    {
+        std::call_once(created, [&]() { species = create(); create = {}; });
+        return species;
+    }
+};
+
+/// All species in the database, created on first access.
+struct DatabaseSpeciesList
 {
-    /// The Species objects in the database.
+    /// The flag used to create the list only once, even if accessed from multiple threads.
+    std::once_flag created;
+
+    /// The list of all species in the database, once created.
     SpeciesList species;
+};
+
+struct Database::Impl
+{
+    /// The species in the database, which are shared among copies of the database (they are not changed once created).
+    Vec<SharedPtr<DatabaseSpecies>> species;
+
+    /// The list of all species in the database, created on first access (replaced whenever a species is added).
+    SharedPtr<DatabaseSpeciesList> species_list = std::make_shared<DatabaseSpeciesList>();
 
     /// The Element objects in the database.
     ElementList elements;
 
+    /// The attributes of the species in the database used to select them, in the same order as in `species`.
+    Vec<SpeciesInfo> species_info;
+
+    /// The index of the first species with a given name in the database.
+    Map<String, Index> species_index;
+
     /// The additional data in the database whose type is known at runtime only.
     Any attached_data;
 
@@ -84,8 +129,8 @@ struct Database::Impl
     /// The ids of the species already inserted in the database, with id = species name + aggregate state
     Set<String> inserted_species_set;
 
-    /// The species in the database grouped in terms of their aggregate state
-    Map<AggregateState, SpeciesList> species_with_aggregate_state;
+    /// The indices of the species in the database grouped in terms of their aggregate state
+    Map<AggregateState, Indices> species_with_aggregate_state;
 
     /// Add an element in the database.
     auto addElement(Element const& element) -> void
@@ -104,12 +149,12 @@ struct Database::Impl
         }
     }
 
-    /// Add a species in the database.
-    auto addSpecies(Species newspecies) -> void
+    /// Register the attributes of a new species in the database and return its unique name and aggregate state in the database.
+    auto registerSpecies(SpeciesInfo info) -> SpeciesInfo const&
     {
         // Ensure unique names for species with same aggregate state are used when storing a new species!
-        auto const name = newspecies.name();
-        auto const agstate = newspecies.aggregateState();
+        auto const name = info.name;
+        auto const agstate = info.aggregate_state;
 
         // Find a unique name and id next, if needed.
         auto unique_id = name + std::to_string(static_cast<int>(agstate));
@@ -123,7 +168,7 @@ struct Database::Impl
 
         // Replace original name with found unique name (using appended !) if name is not unique among the species with same aggregate state.
         if(name != unique_name) {
-            newspecies = newspecies.withName(unique_name);
+            info.name = unique_name;
             warningif(true, "Species with same aggregate state should have unique names in Database, but species `", name, "` with aggregate state `", agstate, "` violates this rule. The unique name ", unique_name, " has been assigned instead.");
         }
 
@@ -137,27 +182,97 @@ struct Database::Impl
         // aq as in H2O(aq), CO2(aq), H2(aq). For all other species, ensure an
         // aggregate state suffix is provided, such as H2O(l), H2O(g),
         // CaCO3(s), Fe3O4(s).
-        if(newspecies.aggregateState() == AggregateState::Undefined)
-            newspecies = newspecies.withAggregateState(AggregateState::Aqueous);
-
-        // Append the new Species object in the species container
-        species.append(newspecies);
+        if(info.aggregate_state == AggregateState::Undefined)
+            info.aggregate_state = AggregateState::Aqueous;
 
         // Update the list of unique species ids.
         inserted_species_set.insert(unique_id);
 
+        // Register the new species in the group of species with same aggregate state and in the index of species names
+        species_with_aggregate_state[info.aggregate_state].push_back(species_info.size());
+        species_index.emplace(info.name, species_info.size());
+
+        // Replace the list of all species, which does not contain the new species (the old one may still be shared with copies of this database)
+        species_list = std::make_shared<DatabaseSpeciesList>();
+
+        species_info.push_back(std::move(info));
+
+        return species_info.back();
+    }
+
+    /// Return the given Species object with the unique name and aggregate state it has in the database.
+    static auto normalizeSpecies(Species newspecies, String const& name, AggregateState agstate) -> Species
+    {
+        if(newspecies.name() != name)
+            newspecies = newspecies.withName(name);
+        if(newspecies.aggregateState() != agstate)
+            newspecies = newspecies.withAggregateState(agstate);
+        return newspecies;
+    }
+
+    /// Add a species in the database.
+    auto addSpecies(Species const& newspecies) -> void
+    {
+        // Register the attributes of the new species used to select species (with its formula parsed only once here)
+        auto const& info = registerSpecies({ newspecies.name(), newspecies.formula(), newspecies.aggregateState(), newspecies.elements().symbols(), newspecies.tags() });
+
+        // Append the new Species object, already created, in the species container
+        auto entry = std::make_shared<DatabaseSpecies>();
+        entry->species = normalizeSpecies(newspecies, info.name, info.aggregate_state);
+        std::call_once(entry->created, []() {});
+        species.push_back(entry);
+
         // Update the container of elements with the Element objects in this new species.
         for(auto&& [element, coeff] : newspecies.elements())
             addElement(element);
+    }
+
+    /// Add a species in the database whose Species object is created only when first needed.
+    auto addSpecies(SpeciesInfo const& newinfo, Fn<Species()> const& create) -> void
+    {
+        errorif(!create, "Expecting a non-empty function to create the species `", newinfo.name, "` when adding it to the database.");
+        auto const& info = registerSpecies(newinfo);
+        auto entry = std::make_shared<DatabaseSpecies>();
+        entry->create = [create, name = info.name, agstate = info.aggregate_state]() { return normalizeSpecies(create(), name, agstate); };
+        species.push_back(entry);
+    }
+
+    /// Return the species with given index in the database, creating it first if not yet created.
+    auto speciesAt(Index i) const -> Species const&
+    {
+        return species[i]->get();
+    }
+
+    /// Return all species in the database, creating first those not yet created.
+    auto allSpecies() const -> SpeciesList const&
+    {
+        auto& list = *species_list;
+        std::call_once(list.created, [&]()
+        {
+            Vec<Species> all;
+            all.reserve(species.size());
+            for(auto const& entry : species)
+                all.push_back(entry->get());
+            list.species = SpeciesList(all);
+        });
+        return list.species;
+    }
 
-        // Add the new species in the group of species with same aggregate state
-        species_with_aggregate_state[newspecies.aggregateState()].push_back(newspecies);
+    /// Return the species with given name in the database, creating it first if not yet created.
+    auto speciesWithName(String const& name) const -> Species const&
+    {
+        auto const it = species_index.find(name);
+        errorif(it == species_index.end(), "Could not find any Species object with name ", name, ".");
+        return speciesAt(it->second);
     }
 
     /// Construct a reaction with given equation.
     auto reaction(String const& equation) const -> Reaction
     {
-        return Reaction().withEquation(ReactionEquation(equation, species));
+        Vec<Species> reactionspecies;
+        for(auto const& [name, coeff] : parseReactionEquation(equation))
+            reactionspecies.push_back(speciesWithName(name));
+        return Reaction().withEquation(ReactionEquation(equation, reactionspecies));
     }
 };
 
@@ -215,6 +330,11 @@ auto Database::addSpecies(Vec<Species> const& species) -> void
         addSpecies(x);
 }
 
+auto Database::addSpecies(SpeciesInfo const& info, Fn<Species()> const& create) -> void
+{
+    pimpl->addSpecies(info, create);
+}
+
 auto Database::attachData(Any const& data) -> void
 {
     pimpl->attached_data = data;
@@ -230,8 +350,10 @@ auto Database::extendWithDatabase(Database const& other) -> void
     for(auto const& element : other.elements())
         addElement(element);
 
-    for(auto const& species : other.species())
-        addSpecies(species);
+    // Species not yet created in the other database remain so in this database (and are created only once for both)
+    auto const& infos = other.pimpl->species_info;
+    for(auto i = 0; i < infos.size(); ++i)
+        addSpecies(infos[i], [entry = other.pimpl->species[i]]() { return entry->get(); });
 
     // TODO: Replace Any by Map<String, Any> so that it becomes easier/more intuitive to unify different attached data to Database objects.
     // pimpl->attached_data = ???;
@@ -254,7 +376,7 @@ auto Database::elements() const -> ElementList const&
 
 auto Database::species() const -> SpeciesList const&
 {
-    return pimpl->species;
+    return pimpl->allSpecies();
 }
 
 auto Database::speciesWithAggregateState(AggregateState option) const -> SpeciesList
@@ -262,7 +384,24 @@ auto Database::speciesWithAggregateState(AggregateState option) const -> Species
     auto it = pimpl->species_with_aggregate_state.find(option);
     if(it == pimpl->species_with_aggregate_state.end())
         return {};
-    return it->second;
+    return speciesWithIndices(it->second);
+}
+
+auto Database::speciesInfo() const -> Vec<SpeciesInfo> const&
+{
+    return pimpl->species_info;
+}
+
+auto Database::speciesWithIndices(Indices const& indices) const -> SpeciesList
+{
+    Vec<Species> selected;
+    selected.reserve(indices.size());
+    for(auto const i : indices)
+    {
+        errorif(i >= pimpl->species_info.size(), "Could not find any Species object with index ", i, " in the database, which has only ", pimpl->species_info.size(), " species.");
+        selected.push_back(pimpl->speciesAt(i));
+    }
+    return selected;
 }
 
 auto Database::element(String const& symbol) const -> Element const&
@@ -272,7 +411,7 @@ auto Database::element(String const& symbol) const -> Element const&
 
 auto Database::species(String const& name) const -> Species const&
 {
-    return species().getWithName(name);
+    return pimpl->speciesWithName(name);
 }
 
 auto Database::reaction(String const& equation) const -> Reaction
@@ -285,6 +424,12 @@ auto Database::attachedData() const -> Any const&
     return pimpl->attached_data;
 }
 
+auto Database::saveBinary(String const& path) const -> void
+{
+    Data doc = *this;
+    doc.saveBinary(path);
+}
+
 auto Database::fromFile(String const& path) -> Database
 {
     auto doc = createDataFromJsonOrYaml(path);
@@ -292,6 +437,13 @@ auto Database::fromFile(String const& path) -> Database
     return Database(dbparser);
 }
 
+auto Database::fromBinaryFile(String const& path) -> Database
+{
+    auto doc = Data::loadBinary(path);
+    DatabaseParser dbparser(doc);
+    return Database(dbparser);
+}
+
 auto Database::fromEmbeddedFile(String const& path) -> Database
 {
     const String contents = Embedded::get("databases/reaktoro/" + path);
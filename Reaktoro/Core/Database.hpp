@@ -26,22 +26,58 @@
 namespace Reaktoro {
 
 /// The class used to store and retrieve data of chemical species.
+/// The Species objects in a database can be created only when they are first
+/// needed (e.g., when loaded from a YAML or JSON database file). The attributes
+/// returned by Database::speciesInfo are available for all species, and can be
+/// used to select species without creating those not selected. The const
+/// methods can be called concurrently from multiple threads.
 /// @see Element, Species
 /// @ingroup Core
 class Database
 {
 public:
+    /// The attributes of a species in the database that are known before its Species object is created.
+    struct SpeciesInfo
+    {
+        /// The unique name of the species in the database.
+        String name;
+
+        /// The chemical formula of the species (parsed once when the species is added to the database).
+        ChemicalFormula formula;
+
+        /// The aggregate state of the species.
+        AggregateState aggregate_state = AggregateState::Undefined;
+
+        /// The symbols of the elements composing the species.
+        Strings elements;
+
+        /// The tags of the species.
+        Strings tags;
+    };
+
     /// Return a Database object constructed with a given local file.
     /// @warning An exception is thrown if `path` does not point to a valid local database file.
     /// @param path The path, including file name, to the local database file.
     static auto fromFile(String const& path) -> Database;
 
+    /// Return a Database object constructed with a given local file in binary format.
+    /// Such files are created with Database::saveBinary or by saving with
+    /// Data::saveBinary the contents of a YAML or JSON database file. They
+    /// are much faster to load than their YAML and JSON counterparts.
+    /// @warning An exception is thrown if `path` does not point to a valid local binary database file.
+    /// @param path The path, including file name, to the local binary database file.
+    static auto fromBinaryFile(String const& path) -> Database;
+
     /// Return a Database object constructed with a given embedded file.
+    /// The embedded JSON database files are also embedded in binary format
+    /// (converted at build time with Data::parseJson and Data::dumpBinary), and
+    /// these are much faster to load (e.g., `supcrtbl.rkdb` instead of `supcrtbl.json`).
     /// @warning An exception is thrown if `path` does not point to a valid embedded database file.
     /// @param path The path, including file name, to the embedded database file.
     static auto fromEmbeddedFile(String const& path) -> Database;
 
     /// Return a Database object constructed with given database text contents.
+    /// The contents can also be in the binary format produced by Data::dumpBinary.
     /// @param contents The contents of the database as a string.
     static auto fromContents(String const& contents) -> Database;
 
@@ -89,6 +125,15 @@ public:
     /// Add a list of species in the database.
     auto addSpecies(Vec<Species> const& species) -> void;
 
+    /// Add a species in the database whose Species object is created only when first needed.
+    /// The given attributes must be consistent with the Species object returned by `create`,
+    /// except for its name and aggregate state, which are replaced by those in the database if needed.
+    /// @note The elements of the species are not added to the database by this method.
+    /// Use Database::addElement beforehand to make them available in Database::elements.
+    /// @param info The attributes of the species known before its creation.
+    /// @param create The function that creates the Species object (called at most once, and released afterwards).
+    auto addSpecies(SpeciesInfo const& info, Fn<Species()> const& create) -> void;
+
     /// Attach data to this database whose type is known at runtime only.
     auto attachData(Any const& data) -> void;
 
@@ -107,26 +152,44 @@ public:
     auto elements() const -> ElementList const&;
 
     /// Return all species in the database.
+    /// @note This method creates all species in the database not yet created.
     auto species() const -> SpeciesList const&;
 
     /// Return all species in the database with given aggregate state.
+    /// @note This method creates only the species with given aggregate state.
     auto speciesWithAggregateState(AggregateState option) const -> SpeciesList;
 
+    /// Return the attributes of all species in the database, in the same order as in Database::species.
+    /// @note This method does not create any species in the database.
+    auto speciesInfo() const -> Vec<SpeciesInfo> const&;
+
+    /// Return the species in the database with given indices in Database::speciesInfo.
+    /// @warning An exception is thrown if any index is out of range.
+    /// @note This method creates only the species with given indices.
+    auto speciesWithIndices(Indices const& indices) const -> SpeciesList;
+
     /// Return an element with given symbol in the database.
     /// @warning An exception is thrown if no element with given symbol exists.
     auto element(String const& symbol) const -> Element const&;
 
     /// Return a species with given name in the database.
     /// @warning An exception is thrown if no species with given name exists.
+    /// @note This method creates only the species with given name.
     auto species(String const& name) const -> Species const&;
 
     /// Construct a reaction with given equation.
     /// @warning An exception is thrown if the reaction has an inexistent species in the database.
+    /// @note This method creates only the species in the reaction.
     auto reaction(String const& equation) const -> Reaction;
 
     /// Return the attached data to this database whose type is known at runtime only.
     auto attachedData() const -> Any const&;
 
+    /// Save the elements and species in this database into a file in binary format.
+    /// Use Database::fromBinaryFile to load the database back from this file.
+    /// @param path The path, including file name, to the binary database file.
+    auto saveBinary(String const& path) const -> void;
+
 private:
     struct Impl;
 
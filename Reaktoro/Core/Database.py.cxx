@@ -34,7 +34,23 @@ void exportDatabase(py::module& m)
         self.addSpecies(species);
     };
 
-    py::class_<Database>(m, "Database")
+    auto addSpecies3 = [](Database& self, const Database::SpeciesInfo& info, const Fn<Species()>& create)
+    {
+        self.addSpecies(info, create);
+    };
+
+    py::class_<Database> database(m, "Database");
+
+    py::class_<Database::SpeciesInfo>(database, "SpeciesInfo")
+        .def(py::init<>())
+        .def_readwrite("name", &Database::SpeciesInfo::name, "The unique name of the species in the database.")
+        .def_readwrite("formula", &Database::SpeciesInfo::formula, "The chemical formula of the species.")
+        .def_readwrite("aggregate_state", &Database::SpeciesInfo::aggregate_state, "The aggregate state of the species.")
+        .def_readwrite("elements", &Database::SpeciesInfo::elements, "The symbols of the elements composing the species.")
+        .def_readwrite("tags", &Database::SpeciesInfo::tags, "The tags of the species.")
+        ;
+
+    database
         .def(py::init<>())
         .def(py::init<const SpeciesList&>())
         .def(py::init<const ElementList&, const SpeciesList&>())
@@ -44,6 +60,7 @@ void exportDatabase(py::module& m)
         .def("addElement", &Database::addElement)
         .def("addSpecies", addSpecies1)
         .def("addSpecies", addSpecies2)
+        .def("addSpecies", addSpecies3)
         .def("attachData", &Database::attachData)
         .def("extend", &Database::extend)
         .def("extendWithDatabase", &Database::extendWithDatabase)
@@ -51,11 +68,15 @@ void exportDatabase(py::module& m)
         .def("elements", &Database::elements)
         .def("species", py::overload_cast<>(&Database::species, py::const_))
         .def("speciesWithAggregateState", &Database::speciesWithAggregateState)
+        .def("speciesInfo", &Database::speciesInfo, return_internal_ref)
+        .def("speciesWithIndices", &Database::speciesWithIndices)
         .def("element", &Database::element, return_internal_ref)
         .def("species", py::overload_cast<const String&>(&Database::species, py::const_), return_internal_ref)
         .def("reaction", &Database::reaction)
         .def("attachedData", &Database::attachedData)
+        .def("saveBinary", &Database::saveBinary)
         .def_static("fromFile", &Database::fromFile)
+        .def_static("fromBinaryFile", &Database::fromBinaryFile)
         .def_static("fromEmbeddedFile", &Database::fromEmbeddedFile)
         .def_static("fromContents", &Database::fromContents)
         .def_static("fromStream", &Database::fromStream)
@@ -19,9 +19,12 @@
 #include <catch2/catch.hpp>
 
 // C++ includes
+#include <atomic>
 #include <fstream>
+#include <thread>
 
 // Reaktoro includes
+#include <Reaktoro/Core/Data.hpp>
 #include <Reaktoro/Core/Database.hpp>
 using namespace Reaktoro;
 
@@ -368,3 +371,194 @@ TEST_CASE("Testing Database object creation using Database::fromContents using J
     CHECK(db.species()[0].name() == "Akermanite");
     CHECK(db.species()[0].formula() == "Ca2MgSi2O7");
 }
+
+TEST_CASE("Testing Database object creation using binary format", "[Database]")
+{
+    String contents = R"#(
+        Species:
+          Akermanite:
+            Name: Akermanite
+            Formula: Ca2MgSi2O7
+            Elements: 2:Ca 1:Mg 2:Si 7:O
+            AggregateState: Solid
+            StandardThermoModel:
+              MaierKelley:
+                Gf: -3679250.6
+                Hf: -3876463.4
+                Sr: 209.32552
+                Vr: 9.281e-05
+                a: 251.41656
+                b: 0.0476976
+                c: -4769760.0
+                Tmax: 1700.0
+        )#";
+
+    auto check_database = [&](Database const& db)
+    {
+        CHECK(db.species().size() == 1);
+        CHECK(db.species()[0].name() == "Akermanite");
+        CHECK(db.species()[0].formula() == "Ca2MgSi2O7");
+        CHECK(db.species()[0].elements().coefficient("Si") == 2);
+        CHECK(db.species()[0].props(300.0, 1e5).G0 == Approx(Database::fromContents(contents).species()[0].props(300.0, 1e5).G0));
+    };
+
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: Database::fromContents with binary contents
+    //-------------------------------------------------------------------------
+    check_database(Database::fromContents(Data::parseYaml(contents).dumpBinary()));
+
+    //-------------------------------------------------------------------------
+    // TESTING METHODS: Database::saveBinary and Database::fromBinaryFile
+    //-------------------------------------------------------------------------
+    Database::fromContents(contents).saveBinary("temporary.rkdb");
+
+    check_database(Database::fromBinaryFile("temporary.rkdb"));
+
+    std::remove("temporary.rkdb");
+}
+
+TEST_CASE("Testing selection of species in Database objects using their attributes", "[Database]")
+{
+    Database db;
+
+    auto addSpecies = [&](String const& name, String const& formula, AggregateState option, Strings const& tags)
+    {
+        db.addSpecies(Species(formula).withName(name).withAggregateState(option).withTags(tags));
+    };
+
+    addSpecies("H2O(aq)",  "H2O",   AggregateState::Aqueous, {});
+    addSpecies("H+(aq)",   "H+",    AggregateState::Aqueous, {"charged"});
+    addSpecies("CO2(aq)",  "CO2",   AggregateState::Aqueous, {});
+    addSpecies("CO2(g)",   "CO2",   AggregateState::Gas, {});
+    addSpecies("H2O(g)",   "H2O",   AggregateState::Gas, {});
+    addSpecies("CaCO3(s)", "CaCO3", AggregateState::Solid, {});
+    addSpecies("CO2(g)",   "CO2",   AggregateState::Gas, {});
+    addSpecies("Halite",   "NaCl",  AggregateState::Undefined, {});
+
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: Database::speciesInfo
+    //-------------------------------------------------------------------------
+    auto const& infos = db.speciesInfo();
+
+    CHECK( infos.size() == 8 );
+    CHECK( infos[0].name == "H2O(aq)" );
+    CHECK( infos[1].tags == Strings{"charged"} );
+    CHECK( infos[1].formula.equivalent("H[+]") );
+    CHECK( infos[5].elements == Strings{"Ca", "C", "O"} );
+    CHECK( infos[6].name == "CO2(g)!" ); // unique name assigned by the database
+    CHECK( infos[7].name == "Halite" );
+    CHECK( infos[7].formula.str() == "NaCl" );
+    CHECK( infos[7].aggregate_state == AggregateState::Aqueous ); // undefined aggregate state replaced by the database
+    CHECK( infos[7].elements == Strings{"Na", "Cl"} );
+
+    for(auto i = 0; i < infos.size(); ++i)
+    {
+        CHECK( db.species()[i].name() == infos[i].name );
+        CHECK( db.species()[i].aggregateState() == infos[i].aggregate_state );
+    }
+
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: Database::speciesWithIndices
+    //-------------------------------------------------------------------------
+    auto selected = db.speciesWithIndices({6, 0, 2});
+
+    CHECK( selected.size() == 3 );
+    CHECK( selected[0].name() == "CO2(g)!" );
+    CHECK( selected[1].name() == "H2O(aq)" );
+    CHECK( selected[2].name() == "CO2(aq)" );
+
+    CHECK_THROWS( db.speciesWithIndices({8}) );
+
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: Database::extend
+    //-------------------------------------------------------------------------
+    Database other;
+    other.extend(db);
+
+    CHECK( other.speciesInfo().size() == 8 );
+    CHECK( other.speciesInfo()[1].name == "H+(aq)" );
+    CHECK( other.speciesInfo()[1].tags == Strings{"charged"} );
+
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: Database::addSpecies with a function that creates the species only when first needed
+    //-------------------------------------------------------------------------
+    Database lazydb;
+
+    Vec<int> created(3);
+
+    auto addLazySpecies = [&](Index i, String const& name, String const& formula, AggregateState option)
+    {
+        lazydb.addSpecies({ name, formula, option, ChemicalFormula(formula).symbols(), {} }, [=, &created]()
+        {
+            created[i] += 1;
+            return Species(formula).withName(name).withAggregateState(option);
+        });
+    };
+
+    addLazySpecies(0, "H2O(aq)", "H2O", AggregateState::Aqueous);
+    addLazySpecies(1, "CO2(g)",  "CO2", AggregateState::Gas);
+    addLazySpecies(2, "Halite",  "NaCl", AggregateState::Undefined);
+
+    CHECK( lazydb.speciesInfo().size() == 3 );
+    CHECK( lazydb.speciesInfo()[2].aggregate_state == AggregateState::Aqueous );
+    CHECK( created == Vec<int>{0, 0, 0} ); // no species created yet
+
+    Database lazyother;
+    lazyother.extend(lazydb);
+
+    CHECK( created == Vec<int>{0, 0, 0} ); // extending a database does not create its species
+
+    CHECK( lazydb.speciesWithIndices({1})[0].name() == "CO2(g)" );
+    CHECK( created == Vec<int>{0, 1, 0} ); // only the selected species is created
+
+    CHECK( lazydb.speciesWithAggregateState(AggregateState::Aqueous).size() == 2 );
+    CHECK( created == Vec<int>{1, 1, 1} );
+
+    CHECK( lazydb.species("Halite").aggregateState() == AggregateState::Aqueous ); // species created with aggregate state in the database
+    CHECK( lazyother.species().size() == 3 );
+    CHECK( lazyother.species()[2].name() == "Halite" );
+    CHECK( created == Vec<int>{1, 1, 1} ); // species are created only once, even when shared with other databases
+
+    CHECK_THROWS( lazydb.addSpecies({ "CaCO3(s)", "CaCO3", AggregateState::Solid, {}, {} }, nullptr) );
+
+    //-------------------------------------------------------------------------
+    // TESTING METHOD: Database::species when called from multiple threads
+    //-------------------------------------------------------------------------
+    Database shareddb;
+
+    std::atomic<int> numcreated = 0;
+
+    for(auto i = 0; i < 100; ++i)
+    {
+        auto const name = "Species" + std::to_string(i);
+        shareddb.addSpecies({ name, "H2O", AggregateState::Aqueous, {"H", "O"}, {} }, [=, &numcreated]()
+        {
+            numcreated += 1;
+            return Species("H2O").withName(name);
+        });
+    }
+
+    Vec<Strings> names(4); // the names of the species accessed in each thread (checked after the threads finish, as Catch2 assertions are not thread-safe)
+
+    Vec<std::thread> threads;
+    for(auto i = 0; i < 4; ++i)
+        threads.emplace_back([&, i]()
+        {
+            for(auto j = 99; j >= 0; --j)
+                names[i].push_back(shareddb.species("Species" + std::to_string(j)).name());
+            names[i].push_back(shareddb.species()[i].name());
+        });
+
+    for(auto& thread : threads)
+        thread.join();
+
+    for(auto i = 0; i < 4; ++i)
+    {
+        CHECK( names[i].size() == 101 );
+        CHECK( names[i][0] == "Species99" );
+        CHECK( names[i][99] == "Species0" );
+        CHECK( names[i][100] == "Species" + std::to_string(i) );
+    }
+
+    CHECK( numcreated == 100 ); // each species created only once
+}
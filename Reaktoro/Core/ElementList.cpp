@@ -17,27 +17,67 @@
 
 #include "ElementList.hpp"
 
+// C++ includes
+#include <atomic>
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/StringList.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// The minimum number of elements in a list for which lookup tables are built (smaller lists are searched linearly).
+const auto lookup_threshold = 32;
+
+} // namespace
+
+struct ElementList::Lookup
+{
+    /// The index of the first element with a given symbol.
+    Map<String, Index> symbols;
+
+    /// The index of the first element with a given name.
+    Map<String, Index> names;
+
+    /// The flag used to build the tables only once, even if requested by several threads.
+    std::once_flag once;
+
+    /// True if the tables have been built.
+    std::atomic<bool> built = false;
+
+    /// Register the element at given index in the list (ignored if preceded by another with same symbol or name).
+    auto add(const Element& element, Index i) -> void
+    {
+        symbols.emplace(element.symbol(), i);
+        names.emplace(element.name(), i);
+    }
+};
 
 ElementList::ElementList()
 {}
 
 ElementList::ElementList(std::initializer_list<Element> elements)
 : m_elements(std::move(elements))
-{}
+{
+    resetLookup();
+}
 
 ElementList::ElementList(const Vec<Element>& elements)
 : m_elements(elements)
-{}
+{
+    resetLookup();
+}
 
 auto ElementList::append(const Element& element) -> void
 {
     m_elements.push_back(element);
+    if(!m_lookup || m_lookup.use_count() > 1)
+        resetLookup();
+    else if(m_lookup->built)
+        m_lookup->add(element, m_elements.size() - 1); // extend the lookup tables in place, since they are not shared with copies of this list
 }
 
 auto ElementList::data() const -> const Vec<Element>&
@@ -67,11 +107,21 @@ auto ElementList::find(const String& symbol) const -> Index
 
 auto ElementList::findWithSymbol(const String& symbol) const -> Index
 {
+    if(const auto table = lookup())
+    {
+        const auto it = table->symbols.find(symbol);
+        return it != table->symbols.end() ? it->second : size();
+    }
     return indexfn(m_elements, RKT_LAMBDA(e, e.symbol() == symbol));
 }
 
 auto ElementList::findWithName(const String& name) const -> Index
 {
+    if(const auto table = lookup())
+    {
+        const auto it = table->names.find(name);
+        return it != table->names.end() ? it->second : size();
+    }
     return indexfn(m_elements, RKT_LAMBDA(e, e.name() == name));
 }
 
@@ -141,6 +191,7 @@ auto ElementList::withoutTags(const StringList& tags) const -> ElementList
 
 ElementList::operator Vec<Element>&()
 {
+    invalidateLookup();
     return m_elements;
 }
 
@@ -149,6 +200,37 @@ ElementList::operator Vec<Element>const&() const
     return m_elements;
 }
 
+auto ElementList::lookup() const -> const Lookup*
+{
+    if(!m_lookup)
+        return nullptr;
+
+    std::call_once(m_lookup->once, [&]
+    {
+        auto& table = *m_lookup;
+        table.symbols.reserve(m_elements.size());
+        table.names.reserve(m_elements.size());
+        for(auto i = 0; i < m_elements.size(); ++i)
+            table.add(m_elements[i], i);
+        table.built = true;
+    });
+
+    return m_lookup.get();
+}
+
+auto ElementList::resetLookup() -> void
+{
+    if(m_elements.size() < lookup_threshold)
+        m_lookup.reset();
+    else m_lookup = std::make_shared<Lookup>();
+}
+
+auto ElementList::invalidateLookup() -> void
+{
+    if(m_lookup && (m_lookup->built || m_lookup.use_count() > 1))
+        resetLookup(); // tables not yet built and owned only by this list are left as they are, since they will be built from the elements as they are then
+}
+
 auto operator+(const ElementList& a, const ElementList& b) -> ElementList
 {
     return concatenate(a, b);
@@ -106,29 +106,48 @@ private:
     /// The elements stored in the list.
     Vec<Element> m_elements;
 
+    /// The hash tables used to find elements by symbol and name.
+    struct Lookup;
+
+    /// The lookup tables of the list, built on first use and shared among its copies until one of them is changed.
+    /// These tables exist only for lists with many elements. They are built once,
+    /// under `std::call_once`, so that a const list can be searched concurrently.
+    SharedPtr<Lookup> m_lookup;
+
+    /// Return the lookup tables of the list or nullptr if the list is too small to justify them.
+    auto lookup() const -> const Lookup*;
+
+    /// Prepare new lookup tables, to be built on first use, for the current elements in the list.
+    auto resetLookup() -> void;
+
+    /// Prepare new lookup tables before the elements in the list may be changed.
+    /// Tables not yet built and not shared with copies of the list are kept, so
+    /// that repeated mutable access to the elements does not allocate new ones.
+    auto invalidateLookup() -> void;
+
 public:
     /// Construct an ElementList object with given begin and end iterators.
     template<typename InputIterator>
-    ElementList(InputIterator begin, InputIterator end) : m_elements(begin, end) {}
+    ElementList(InputIterator begin, InputIterator end) : m_elements(begin, end) { resetLookup(); }
 
     /// Return begin const iterator of this ElementList instance (for STL compatibility reasons).
     auto begin() const { return m_elements.begin(); }
 
     /// Return begin iterator of this ElementList instance (for STL compatibility reasons).
-    auto begin() { return m_elements.begin(); }
+    auto begin() { invalidateLookup(); return m_elements.begin(); }
 
     /// Return end const iterator of this ElementList instance (for STL compatibility reasons).
     auto end() const { return m_elements.end(); }
 
     /// Return end iterator of this ElementList instance (for STL compatibility reasons).
-    auto end() { return m_elements.end(); }
+    auto end() { invalidateLookup(); return m_elements.end(); }
 
     /// Append a new Element at the back of the container (for STL compatibility reasons).
     auto push_back(const Element& elements) -> void { append(elements); }
 
     /// Insert a container of Element objects into this ElementList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_elements.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_elements.insert(pos, begin, end); resetLookup(); }
 
     /// The type of the value stored in a ElementList (for STL compatibility reasons).
     using value_type = Element;
@@ -268,3 +268,32 @@ TEST_CASE("Testing ElementList", "[ElementList]")
     for(auto [i, element] : enumerate(elements))
         REQUIRE( element.name() == elements[i].name() );
 }
+
+TEST_CASE("Testing ElementList with many elements", "[ElementList]")
+{
+    // Large enough to search elements using the hash tables of the list
+    ElementList elements;
+    for(auto i = 0; i < 40; ++i)
+        elements.append(Element().withSymbol("E" + std::to_string(i)).withName("Element" + std::to_string(i)));
+
+    for(auto i = 0; i < 40; ++i)
+    {
+        CHECK( elements.findWithSymbol("E" + std::to_string(i)) == i );
+        CHECK( elements.findWithName("Element" + std::to_string(i)) == i );
+    }
+
+    CHECK( elements.findWithSymbol("Xy") == elements.size() );
+    CHECK( elements.findWithName("Xyrium") == elements.size() );
+
+    elements.append(Element().withSymbol("Xy").withName("Xyrium"));
+    elements.append(Element().withSymbol("Xy").withName("Xyrium2"));
+
+    CHECK( elements.findWithSymbol("Xy") == 40 );
+    CHECK( elements.findWithName("Xyrium2") == 41 );
+
+    for(auto& element : elements)
+        element = element.withSymbol(element.symbol() + "z");
+
+    CHECK( elements.findWithSymbol("E0") == elements.size() );
+    CHECK( elements.findWithSymbol("E0z") == 0 );
+}
@@ -17,12 +17,86 @@
 
 #include "Embedded.hpp"
 
+// C++ includes
+#include <cstring>
+#include <mutex>
+
 // CMakeRC includes
 #include <cmrc/cmrc.hpp>
 
+// zstd includes
+#ifdef REAKTORO_ENABLE_ZSTD
+#include <zstd.h>
+#endif
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
 CMRC_DECLARE(ReaktoroEmbedded);
 
 namespace Reaktoro {
+namespace {
+
+/// The magic number (in little-endian byte order) at the beginning of every zstd frame.
+const unsigned char zstd_magic_number[4] = { 0x28, 0xB5, 0x2F, 0xFD };
+
+/// Return true if the embedded file has been compressed into a zstd frame when Reaktoro was built.
+auto isCompressed(Chars begin, Chars end) -> bool
+{
+    return end - begin >= 4 && std::memcmp(begin, zstd_magic_number, 4) == 0;
+}
+
+/// Return the decompressed contents of a zstd frame.
+auto decompress(String const& path, Chars begin, Chars end) -> String
+{
+#ifndef REAKTORO_ENABLE_ZSTD
+    errorif(true, "Could not decompress embedded file `", path, "` because Reaktoro was built without zstd (with REAKTORO_ENABLE_ZSTD=OFF or zstd not found).");
+    return {};
+#else
+    // The size of the decompressed contents is not stored in the frame when
+    // it is created by CMake, so the output buffer grows as needed.
+    std::unique_ptr<ZSTD_DStream, decltype(&ZSTD_freeDStream)> stream(ZSTD_createDStream(), ZSTD_freeDStream);
+    errorif(!stream, "Could not decompress embedded file `", path, "` because the zstd decompression stream could not be created.");
+
+    String contents;
+    ZSTD_inBuffer input = { begin, static_cast<size_t>(end - begin), 0 };
+    size_t status = 1;
+    while(input.pos < input.size)
+    {
+        const auto offset = contents.size();
+        contents.resize(offset + ZSTD_DStreamOutSize());
+        ZSTD_outBuffer output = { contents.data() + offset, contents.size() - offset, 0 };
+        status = ZSTD_decompressStream(stream.get(), &output, &input);
+        errorif(ZSTD_isError(status), "Could not decompress embedded file `", path, "` due to zstd error: ", ZSTD_getErrorName(status));
+        contents.resize(offset + output.pos);
+    }
+    errorif(status != 0, "Could not decompress embedded file `", path, "` because it has been truncated.");
+
+    return contents;
+#endif
+}
+
+/// Return the decompressed contents of the embedded files accessed so far (kept alive so that string views into them remain valid).
+auto decompressedFiles() -> Map<String, String>&
+{
+    static Map<String, String> files;
+    return files;
+}
+
+/// Return the mutex used to protect the decompressed files when embedded files are accessed from multiple threads.
+auto decompressedFilesMutex() -> std::mutex&
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+} // namespace
+
+auto Embedded::exists(String const& path) -> bool
+{
+    auto fs = cmrc::ReaktoroEmbedded::get_filesystem();
+    return fs.is_file("embedded/" + path);
+}
 
 auto Embedded::get(String const& path) -> String
 {
@@ -31,15 +105,42 @@ auto Embedded::get(String const& path) -> String
 
 auto Embedded::getAsString(String const& path) -> String
 {
-    const auto [begin, end] = getAsStringView(path);
-    return String(begin, end);
+    auto fs = cmrc::ReaktoroEmbedded::get_filesystem();
+    auto file = fs.open("embedded/" + path);
+
+    if(!isCompressed(file.begin(), file.end()))
+        return String(file.begin(), file.end());
+
+    // Use the decompressed contents if these were kept by a previous call to getAsStringView.
+    // Otherwise, decompress directly into the returned string, without keeping another copy.
+    {
+        std::lock_guard<std::mutex> lock(decompressedFilesMutex());
+        const auto& files = decompressedFiles();
+        const auto it = files.find(path);
+        if(it != files.end())
+            return it->second;
+    }
+
+    return decompress(path, file.begin(), file.end());
 }
 
 auto Embedded::getAsStringView(String const& path) -> Pair<Chars, Chars>
 {
     auto fs = cmrc::ReaktoroEmbedded::get_filesystem();
     auto file = fs.open("embedded/" + path);
-    return { file.begin(), file.end() };
+
+    if(!isCompressed(file.begin(), file.end()))
+        return { file.begin(), file.end() };
+
+    std::lock_guard<std::mutex> lock(decompressedFilesMutex());
+
+    auto& files = decompressedFiles();
+    auto it = files.find(path);
+    if(it == files.end())
+        it = files.emplace(path, decompress(path, file.begin(), file.end())).first;
+
+    const auto& contents = it->second;
+    return { contents.data(), contents.data() + contents.size() };
 }
 
 } // namespace Reaktoro
@@ -26,6 +26,9 @@ namespace Reaktoro {
 class Embedded
 {
 public:
+    /// Return true if there is an embedded document with given path.
+    static auto exists(String const& path) -> bool;
+
     /// Return the contents of the embedded document with given path (as a string).
     static auto get(String const& path) -> String;
 
@@ -33,6 +36,14 @@ public:
     static auto getAsString(String const& path) -> String;
 
     /// Return the contents of the embedded document with given path (as a string view).
+    /// Embedded documents are stored compressed in the library when it is built with
+    /// `REAKTORO_COMPRESS_EMBEDDED` and zstd is found. In this case, a document is decompressed on its
+    /// first access and kept in memory until the end of the process, so that the
+    /// returned view remains valid.
+    /// @warning The decompressed documents are never released, so their memory
+    /// (e.g., a few MB for a large database) stays in use for the rest of the
+    /// process. Use Embedded::getAsString instead for documents read only once,
+    /// since it does not keep a copy of the decompressed contents.
     static auto getAsStringView(String const& path) -> Pair<Chars, Chars>;
 
     /// Deleted default constructor.
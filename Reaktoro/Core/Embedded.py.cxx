@@ -25,6 +25,7 @@ using namespace Reaktoro;
 void exportEmbedded(py::module& m)
 {
     py::class_<Embedded>(m, "Embedded")
+        .def_static("exists", Embedded::exists)
         .def_static("get", Embedded::get)
         .def_static("getAsString", Embedded::getAsString)
         .def_static("getAsStringView", Embedded::getAsStringView)
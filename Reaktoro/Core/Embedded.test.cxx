@@ -26,4 +26,17 @@ TEST_CASE("Testing Embedded class", "[Embedded]")
 {
     CHECK_NOTHROW( Embedded::get("databases/reaktoro/supcrtbl.json") );
     CHECK_THROWS( Embedded::get("path/to/something/that/does/not/exist.txt") );
+
+    CHECK( Embedded::exists("databases/reaktoro/supcrtbl.json") );
+    CHECK( Embedded::exists("databases/reaktoro/supcrtbl.rkdb") ); // the binary database converted from the JSON one at build time
+    CHECK_FALSE( Embedded::exists("databases/reaktoro/supcrtbl.yaml.rkdb") );
+    CHECK_FALSE( Embedded::exists("path/to/something/that/does/not/exist.txt") );
+
+    const auto contents = Embedded::getAsString("params/CubicEOS.yaml");
+    const auto [begin, end] = Embedded::getAsStringView("params/CubicEOS.yaml");
+
+    CHECK( contents.substr(0, 9) == "CubicEOS:" ); // check the contents are decompressed if these have been compressed in the library
+    CHECK( String(begin, end) == contents );
+    CHECK( Embedded::getAsStringView("params/CubicEOS.yaml").first == begin ); // check the view refers to the same (kept) contents in successive calls
+    CHECK( Embedded::get("params/CubicEOS.yaml") == contents );
 }
@@ -42,6 +42,47 @@ struct FormationReaction::Impl
     Impl()
     {}
 
+    /// Return the standard thermodynamic properties of the product species with given ones of the reactant species.
+    auto computeStandardThermoProps(real const& T, real const& P, Vec<StandardThermoProps> const& reactants_props) const -> StandardThermoProps
+    {
+        const auto num_reactants = reactants.size();
+
+        errorif(reactants_props.size() != num_reactants, "Expecting the standard thermodynamic properties "
+            "of ", num_reactants, " reactant species in the formation reaction, but got ", reactants_props.size(), ".");
+
+        // Compute the standard molar volume of the product species
+        const auto V0p = std_volume_model ? std_volume_model(T, P) : real{0.0};
+
+        // Compute the standard molar volume change of the reaction
+        auto dV0 = V0p;
+        for(auto i = 0; i < num_reactants; ++i)
+        {
+            const auto& coeff = reactants[i].second;
+            dV0 -= coeff * reactants_props[i].V0; // coeff is positve for left-hand side reactant, negative for right-hand side
+        }
+
+        // Compute the rest of the standard thermodynamic properties of the reaction
+        ReactionStandardThermoProps rxnprops;
+        rxn_thermo_model.apply(rxnprops, {T, P, dV0});
+
+        // Compute finally the standard thermodynamic properties of the product species
+        StandardThermoProps props;
+
+        props.V0  = V0p;
+        props.G0  = rxnprops.dG0;  // G0  = ΔG0  + sum(vr * G0r)
+        props.H0  = rxnprops.dH0;  // H0  = ΔH0  + sum(vr * H0r)
+        props.Cp0 = rxnprops.dCp0; // Cp0 = ΔCp0 + sum(vr * Cp0r)
+        for(auto i = 0; i < num_reactants; ++i)
+        {
+            const auto& coeff = reactants[i].second;
+            const auto& reactantprops = reactants_props[i];
+            props.G0  += coeff * reactantprops.G0;
+            props.H0  += coeff * reactantprops.H0;
+            props.Cp0 += coeff * reactantprops.Cp0;
+        }
+        return props;
+    }
+
     /// Return the standard thermodynamic model function of the product species.
     auto createStandardThermoModel() const -> StandardThermoModel
     {
@@ -73,37 +114,7 @@ struct FormationReaction::Impl
                 reactants_props[i] = reactant.standardThermoProps(T, P);
             }
 
-            // Compute the standard molar volume of the product species
-            const auto V0p = std_volume_model ? std_volume_model(T, P) : real{0.0};
-
-            // Compute the standard molar volume change of the reaction
-            auto dV0 = V0p;
-            for(auto i = 0; i < num_reactants; ++i)
-            {
-                const auto& coeff = reactants[i].second;
-                dV0 -= coeff * reactants_props[i].V0; // coeff is positve for left-hand side reactant, negative for right-hand side
-            }
-
-            // Compute the rest of the standard thermodynamic properties of the reaction
-            ReactionStandardThermoProps rxnprops;
-            rxn_thermo_model.apply(rxnprops, {T, P, dV0});
-
-            // Compute finally the standard thermodynamic properties of the product species
-            StandardThermoProps props;
-
-            props.V0  = V0p;
-            props.G0  = rxnprops.dG0;  // G0  = ΔG0  + sum(vr * G0r)
-            props.H0  = rxnprops.dH0;  // H0  = ΔH0  + sum(vr * H0r)
-            props.Cp0 = rxnprops.dCp0; // Cp0 = ΔCp0 + sum(vr * Cp0r)
-            for(auto i = 0; i < num_reactants; ++i)
-            {
-                const auto& coeff = reactants[i].second;
-                const auto& reactantprops = reactants_props[i];
-                props.G0  += coeff * reactantprops.G0;
-                props.H0  += coeff * reactantprops.H0;
-                props.Cp0 += coeff * reactantprops.Cp0;
-            }
-            return props;
+            return computeStandardThermoProps(T, P, reactants_props);
         };
 
         return StandardThermoModel(calcfn, params);
@@ -188,4 +199,9 @@ auto FormationReaction::createStandardThermoModel() const -> StandardThermoModel
     return pimpl->createStandardThermoModel();
 }
 
+auto FormationReaction::standardThermoProps(real const& T, real const& P, Vec<StandardThermoProps> const& reactants_props) const -> StandardThermoProps
+{
+    return pimpl->computeStandardThermoProps(T, P, reactants_props);
+}
+
 } // namespace Reaktoro
@@ -111,6 +111,18 @@ public:
     /// have not been invoked.
     auto createStandardThermoModel() const -> StandardThermoModel;
 
+    /// Calculate the standard thermodynamic properties of the product species with given ones of the reactant species.
+    ///
+    /// This method permits the standard thermodynamic properties of the
+    /// reactant species to be computed elsewhere and only once when many
+    /// product species share the same reactants (e.g., master species in
+    /// PHREEQC databases).
+    ///
+    /// @param T The temperature for the calculation (in K)
+    /// @param P The pressure for the calculation (in Pa)
+    /// @param reactants_props The standard thermodynamic properties of the reactants (in the same order as in @ref reactants)
+    auto standardThermoProps(real const& T, real const& P, Vec<StandardThermoProps> const& reactants_props) const -> StandardThermoProps;
+
 private:
     struct Impl;
 
@@ -39,5 +39,6 @@ void exportFormationReaction(py::module& m)
         .def("productStandardVolumeModel", &FormationReaction::productStandardVolumeModel)
         .def("reactionThermoModel", &FormationReaction::reactionThermoModel)
         .def("createStandardThermoModel", &FormationReaction::createStandardThermoModel)
+        .def("standardThermoProps", &FormationReaction::standardThermoProps)
         ;
 }
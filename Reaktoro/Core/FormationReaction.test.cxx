@@ -181,4 +181,16 @@ TEST_CASE("Testing FormationReaction class", "[FormationReaction]")
     REQUIRE( Cp0(C.reaction(), T, P)  == Approx(Cp0_C) );
     REQUIRE( Cp0(D.reaction(), T, P)  == Approx(Cp0_D) );
     REQUIRE( Cp0(E.reaction(), T, P)  == Approx(Cp0_E) );
+
+    // Checking the calculation with given standard thermodynamic properties of the reactants
+    const auto propsC = C.standardThermoProps(T, P);
+    const auto propsD = D.standardThermoProps(T, P);
+    const auto propsE = E.reaction().standardThermoProps(T, P, { propsC, propsD });
+
+    REQUIRE( propsE.G0  == Approx(G0_E)  );
+    REQUIRE( propsE.H0  == Approx(H0_E)  );
+    REQUIRE( propsE.Cp0 == Approx(Cp0_E) );
+    REQUIRE( propsE.V0  == Approx(E.standardThermoProps(T, P).V0) );
+
+    REQUIRE_THROWS( E.reaction().standardThermoProps(T, P, { propsC }) );
 }
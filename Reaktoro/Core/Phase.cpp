@@ -17,10 +17,14 @@
 
 #include "Phase.hpp"
 
+// C++ includes
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Core/Utils.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsBatch.hpp>
 
 namespace Reaktoro {
 namespace detail {
@@ -36,6 +40,16 @@ auto ensureCommonAggregateState(const SpeciesList& species)
             "aggregate state ", aggregatestate, " while ", s.name(), " has aggregate state ", s.aggregateState(), ".");
 }
 
+/// Used to create the StandardThermoPropsBatch object of a phase only when it is first needed.
+struct LazyStandardThermoPropsBatch
+{
+    /// The flag ensuring the batch is created only once, even if requested by many threads at the same time.
+    std::once_flag once;
+
+    /// The batched evaluator of the standard thermodynamic properties of the species in the phase.
+    StandardThermoPropsBatch batch;
+};
+
 } // namespace detail
 
 struct Phase::Impl
@@ -60,6 +74,9 @@ struct Phase::Impl
 
     /// The molar masses of the species in the phase.
     ArrayXd species_molar_masses;
+
+    /// The batched evaluator of the standard thermodynamic properties of the species in the phase (created on first use).
+    SharedPtr<detail::LazyStandardThermoPropsBatch> standard_thermo_props_batch = std::make_shared<detail::LazyStandardThermoPropsBatch>();
 };
 
 Phase::Phase()
@@ -87,6 +104,7 @@ auto Phase::withSpecies(SpeciesList species) -> Phase
     copy.pimpl->elements = species.elements();
     copy.pimpl->species = std::move(species);
     copy.pimpl->species_molar_masses = detail::molarMasses(copy.pimpl->species);
+    copy.pimpl->standard_thermo_props_batch = std::make_shared<detail::LazyStandardThermoPropsBatch>();
     return copy;
 }
 
@@ -161,6 +179,13 @@ auto Phase::idealActivityModel() const -> const ActivityModel&
     return pimpl->ideal_activity_model;
 }
 
+auto Phase::standardThermoPropsBatch() const -> const StandardThermoPropsBatch&
+{
+    auto& lazy = *pimpl->standard_thermo_props_batch;
+    std::call_once(lazy.once, [&] { lazy.batch = StandardThermoPropsBatch(pimpl->species); });
+    return lazy.batch;
+}
+
 auto operator<(const Phase& lhs, const Phase& rhs) -> bool
 {
     return lhs.name() < rhs.name();
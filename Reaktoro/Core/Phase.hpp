@@ -26,6 +26,9 @@
 
 namespace Reaktoro {
 
+// Forward declarations
+class StandardThermoPropsBatch;
+
 /// A type used to define a phase and its attributes.
 /// @see ChemicalSystem, Element, Species
 /// @ingroup Core
@@ -83,6 +86,14 @@ public:
     /// Return the function that computes ideal activity properties of the phase.
     auto idealActivityModel() const -> const ActivityModel&;
 
+    /// Return the object that evaluates the standard thermodynamic properties of all species in the phase at once.
+    /// This object is created on the first call to this method. It is needed only
+    /// when the chemical properties of the phase are computed on their own
+    /// (e.g., with ChemicalPropsPhase::update), since ChemicalProps evaluates
+    /// the standard thermodynamic properties of all phases in a chemical system
+    /// at once with ChemicalSystem::standardThermoPropsBatch.
+    auto standardThermoPropsBatch() const -> const StandardThermoPropsBatch&;
+
 private:
     struct Impl;
 
@@ -17,6 +17,10 @@
 
 #include "PhaseList.hpp"
 
+// C++ includes
+#include <atomic>
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
@@ -24,21 +28,62 @@
 #include <Reaktoro/Common/StringList.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// The minimum number of species in the phases of a list for which lookup tables are built (smaller lists are searched linearly).
+const auto lookup_threshold = 32;
+
+} // namespace
+
+struct PhaseList::Lookup
+{
+    /// The index of the first phase with a given name.
+    Map<String, Index> names;
+
+    /// The index of the first phase containing a species with a given name.
+    Map<String, Index> species;
+
+    /// The number of species in the phases preceding each phase, followed by the total number of species.
+    Indices offsets = { 0 };
+
+    /// The flag used to build the tables only once, even if requested by several threads.
+    std::once_flag once;
+
+    /// True if the tables have been built.
+    std::atomic<bool> built = false;
+
+    /// Register the phase at given index in the list, which must be the last one registered.
+    auto add(const Phase& phase, Index i) -> void
+    {
+        names.emplace(phase.name(), i);
+        for(const auto& species : phase.species())
+            this->species.emplace(species.name(), i);
+        offsets.push_back(offsets.back() + phase.species().size());
+    }
+};
 
 PhaseList::PhaseList()
 {}
 
 PhaseList::PhaseList(std::initializer_list<Phase> phases)
 : m_phases(std::move(phases))
-{}
+{
+    resetLookup();
+}
 
 PhaseList::PhaseList(const Vec<Phase>& phases)
 : m_phases(phases)
-{}
+{
+    resetLookup();
+}
 
 auto PhaseList::append(const Phase& phase) -> void
 {
     m_phases.push_back(phase);
+    if(!m_lookup || m_lookup.use_count() > 1)
+        resetLookup();
+    else if(m_lookup->built)
+        m_lookup->add(phase, m_phases.size() - 1); // extend the lookup tables in place, since they are not shared with copies of this list
 }
 
 auto PhaseList::data() const -> const Vec<Phase>&
@@ -75,6 +120,7 @@ auto PhaseList::operator[](Index i) const -> const Phase&
 
 auto PhaseList::operator[](Index i) -> Phase&
 {
+    invalidateLookup();
     return m_phases[i];
 }
 
@@ -85,11 +131,22 @@ auto PhaseList::find(const String& name) const -> Index
 
 auto PhaseList::findWithName(const String& name) const -> Index
 {
+    if(const auto table = lookup())
+    {
+        const auto it = table->names.find(name);
+        return it != table->names.end() ? it->second : size();
+    }
     return indexfn(m_phases, RKT_LAMBDA(p, p.name() == name));
 }
 
 auto PhaseList::findWithSpecies(Index index) const -> Index
 {
+    if(const auto table = lookup())
+    {
+        const auto& offsets = table->offsets;
+        const auto it = std::upper_bound(offsets.begin(), offsets.end(), index);
+        return it == offsets.end() ? size() : Index(it - offsets.begin()) - 1;
+    }
     auto counter = 0;
     for(auto i = 0; i < size(); ++i) {
         counter += m_phases[i].species().size();
@@ -101,6 +158,11 @@ auto PhaseList::findWithSpecies(Index index) const -> Index
 
 auto PhaseList::findWithSpecies(const String& name) const -> Index
 {
+    if(const auto table = lookup())
+    {
+        const auto it = table->species.find(name);
+        return it != table->species.end() ? it->second : size();
+    }
     return indexfn(m_phases, RKT_LAMBDA(p, containsfn(p.species(), RKT_LAMBDA(s, s.name() == name))));
 }
 
@@ -249,6 +311,7 @@ auto PhaseList::indicesSpeciesInPhases(const Indices& iphases) const -> Indices
 
 PhaseList::operator Vec<Phase>&()
 {
+    invalidateLookup();
     return m_phases;
 }
 
@@ -257,6 +320,46 @@ PhaseList::operator Vec<Phase>const&() const
     return m_phases;
 }
 
+auto PhaseList::lookup() const -> const Lookup*
+{
+    if(!m_lookup)
+        return nullptr;
+
+    std::call_once(m_lookup->once, [&]
+    {
+        auto num_species = 0;
+        for(const auto& phase : m_phases)
+            num_species += phase.species().size();
+
+        auto& table = *m_lookup;
+        table.names.reserve(m_phases.size());
+        table.species.reserve(num_species);
+        table.offsets.reserve(m_phases.size() + 1);
+        for(auto i = 0; i < m_phases.size(); ++i)
+            table.add(m_phases[i], i);
+        table.built = true;
+    });
+
+    return m_lookup.get();
+}
+
+auto PhaseList::resetLookup() -> void
+{
+    auto num_species = 0;
+    for(const auto& phase : m_phases)
+        num_species += phase.species().size();
+
+    if(m_phases.size() < lookup_threshold && num_species < lookup_threshold)
+        m_lookup.reset();
+    else m_lookup = std::make_shared<Lookup>();
+}
+
+auto PhaseList::invalidateLookup() -> void
+{
+    if(m_lookup && (m_lookup->built || m_lookup.use_count() > 1))
+        resetLookup(); // tables not yet built and owned only by this list are left as they are, since they will be built from the phases as they are then
+}
+
 auto operator+(const PhaseList& a, const PhaseList& b) -> PhaseList
 {
     return concatenate(a, b);
@@ -137,29 +137,48 @@ private:
     /// The phases stored in the list.
     Vec<Phase> m_phases;
 
+    /// The hash tables used to find phases by name and by the names of their species.
+    struct Lookup;
+
+    /// The lookup tables of the list, built on first use and shared among its copies until one of them is changed.
+    /// These tables exist only for lists with many phases. They are built once,
+    /// under `std::call_once`, so that a const list can be searched concurrently.
+    SharedPtr<Lookup> m_lookup;
+
+    /// Return the lookup tables of the list or nullptr if the list is too small to justify them.
+    auto lookup() const -> const Lookup*;
+
+    /// Prepare new lookup tables, to be built on first use, for the current phases in the list.
+    auto resetLookup() -> void;
+
+    /// Prepare new lookup tables before the phases in the list may be changed.
+    /// Tables not yet built and not shared with copies of the list are kept, so
+    /// that repeated mutable access to the phases does not allocate new ones.
+    auto invalidateLookup() -> void;
+
 public:
     /// Construct an PhaseList object with given begin and end iterators.
     template<typename InputIterator>
-    PhaseList(InputIterator begin, InputIterator end) : m_phases(begin, end) {}
+    PhaseList(InputIterator begin, InputIterator end) : m_phases(begin, end) { resetLookup(); }
 
     /// Return begin const iterator of this PhaseList instance (for STL compatibility reasons).
     auto begin() const { return m_phases.begin(); }
 
     /// Return begin iterator of this PhaseList instance (for STL compatibility reasons).
-    auto begin() { return m_phases.begin(); }
+    auto begin() { invalidateLookup(); return m_phases.begin(); }
 
     /// Return end const iterator of this PhaseList instance (for STL compatibility reasons).
     auto end() const { return m_phases.end(); }
 
     /// Return end iterator of this PhaseList instance (for STL compatibility reasons).
-    auto end() { return m_phases.end(); }
+    auto end() { invalidateLookup(); return m_phases.end(); }
 
     /// Append a new Phase at the back of the container (for STL compatibility reasons).
     auto push_back(const Phase& species) -> void { append(species); }
 
     /// Insert a container of Phase objects into this PhaseList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_phases.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_phases.insert(pos, begin, end); resetLookup(); }
 
     /// The type of the value stored in a PhaseList (for STL compatibility reasons).
     using value_type = Phase;
@@ -332,3 +332,62 @@ TEST_CASE("Testing PhaseList", "[PhaseList]")
     for(auto [i, phase] : enumerate(phases))
         REQUIRE( phase.name() == phases[i].name() );
 }
+
+TEST_CASE("Testing PhaseList with many species", "[PhaseList]")
+{
+    // Large enough to search phases using the hash tables of the list
+    PhaseList phases;
+
+    phases.append(Phase()
+        .withName("AqueousPhase")
+        .withSpecies(SpeciesList("H2O(aq) H+ OH- H2(aq) O2(aq) Na+ Cl- NaCl(aq) CO2(aq) HCO3- CO3-2 CH4(aq) Ca+2 Mg+2 CaCO3(aq) MgCO3(aq)"))
+        .withStateOfMatter(StateOfMatter::Liquid));
+
+    phases.append(Phase()
+        .withName("GaseousPhase")
+        .withSpecies(SpeciesList("H2O(g) CO2(g) CH4(g) O2(g) H2(g) CO(g)"))
+        .withStateOfMatter(StateOfMatter::Gas));
+
+    phases.append(Phase()
+        .withName("EmptyPhase")
+        .withStateOfMatter(StateOfMatter::Gas));
+
+    for(auto i = 0; i < 12; ++i)
+        phases.append(Phase()
+            .withName("Mineral" + std::to_string(i))
+            .withSpecies({ Species("CaCO3(s)").withName("Mineral" + std::to_string(i)) })
+            .withStateOfMatter(StateOfMatter::Solid));
+
+    REQUIRE( phases.species().size() == 34 );
+
+    CHECK( phases.findWithName("AqueousPhase") == 0 );
+    CHECK( phases.findWithName("GaseousPhase") == 1 );
+    CHECK( phases.findWithName("EmptyPhase")   == 2 );
+    CHECK( phases.findWithName("Mineral11")    == 14 );
+    CHECK( phases.findWithName("Mineral12")    == phases.size() );
+
+    CHECK( phases.findWithSpecies("H2O(aq)")   == 0 );
+    CHECK( phases.findWithSpecies("MgCO3(aq)") == 0 );
+    CHECK( phases.findWithSpecies("CO(g)")     == 1 );
+    CHECK( phases.findWithSpecies("Mineral0")  == 3 );
+    CHECK( phases.findWithSpecies("Mineral11") == 14 );
+    CHECK( phases.findWithSpecies("Calcite")   == phases.size() );
+
+    CHECK( phases.findWithSpecies(0)  == 0 );
+    CHECK( phases.findWithSpecies(15) == 0 );
+    CHECK( phases.findWithSpecies(16) == 1 );
+    CHECK( phases.findWithSpecies(21) == 1 );
+    CHECK( phases.findWithSpecies(22) == 3 );
+    CHECK( phases.findWithSpecies(33) == 14 );
+    CHECK( phases.findWithSpecies(34) == phases.size() );
+
+    phases[3] = Phase()
+        .withName("Calcite")
+        .withSpecies({ Species("CaCO3(s)").withName("Calcite") })
+        .withStateOfMatter(StateOfMatter::Solid);
+
+    CHECK( phases.findWithName("Calcite")     == 3 );
+    CHECK( phases.findWithName("Mineral0")    == phases.size() );
+    CHECK( phases.findWithSpecies("Calcite")  == 3 );
+    CHECK( phases.findWithSpecies("Mineral0") == phases.size() );
+}
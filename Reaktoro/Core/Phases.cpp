@@ -22,6 +22,53 @@
 #include <Reaktoro/Common/ParseUtils.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Return the species in a database with given aggregate states selected with given names, element symbols, and excluded tags.
+/// The selection uses only the attributes in Database::speciesInfo so that only the selected Species objects are copied.
+auto selectSpecies(Database const& db, AggregateState aggregatestate, Vec<AggregateState> const& other_aggregate_states, Strings const& names, Strings const& symbols, Strings const& excludetags) -> SpeciesList
+{
+    auto const& infos = db.speciesInfo();
+
+    // The indices of the species with the main aggregate state followed by those with the additional aggregate states
+    Indices candidates;
+    auto const collect_candidates = [&](AggregateState option)
+    {
+        for(auto i = 0; i < infos.size(); ++i)
+            if(infos[i].aggregate_state == option)
+                candidates.push_back(i);
+    };
+
+    collect_candidates(aggregatestate);
+
+    // If additional aggregate states provided, consider also other species in the database
+    for(auto other_aggregate_state : other_aggregate_states)
+        collect_candidates(other_aggregate_state);
+
+    Indices selected;
+
+    if(names.size())
+    {
+        Map<String, Index> candidates_with_name;
+        for(auto const i : candidates)
+            candidates_with_name.emplace(infos[i].name, i);
+        for(auto const& name : names)
+        {
+            auto const it = candidates_with_name.find(name);
+            errorif(it == candidates_with_name.end(), "Could not find any Species object with name ", name, ".");
+            selected.push_back(it->second);
+        }
+    }
+    else selected = filter(candidates, RKT_LAMBDA(i, contained(infos[i].elements, symbols)));
+
+    // Filter out species with provided tags in the exclude function
+    if(excludetags.size())
+        selected = filter(selected, RKT_LAMBDA(i, !contained(excludetags, infos[i].tags)));
+
+    return db.speciesWithIndices(selected);
+}
+
+} // namespace
 
 auto speciate(StringList const& substances) -> Speciate
 {
@@ -163,24 +210,7 @@ auto GeneralPhase::convert(const Database& db, const Strings& elements) const ->
         "GeneralPhase::convert requires an AggregateState value to be specified.\n"
         "Use method GeneralPhase::setAggregateState to fix this.");
 
-    auto species = db.speciesWithAggregateState(aggregatestate);
-
-    // If additional aggregate states provided, consider also other species in the database
-    for(auto other_aggregate_state : other_aggregate_states)
-    {
-        auto other_species = db.speciesWithAggregateState(other_aggregate_state);
-        if(other_species.size())
-            species = concatenate(species, other_species);
-    }
-
-    species =
-        names.size() ? species.withNames(names) :
-        symbols.size() ? species.withElements(symbols) :
-            species.withElements(elements);
-
-    // Filter out species with provided tags in the exclude function
-    if(excludetags.size())
-        species = species.withoutTags(excludetags);
+    auto const species = selectSpecies(db, aggregatestate, other_aggregate_states, names, symbols.size() ? symbols : elements, excludetags);
 
     errorif(species.empty(), "Expecting at least one species when defining a phase, but none was provided. Make sure you have listed the species names yourself or used the `speciate` method appropriately.")
 
@@ -303,24 +333,7 @@ auto GeneralPhasesGenerator::convert(const Database& db, const Strings& elements
         "GeneralPhasesGenerator::convert requires an AggregateState value to be specified. "
         "Use method GeneralPhasesGenerator::set(AggregateState) to fix this.");
 
-    auto species = db.speciesWithAggregateState(aggregatestate);
-
-    // If additional aggregate states provided, consider also other species in the database
-    for(auto other_aggregate_state : other_aggregate_states)
-    {
-        auto other_species = db.speciesWithAggregateState(other_aggregate_state);
-        if(other_species.size())
-            species = concatenate(species, other_species);
-    }
-
-    species =
-        names.size() ? species.withNames(names) :
-        symbols.size() ? species.withElements(symbols) :
-            species.withElements(elements);
-
-    // Filter out species with provided tags in the exclude function
-    if(excludetags.size())
-        species = species.withoutTags(excludetags);
+    auto const species = selectSpecies(db, aggregatestate, other_aggregate_states, names, symbols.size() ? symbols : elements, excludetags);
 
     errorif(species.empty(), "Expecting at least one species when defining a list of single-species phases, but none was provided. Make sure you have listed the species names yourself or used the `speciate` method appropriately.")
 
@@ -384,8 +397,8 @@ auto Phases::convert() const -> Vec<Phase>
             if(phase.elements().size())
                 result = merge(result, phase.elements());
             if(phase.species().size())
-                for(auto&& s : db.species().withNames(phase.species()))
-                    result = merge(result, s.elements().symbols());
+                for(auto&& name : phase.species())
+                    result = merge(result, db.species(name).elements().symbols());
             if(phase.aggregateState() == AggregateState::Aqueous)
                 result = merge(result, Strings{"H", "O"}); // ensure both H and O are considered in case there is aqueous phases
             return result;
@@ -17,205 +17,408 @@
 
 #include "Prop.hpp"
 
+// C++ includes
+#include <sstream>
+
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
-#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Common/StringUtils.hpp>
+#include <Reaktoro/Common/Units.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// Return the property function that evaluates the amount of an element among the species in a range of indices, multiplied by a factor.
+/// Only the species containing the element are considered in the evaluation.
+auto elementAmountAmongSpeciesFn(const ChemicalSystem& system, Index ielement, Index ibegin, Index size, double factor) -> PropFn
+{
+    const auto A = system.formulaMatrixElements();
+
+    Indices ispecies;
+    Vec<double> coeffs;
+    for(auto i = ibegin; i < ibegin + size; ++i)
+    {
+        if(A(ielement, i) == 0.0)
+            continue;
+        ispecies.push_back(i);
+        coeffs.push_back(factor * A(ielement, i));
+    }
+
+    return [=](const ChemicalProps& props) -> real
+    {
+        const auto n = props.speciesAmounts();
+        real sum = 0.0;
+        for(auto k = 0; k < ispecies.size(); ++k)
+            sum += coeffs[k] * n[ispecies[k]];
+        return sum;
+    };
+}
+
+/// Used to describe a quantity that can be given in the expressions used to construct Prop objects.
+struct PropQuantity
+{
+    /// The number of arguments of the quantity (e.g., names of species, elements, phases).
+    Index numargs;
+
+    /// The units of the evaluated quantity.
+    String units;
+
+    /// The function that creates the Prop object for the quantity.
+    Fn<Prop(const ChemicalSystem&, const Strings&)> create;
+};
+
+/// Return the quantities that can be given in the expressions used to construct Prop objects.
+auto propQuantities() -> const Map<String, PropQuantity>&
+{
+    static const Map<String, PropQuantity> quantities = {
+        { "elementAmount",                       { 1, "mol",       [](auto const& system, auto const& args) { return Prop::elementAmount(system, args[0]); } } },
+        { "elementAmountInPhase",                { 2, "mol",       [](auto const& system, auto const& args) { return Prop::elementAmountInPhase(system, args[0], args[1]); } } },
+        { "elementMass",                         { 1, "kg",        [](auto const& system, auto const& args) { return Prop::elementMass(system, args[0]); } } },
+        { "elementMassInPhase",                  { 2, "kg",        [](auto const& system, auto const& args) { return Prop::elementMassInPhase(system, args[0], args[1]); } } },
+        { "speciesAmount",                       { 1, "mol",       [](auto const& system, auto const& args) { return Prop::speciesAmount(system, args[0]); } } },
+        { "speciesMass",                         { 1, "kg",        [](auto const& system, auto const& args) { return Prop::speciesMass(system, args[0]); } } },
+        { "speciesMoleFraction",                 { 1, "",          [](auto const& system, auto const& args) { return Prop::speciesMoleFraction(system, args[0]); } } },
+        { "speciesActivityCoefficient",          { 1, "",          [](auto const& system, auto const& args) { return Prop::speciesActivityCoefficient(system, args[0]); } } },
+        { "speciesActivity",                     { 1, "",          [](auto const& system, auto const& args) { return Prop::speciesActivity(system, args[0]); } } },
+        { "speciesChemicalPotential",            { 1, "J/mol",     [](auto const& system, auto const& args) { return Prop::speciesChemicalPotential(system, args[0]); } } },
+        { "speciesStandardVolume",               { 1, "m3/mol",    [](auto const& system, auto const& args) { return Prop::speciesStandardVolume(system, args[0]); } } },
+        { "speciesStandardGibbsEnergy",          { 1, "J/mol",     [](auto const& system, auto const& args) { return Prop::speciesStandardGibbsEnergy(system, args[0]); } } },
+        { "speciesStandardEnthalpy",             { 1, "J/mol",     [](auto const& system, auto const& args) { return Prop::speciesStandardEnthalpy(system, args[0]); } } },
+        { "speciesStandardEntropy",              { 1, "J/(mol*K)", [](auto const& system, auto const& args) { return Prop::speciesStandardEntropy(system, args[0]); } } },
+        { "speciesStandardInternalEnergy",       { 1, "J/mol",     [](auto const& system, auto const& args) { return Prop::speciesStandardInternalEnergy(system, args[0]); } } },
+        { "speciesStandardHelmholtzEnergy",      { 1, "J/mol",     [](auto const& system, auto const& args) { return Prop::speciesStandardHelmholtzEnergy(system, args[0]); } } },
+        { "speciesStandardHeatCapacitiesConstP", { 1, "J/(mol*K)", [](auto const& system, auto const& args) { return Prop::speciesStandardHeatCapacitiesConstP(system, args[0]); } } },
+        { "speciesStandardHeatCapacitiesConstV", { 1, "J/(mol*K)", [](auto const& system, auto const& args) { return Prop::speciesStandardHeatCapacitiesConstV(system, args[0]); } } },
+        { "phaseAmount",                         { 1, "mol",       [](auto const& system, auto const& args) { return Prop::phaseAmount(system, args[0]); } } },
+        { "phaseMass",                           { 1, "kg",        [](auto const& system, auto const& args) { return Prop::phaseMass(system, args[0]); } } },
+        { "phaseVolume",                         { 1, "m3",        [](auto const& system, auto const& args) { return Prop::phaseVolume(system, args[0]); } } },
+        { "phaseGibbsEnergy",                    { 1, "J",         [](auto const& system, auto const& args) { return Prop::phaseGibbsEnergy(system, args[0]); } } },
+        { "phaseEnthalpy",                       { 1, "J",         [](auto const& system, auto const& args) { return Prop::phaseEnthalpy(system, args[0]); } } },
+        { "phaseEntropy",                        { 1, "J/K",       [](auto const& system, auto const& args) { return Prop::phaseEntropy(system, args[0]); } } },
+        { "phaseInternalEnergy",                 { 1, "J",         [](auto const& system, auto const& args) { return Prop::phaseInternalEnergy(system, args[0]); } } },
+        { "phaseHelmholtzEnergy",                { 1, "J",         [](auto const& system, auto const& args) { return Prop::phaseHelmholtzEnergy(system, args[0]); } } },
+        { "temperature",                         { 0, "K",         [](auto const& system, auto const& args) { return Prop::temperature(system); } } },
+        { "pressure",                            { 0, "Pa",        [](auto const& system, auto const& args) { return Prop::pressure(system); } } },
+        { "amount",                              { 0, "mol",       [](auto const& system, auto const& args) { return Prop::amount(system); } } },
+        { "mass",                                { 0, "kg",        [](auto const& system, auto const& args) { return Prop::mass(system); } } },
+        { "volume",                              { 0, "m3",        [](auto const& system, auto const& args) { return Prop::volume(system); } } },
+        { "gibbsEnergy",                         { 0, "J",         [](auto const& system, auto const& args) { return Prop::gibbsEnergy(system); } } },
+        { "enthalpy",                            { 0, "J",         [](auto const& system, auto const& args) { return Prop::enthalpy(system); } } },
+        { "entropy",                             { 0, "J/K",       [](auto const& system, auto const& args) { return Prop::entropy(system); } } },
+        { "internalEnergy",                      { 0, "J",         [](auto const& system, auto const& args) { return Prop::internalEnergy(system); } } },
+        { "helmholtzEnergy",                     { 0, "J",         [](auto const& system, auto const& args) { return Prop::helmholtzEnergy(system); } } },
+        { "pH",                                  { 0, "",          [](auto const& system, auto const& args) { return Prop::pH(system); } } },
+    };
+    return quantities;
+}
+
+/// Return the property function for a quantity expression such as `"phaseVolume(GaseousPhase units=cm3)"`.
+auto createPropFn(const ChemicalSystem& system, const String& quantity) -> PropFn
+{
+    const auto expr = trim(quantity);
+    const auto ibegin = expr.find('(');
+    const auto name = expr.substr(0, ibegin);
+
+    Strings args;
+    String units;
+
+    if(ibegin != String::npos)
+    {
+        errorif(expr.back() != ')', "Expecting quantity expression `", quantity, "` to end with `)`.");
+        std::istringstream ss(expr.substr(ibegin + 1, expr.size() - ibegin - 2)); // the arguments between the first `(` and the last `)`, so that names such as H2O(aq) are kept whole
+        for(String arg; ss >> arg;)
+            if(startswith(arg, "units=")) units = arg.substr(6);
+            else args.push_back(arg);
+    }
+
+    auto const& quantities = propQuantities();
+    const auto it = quantities.find(name);
+
+    errorif(it == quantities.end(), "There is no quantity named `", name, "` that can be used in quantity expression `", quantity, "`.");
+
+    auto const& [numargs, defaultunits, create] = it->second;
+
+    errorif(args.size() != numargs, "Expecting ", numargs, " argument(s) for quantity `", name, "` in quantity expression `", quantity, "`, but got ", args.size(), ".");
+
+    const auto prop = create(system, args);
+
+    if(units.empty() || units == defaultunits)
+        return [=](const ChemicalProps& props) -> real { return prop(props); };
+
+    errorifnot(units::convertible(defaultunits, units), "Cannot convert quantity `", name, "` from its units, ", defaultunits, ", to the units ", units, " in quantity expression `", quantity, "`.");
+
+    const auto a = units::slope(defaultunits, units); // the unit conversion is resolved here, so that it is just a linear transformation during evaluation
+    const auto b = units::intercept(defaultunits, units);
+
+    return [=](const ChemicalProps& props) -> real { return prop(props) * a + b; };
+}
+
+} // namespace
 
 Prop::Prop(const PropFn& propfn)
 : propfn(propfn)
 {}
 
-auto Prop::eval(const ChemicalProps& props) -> real
+Prop::Prop(const ChemicalSystem& system, const String& quantity)
+: propfn(createPropFn(system, quantity))
+{}
+
+auto Prop::eval(const ChemicalProps& props) const -> real
 {
     return propfn(props);
 }
 
-auto Prop::operator()(const ChemicalProps& props) -> real
+auto Prop::operator()(const ChemicalProps& props) const -> real
 {
     return propfn(props);
 }
 
 auto Prop::elementAmount(const ChemicalSystem& system, const String& element) -> Prop
 {
-    errorif(true, "Prop::elementAmount has not been implemented yet."); // TODO: Implement method Prop::elementAmount.
+    const auto ielement = system.elements().index(element);
+    return Prop(elementAmountAmongSpeciesFn(system, ielement, 0, system.species().size(), 1.0));
 }
 
 auto Prop::elementAmountInPhase(const ChemicalSystem& system, const String& element, const String& phase) -> Prop
 {
-    errorif(true, "Prop::elementAmountInPhase has not been implemented yet."); // TODO: Implement method Prop::elementAmountInPhase.
+    const auto ielement = system.elements().index(element);
+    const auto iphase = system.phases().index(phase);
+    const auto ibegin = system.phases().numSpeciesUntilPhase(iphase);
+    const auto size = system.phase(iphase).species().size();
+    return Prop(elementAmountAmongSpeciesFn(system, ielement, ibegin, size, 1.0));
 }
 
 auto Prop::elementMass(const ChemicalSystem& system, const String& element) -> Prop
 {
-    errorif(true, "Prop::elementMass has not been implemented yet."); // TODO: Implement method Prop::elementMass.
+    const auto ielement = system.elements().index(element);
+    const auto molarmass = system.element(ielement).molarMass();
+    return Prop(elementAmountAmongSpeciesFn(system, ielement, 0, system.species().size(), molarmass));
 }
 
 auto Prop::elementMassInPhase(const ChemicalSystem& system, const String& element, const String& phase) -> Prop
 {
-    errorif(true, "Prop::elementMassInPhase has not been implemented yet."); // TODO: Implement method Prop::elementMassInPhase.
+    const auto ielement = system.elements().index(element);
+    const auto iphase = system.phases().index(phase);
+    const auto ibegin = system.phases().numSpeciesUntilPhase(iphase);
+    const auto size = system.phase(iphase).species().size();
+    const auto molarmass = system.element(ielement).molarMass();
+    return Prop(elementAmountAmongSpeciesFn(system, ielement, ibegin, size, molarmass));
 }
 
 auto Prop::speciesAmount(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::speciesAmount has not been implemented yet."); // TODO: Implement method Prop::speciesAmount.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return props.speciesAmounts()[i]; });
 }
 
 auto Prop::speciesMass(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::speciesMass has not been implemented yet."); // TODO: Implement method Prop::speciesMass.
+    const auto i = system.species().index(species);
+    const auto molarmass = system.species(i).molarMass();
+    return Prop([=](const ChemicalProps& props) -> real { return props.speciesAmounts()[i] * molarmass; });
 }
 
 auto Prop::speciesMoleFraction(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::moleFraction has not been implemented yet."); // TODO: Implement method Prop::speciesMoleFraction.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return props.speciesMoleFractions()[i]; });
 }
 
 auto Prop::speciesActivityCoefficient(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::activityCoefficient has not been implemented yet."); // TODO: Implement method Prop::speciesActivityCoefficient.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return exp(props.speciesActivityCoefficientsLn()[i]); });
 }
 
 auto Prop::speciesActivity(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::activity has not been implemented yet."); // TODO: Implement method Prop::speciesActivity.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return exp(props.speciesActivitiesLn()[i]); });
 }
 
 auto Prop::speciesChemicalPotential(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::chemicalPotential has not been implemented yet."); // TODO: Implement method Prop::speciesChemicalPotential.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return props.speciesChemicalPotentials()[i]; });
 }
 
 auto Prop::speciesStandardVolume(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::standardVolume has not been implemented yet."); // TODO: Implement method Prop::speciesStandardVolume.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return props.speciesStandardVolumes()[i]; });
 }
 
 auto Prop::speciesStandardGibbsEnergy(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::standardGibbsEnergy has not been implemented yet."); // TODO: Implement method Prop::speciesStandardGibbsEnergy.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return props.speciesStandardGibbsEnergies()[i]; });
 }
 
 auto Prop::speciesStandardEnthalpy(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::standardEnthalpy has not been implemented yet."); // TODO: Implement method Prop::speciesStandardEnthalpy.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return props.speciesStandardEnthalpies()[i]; });
 }
 
 auto Prop::speciesStandardEntropy(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::standardEntropy has not been implemented yet."); // TODO: Implement method Prop::speciesStandardEntropy.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return props.speciesStandardEntropy(i); });
 }
 
 auto Prop::speciesStandardInternalEnergy(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::standardInternalEnergy has not been implemented yet."); // TODO: Implement method Prop::speciesStandardInternalEnergy.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return props.speciesStandardInternalEnergy(i); });
 }
 
 auto Prop::speciesStandardHelmholtzEnergy(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::standardHelmholtzEnergy has not been implemented yet."); // TODO: Implement method Prop::speciesStandardHelmholtzEnergy.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return props.speciesStandardHelmholtzEnergy(i); });
 }
 
 auto Prop::speciesStandardHeatCapacitiesConstP(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::speciesStandardHeatCapacitiesConstP has not been implemented yet."); // TODO: Implement method Prop::speciesStandardHeatCapacitiesConstP.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return props.speciesStandardHeatCapacitiesConstP()[i]; });
 }
 
 auto Prop::speciesStandardHeatCapacitiesConstV(const ChemicalSystem& system, const String& species) -> Prop
 {
-    errorif(true, "Prop::speciesStandardHeatCapacitiesConstV has not been implemented yet."); // TODO: Implement method Prop::speciesStandardHeatCapacitiesConstV.
+    const auto i = system.species().index(species);
+    return Prop([=](const ChemicalProps& props) -> real { return props.speciesStandardHeatCapacityConstV(i); });
 }
 
 auto Prop::phaseAmount(const ChemicalSystem& system, const String& phase) -> Prop
 {
-    errorif(true, "Prop::phaseAmount has not been implemented yet."); // TODO: Implement method Prop::phaseAmount.
+    const auto i = system.phases().index(phase);
+    return Prop([=](const ChemicalProps& props) -> real { return props.phaseProps(i).amount(); });
 }
 
 auto Prop::phaseMass(const ChemicalSystem& system, const String& phase) -> Prop
 {
-    errorif(true, "Prop::phaseMass has not been implemented yet."); // TODO: Implement method Prop::phaseMass.
+    const auto i = system.phases().index(phase);
+    return Prop([=](const ChemicalProps& props) -> real { return props.phaseProps(i).mass(); });
 }
 
 auto Prop::phaseVolume(const ChemicalSystem& system, const String& phase) -> Prop
 {
-    errorif(true, "Prop::phaseVolume has not been implemented yet."); // TODO: Implement method Prop::phaseVolume.
+    const auto i = system.phases().index(phase);
+    return Prop([=](const ChemicalProps& props) -> real { return props.phaseProps(i).volume(); });
 }
 
 auto Prop::phaseGibbsEnergy(const ChemicalSystem& system, const String& phase) -> Prop
 {
-    errorif(true, "Prop::phaseGibbsEnergy has not been implemented yet."); // TODO: Implement method Prop::phaseGibbsEnergy.
+    const auto i = system.phases().index(phase);
+    return Prop([=](const ChemicalProps& props) -> real { return props.phaseProps(i).gibbsEnergy(); });
 }
 
 auto Prop::phaseEnthalpy(const ChemicalSystem& system, const String& phase) -> Prop
 {
-    errorif(true, "Prop::phaseEnthalpy has not been implemented yet."); // TODO: Implement method Prop::phaseEnthalpy.
+    const auto i = system.phases().index(phase);
+    return Prop([=](const ChemicalProps& props) -> real { return props.phaseProps(i).enthalpy(); });
 }
 
 auto Prop::phaseEntropy(const ChemicalSystem& system, const String& phase) -> Prop
 {
-    errorif(true, "Prop::phaseEntropy has not been implemented yet."); // TODO: Implement method Prop::phaseEntropy.
+    const auto i = system.phases().index(phase);
+    return Prop([=](const ChemicalProps& props) -> real { return props.phaseProps(i).entropy(); });
 }
 
 auto Prop::phaseInternalEnergy(const ChemicalSystem& system, const String& phase) -> Prop
 {
-    errorif(true, "Prop::phaseInternalEnergy has not been implemented yet."); // TODO: Implement method Prop::phaseInternalEnergy.
+    const auto i = system.phases().index(phase);
+    return Prop([=](const ChemicalProps& props) -> real { return props.phaseProps(i).internalEnergy(); });
 }
 
 auto Prop::phaseHelmholtzEnergy(const ChemicalSystem& system, const String& phase) -> Prop
 {
-    errorif(true, "Prop::phaseHelmholtzEnergy has not been implemented yet."); // TODO: Implement method Prop::phaseHelmholtzEnergy.
+    const auto i = system.phases().index(phase);
+    return Prop([=](const ChemicalProps& props) -> real { return props.phaseProps(i).helmholtzEnergy(); });
 }
 
 auto Prop::temperature(const ChemicalSystem& system) -> Prop
 {
-    errorif(true, "Prop::temperature has not been implemented yet."); // TODO: Implement method Prop::temperature.
+    return Prop([=](const ChemicalProps& props) -> real { return props.temperature(); });
 }
 
 auto Prop::pressure(const ChemicalSystem& system) -> Prop
 {
-    errorif(true, "Prop::pressure has not been implemented yet."); // TODO: Implement method Prop::pressure.
+    return Prop([=](const ChemicalProps& props) -> real { return props.pressure(); });
 }
 
 auto Prop::amount(const ChemicalSystem& system) -> Prop
 {
-    errorif(true, "Prop::amount has not been implemented yet."); // TODO: Implement method Prop::amount.
+    return Prop([=](const ChemicalProps& props) -> real { return props.amount(); });
 }
 
 auto Prop::mass(const ChemicalSystem& system) -> Prop
 {
-    errorif(true, "Prop::mass has not been implemented yet."); // TODO: Implement method Prop::mass.
+    return Prop([=](const ChemicalProps& props) -> real { return props.mass(); });
 }
 
 auto Prop::volume(const ChemicalSystem& system) -> Prop
 {
-    errorif(true, "Prop::volume has not been implemented yet."); // TODO: Implement method Prop::volume.
+    return Prop([=](const ChemicalProps& props) -> real { return props.volume(); });
 }
 
 auto Prop::gibbsEnergy(const ChemicalSystem& system) -> Prop
 {
-    errorif(true, "Prop::gibbsEnergy has not been implemented yet."); // TODO: Implement method Prop::gibbsEnergy.
+    return Prop([=](const ChemicalProps& props) -> real { return props.gibbsEnergy(); });
 }
 
 auto Prop::enthalpy(const ChemicalSystem& system) -> Prop
 {
-    errorif(true, "Prop::enthalpy has not been implemented yet."); // TODO: Implement method Prop::enthalpy.
+    return Prop([=](const ChemicalProps& props) -> real { return props.enthalpy(); });
 }
 
 auto Prop::entropy(const ChemicalSystem& system) -> Prop
 {
-    errorif(true, "Prop::entropy has not been implemented yet."); // TODO: Implement method Prop::entropy.
+    return Prop([=](const ChemicalProps& props) -> real { return props.entropy(); });
 }
 
 auto Prop::internalEnergy(const ChemicalSystem& system) -> Prop
 {
-    errorif(true, "Prop::internalEnergy has not been implemented yet."); // TODO: Implement method Prop::internalEnergy.
+    return Prop([=](const ChemicalProps& props) -> real { return props.internalEnergy(); });
 }
 
 auto Prop::helmholtzEnergy(const ChemicalSystem& system) -> Prop
 {
-    errorif(true, "Prop::helmholtzEnergy has not been implemented yet."); // TODO: Implement method Prop::helmholtzEnergy.
+    return Prop([=](const ChemicalProps& props) -> real { return props.helmholtzEnergy(); });
+}
+
+auto Prop::pH(const ChemicalSystem& system) -> Prop
+{
+    const auto numspecies = system.species().size();
+    auto i = system.species().findWithFormula("H+");
+    if(i >= numspecies)
+        i = system.species().findWithFormula("H3O+");
+    errorif(i >= numspecies, "Cannot create a property function for pH because there is no species with formula H+ or H3O+ in the chemical system.");
+    return Prop([=](const ChemicalProps& props) -> real { return -props.speciesActivitiesLn()[i] / ln10; });
+}
+
+auto evalProps(const Vec<Prop>& props, const Vec<ChemicalProps>& chemprops, MatrixXdRef values) -> void
+{
+    errorif(values.rows() != chemprops.size() || values.cols() != props.size(), "Expecting a matrix with ", chemprops.size(), " rows and ", props.size(), " columns for the evaluation of properties, but got a matrix with ", values.rows(), " rows and ", values.cols(), " columns.");
+    for(auto i = 0; i < chemprops.size(); ++i)
+        for(auto j = 0; j < props.size(); ++j)
+            values(i, j) = double(props[j](chemprops[i]));
+}
+
+auto evalProps(const Vec<Prop>& props, const Vec<ChemicalState>& states, MatrixXdRef values) -> void
+{
+    errorif(values.rows() != states.size() || values.cols() != props.size(), "Expecting a matrix with ", states.size(), " rows and ", props.size(), " columns for the evaluation of properties, but got a matrix with ", values.rows(), " rows and ", values.cols(), " columns.");
+    for(auto i = 0; i < states.size(); ++i)
+    {
+        auto const& chemprops = states[i].props();
+        for(auto j = 0; j < props.size(); ++j)
+            values(i, j) = double(props[j](chemprops));
+    }
 }
 
 } // namespace Reaktoro
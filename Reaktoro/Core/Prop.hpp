@@ -18,12 +18,14 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Types.hpp>
 
 namespace Reaktoro {
 
 // Forward declarations
 class ChemicalProps;
+class ChemicalState;
 class ChemicalSystem;
 
 /// The function type for evaluation of a property of a chemical system.
@@ -32,19 +34,39 @@ class ChemicalSystem;
 using PropFn = Fn<real(const ChemicalProps& props)>;
 
 /// Used to retrieve a specified property from the chemical properties of a system.
+/// The names of elements, species, and phases given to the static factory
+/// methods below (or in the quantity expression given to the constructor)
+/// are resolved to indices only once, when the Prop object is created. The
+/// evaluation of the property then only reads the chemical properties at
+/// these indices, without name lookups or memory allocations. This makes
+/// Prop objects suitable for evaluation in loops (e.g., output of many
+/// chemical states with @ref evalProps or ChemicalOutput).
 class Prop
 {
 public:
     /// Construct a Prop evaluator object with given property evaluation function.
     explicit Prop(const PropFn& propfn);
 
+    /// Construct a Prop evaluator object for a quantity expression such as `"speciesAmount(H2O(aq))"`.
+    /// The expression is the name of one of the static factory methods in
+    /// this class, followed by its arguments between parentheses and
+    /// separated by spaces (e.g., `"elementAmountInPhase(Ca AqueousPhase)"`).
+    /// Parentheses can be omitted when there are no arguments (e.g., `"pH"`).
+    /// The units of the evaluated property can be specified as an extra
+    /// argument (e.g., `"phaseVolume(GaseousPhase units=cm3)"`,
+    /// `"temperature(units=celsius)"`); otherwise, the units documented in the
+    /// corresponding factory method are used.
+    /// @param system The chemical system in which the property is evaluated.
+    /// @param quantity The expression of the quantity to be evaluated.
+    Prop(const ChemicalSystem& system, const String& quantity);
+
     /// Evaluate the property with given chemical properties of the system.
     /// @param props The already evaluated chemical properties of the system.
-    auto eval(const ChemicalProps& props) -> real;
+    auto eval(const ChemicalProps& props) const -> real;
 
     /// Evaluate the property with given chemical properties of the system.
     /// @param props The already evaluated chemical properties of the system.
-    auto operator()(const ChemicalProps& props) -> real;
+    auto operator()(const ChemicalProps& props) const -> real;
 
     /// Return a property function that evaluates the amount of an element in the system (in mol).
     static auto elementAmount(const ChemicalSystem& system, const String& element) -> Prop;
@@ -154,9 +176,24 @@ public:
     /// Return a property function that evaluates the Helmholtz energy of formation of the system (in J).
     static auto helmholtzEnergy(const ChemicalSystem& system) -> Prop;
 
+    /// Return a property function that evaluates the pH of the aqueous phase in the system, from the activity of species H+ (or H3O+).
+    static auto pH(const ChemicalSystem& system) -> Prop;
+
 private:
     /// The function that evaluates/retrieves a property of a chemical system.
     PropFn propfn;
 };
 
+/// Evaluate many properties for the chemical properties of many chemical systems into a matrix.
+/// @param props The property evaluators, one for each column of `values`.
+/// @param chemprops The already evaluated chemical properties, one for each row of `values`.
+/// @param[out] values The matrix with the evaluated properties, with dimensions already equal to (number of chemical properties) x (number of property evaluators).
+auto evalProps(const Vec<Prop>& props, const Vec<ChemicalProps>& chemprops, MatrixXdRef values) -> void;
+
+/// Evaluate many properties for many chemical states into a matrix.
+/// @param props The property evaluators, one for each column of `values`.
+/// @param states The chemical states, with their chemical properties already evaluated, one for each row of `values`.
+/// @param[out] values The matrix with the evaluated properties, with dimensions already equal to (number of chemical states) x (number of property evaluators).
+auto evalProps(const Vec<Prop>& props, const Vec<ChemicalState>& states, MatrixXdRef values) -> void;
+
 } // namespace Reaktoro
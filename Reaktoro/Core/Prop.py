@@ -0,0 +1,59 @@
+# Reaktoro is a unified framework for modeling chemically reactive systems.
+#
+# Copyright © 2014-2024 Allan Leal
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+from reaktoro import *
+from math import log
+import pytest
+
+
+def testProp():
+    db = SupcrtDatabase("supcrtbl")
+
+    system = ChemicalSystem(db, AqueousPhase("H2O(aq) H+ OH- Na+ Cl-"))
+
+    states = []
+    for i in range(3):
+        state = ChemicalState(system)
+        state.temperature(25.0 + i, "celsius")
+        state.set("H2O(aq)", 1.0, "kg")
+        state.set("Na+", 0.1 * (i + 1), "mol")
+        state.set("Cl-", 0.1 * (i + 1), "mol")
+        states.append(state)
+
+    props = states[0].props()
+
+    assert Prop.speciesAmount(system, "Na+")(props) == props.speciesAmount("Na+")
+    assert Prop.elementAmount(system, "Cl").eval(props) == pytest.approx(props.elementAmount("Cl"))
+    assert Prop(system, "temperature(units=celsius)")(props) == pytest.approx(25.0)
+    assert Prop(system, "speciesAmount(Na+ units=mmol)")(props) == pytest.approx(100.0)
+    assert Prop(system, "pH")(props) == pytest.approx(-props.speciesActivityLn("H+") / log(10))
+
+    with pytest.raises(Exception):
+        Prop(system, "unknownQuantity(Na+)")
+
+    quantities = [
+        Prop(system, "temperature(units=celsius)"),
+        Prop(system, "speciesAmount(Na+)"),
+    ]
+
+    values = evalProps(quantities, states)
+
+    assert values.shape == (3, 2)
+    for i, state in enumerate(states):
+        assert values[i, 0] == pytest.approx(25.0 + i)
+        assert values[i, 1] == pytest.approx(0.1 * (i + 1))
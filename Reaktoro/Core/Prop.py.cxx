@@ -0,0 +1,87 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Prop.hpp>
+using namespace Reaktoro;
+
+void exportProp(py::module& m)
+{
+    py::class_<Prop>(m, "Prop")
+        .def(py::init<const PropFn&>())
+        .def(py::init<const ChemicalSystem&, const String&>())
+        .def("eval", &Prop::eval)
+        .def("__call__", &Prop::operator())
+        .def_static("elementAmount",                       &Prop::elementAmount)
+        .def_static("elementAmountInPhase",                &Prop::elementAmountInPhase)
+        .def_static("elementMass",                         &Prop::elementMass)
+        .def_static("elementMassInPhase",                  &Prop::elementMassInPhase)
+        .def_static("speciesAmount",                       &Prop::speciesAmount)
+        .def_static("speciesMass",                         &Prop::speciesMass)
+        .def_static("speciesMoleFraction",                 &Prop::speciesMoleFraction)
+        .def_static("speciesActivityCoefficient",          &Prop::speciesActivityCoefficient)
+        .def_static("speciesActivity",                     &Prop::speciesActivity)
+        .def_static("speciesChemicalPotential",            &Prop::speciesChemicalPotential)
+        .def_static("speciesStandardVolume",               &Prop::speciesStandardVolume)
+        .def_static("speciesStandardGibbsEnergy",          &Prop::speciesStandardGibbsEnergy)
+        .def_static("speciesStandardEnthalpy",             &Prop::speciesStandardEnthalpy)
+        .def_static("speciesStandardEntropy",              &Prop::speciesStandardEntropy)
+        .def_static("speciesStandardInternalEnergy",       &Prop::speciesStandardInternalEnergy)
+        .def_static("speciesStandardHelmholtzEnergy",      &Prop::speciesStandardHelmholtzEnergy)
+        .def_static("speciesStandardHeatCapacitiesConstP", &Prop::speciesStandardHeatCapacitiesConstP)
+        .def_static("speciesStandardHeatCapacitiesConstV", &Prop::speciesStandardHeatCapacitiesConstV)
+        .def_static("phaseAmount",                         &Prop::phaseAmount)
+        .def_static("phaseMass",                           &Prop::phaseMass)
+        .def_static("phaseVolume",                         &Prop::phaseVolume)
+        .def_static("phaseGibbsEnergy",                    &Prop::phaseGibbsEnergy)
+        .def_static("phaseEnthalpy",                       &Prop::phaseEnthalpy)
+        .def_static("phaseEntropy",                        &Prop::phaseEntropy)
+        .def_static("phaseInternalEnergy",                 &Prop::phaseInternalEnergy)
+        .def_static("phaseHelmholtzEnergy",                &Prop::phaseHelmholtzEnergy)
+        .def_static("temperature",                         &Prop::temperature)
+        .def_static("pressure",                            &Prop::pressure)
+        .def_static("amount",                              &Prop::amount)
+        .def_static("mass",                                &Prop::mass)
+        .def_static("volume",                              &Prop::volume)
+        .def_static("gibbsEnergy",                         &Prop::gibbsEnergy)
+        .def_static("enthalpy",                            &Prop::enthalpy)
+        .def_static("entropy",                             &Prop::entropy)
+        .def_static("internalEnergy",                      &Prop::internalEnergy)
+        .def_static("helmholtzEnergy",                     &Prop::helmholtzEnergy)
+        .def_static("pH",                                  &Prop::pH)
+        ;
+
+    m.def("evalProps", [](const Vec<Prop>& props, const Vec<ChemicalProps>& chemprops)
+    {
+        MatrixXd values(chemprops.size(), props.size());
+        evalProps(props, chemprops, values);
+        return values;
+    });
+
+    m.def("evalProps", [](const Vec<Prop>& props, const Vec<ChemicalState>& states)
+    {
+        MatrixXd values(states.size(), props.size());
+        evalProps(props, states, values);
+        return values;
+    });
+}
@@ -0,0 +1,187 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
+#include <Reaktoro/Core/ChemicalProps.hpp>
+#include <Reaktoro/Core/ChemicalState.hpp>
+#include <Reaktoro/Core/ChemicalSystem.hpp>
+#include <Reaktoro/Core/Prop.hpp>
+using namespace Reaktoro;
+
+namespace test {
+
+/// Return a mock ChemicalSystem object for test reasons.
+auto createChemicalSystem() -> ChemicalSystem;
+
+} // namespace test
+
+TEST_CASE("Testing Prop class", "[Prop]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    ChemicalState state(system);
+    state.setTemperature(345.0);
+    state.setPressure(2.0e5);
+    for(auto i = 0; i < system.species().size(); ++i)
+        state.setSpeciesAmount(i, 0.5 + 0.1 * i);
+
+    ChemicalProps props(state);
+
+    SECTION("Testing the Prop factories")
+    {
+        CHECK( Prop::elementAmount(system, "C")(props)                                     == Approx(props.elementAmount("C")) );
+        CHECK( Prop::elementAmountInPhase(system, "C", "GaseousPhase")(props)              == Approx(props.elementAmountInPhase("C", "GaseousPhase")) );
+        CHECK( Prop::elementMass(system, "Na")(props)                                      == Approx(props.elementMass("Na")) );
+        CHECK( Prop::elementMassInPhase(system, "Na", "AqueousPhase")(props)               == Approx(props.elementMassInPhase("Na", "AqueousPhase")) );
+        CHECK( Prop::speciesAmount(system, "CO2(g)")(props)                                == Approx(props.speciesAmount("CO2(g)")) );
+        CHECK( Prop::speciesMass(system, "CO2(g)")(props)                                  == Approx(props.speciesMass("CO2(g)")) );
+        CHECK( Prop::speciesMoleFraction(system, "CO2(g)")(props)                          == Approx(props.speciesMoleFraction("CO2(g)")) );
+        CHECK( Prop::speciesActivityCoefficient(system, "Na+(aq)")(props)                  == Approx(props.speciesActivityCoefficient("Na+(aq)")) );
+        CHECK( Prop::speciesActivity(system, "Na+(aq)")(props)                             == Approx(props.speciesActivity("Na+(aq)")) );
+        CHECK( Prop::speciesChemicalPotential(system, "Na+(aq)")(props)                    == Approx(props.speciesChemicalPotential("Na+(aq)")) );
+        CHECK( Prop::speciesStandardVolume(system, "Na+(aq)")(props)                       == Approx(props.speciesStandardVolume("Na+(aq)")) );
+        CHECK( Prop::speciesStandardGibbsEnergy(system, "Na+(aq)")(props)                  == Approx(props.speciesStandardGibbsEnergy("Na+(aq)")) );
+        CHECK( Prop::speciesStandardEnthalpy(system, "Na+(aq)")(props)                     == Approx(props.speciesStandardEnthalpy("Na+(aq)")) );
+        CHECK( Prop::speciesStandardEntropy(system, "Na+(aq)")(props)                      == Approx(props.speciesStandardEntropy("Na+(aq)")) );
+        CHECK( Prop::speciesStandardInternalEnergy(system, "Na+(aq)")(props)               == Approx(props.speciesStandardInternalEnergy("Na+(aq)")) );
+        CHECK( Prop::speciesStandardHelmholtzEnergy(system, "Na+(aq)")(props)              == Approx(props.speciesStandardHelmholtzEnergy("Na+(aq)")) );
+        CHECK( Prop::speciesStandardHeatCapacitiesConstP(system, "Na+(aq)")(props)         == Approx(props.speciesStandardHeatCapacityConstP("Na+(aq)")) );
+        CHECK( Prop::speciesStandardHeatCapacitiesConstV(system, "Na+(aq)")(props)         == Approx(props.speciesStandardHeatCapacityConstV("Na+(aq)")) );
+        CHECK( Prop::phaseAmount(system, "GaseousPhase")(props)                            == Approx(props.phaseProps("GaseousPhase").amount()) );
+        CHECK( Prop::phaseMass(system, "GaseousPhase")(props)                              == Approx(props.phaseProps("GaseousPhase").mass()) );
+        CHECK( Prop::phaseVolume(system, "GaseousPhase")(props)                            == Approx(props.phaseProps("GaseousPhase").volume()) );
+        CHECK( Prop::phaseGibbsEnergy(system, "GaseousPhase")(props)                       == Approx(props.phaseProps("GaseousPhase").gibbsEnergy()) );
+        CHECK( Prop::phaseEnthalpy(system, "GaseousPhase")(props)                          == Approx(props.phaseProps("GaseousPhase").enthalpy()) );
+        CHECK( Prop::phaseEntropy(system, "GaseousPhase")(props)                           == Approx(props.phaseProps("GaseousPhase").entropy()) );
+        CHECK( Prop::phaseInternalEnergy(system, "GaseousPhase")(props)                    == Approx(props.phaseProps("GaseousPhase").internalEnergy()) );
+        CHECK( Prop::phaseHelmholtzEnergy(system, "GaseousPhase")(props)                   == Approx(props.phaseProps("GaseousPhase").helmholtzEnergy()) );
+        CHECK( Prop::temperature(system)(props)                                            == Approx(props.temperature()) );
+        CHECK( Prop::pressure(system)(props)                                               == Approx(props.pressure()) );
+        CHECK( Prop::amount(system)(props)                                                 == Approx(props.amount()) );
+        CHECK( Prop::mass(system)(props)                                                   == Approx(props.mass()) );
+        CHECK( Prop::volume(system)(props)                                                 == Approx(props.volume()) );
+        CHECK( Prop::gibbsEnergy(system)(props)                                            == Approx(props.gibbsEnergy()) );
+        CHECK( Prop::enthalpy(system)(props)                                               == Approx(props.enthalpy()) );
+        CHECK( Prop::entropy(system)(props)                                                == Approx(props.entropy()) );
+        CHECK( Prop::internalEnergy(system)(props)                                         == Approx(props.internalEnergy()) );
+        CHECK( Prop::helmholtzEnergy(system)(props)                                        == Approx(props.helmholtzEnergy()) );
+        CHECK( Prop::pH(system)(props)                                                     == Approx(-props.speciesActivityLn("H+(aq)") / ln10) );
+
+        CHECK_THROWS( Prop::speciesAmount(system, "XYZ(aq)") );
+        CHECK_THROWS( Prop::elementAmount(system, "Xy") );
+        CHECK_THROWS( Prop::phaseAmount(system, "XYZPhase") );
+    }
+
+    SECTION("Testing the Prop quantity expressions")
+    {
+        CHECK( Prop(system, "temperature")(props)                                   == Approx(props.temperature()) );
+        CHECK( Prop(system, "temperature()")(props)                                 == Approx(props.temperature()) );
+        CHECK( Prop(system, "temperature(units=celsius)")(props)                    == Approx(props.temperature() - 273.15) );
+        CHECK( Prop(system, "pressure(units=bar)")(props)                           == Approx(props.pressure() * 1e-5) );
+        CHECK( Prop(system, "speciesAmount(CO2(g))")(props)                         == Approx(props.speciesAmount("CO2(g)")) );
+        CHECK( Prop(system, "speciesAmount(CO2(g) units=mmol)")(props)              == Approx(props.speciesAmount("CO2(g)") * 1e3) );
+        CHECK( Prop(system, "  elementAmountInPhase( C  GaseousPhase )  ")(props)   == Approx(props.elementAmountInPhase("C", "GaseousPhase")) );
+        CHECK( Prop(system, "phaseVolume(GaseousPhase units=cm3)")(props)           == Approx(props.phaseProps("GaseousPhase").volume() * 1e6) );
+        CHECK( Prop(system, "pH")(props)                                            == Approx(Prop::pH(system)(props)) );
+
+        CHECK_THROWS( Prop(system, "unknownQuantity(CO2(g))") );
+        CHECK_THROWS( Prop(system, "speciesAmount") );
+        CHECK_THROWS( Prop(system, "speciesAmount(CO2(g) H2O(g))") );
+        CHECK_THROWS( Prop(system, "speciesAmount(CO2(g)") );
+        CHECK_THROWS( Prop(system, "speciesAmount(CO2(g) units=m3)") );
+    }
+
+    SECTION("Testing the batched evaluation of Prop objects")
+    {
+        Vec<ChemicalState> states(4, state);
+        for(auto i = 0; i < states.size(); ++i)
+        {
+            states[i].setTemperature(300.0 + 10.0 * i);
+            states[i].props().update(states[i]);
+        }
+
+        Vec<ChemicalProps> chemprops;
+        for(auto const& s : states)
+            chemprops.push_back(s.props());
+
+        Vec<Prop> quantities = {
+            Prop(system, "temperature(units=celsius)"),
+            Prop(system, "speciesAmount(Na+(aq))"),
+            Prop(system, "phaseVolume(GaseousPhase)"),
+        };
+
+        MatrixXd values(states.size(), quantities.size());
+
+        evalProps(quantities, states, values);
+
+        for(auto i = 0; i < states.size(); ++i)
+        {
+            CHECK( values(i, 0) == Approx(states[i].temperature() - 273.15) );
+            CHECK( values(i, 1) == Approx(states[i].speciesAmount("Na+(aq)")) );
+            CHECK( values(i, 2) == Approx(states[i].props().phaseProps("GaseousPhase").volume()) );
+        }
+
+        values.fill(0.0);
+
+        evalProps(quantities, chemprops, values);
+
+        for(auto i = 0; i < states.size(); ++i)
+            CHECK( values(i, 0) == Approx(states[i].temperature() - 273.15) );
+
+        MatrixXd wrong(states.size(), quantities.size() + 1);
+
+        CHECK_THROWS( evalProps(quantities, states, wrong) );
+    }
+}
+
+TEST_CASE("Benchmarking Prop class", "[.benchmark]")
+{
+    ChemicalSystem system = test::createChemicalSystem();
+
+    ChemicalState state(system);
+    state.setSpeciesAmounts(1.0);
+
+    ChemicalProps props(state);
+
+    Strings species = { "H2O(aq)", "H+(aq)", "OH-(aq)", "Na+(aq)", "Cl-(aq)", "CO2(g)" };
+
+    Vec<Prop> quantities;
+    for(auto const& name : species)
+        quantities.push_back(Prop(system, "speciesAmount(" + name + ")"));
+    quantities.push_back(Prop(system, "elementAmount(C)"));
+
+    BENCHMARK("Evaluation with names resolved at every call")
+    {
+        real sum = 0.0;
+        for(auto const& name : species)
+            sum += props.speciesAmount(name);
+        sum += props.elementAmount("C");
+        return sum;
+    };
+
+    BENCHMARK("Evaluation with Prop objects")
+    {
+        real sum = 0.0;
+        for(auto const& prop : quantities)
+            sum += prop(props);
+        return sum;
+    };
+}
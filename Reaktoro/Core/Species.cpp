@@ -211,9 +211,8 @@ auto Species::withAggregateState(AggregateState option) const -> Species
 
 auto Species::withFormationReaction(const FormationReaction& reaction) const -> Species
 {
-    Species copy = clone();
+    Species copy = withStandardThermoModel(reaction.createStandardThermoModel());
     copy.pimpl->reaction = reaction;
-    copy = copy.withStandardThermoModel(reaction.createStandardThermoModel());
     return copy;
 }
 
@@ -226,6 +225,7 @@ auto Species::withStandardThermoModel(const StandardThermoModel& model) const ->
 {
     Species copy = clone();
     copy.pimpl->propsfn = model.withMemoization();
+    copy.pimpl->reaction = FormationReaction(); // the formation reaction, if any, no longer determines the standard thermodynamic properties of the species
     return copy;
 }
 
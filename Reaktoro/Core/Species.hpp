@@ -120,7 +120,8 @@ public:
     /// This method exists for convenience only. Its use results in a standard
     /// thermodynamic model for this species in which its standard Gibbs energy
     /// is constant. All other standard thermodynamic properties are set to
-    /// zero. For a more complete standard thermodynamic model, use method @ref
+    /// zero. Any formation reaction previously assigned to this species is
+    /// removed. For a more complete standard thermodynamic model, use method @ref
     /// withStandardThermoModel or @ref withFormationReaction, in case the
     /// thermodynamic model is based on reaction properties.
     /// @param G0 The constant standard Gibbs energy of the species (in J/mol).
@@ -132,6 +133,7 @@ public:
     /// temperature and pressure. Alternatively, methods @ref
     /// withStandardGibbsEnergy and @ref withFormationReaction can be used to
     /// indirectly assign a standard thermodynamic model to this species.
+    /// Any formation reaction previously assigned to this species is removed.
     auto withStandardThermoModel(const StandardThermoModel& model) const -> Species;
 
     /// Return a duplicate of this Species object with new tags attribute.
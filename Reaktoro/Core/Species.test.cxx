@@ -119,6 +119,11 @@ TEST_CASE("Testing Species class", "[Species]")
         CHECK( species.standardThermoProps(T, P).G0 == species.reaction().createStandardThermoModel()(T, P).G0 );
         CHECK( species.standardThermoProps(T, P).H0 == species.reaction().createStandardThermoModel()(T, P).H0 );
         CHECK( species.standardThermoProps(T, P).Cp0 == species.reaction().createStandardThermoModel()(T, P).Cp0 );
+
+        species = species.withStandardGibbsEnergy(4321.0); // the formation reaction no longer applies
+
+        CHECK( species.reaction().initialized() == false );
+        CHECK( species.standardThermoProps(T, P).G0 == 4321.0 );
     }
 
     SECTION("Testing automatic construction of chemical species with given chemical formula")
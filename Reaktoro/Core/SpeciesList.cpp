@@ -17,6 +17,11 @@
 
 #include "SpeciesList.hpp"
 
+// C++ includes
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -25,25 +30,103 @@
 #include <Reaktoro/Core/ChemicalFormula.hpp>
 
 namespace Reaktoro {
+namespace {
+
+/// The minimum number of species in a list for which lookup tables are built (smaller lists are searched linearly).
+const auto lookup_threshold = 32;
+
+/// Append the exact bit pattern of a number to a string key (with -0.0 and 0.0 considered the same).
+auto appendNumberKey(String& key, double value) -> void
+{
+    value = value == 0.0 ? 0.0 : value;
+    char bytes[sizeof(double)];
+    std::memcpy(bytes, &value, sizeof(double));
+    key.append(bytes, sizeof(double));
+}
+
+/// Return a key for a chemical formula that is the same for all equivalent formulas.
+/// An empty key is returned for formulas with repeated element symbols, which can only be compared linearly.
+auto formulaKey(const ChemicalFormula& formula) -> String
+{
+    auto elements = formula.elements();
+    std::sort(elements.begin(), elements.end());
+    String key;
+    for(auto i = 0; i < elements.size(); ++i)
+    {
+        const auto& [symbol, coeff] = elements[i];
+        if(i > 0 && symbol == elements[i - 1].first)
+            return {};
+        key.append(symbol);
+        key.push_back('\0');
+        appendNumberKey(key, coeff);
+    }
+    key.push_back('\0');
+    appendNumberKey(key, formula.charge());
+    return key;
+}
+
+} // namespace
+
+struct SpeciesList::Lookup
+{
+    /// The index of the first species with a given name.
+    Map<String, Index> names;
+
+    /// The index of the first species with a given substance name.
+    Map<String, Index> substances;
+
+    /// The index of the first species with a given formula key (see `formulaKey`).
+    Map<String, Index> formulas;
+
+    /// True if the formula of every species in the list has a key in `formulas`.
+    bool formulas_complete = true;
+
+    /// The flag used to build the tables only once, even if requested by several threads.
+    std::once_flag once;
+
+    /// True if the tables have been built.
+    std::atomic<bool> built = false;
+
+    /// Register the species at given index in the list (ignored if preceded by another with same name, substance or formula).
+    auto add(const Species& species, Index i) -> void
+    {
+        names.emplace(species.name(), i);
+        substances.emplace(species.substance(), i);
+        auto key = formulaKey(species.formula());
+        if(key.empty())
+            formulas_complete = false;
+        else formulas.emplace(std::move(key), i);
+    }
+};
 
 SpeciesList::SpeciesList()
 {}
 
 SpeciesList::SpeciesList(std::initializer_list<Species> species)
 : m_species(std::move(species))
-{}
+{
+    resetLookup();
+}
 
 SpeciesList::SpeciesList(const Vec<Species>& species)
 : m_species(species)
-{}
+{
+    resetLookup();
+}
 
 SpeciesList::SpeciesList(const StringList& formulas)
 : m_species(vectorize(formulas, RKT_LAMBDA(x, Species(x))))
-{}
+{
+    resetLookup();
+}
 
 auto SpeciesList::append(const Species& species) -> void
 {
     m_species.push_back(species);
+    if(!m_lookup || m_lookup.use_count() > 1)
+        resetLookup();
+    else if(m_lookup->built)
+        m_lookup->add(species, m_species.size() - 1); // extend the lookup tables in place, since they are not shared with copies of this list
 }
 
 auto SpeciesList::data() const -> const Vec<Species>&
@@ -80,6 +163,7 @@ auto SpeciesList::operator[](Index i) const -> const Species&
 
 auto SpeciesList::operator[](Index i) -> Species&
 {
+    invalidateLookup();
     return m_species[i];
 }
 
@@ -90,16 +174,36 @@ auto SpeciesList::find(const String& name) const -> Index
 
 auto SpeciesList::findWithName(const String& name) const -> Index
 {
+    if(const auto table = lookup())
+    {
+        const auto it = table->names.find(name);
+        return it != table->names.end() ? it->second : size();
+    }
     return indexfn(m_species, RKT_LAMBDA(s, s.name() == name));
 }
 
 auto SpeciesList::findWithFormula(const ChemicalFormula& formula) const -> Index
 {
+    const auto table = lookup();
+    const auto key = table && table->formulas_complete ? formulaKey(formula) : String();
+    if(!key.empty())
+    {
+        const auto it = table->formulas.find(key);
+        if(it == table->formulas.end())
+            return size();
+        if(formula.equivalent(m_species[it->second].formula()))
+            return it->second;
+    }
     return indexfn(m_species, RKT_LAMBDA(s, formula.equivalent(s.formula())));
 }
 
 auto SpeciesList::findWithSubstance(const String& substance) const -> Index
 {
+    if(const auto table = lookup())
+    {
+        const auto it = table->substances.find(substance);
+        return it != table->substances.end() ? it->second : size();
+    }
     return indexfn(m_species, RKT_LAMBDA(s, s.substance() == substance));
 }
 
@@ -217,6 +321,7 @@ auto SpeciesList::withElementsOf(const StringList& formulas) const -> SpeciesLis
 
 SpeciesList::operator Vec<Species>&()
 {
+    invalidateLookup();
     return m_species;
 }
 
@@ -225,6 +330,38 @@ SpeciesList::operator const Vec<Species>&() const
     return m_species;
 }
 
+auto SpeciesList::lookup() const -> const Lookup*
+{
+    if(!m_lookup)
+        return nullptr;
+
+    std::call_once(m_lookup->once, [&]
+    {
+        auto& table = *m_lookup;
+        table.names.reserve(m_species.size());
+        table.substances.reserve(m_species.size());
+        table.formulas.reserve(m_species.size());
+        for(auto i = 0; i < m_species.size(); ++i)
+            table.add(m_species[i], i);
+        table.built = true;
+    });
+
+    return m_lookup.get();
+}
+
+auto SpeciesList::resetLookup() -> void
+{
+    if(m_species.size() < lookup_threshold)
+        m_lookup.reset();
+    else m_lookup = std::make_shared<Lookup>();
+}
+
+auto SpeciesList::invalidateLookup() -> void
+{
+    if(m_lookup && (m_lookup->built || m_lookup.use_count() > 1))
+        resetLookup(); // tables not yet built and owned only by this list are left as they are, since they will be built from the species as they are then
+}
+
 auto operator+(const SpeciesList& a, const SpeciesList& b) -> SpeciesList
 {
     return concatenate(a, b);
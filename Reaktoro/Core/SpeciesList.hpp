@@ -169,29 +169,48 @@ private:
     /// The species stored in the list.
     Vec<Species> m_species;
 
+    /// The hash tables used to find species by name, substance and formula.
+    struct Lookup;
+
+    /// The lookup tables of the list, built on first use and shared among its copies until one of them is changed.
+    /// These tables exist only for lists with many species. They are built once,
+    /// under `std::call_once`, so that a const list can be searched concurrently.
+    SharedPtr<Lookup> m_lookup;
+
+    /// Return the lookup tables of the list or nullptr if the list is too small to justify them.
+    auto lookup() const -> const Lookup*;
+
+    /// Prepare new lookup tables, to be built on first use, for the current species in the list.
+    auto resetLookup() -> void;
+
+    /// Prepare new lookup tables before the species in the list may be changed.
+    /// Tables not yet built and not shared with copies of the list are kept, so
+    /// that repeated mutable access to the species does not allocate new ones.
+    auto invalidateLookup() -> void;
+
 public:
     /// Construct an SpeciesList object with given begin and end iterators.
     template<typename InputIterator>
-    SpeciesList(InputIterator begin, InputIterator end) : m_species(begin, end) {}
+    SpeciesList(InputIterator begin, InputIterator end) : m_species(begin, end) { resetLookup(); }
 
     /// Return begin const iterator of this SpeciesList instance (for STL compatibility reasons).
     auto begin() const { return m_species.begin(); }
 
     /// Return begin iterator of this SpeciesList instance (for STL compatibility reasons).
-    auto begin() { return m_species.begin(); }
+    auto begin() { invalidateLookup(); return m_species.begin(); }
 
     /// Return end const iterator of this SpeciesList instance (for STL compatibility reasons).
     auto end() const { return m_species.end(); }
 
     /// Return end iterator of this SpeciesList instance (for STL compatibility reasons).
-    auto end() { return m_species.end(); }
+    auto end() { invalidateLookup(); return m_species.end(); }
 
     /// Append a new Species at the back of the container (for STL compatibility reasons).
     auto push_back(const Species& species) -> void { append(species); }
 
     /// Insert a container of Species objects into this SpeciesList instance (for STL compatibility reasons).
     template<typename Iterator, typename InputIterator>
-    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_species.insert(pos, begin, end); }
+    auto insert(Iterator pos, InputIterator begin, InputIterator end) -> void { m_species.insert(pos, begin, end); resetLookup(); }
 
     /// The type of the value stored in a SpeciesList (for STL compatibility reasons).
     using value_type = Species;
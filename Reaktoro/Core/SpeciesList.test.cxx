@@ -15,6 +15,9 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <thread>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -512,3 +515,94 @@ TEST_CASE("Testing SpeciesList", "[SpeciesList]")
     for(auto [i, species] : enumerate(specieslist))
         REQUIRE( species.name() == specieslist[i].name() );
 }
+
+TEST_CASE("Testing SpeciesList with many species", "[SpeciesList]")
+{
+    // Large enough to search species using the hash tables of the list
+    Vec<Species> species;
+    for(auto i = 1; i <= 50; ++i)
+        species.push_back(Species("C" + std::to_string(i) + "H" + std::to_string(2*i + 2) + "(aq)"));
+
+    SpeciesList specieslist(species);
+
+    //-------------------------------------------------------------------------
+    // TESTING METHODS: SpeciesList::find*
+    //-------------------------------------------------------------------------
+    for(auto i = 0; i < 50; ++i)
+    {
+        const auto formula = "C" + std::to_string(i + 1) + "H" + std::to_string(2*i + 4);
+        CHECK( specieslist.findWithName(formula + "(aq)") == i );
+        CHECK( specieslist.findWithSubstance(formula) == i );
+        CHECK( specieslist.findWithFormula(formula) == i );
+    }
+
+    CHECK( specieslist.findWithFormula("H4C1") == 0 );         // equivalent formula with elements in different order
+    CHECK( specieslist.findWithFormula("CH4+") == 50 );        // same elements but different charge
+    CHECK( specieslist.findWithName("CH4(g)") == 50 );
+    CHECK( specieslist.findWithSubstance("CH5") == 50 );
+
+    //-------------------------------------------------------------------------
+    // TESTING METHODS: SpeciesList::find* return the first species found
+    //-------------------------------------------------------------------------
+    specieslist.append(Species("CH4(g)"));
+    specieslist.append(Species("CH4(aq)").withName("Methane"));
+
+    CHECK( specieslist.findWithName("CH4(g)") == 50 );
+    CHECK( specieslist.findWithName("Methane") == 51 );
+    CHECK( specieslist.findWithSubstance("C1H4") == 0 );
+    CHECK( specieslist.findWithSubstance("CH4") == 50 );
+    CHECK( specieslist.findWithFormula("CH4") == 0 );
+
+    //-------------------------------------------------------------------------
+    // TESTING METHODS: SpeciesList::find* after changing species in the list
+    //-------------------------------------------------------------------------
+    specieslist[0] = Species("CO2(aq)");
+
+    CHECK( specieslist.findWithName("CO2(aq)") == 0 );
+    CHECK( specieslist.findWithName("CH4(aq)") == 52 );
+    CHECK( specieslist.findWithFormula("CH4") == 50 );
+
+    for(auto& s : specieslist)
+        s = s.withName(s.name() + "!");
+
+    CHECK( specieslist.findWithName("CO2(aq)!") == 0 );
+    CHECK( specieslist.findWithName("CO2(aq)") == specieslist.size() );
+
+    //-------------------------------------------------------------------------
+    // TESTING METHODS: SpeciesList::find* in copies of the list
+    //-------------------------------------------------------------------------
+    SpeciesList copy = specieslist;
+    copy.append(Species("H2O(aq)"));
+
+    CHECK( copy.findWithName("H2O(aq)") == specieslist.size() );
+    CHECK( specieslist.findWithName("H2O(aq)") == specieslist.size() );
+    CHECK( copy.findWithName("CO2(aq)!") == 0 );
+
+    SpeciesList original(species);
+    SpeciesList changed = original; // a copy changed before any search in both lists
+    changed[1] = Species("NaCl(aq)");
+
+    CHECK( original.findWithName("NaCl(aq)") == original.size() );
+    CHECK( changed.findWithName("NaCl(aq)") == 1 );
+    CHECK( changed.findWithName("C2H6(aq)") == changed.size() );
+
+    //-------------------------------------------------------------------------
+    // TESTING METHODS: SpeciesList::find* from several threads
+    //-------------------------------------------------------------------------
+    const SpeciesList shared(species);
+
+    const auto numthreads = 4;
+    Vec<Index> found(numthreads * species.size());
+    Vec<std::thread> threads;
+    for(auto t = 0; t < numthreads; ++t)
+        threads.emplace_back([&, t] {
+            for(auto i = 0; i < species.size(); ++i)
+                found[t*species.size() + i] = shared.findWithName(species[i].name());
+        });
+    for(auto& thread : threads)
+        thread.join();
+
+    for(auto t = 0; t < numthreads; ++t)
+        for(auto i = 0; i < species.size(); ++i)
+            CHECK( found[t*species.size() + i] == i );
+}
@@ -17,8 +17,12 @@
 
 #include "DatabaseParser.hpp"
 
+// C++ includes
+#include <mutex>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Common/ParseUtils.hpp>
 #include <Reaktoro/Core/Data.hpp>
 #include <Reaktoro/Core/Database.hpp>
@@ -26,17 +30,91 @@
 #include <Reaktoro/Serialization.hpp>
 
 namespace Reaktoro {
+namespace {
 
-struct DatabaseParser::Impl
+/// Return a function that creates a Species object on its first call only and returns the same object in later calls (also from multiple threads).
+auto createOnce(Fn<Species()> create) -> Fn<Species()>
+{
+    struct State
+    {
+        std::once_flag created;
+        Fn<Species()> create;
+        Species species;
+    };
+
+    auto state = std::make_shared<State>();
+    state->create = std::move(create);
+
+    return [state]() -> Species
+    {
+        std::call_once(state->created, [&]() { state->species = state->create(); state->create = {}; });
+        return state->species;
+    };
+}
+
+/// Create the vector of tags with given Data object with attributes for a species.
+auto createTags(Data const& attributes) -> Strings
+{
+    if(attributes.exists("Tags"))
+    {
+        if(attributes["Tags"].isString())
+            return split(attributes["Tags"].asString());
+        if(attributes["Tags"].isList())
+            return attributes["Tags"].as<Strings>();
+    }
+    return {};
+}
+
+/// Create a standard thermodynamic model with given Data object with attributes for a species.
+auto createStandardThermoModel(Data const& attributes) -> StandardThermoModel
 {
-    ///< The Species objects in the database.
-    SpeciesList species_list;
+    if(attributes.exists("StandardThermoModel"))
+        return attributes.at("StandardThermoModel").as<StandardThermoModel>();
+    return {};
+}
 
+/// Create a standard thermodynamic model with given formation reaction as a Data object.
+auto createReactionStandardThermoModel(Data const& data) -> ReactionStandardThermoModel
+{
+    errorif(!data.exists("ReactionStandardThermoModel"), "Missing `ReactionStandardThermoModel` specification in:\n\n", data.repr());
+    return data["ReactionStandardThermoModel"].as<ReactionStandardThermoModel>();
+}
+
+/// Create a formation reaction with given Data object with attributes for a species and the functions that create its reactant species.
+auto createFormationReaction(Data const& attributes, Pairs<Fn<Species()>, double> const& reactants) -> FormationReaction
+{
+    if(attributes.exists("FormationReaction"))
+    {
+        Pairs<Species, double> pairs;
+        for(auto const& [create, coeff] : reactants)
+            pairs.emplace_back(create(), coeff);
+        return FormationReaction()
+            .withReactants(pairs)
+            .withReactionStandardThermoModel(createReactionStandardThermoModel(attributes.at("FormationReaction")))
+            // .withProductStandardVolumeModel(createStandardVolumeModel(attributes.at("FormationReaction")))
+            ;
+    }
+    return {};
+}
+
+} // namespace
+
+struct DatabaseParser::Impl
+{
     ///< The Element objects in the database.
     ElementList element_list;
 
-    ///< The database contents parsed from YAML or JSON into a Data object.
-    Data doc;
+    ///< The database with the species in the database file, whose Species objects are created only when first needed.
+    Database database;
+
+    ///< The functions that create the Species objects (on their first call only) of the species already added, with their names as keys.
+    Map<String, Fn<Species()>> species_creators;
+
+    ///< The names of the species being added, used to detect formation reactions that depend on the species itself.
+    Set<String> species_being_added;
+
+    ///< The database contents parsed from YAML or JSON into a Data object (only while parsing, since the species keep only their own attributes).
+    Data const* doc = nullptr;
 
     /// Construct a default DatabaseParser::Impl object.
     Impl()
@@ -49,7 +127,7 @@ struct DatabaseParser::Impl
 
     /// Construct a DatabaseParser::Impl object with given Data object.
     Impl(const Data& doc, const ElementList& elements)
-    : doc(doc), element_list(elements)
+    : element_list(elements), doc(&doc)
     {
         errorif(!doc.isDict(), "Could not understand your YAML or JSON database file with content:\n", doc.repr(), "\n",
             "Repeating the error message here in case the above printed content is too long.\n",
@@ -87,23 +165,29 @@ struct DatabaseParser::Impl
             else errorif(true, "Expecting the `Species` section in your YAML or JSON database to be either a list or dictionary. Please check other Reaktoro databases in either YAML or JSON format and replicate the structure.");
 
         }
+
+        // Add the elements in the database (these are not added together with the species not yet created)
+        for(auto const& element : element_list)
+            database.addElement(element);
+
+        this->doc = nullptr;
     }
 
     /// Return the Data object with the details of an element with given unique @p symbol.
     auto getElementDetails(String const& symbol) -> Data
     {
-        if(doc.exists("Elements"))
-            if(doc["Elements"].exists(symbol))
-                return doc["Elements"][symbol];
+        if(doc->exists("Elements"))
+            if((*doc)["Elements"].exists(symbol))
+                return (*doc)["Elements"][symbol];
         return {};
     }
 
     /// Return the Data object with the details of a species with given unique @p name.
     auto getSpeciesDetails(const String& name) -> Data
     {
-        if(doc.exists("Species"))
-            if(doc["Species"].exists(name))
-                return doc["Species"][name];
+        if(doc->exists("Species"))
+            if((*doc)["Species"].exists(name))
+                return (*doc)["Species"][name];
         return {};
     }
 
@@ -133,7 +217,7 @@ struct DatabaseParser::Impl
     }
 
     /// Add a new species with given unique @p name. A Data object for this species must exist.
-    auto addSpecies(String const& name) -> Species
+    auto addSpecies(String const& name) -> Fn<Species()>
     {
         const auto attributes = getSpeciesDetails(name);
         errorif(attributes.isNull(), "Could not create a Species object with "
@@ -142,8 +226,9 @@ struct DatabaseParser::Impl
         return addSpecies(name, attributes);
     }
 
-    /// Add a new species with given `name` and `attributes`.
-    auto addSpecies(String const& name, Data const& attributes) -> Species
+    /// Add a new species with given `name` and `attributes` and return the function that creates its Species object.
+    /// The Species object is created only when first needed, and the function keeps only the attributes of this species until then.
+    auto addSpecies(String const& name, Data const& attributes) -> Fn<Species()>
     {
         errorif(!attributes.isDict(), "Expecting the attributes of a species as an object, but got instead:\n\n", attributes.repr());
         errorif(!attributes.exists("Formula"), "Missing `Formula` specification in:\n\n", attributes.repr());
@@ -151,25 +236,39 @@ struct DatabaseParser::Impl
         errorif(!attributes.exists("Elements"), "Missing `Elements` specification in:\n\n", attributes.repr(), "\n",
             "Please assign `Elements: null` if this species does not have chemical elements (e.g., e-, which may be represented with only `Charge: -1`).");
         errorif(!attributes.exists("FormationReaction") && !attributes.exists("StandardThermoModel"), "Missing `FormationReaction` or `StandardThermoModel` specification in:\n\n", attributes.repr());
-        const auto idx = species_list.find(name);
-        if(idx < species_list.size())
-            return species_list[idx]; // Do not add a species that has already been added! Return existing one.
-        Species::Attribs attribs;
-        attribs.name = name;
-        attributes.at("Formula").to(attribs.formula);
-        if(attributes.exists("Substance")) attributes.at("Substance").to(attribs.substance);
-        if(attributes.exists("Charge")) attributes.at("Charge").to(attribs.charge);
-        attributes.at("AggregateState").to(attribs.aggregate_state);
-        errorif(attribs.aggregate_state == AggregateState::Undefined,
+        const auto it = species_creators.find(name);
+        if(it != species_creators.end())
+            return it->second; // Do not add a species that has already been added! Return existing one.
+        errorif(species_being_added.count(name), "Could not create the species `", name, "` because its formation reaction depends on the species itself, either directly or through other species.");
+        auto const formula = attributes.at("Formula").asString();
+        auto const charge = attributes.exists("Charge") ? attributes.at("Charge").asFloat() : 0.0;
+        auto const aggregate_state = attributes.at("AggregateState").as<AggregateState>();
+        errorif(aggregate_state == AggregateState::Undefined,
             "Unsupported AggregateState value `", attributes["AggregateState"].asString(), "` in:\n\n", attributes.repr(), "\n\n"
             "The supported values are given below:\n\n", supportedAggregateStateValues());
-        attribs.elements = createElementalComposition(attributes);
-        attribs.formation_reaction = createFormationReaction(attributes);
-        attribs.std_thermo_model = createStandardThermoModel(attributes);
-        attribs.tags = createTags(attributes);
-        Species species(attribs);
-        species_list.append(species);
-        return species;
+        auto const elements = createElementalComposition(attributes);
+        auto const tags = createTags(attributes);
+        species_being_added.insert(name);
+        auto const reactants = attributes.exists("FormationReaction") ? createReactants(attributes.at("FormationReaction")) : Pairs<Fn<Species()>, double>();
+        species_being_added.erase(name);
+        auto const create = createOnce([=]() -> Species
+        {
+            Species::Attribs attribs;
+            attribs.name = name;
+            attribs.formula = formula;
+            if(attributes.exists("Substance")) attributes.at("Substance").to(attribs.substance);
+            attribs.charge = charge;
+            attribs.aggregate_state = aggregate_state;
+            attribs.elements = elements;
+            attribs.formation_reaction = createFormationReaction(attributes, reactants);
+            attribs.std_thermo_model = createStandardThermoModel(attributes);
+            attribs.tags = tags;
+            return Species(attribs);
+        });
+        species_creators.emplace(name, create);
+        const auto info = Database::SpeciesInfo{ name, ChemicalFormula(splitSpeciesNameSuffix(formula).first, elements, charge), aggregate_state, elements.symbols(), tags };
+        database.addSpecies(info, create);
+        return create;
     }
 
     /// Create the elemental composition of the species whose attributes are found in the given Data object `data`.
@@ -195,51 +294,18 @@ struct DatabaseParser::Impl
         return ElementalComposition(pairs);
     }
 
-    /// Create the vector of tags with given Data object with attributes for a species.
-    auto createTags(Data const& attributes) -> Strings
-    {
-        if(attributes.exists("Tags"))
-        {
-            if(attributes["Tags"].isString())
-                return split(attributes["Tags"].asString());
-            if(attributes["Tags"].isList())
-                return attributes["Tags"].as<Strings>();
-        }
-        return {};
-    }
-
-    /// Create a standard thermodynamic model with given Data object with attributes for a species.
-    auto createStandardThermoModel(Data const& attributes) -> StandardThermoModel
-    {
-        if(attributes.exists("StandardThermoModel"))
-            return attributes.at("StandardThermoModel").as<StandardThermoModel>();
-        return {};
-    }
-
-    /// Create a formation reaction with given given Data object with attributes for a species.
-    auto createFormationReaction(Data const& attributes) -> FormationReaction
-    {
-        if(attributes.exists("FormationReaction"))
-            return FormationReaction()
-                .withReactants(createReactants(attributes.at("FormationReaction")))
-                .withReactionStandardThermoModel(createReactionStandardThermoModel(attributes.at("FormationReaction")))
-                // .withProductStandardVolumeModel(createStandardVolumeModel(attributes.at("FormationReaction")))
-                ;
-        return {};
-    }
-
-    /// Create the list of reactant species in given formation reaction as a Data object.
-    auto createReactants(Data const& data) -> Pairs<Species, double>
+    /// Create the functions that create the reactant species in given formation reaction as a Data object.
+    auto createReactants(Data const& data) -> Pairs<Fn<Species()>, double>
     {
         errorif(!data.exists("Reactants"), "Missing `Reactants` specification in:\n\n", data.repr());
         const auto names_and_coeffs = parseNumberStringPairs(data["Reactants"].asString());
-        Pairs<Species, double> reactants;
+        Pairs<Fn<Species()>, double> reactants;
         for(const auto& [name, coeff] : names_and_coeffs)
         {
-            const auto idx = species_list.find(name);
-            if(idx < species_list.size()) // check if there is a Species object with current name
-                reactants.emplace_back(species_list[idx], coeff); // if so, add it to the list of reactants
-            else // otherwise, add a new Species object
+            const auto it = species_creators.find(name);
+            if(it != species_creators.end()) // check if there is a species already added with current name
+                reactants.emplace_back(it->second, coeff); // if so, add it to the list of reactants
+            else // otherwise, add a new species
             {
                 const auto new_species = addSpecies(name); // Note potential recursivity: addSpecies may also need to call createReactants! This is needed in case reactions are defined recursively.
                 reactants.emplace_back(new_species, coeff);
@@ -248,13 +314,6 @@ struct DatabaseParser::Impl
         return reactants;
     }
 
-    /// Create a standard thermodynamic model with given formation reaction as a Data object.
-    auto createReactionStandardThermoModel(Data const& data) -> ReactionStandardThermoModel
-    {
-        errorif(!data.exists("ReactionStandardThermoModel"), "Missing `ReactionStandardThermoModel` specification in:\n\n", data.repr());
-        return data["ReactionStandardThermoModel"].as<ReactionStandardThermoModel>();
-    }
-
     // auto createStandardVolumeModel(Data const& child) -> StandardVolumeModel
     // {
 
@@ -293,12 +352,12 @@ auto DatabaseParser::elements() const -> const ElementList&
 
 auto DatabaseParser::species() const -> const SpeciesList&
 {
-    return pimpl->species_list;
+    return pimpl->database.species();
 }
 
 DatabaseParser::operator Database() const
 {
-    return Database(elements(), species());
+    return pimpl->database;
 }
 
 } // namespace Reaktoro
@@ -54,6 +54,7 @@ public:
     auto elements() const -> const ElementList&;
 
     /// Return the parsed Species objects in the database file.
+    /// @note This method creates all species in the database file, which are otherwise created only when first needed.
     auto species() const -> const SpeciesList&;
 
     /// Return the parsed Element objects in the database file.
@@ -175,6 +175,30 @@ Species:
       Tmax: 0.0
 )";
 
+const String doc_species_cyclic = R"(
+Species:
+  H2O(aq):
+    Name: H2O(aq)
+    Formula: H2O
+    Elements: 2:H 1:O
+    AggregateState: Aqueous
+    FormationReaction:
+      Reactants: 1:H2O(g)
+      ReactionStandardThermoModel:
+        ConstLgK:
+          lgKr: 1.0
+  H2O(g):
+    Name: H2O(g)
+    Formula: H2O
+    Elements: 2:H 1:O
+    AggregateState: Gas
+    FormationReaction:
+      Reactants: 1:H2O(aq)
+      ReactionStandardThermoModel:
+        ConstLgK:
+          lgKr: 1.0
+)";
+
 } // namespace (anonymous)
 
 TEST_CASE("Testing DatabaseParser class", "[DatabaseParser]")
@@ -235,5 +259,6 @@ TEST_CASE("Testing DatabaseParser class", "[DatabaseParser]")
     {
         CHECK_THROWS(DatabaseParser(Data::parse(doc_elements_wrong)));
         CHECK_THROWS(DatabaseParser(Data::parse(doc_species_wrong)));
+        CHECK_THROWS_WITH(DatabaseParser(Data::parse(doc_species_cyclic)), Catch::Contains("depends on the species itself"));
     }
 }
@@ -33,10 +33,13 @@ namespace {
 /// Return a Species object in a Database with given formula and aggregate state
 auto getSpecies(Database const& db, String const& formula, AggregateState aggstate) -> Species
 {
-    const auto selected = db.speciesWithAggregateState(aggstate);
-    const auto idx = selected.findWithFormula(formula);
-    if(idx < selected.size()) return selected[idx];
-    else return Species();
+    // Find the species using the formulas already parsed in the database to avoid parsing the formula of every species
+    const ChemicalFormula target(formula);
+    const auto& infos = db.speciesInfo();
+    for(auto i = 0; i < infos.size(); ++i)
+        if(infos[i].aggregate_state == aggstate && target.equivalent(infos[i].formula))
+            return db.speciesWithIndices({ Index(i) })[0];
+    return Species();
 }
 
 /// Return a Species object in a Database with given formula and aqueous aggregate state.
@@ -437,12 +440,12 @@ auto EquilibriumSpecs::lnActivity(Species const& species) -> void
 
 auto EquilibriumSpecs::lnActivity(String name) -> void
 {
-    const auto specieslist = m_system.database().species();
-    const auto idx = specieslist.findWithName(name);
-    errorif(idx >= specieslist.size(),
+    const auto& infos = m_system.database().speciesInfo();
+    const auto idx = indexfn(infos, RKT_LAMBDA(x, x.name == name));
+    errorif(idx >= infos.size(),
         "Could not impose an activity constraint for species with name `", name, "` "
         "because it is not in the database.");
-    const auto species = specieslist[idx];
+    const auto species = m_system.database().speciesWithIndices({ idx })[0];
     lnActivity(species);
 }
 
@@ -19,8 +19,10 @@
 #include <Reaktoro/pybind11.hxx>
 
 void exportPhreeqcDatabase(py::module& m);
+void exportPhreeqcWater(py::module& m);
 
 void exportExtensionPhreeqc(py::module& m)
 {
     exportPhreeqcDatabase(m);
+    exportPhreeqcWater(m);
 }
@@ -17,6 +17,12 @@
 
 #include "PhreeqcDatabase.hpp"
 
+// C++ includes
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <sstream>
+
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Exception.hpp>
@@ -45,8 +51,8 @@ struct PhreeqcDatabaseHelper
     /// The symbols of the elements already in the database (needed for fast existence check)
     Set<String> inserted_elements_set;
 
-    /// The ids of the species already inserted in the database, with id = name + aggregate state (needed for fast existence check)
-    Set<String> inserted_species_set;
+    /// The indices of the species already inserted in the database, with id = name + aggregate state (needed for fast existence check)
+    Map<String, Index> inserted_species_index;
 
     /// Construct a default PhreeqcDatabaseHelper object.
     PhreeqcDatabaseHelper()
@@ -83,7 +89,14 @@ struct PhreeqcDatabaseHelper
     auto containsSpecies(String name, AggregateState agstate) -> bool
     {
         auto const id = name + std::to_string(static_cast<int>(agstate));
-        return inserted_species_set.find(id) != inserted_species_set.end();
+        return inserted_species_index.find(id) != inserted_species_index.end();
+    }
+
+    /// Return the index of the Species object with given name and aggregate state or the number of species if not found.
+    auto findSpecies(String const& name, AggregateState agstate) -> Index
+    {
+        auto const it = inserted_species_index.find(name + std::to_string(static_cast<int>(agstate)));
+        return it != inserted_species_index.end() ? it->second : species_list.size();
     }
 
     /// Append an Element object with given PhreeqcElement pointer.
@@ -108,14 +121,14 @@ struct PhreeqcDatabaseHelper
         // Skip if species with same name and same aggregate state has already been appended!
         const auto name = PhreeqcUtils::name(s);
         const auto agstate = PhreeqcUtils::aggregateState(s);
-        const auto idx = indexfn(species_list, RKT_LAMBDA(x, x.name() == name && x.aggregateState() == agstate));
+        const auto idx = findSpecies(name, agstate);
         if(idx < species_list.size())
             return species_list[idx];
 
         const auto newspecies = PhreeqcUtils::isMasterSpecies(s) ? createMasterSpecies(s) : createProductSpecies(s);
 
         species_list.append(newspecies);
-        inserted_species_set.insert(name + std::to_string(static_cast<int>(agstate)));
+        inserted_species_index.emplace(name + std::to_string(static_cast<int>(agstate)), species_list.size() - 1);
 
         return species_list.back();
     }
@@ -235,11 +248,93 @@ auto getPhreeqcDatabaseContent(String name) -> String
     return Embedded::get("databases/phreeqc/" + name);
 }
 
-/// Create the Species objects from given PHREEQC database.
-auto createSpeciesWithDatabaseContentOrPath(String database)
+/// Return the contents of a PHREEQC database given either its contents or the path to its file (or empty if the file cannot be read).
+auto readPhreeqcDatabaseContents(String const& database) -> String
+{
+    if(database.find('\n') != String::npos) // same check used in PhreeqcUtils::load
+        return database;
+    std::ifstream file(database);
+    if(!file.is_open())
+        return {};
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+/// A PHREEQC database in PhreeqcDatabaseCache with the PhreeqcDatabaseHelper object created for it.
+struct PhreeqcDatabaseCacheEntry
+{
+    /// The hash of the contents of the PHREEQC database (used to skip comparing the contents of different databases).
+    std::size_t hash;
+
+    /// The contents of the PHREEQC database (compared on a cache hit, since different contents may have equal hashes).
+    String contents;
+
+    /// The PhreeqcDatabaseHelper object created for the PHREEQC database.
+    SharedPtr<PhreeqcDatabaseHelper const> helper;
+};
+
+/// The PhreeqcDatabaseHelper objects already created in this process for the most recently loaded PHREEQC databases.
+struct PhreeqcDatabaseCache
+{
+    /// The maximum number of PHREEQC databases kept in the cache.
+    static constexpr auto capacity = 8;
+
+    /// The mutex that guards the cache when PHREEQC databases are loaded in parallel.
+    std::mutex mutex;
+
+    /// The cached PhreeqcDatabaseHelper objects ordered from the least to the most recently used.
+    Deque<PhreeqcDatabaseCacheEntry> entries;
+
+    /// Return the index of the entry with given database contents and their hash or the number of entries if not found.
+    auto find(String const& contents, std::size_t hash) const -> Index
+    {
+        return indexfn(entries, RKT_LAMBDA(x, x.hash == hash && x.contents == contents));
+    }
+};
+
+/// Return the cache of the PhreeqcDatabaseHelper objects created in this process.
+auto phreeqcDatabaseCache() -> PhreeqcDatabaseCache&
+{
+    static PhreeqcDatabaseCache cache;
+    return cache;
+}
+
+/// Return the PhreeqcDatabaseHelper object for given PHREEQC database, creating it only if no database with same contents has been loaded recently.
+/// The PHREEQC instance is only read after the database is parsed, so it can be shared among PhreeqcDatabase objects.
+auto createPhreeqcDatabaseHelper(String const& database) -> SharedPtr<PhreeqcDatabaseHelper const>
 {
-    PhreeqcDatabaseHelper helper(database);
-    return helper.species_list;
+    auto contents = readPhreeqcDatabaseContents(database);
+    if(contents.empty())
+        return std::make_shared<PhreeqcDatabaseHelper const>(database); // let PHREEQC report the error if the database file cannot be read
+
+    auto const hash = std::hash<String>{}(contents);
+
+    auto& cache = phreeqcDatabaseCache();
+
+    {
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        auto const i = cache.find(contents, hash);
+        if(i < cache.entries.size())
+        {
+            auto entry = std::move(cache.entries[i]);
+            cache.entries.erase(cache.entries.begin() + i);
+            cache.entries.push_back(std::move(entry)); // move the entry to the end as the most recently used one
+            return cache.entries.back().helper;
+        }
+    }
+
+    // Parse the PHREEQC database outside the lock so that different databases can be loaded in parallel
+    auto helper = std::make_shared<PhreeqcDatabaseHelper const>(database);
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto const i = cache.find(contents, hash);
+    if(i < cache.entries.size()) // another thread loaded a database with same contents in the meantime
+        return cache.entries[i].helper;
+    if(cache.entries.size() == PhreeqcDatabaseCache::capacity)
+        cache.entries.pop_front(); // release the least recently used database
+    cache.entries.push_back({ hash, std::move(contents), helper });
+    return helper;
 }
 
 } // namespace detail
@@ -254,10 +349,11 @@ PhreeqcDatabase::PhreeqcDatabase(const String& name)
 
 auto PhreeqcDatabase::load(const String& filename) -> PhreeqcDatabase&
 {
-    detail::PhreeqcDatabaseHelper helper(filename);
+    auto const helper = detail::createPhreeqcDatabaseHelper(filename);
     Database::clear();
-    Database::addSpecies(helper.species_list);
-    Database::attachData(helper);
+    Database::addSpecies(helper->species_list);
+    Database::attachData(*helper);
+    m_ptr = helper->phreeqc;
     return *this;
 }
 
@@ -268,22 +364,16 @@ auto PhreeqcDatabase::ptr() const -> SharedPtr<PHREEQC> const&
 
 auto PhreeqcDatabase::withName(const String& name) -> PhreeqcDatabase
 {
-    PhreeqcDatabase db;
-    const auto content = detail::getPhreeqcDatabaseContent(name);
-    detail::PhreeqcDatabaseHelper helper(content);
-    db.addSpecies(helper.species_list);
-    db.attachData(helper);
-    db.m_ptr = helper.phreeqc;
-    return db;
+    return fromContents(detail::getPhreeqcDatabaseContent(name));
 }
 
 auto PhreeqcDatabase::fromFile(const String& path) -> PhreeqcDatabase
 {
-    detail::PhreeqcDatabaseHelper helper(path);
+    auto const helper = detail::createPhreeqcDatabaseHelper(path);
     PhreeqcDatabase db;
-    db.addSpecies(helper.species_list);
-    db.attachData(helper);
-    db.m_ptr = helper.phreeqc;
+    db.addSpecies(helper->species_list);
+    db.attachData(*helper);
+    db.m_ptr = helper->phreeqc;
     return db;
 }
 
@@ -297,6 +387,13 @@ auto PhreeqcDatabase::contents(const String& database) -> String
     return detail::getPhreeqcDatabaseContent(database);
 }
 
+auto PhreeqcDatabase::clearCache() -> void
+{
+    auto& cache = detail::phreeqcDatabaseCache();
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.entries.clear();
+}
+
 auto PhreeqcDatabase::namesEmbeddedDatabases() -> Strings
 {
     return {
@@ -26,6 +26,10 @@ class PHREEQC;
 namespace Reaktoro {
 
 /// The class used to store and retrieve data of chemical species from PHREEQC databases.
+/// The last few PHREEQC databases parsed and converted in a process are kept in
+/// memory. Loading a database with the same contents as one of them (e.g., the
+/// same embedded database or file) reuses its elements, species and underlying
+/// PHREEQC object. Use PhreeqcDatabase::clearCache to release them.
 class PhreeqcDatabase : public Database
 {
 public:
@@ -88,6 +92,10 @@ public:
     /// Return the names of the currently supported embedded PHREEQC databases.
     static auto namesEmbeddedDatabases() -> Strings;
 
+    /// Release the PHREEQC databases parsed and converted recently in this process.
+    /// Existing PhreeqcDatabase objects remain valid after this call.
+    static auto clearCache() -> void;
+
 private:
     /// The underlying PHREEQC object containing the state of PHREEQC after parsing the database.
     SharedPtr<PHREEQC> m_ptr;
@@ -33,5 +33,6 @@ void exportPhreeqcDatabase(py::module& m)
         .def_static("fromContents", &PhreeqcDatabase::fromContents)
         .def_static("contents", &PhreeqcDatabase::contents)
         .def_static("namesEmbeddedDatabases", &PhreeqcDatabase::namesEmbeddedDatabases)
+        .def_static("clearCache", &PhreeqcDatabase::clearCache)
         ;
 }
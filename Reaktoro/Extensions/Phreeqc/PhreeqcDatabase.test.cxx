@@ -159,6 +159,37 @@ TEST_CASE("Testing PhreeqcDatabase constructor and load method", "[PhreeqcDataba
         CHECK_NOTHROW( solids.getWithName("FeSO4") );
     }
 
+    //-------------------------------------------------------------------------
+    // Testing databases with same contents are parsed and converted only once
+    //-------------------------------------------------------------------------
+    {
+        PhreeqcDatabase db1("phreeqc.dat");
+        PhreeqcDatabase db2 = PhreeqcDatabase::fromContents(PhreeqcDatabase::contents("phreeqc.dat"));
+        PhreeqcDatabase db3;
+        db3.load(PhreeqcDatabase::contents("phreeqc.dat"));
+
+        CHECK( db1.ptr() != nullptr );
+        CHECK( db2.ptr() == db1.ptr() );
+        CHECK( db3.ptr() == db1.ptr() );
+        CHECK( db2.species().size() == db1.species().size() );
+        CHECK( db3.species().size() == db1.species().size() );
+
+        auto contents = PhreeqcDatabase::contents("phreeqc.dat");
+        contents.back() = contents.back() == '\n' ? ' ' : '\n'; // same size as phreeqc.dat, but different contents
+
+        PhreeqcDatabase db5 = PhreeqcDatabase::fromContents(contents);
+
+        CHECK( db5.ptr() != db1.ptr() );
+
+        PhreeqcDatabase::clearCache();
+
+        PhreeqcDatabase db4("phreeqc.dat");
+
+        CHECK( db4.ptr() != db1.ptr() );
+        CHECK( db4.species().size() == db1.species().size() );
+        CHECK( db1.species("CO2").props(298.15, 1e5).G0 == db4.species("CO2").props(298.15, 1e5).G0 );
+    }
+
     // // // In this new load operation, complement the PhreeqcDatabase object with more contents
     // db.extend(getStringContentsPhreeqcDatabaseComplement()); // TODO Implement PhreeqcDatabase::extend method using PhreeqcUtis::execute for this.
 
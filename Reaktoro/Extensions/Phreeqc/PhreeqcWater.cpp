@@ -20,7 +20,6 @@
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
-#include <Reaktoro/Common/Memoization.hpp>
 
 namespace Reaktoro {
 namespace PhreeqcUtils {
@@ -180,8 +179,13 @@ auto waterProps(real T, real P) -> PhreeqcWaterProps
 
 auto waterPropsMemoized(real T, real P) -> PhreeqcWaterProps
 {
-    static thread_local auto memoized_water_props = memoizeLast(waterProps);
-    return memoized_water_props(T, P);
+    return waterPropsMemoizedFn()(T, P);
+}
+
+auto waterPropsMemoizedFn() -> PhreeqcWaterPropsMemoizedFn&
+{
+    static thread_local PhreeqcWaterPropsMemoizedFn fn(waterProps);
+    return fn;
 }
 
 auto waterDensityPhreeqc(real T, real P) -> real
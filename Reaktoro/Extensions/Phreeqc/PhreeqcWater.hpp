@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Common/Real.hpp>
 
 namespace Reaktoro {
@@ -86,6 +87,14 @@ auto waterProps(real T, real P) -> PhreeqcWaterProps;
 /// @param P The pressure for the calculation (in Pa)
 auto waterPropsMemoized(real T, real P) -> PhreeqcWaterProps;
 
+/// The type of the memoized function used in @ref waterPropsMemoized.
+using PhreeqcWaterPropsMemoizedFn = MemoizedFn<PhreeqcWaterProps(real, real)>;
+
+/// Return the memoized function used in @ref waterPropsMemoized (of the calling thread).
+/// By default, only its last invocation is cached. Use it to select the
+/// capacity of its cache and to inspect its cache hits and misses.
+auto waterPropsMemoizedFn() -> PhreeqcWaterPropsMemoizedFn&;
+
 /// Return the water density used in the evaluation of Debye--Hückel coefficients @eq{A_\gamma} and  @eq{B_\gamma}.
 /// This function implements equation (2.6) of Wagner and Pruss (2002)\sup{\cite Wagner2002}
 /// for the calculation of liquid water density along the saturation curve (0-300 celsius).
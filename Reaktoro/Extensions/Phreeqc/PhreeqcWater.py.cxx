@@ -0,0 +1,37 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Extensions/Phreeqc/PhreeqcWater.hpp>
+using namespace Reaktoro;
+
+void exportPhreeqcWater(py::module& m)
+{
+    using PhreeqcUtils::PhreeqcWaterPropsMemoizedFn;
+
+    py::class_<PhreeqcWaterPropsMemoizedFn>(m, "PhreeqcWaterPropsMemoizedFn")
+        .def("setCapacity", &PhreeqcWaterPropsMemoizedFn::setCapacity, "Set the maximum number of calls cached (the current cache is discarded).")
+        .def("capacity", &PhreeqcWaterPropsMemoizedFn::capacity, "Return the maximum number of calls cached.")
+        .def("stats", &PhreeqcWaterPropsMemoizedFn::stats, return_internal_ref, "Return the counters of cache hits and misses.")
+        .def("resetStats", &PhreeqcWaterPropsMemoizedFn::resetStats, "Reset the counters of cache hits and misses.")
+        ;
+
+    m.def("phreeqcWaterPropsMemoizedFn", PhreeqcUtils::waterPropsMemoizedFn, py::return_value_policy::reference, "Return the memoized function used to calculate the thermodynamic and electrostatic properties of water as in PHREEQC (of the calling thread).");
+}
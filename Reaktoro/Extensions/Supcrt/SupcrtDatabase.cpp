@@ -63,8 +63,10 @@ auto SupcrtDatabase::withName(const String& name) -> SupcrtDatabase
         "    - supcrtbl \n",
         "    - supcrtbl-organics \n",
         "");
-    const auto text = Embedded::get("databases/reaktoro/" + name + ".json");
-    const auto doc = Data::parseJson(text);
+    const auto binarypath = "databases/reaktoro/" + name + ".rkdb"; // the binary database converted from the JSON one at build time
+    const auto doc = Embedded::exists(binarypath) ?
+        Data::parseBinary(Embedded::get(binarypath)) :
+        Data::parseJson(Embedded::get("databases/reaktoro/" + name + ".json"));
     DatabaseParser dbparser(doc);
     return Database(dbparser);
 }
@@ -19,6 +19,9 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Core/Data.hpp>
+#include <Reaktoro/Core/Embedded.hpp>
+#include <Reaktoro/Core/Support/DatabaseParser.hpp>
 #include <Reaktoro/Extensions/Supcrt/SupcrtDatabase.hpp>
 using namespace Reaktoro;
 
@@ -32,6 +35,19 @@ TEST_CASE("Testing SupcrtDatabase object creation using embedded files", "[Supcr
     CHECK_NOTHROW( SupcrtDatabase("supcrt16-organics") );
     CHECK_NOTHROW( SupcrtDatabase("supcrtbl") );
     CHECK_NOTHROW( SupcrtDatabase("supcrtbl-organics") );
+
+    // Check the embedded binary database (loaded by SupcrtDatabase) is the same as the embedded JSON one
+    const auto db = SupcrtDatabase("supcrtbl");
+    const auto expected = Database(DatabaseParser(Data::parseJson(Embedded::get("databases/reaktoro/supcrtbl.json"))));
+
+    REQUIRE( db.species().size() == expected.species().size() );
+
+    for(auto i = 0; i < db.species().size(); ++i)
+    {
+        INFO( "species: " << expected.species()[i].name() );
+        CHECK( db.species()[i].name() == expected.species()[i].name() );
+        CHECK( db.species()[i].standardThermoProps(298.15, 1e5).G0 == expected.species()[i].standardThermoProps(298.15, 1e5).G0 );
+    }
 }
 
 TEST_CASE("Testing SupcrtDatabase module", "[SupcrtDatabase]")
@@ -67,14 +67,14 @@ auto activityModelDavies(const SpeciesList& species, ActivityModelDaviesParams p
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        mixture.update(*stateptr, T, P, x);
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous mixture and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = stateptr;
-        props.extra["AqueousMixture"] = mixtureptr;
+        exportAqueousMixture(props.extra, mixtureptr, stateptr);
 
         // Auxiliary constant references
         const auto& m = state.m;             // the molalities of all species
@@ -160,7 +160,8 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
         auto const RT = universalGasConstant*T;
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = *aqstateptr = solution.state(T, P, x);
+        solution.update(*aqstateptr, T, P, x);
+        auto const& aqstate = *aqstateptr;
 
         // The ionic strength of the solution and its square root
         auto const& I = aqstate.Ie;
@@ -174,8 +175,7 @@ auto createActivityModelExtendedUNIQUAC(SpeciesList const& species, ActivityMode
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous solution and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = aqstateptr;
-        props.extra["AqueousMixture"] = aqsolutionptr;
+        exportAqueousMixture(props.extra, aqsolutionptr, aqstateptr);
 
         // The mole fraction of water and its natural log
         auto const xw = x[iw];
@@ -31,7 +31,7 @@ auto ActivityModelIdealAqueous() -> ActivityModelGenerator
         const auto iw = species.indexWithFormula("H2O");
         const auto Mw = species[iw].molarMass();
 
-        ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
+        auto fn = [=](ActivityPropsRef props, ActivityModelArgs args)
         {
             const auto x = args.x;
             const auto xw = x[iw];
@@ -45,7 +45,10 @@ auto ActivityModelIdealAqueous() -> ActivityModelGenerator
             props.ln_a[iw] = -(1 - xw)/xw; // consistent to Gibbs-Duhem conditions
         };
 
-        return fn;
+        Data params;
+        params["IdealAqueous"] = Data();
+
+        return ActivityModel(fn, params);
     };
 
     return model;
@@ -30,7 +30,7 @@ auto ActivityModelIdealGas() -> ActivityModelGenerator
     {
         const auto R = universalGasConstant;
 
-        ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
+        auto fn = [=](ActivityPropsRef props, ActivityModelArgs args)
         {
             const auto& [T, P, x] = args;
 
@@ -46,7 +46,10 @@ auto ActivityModelIdealGas() -> ActivityModelGenerator
             props.ln_a = x.log() + log(Pbar);
         };
 
-        return fn;
+        Data params;
+        params["IdealGas"] = Data();
+
+        return ActivityModel(fn, params);
     };
 
     return model;
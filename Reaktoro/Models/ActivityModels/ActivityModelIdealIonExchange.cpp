@@ -32,7 +32,7 @@ auto ActivityModelIdealIonExchange() -> ActivityModelGenerator
         // The numbers of exchanger's equivalents for exchange species
         ArrayXd ze = surface.ze();
 
-        ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
+        auto fn = [=](ActivityPropsRef props, ActivityModelArgs args)
         {
             // Fetch species fractions for the activity model evaluation
             const auto x = args.x;
@@ -41,7 +41,10 @@ auto ActivityModelIdealIonExchange() -> ActivityModelGenerator
             props.ln_a = (x*ze/(x*ze).sum()).log();
         };
 
-        return fn;
+        Data params;
+        params["IdealIonExchange"] = Data();
+
+        return ActivityModel(fn, params);
     };
 
     return model;
@@ -17,13 +17,16 @@
 
 #include "ActivityModelIdealSolution.hpp"
 
+// Reaktoro includes
+#include <Reaktoro/Serialization/Core.hpp>
+
 namespace Reaktoro {
 
 auto ActivityModelIdealSolution(StateOfMatter stateofmatter) -> ActivityModelGenerator
 {
     ActivityModelGenerator model = [=](const SpeciesList& species)
     {
-        ActivityModel fn = [=](ActivityPropsRef props, ActivityModelArgs args)
+        auto fn = [=](ActivityPropsRef props, ActivityModelArgs args)
         {
             // Set the state of matter of the phase
             props.som = stateofmatter;
@@ -32,7 +35,10 @@ auto ActivityModelIdealSolution(StateOfMatter stateofmatter) -> ActivityModelGen
             props.ln_a = args.x.log();
         };
 
-        return fn;
+        Data params;
+        params["IdealSolution"]["StateOfMatter"] = stateofmatter;
+
+        return ActivityModel(fn, params);
     };
 
     return model;
@@ -58,11 +58,15 @@ auto activityModelIonExchangeGainesThomas(const SpeciesList& species) -> Activit
         // Initialized the ln of activity coefficients of the ion exchange species on the surface
         ln_g = ArrayXr::Zero(num_species);
 
-        // Calculate Davies and Debye--Huckel parameters only if the AqueousPhase has been already evaluated
-        if(props.extra["AqueousMixtureState"].has_value())
+        // The aqueous mixture state exported by the aqueous activity model, if the AqueousPhase has been already evaluated
+        auto aqstateit = props.extra.find("AqueousMixtureState");
+        auto aqstateptr = aqstateit != props.extra.end() && aqstateit->second.has_value() ? std::any_cast<SharedPtr<AqueousMixtureState> const&>(aqstateit->second) : nullptr;
+
+        // Calculate Davies and Debye--Huckel parameters only if the aqueous mixture state has valid water density and dielectric constant (e.g., not NaN)
+        if(aqstateptr && aqstateptr->rho > 0.0 && aqstateptr->epsilon > 0.0)
         {
             // Export aqueous mixture state via `extra` data member
-            const auto& aqstate = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(props.extra["AqueousMixtureState"]);
+            const auto& aqstate = *aqstateptr;
 
             // Auxiliary constant references properties
             const auto& I = aqstate.Is;            // the stoichiometric ionic strength
@@ -135,11 +139,15 @@ auto activityModelIonExchangeVanselow(const SpeciesList& species) -> ActivityMod
             // Initialized the ln of activity coefficients of the ion exchange species on the surface
             ln_g = ArrayXr::Zero(num_species);
 
-            // Calculate Davies and Debye--Huckel parameters only if the AqueousPhase has been already evaluated
-            if(props.extra["AqueousMixtureState"].has_value())
+            // The aqueous mixture state exported by the aqueous activity model, if the AqueousPhase has been already evaluated
+            auto aqstateit = props.extra.find("AqueousMixtureState");
+            auto aqstateptr = aqstateit != props.extra.end() && aqstateit->second.has_value() ? std::any_cast<SharedPtr<AqueousMixtureState> const&>(aqstateit->second) : nullptr;
+
+            // Calculate Davies and Debye--Huckel parameters only if the aqueous mixture state has valid water density and dielectric constant (e.g., not NaN)
+            if(aqstateptr && aqstateptr->rho > 0.0 && aqstateptr->epsilon > 0.0)
             {
                 // Export aqueous mixture state via `extra` data member
-                const auto& aqstate = *std::any_cast<SharedPtr<AqueousMixtureState> const&>(props.extra["AqueousMixtureState"]);
+                const auto& aqstate = *aqstateptr;
 
                 // Auxiliary constant references properties
                 const auto& I = aqstate.Is;            // the stoichiometric ionic strength
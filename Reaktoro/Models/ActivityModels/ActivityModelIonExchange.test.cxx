@@ -19,7 +19,9 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Extensions/Phreeqc/PhreeqcDatabase.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIdealAqueous.hpp>
 #include <Reaktoro/Models/ActivityModels/ActivityModelIonExchange.hpp>
 #include <Reaktoro/Utils/AqueousProps.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
@@ -121,6 +123,56 @@ TEST_CASE("Testing ActivityModelIonExchange", "[ActivityModelIonExchange]")
         CHECK( props.ln_a[5] == Approx(-13.3047)  ); // NH4X
     }
 
+    SECTION("Checking the activities (custom database) when the aqueous phase is ideal")
+    {
+        // Define aqueous species list and corresponding fractions
+        const auto species_aq = SpeciesList("H2O H+ OH- Na+ Cl- NaCl");
+        const auto x_aq = initializeAqueousMoleFractions(species_aq);
+
+        // Evaluate the ideal activity model of the aqueous phase first, as done for the phases in a chemical system
+        ActivityModel fnaq = ActivityModelIdealAqueous()(species_aq);
+        ActivityProps propsaq = ActivityProps::create(species_aq.size());
+        fnaq(propsaq, {T, P, x_aq});
+
+        // Construct the activity model function with the given ion exchange species.
+        ActivityModel fn = ActivityModelIonExchange()(species_db);
+
+        // Create the ActivityProps object with the results.
+        ActivityProps props = ActivityProps::create(species_db.size());
+
+        props.extra = propsaq.extra;
+
+        // Evaluate the activity props function
+        fn(props, {T, P, x_db});
+
+        CHECK( (props.ln_g == 0.0).all() ); // the ion exchange species remain ideal
+
+        CHECK( props.ln_a[0] == Approx(-12.6115)  ); // AlX3
+        CHECK( props.ln_a[1] == Approx(-0.810936) ); // CaX2
+        CHECK( props.ln_a[2] == Approx(-13.7102)  ); // KX
+        CHECK( props.ln_a[3] == Approx(-1.50408)  ); // MgX2
+        CHECK( props.ln_a[4] == Approx(-1.09862)  ); // NaX
+        CHECK( props.ln_a[5] == Approx(-13.7102)  ); // NH4X
+
+        // An aqueous mixture state without valid water density and dielectric constant is ignored
+        AqueousMixtureState aqstate = AqueousMixture(species_aq).state(T, P, x_aq);
+        aqstate.rho = NaN;
+        aqstate.epsilon = NaN;
+
+        props.extra["AqueousMixtureState"] = std::make_shared<AqueousMixtureState>(aqstate);
+
+        fn(props, {T, P, x_db});
+
+        CHECK( (props.ln_g == 0.0).all() );
+        CHECK( props.ln_a[1] == Approx(-0.810936) ); // CaX2
+
+        fn = ActivityModelIonExchangeVanselow()(species_db);
+        fn(props, {T, P, x_db});
+
+        CHECK( (props.ln_g == 0.0).all() );
+        CHECK( props.ln_a[1] == Approx(-1.09862)  ); // CaX2
+    }
+
     // Initialize the database corresponding to the string `phreeqc.dat` has been already initialized
     auto dbphreeqc = test::getPhreeqcDatabase("phreeqc.dat");
 
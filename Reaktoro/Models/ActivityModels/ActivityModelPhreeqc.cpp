@@ -106,14 +106,14 @@ auto createActivityModelPhreeqc(SpeciesList const& species, PhreeqcDatabase cons
         assert(x.minCoeff() > 0.0 && x.maxCoeff() <= 1.0);
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = *aqstateptr = solution.state(T, P, x);
+        solution.update(*aqstateptr, T, P, x);
+        auto const& aqstate = *aqstateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous solution and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = aqstateptr;
-        props.extra["AqueousMixture"] = aqsolutionptr;
+        exportAqueousMixture(props.extra, aqsolutionptr, aqstateptr);
 
         // Calculates gammas and [moles * d(ln gamma)/d mu] for all aqueous species.
         int i, j;
@@ -30,6 +30,7 @@
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/InterpolationUtils.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Common/ParseUtils.hpp>
 #include <Reaktoro/Common/Real.hpp>
@@ -330,6 +331,53 @@ struct PitzerParam
     }
 };
 
+/// Used to represent a list of interaction parameters of the same kind in the Pitzer activity model.
+/// The species indices and the current values of the parameters are stored in
+/// contiguous arrays so that the evaluation of the Pitzer model can sweep over
+/// them without chasing the memory of individual PitzerParam objects.
+struct PitzerParamList
+{
+    /// The indices of the first species associated with the interaction parameters.
+    Indices i0;
+
+    /// The indices of the second species associated with the interaction parameters.
+    Indices i1;
+
+    /// The indices of the third species associated with the interaction parameters (ternary parameters only).
+    Indices i2;
+
+    /// The temperature-pressure correction models of the interaction parameters.
+    Vec<Fn<real(real const&, real const&)>> models;
+
+    /// The current values of the interaction parameters since last update.
+    ArrayXr values;
+
+    /// Return the number of interaction parameters in the list.
+    auto size() const -> Index
+    {
+        return models.size();
+    }
+
+    /// Append an interaction parameter to the list.
+    auto append(PitzerParam const& param) -> void
+    {
+        i0.push_back(param.ispecies[0]);
+        i1.push_back(param.ispecies[1]);
+        if(param.ispecies.size() > 2)
+            i2.push_back(param.ispecies[2]);
+        models.push_back(param.model);
+        values.conservativeResize(models.size());
+        values[models.size() - 1] = 0.0;
+    }
+
+    /// Update the current values of the interaction parameters.
+    auto update(real const& T, real const& Pbar) -> void
+    {
+        for(auto k = 0; k < size(); ++k)
+            values[k] = models[k](T, Pbar);
+    }
+};
+
 /// Auxiliary alias for ActivityModelParamsPitzer::InteractionParamAttribs.
 using PitzerInteractionParamAttribs = ActivityModelParamsPitzer::InteractionParamAttribs;
 
@@ -640,33 +688,46 @@ struct PitzerModel
 {
     AqueousMixture solution; ///< The aqueous solution for which this Pitzer activity model is defined.
 
-    Vec<PitzerParam> beta0;  ///< The parameters \eq{\beta^{(0)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> beta1;  ///< The parameters \eq{\beta^{(1)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> beta2;  ///< The parameters \eq{\beta^{(2)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> Cphi;   ///< The parameters \eq{C^{\phi}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
-    Vec<PitzerParam> theta;  ///< The parameters \eq{\theta_{ij}(T, P)} in the Pitzer model for cation-cation and anion-anion interactions.
-    Vec<PitzerParam> psi;    ///< The parameters \eq{\psi_{ijk}(T, P)} in the Pitzer model for cation-cation-anion and anion-anion-cation interactions.
-    Vec<PitzerParam> lambda; ///< The parameters \eq{\lambda_{ij}(T, P)} in the Pitzer model for neutral-cation and neutral-anion interactions.
-    Vec<PitzerParam> zeta;   ///< The parameters \eq{\zeta_{ijk}(T, P)} in the Pitzer model for neutral-cation-anion interactions.
-    Vec<PitzerParam> mu;     ///< The parameters \eq{\mu_{ijk}(T, P)} in the Pitzer model for neutral-neutral-neutral, neutral-neutral-cation, and neutral-neutral-anion interactions.
-    Vec<PitzerParam> eta;    ///< The parameters \eq{\eta_{ijk}(T, P)} in the Pitzer model for neutral-cation-cation and neutral-anion-anion interactions.
-
-    Vec<real> alpha1; ///< The parameters \eq{alpha_1_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}}.
-    Vec<real> alpha2; ///< The parameters \eq{alpha_2_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}}.
+    PitzerParamList beta0;  ///< The parameters \eq{\beta^{(0)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamList beta1;  ///< The parameters \eq{\beta^{(1)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamList beta2;  ///< The parameters \eq{\beta^{(2)}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamList Cphi;   ///< The parameters \eq{C^{\phi}_{ij}(T, P)} in the Pitzer model for cation-anion interactions.
+    PitzerParamList theta;  ///< The parameters \eq{\theta_{ij}(T, P)} in the Pitzer model for cation-cation and anion-anion interactions.
+    PitzerParamList psi;    ///< The parameters \eq{\psi_{ijk}(T, P)} in the Pitzer model for cation-cation-anion and anion-anion-cation interactions.
+    PitzerParamList lambda; ///< The parameters \eq{\lambda_{ij}(T, P)} in the Pitzer model for neutral-cation and neutral-anion interactions.
+    PitzerParamList zeta;   ///< The parameters \eq{\zeta_{ijk}(T, P)} in the Pitzer model for neutral-cation-anion interactions.
+    PitzerParamList mu;     ///< The parameters \eq{\mu_{ijk}(T, P)} in the Pitzer model for neutral-neutral-neutral, neutral-neutral-cation, and neutral-neutral-anion interactions.
+    PitzerParamList eta;    ///< The parameters \eq{\eta_{ijk}(T, P)} in the Pitzer model for neutral-cation-cation and neutral-anion-anion interactions.
+
+    Vec<real> alphas; ///< The distinct values of the parameters \eq{\alpha_1_{ij}} and \eq{\alpha_2_{ij}} associated to the parameters \eq{\beta^{(1)}_{ij}} and \eq{\beta^{(2)}_{ij}}.
+    Indices ialpha1;  ///< The index in `alphas` of the parameter \eq{\alpha_1_{ij}} associated to each parameter \eq{\beta^{(1)}_{ij}}.
+    Indices ialpha2;  ///< The index in `alphas` of the parameter \eq{\alpha_2_{ij}} associated to each parameter \eq{\beta^{(2)}_{ij}}.
+    ArrayXr galpha;   ///< The current values of \eq{g(\alpha\sqrt{I})} for each distinct value of \eq{\alpha}.
+    ArrayXr gpalpha;  ///< The current values of \eq{g^\prime(\alpha\sqrt{I})/I} for each distinct value of \eq{\alpha}.
+    ArrayXr expalpha; ///< The current values of \eq{e^{-\alpha\sqrt{I}}} for each distinct value of \eq{\alpha}.
+
+    ArrayXd Cphi_factors; ///< The factors \eq{1/(2\sqrt{|z_iz_j|})} multiplying the parameters \eq{C^{\phi}_{ij}(T, P)}.
 
     using Tuples2i = Tuples<Index, Index>;                   ///< Auxiliary type for a tuple of 2 index values.
+    using Tuples2d = Tuples<double, double>;                 ///< Auxiliary type for a tuple of 2 double values.
     using Tuples3d = Tuples<double, double, double>;         ///< Auxiliary type for a tuple of 3 double values.
     using Tuples4d = Tuples<double, double, double, double>; ///< Auxiliary type for a tuple of 4 double values.
 
     Tuples3d lambda_coeffs; ///< The coefficients multiplying the terms where the lambda Pitzer parameter is involved.
     Tuples4d mu_coeffs;     ///< The coefficients multiplying the terms where the mu Pitzer parameter is involved.
 
-    Tuples2i thetaij; ///< The indices (i, j) of the cation-cation and anion-anion species pairs used to account for \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} contributions.
-    ArrayXr thetaE;   ///< The current values of the parameters \eq{^{E}\theta_{ij}(I)} associated to the \eq{\theta_{ij}} parameters.
-    ArrayXr thetaEP;  ///< The current values of the parameters \eq{^{E}\theta_{ij}^{\prime}(I)} associated to the \eq{\theta_{ij}} parameters.
+    Tuples2i thetaij;         ///< The indices (i, j) of the cation-cation and anion-anion species pairs with unequal charges used to account for \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} contributions.
+    Indices thetaij_icharges; ///< The index in `thetaE_charges` of the charge pair of each species pair in `thetaij`.
+    Tuples2d thetaE_charges;  ///< The distinct charge pairs \eq{(z_i, z_j)} in `thetaij`, for which \eq{^{E}\theta_{ij}(I)} and \eq{^{E}\theta_{ij}^{\prime}(I)} are computed only once.
+    ArrayXr thetaE;           ///< The current values of the parameters \eq{^{E}\theta_{ij}(I)} for each distinct charge pair in `thetaE_charges`.
+    ArrayXr thetaEP;          ///< The current values of the parameters \eq{^{E}\theta_{ij}^{\prime}(I)} for each distinct charge pair in `thetaE_charges`.
 
     Fn<real(real const&, real const&)> Aphi; ///< The function that computes the Debye-huckel parameter \eq{A^\phi(T, P)} in the Pitzer model.
 
+    real Tparams;              ///< The temperature used in the last update of the interaction parameters (in K).
+    real Pparams;              ///< The pressure used in the last update of the interaction parameters (in Pa).
+    bool paramsupdated = false; ///< The flag indicating whether the interaction parameters have been updated at least once.
+
     /// Construct a default Pitzer object.
     PitzerModel()
     {}
@@ -678,75 +739,99 @@ struct PitzerModel
     {
         for(auto const& entry : params.beta0)
             if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta0.push_back(param);
+                beta0.append(param);
 
         for(auto const& entry : params.beta1)
             if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta1.push_back(param);
+            {
+                beta1.append(param);
+                ialpha1.push_back(indexAlpha(determineAlpha1(entry.formulas[0], entry.formulas[1], params.alpha1)));
+            }
 
         for(auto const& entry : params.beta2)
             if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                beta2.push_back(param);
+            {
+                beta2.append(param);
+                ialpha2.push_back(indexAlpha(determineAlpha2(entry.formulas[0], entry.formulas[1], params.alpha2)));
+            }
 
         for(auto const& entry : params.Cphi)
             if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                Cphi.push_back(param);
+                Cphi.append(param);
 
         for(auto const& entry : params.theta)
             if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                theta.push_back(param);
+                theta.append(param);
 
         for(auto const& entry : params.psi)
             if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                psi.push_back(param);
+                psi.append(param);
 
         for(auto const& entry : params.lambda)
             if(PitzerParam param = createPitzerParamBinary(solution.species(), entry); !param.ispecies.empty())
-                lambda.push_back(param);
+                lambda.append(param);
 
         for(auto const& entry : params.zeta)
             if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                zeta.push_back(param);
+                zeta.append(param);
 
         for(auto const& entry : params.mu)
             if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                mu.push_back(param);
+                mu.append(param);
 
         for(auto const& entry : params.eta)
             if(PitzerParam param = createPitzerParamTernary(solution.species(), entry); !param.ispecies.empty())
-                eta.push_back(param);
+                eta.append(param);
 
-        for(auto const& entry : params.beta1)
-            alpha1.push_back(determineAlpha1(entry.formulas[0], entry.formulas[1], params.alpha1));
+        galpha.resize(alphas.size());
+        gpalpha.resize(alphas.size());
+        expalpha.resize(alphas.size());
 
-        for(auto const& entry : params.beta2)
-            alpha2.push_back(determineAlpha2(entry.formulas[0], entry.formulas[1], params.alpha2));
+        auto const& z = solution.charges();
+
+        Cphi_factors.resize(Cphi.size());
+        for(auto k = 0; k < Cphi.size(); ++k)
+            Cphi_factors[k] = 1.0/(2.0 * sqrt(abs(z[Cphi.i0[k]] * z[Cphi.i1[k]])));
 
         auto const& ications = solution.indicesCations();
         auto const& ianions = solution.indicesAnions();
 
-        for(auto i = 0; i < ications.size() - 1; ++i)
+        // Species pairs with equal charges have vanishing ^E(theta) and ^E(theta)' and are not considered
+        auto addThetaPair = [&](Index i, Index j)
+        {
+            if(z[i] == z[j])
+                return;
+            auto const charges = std::make_tuple(z[i], z[j]);
+            auto const k = index(thetaE_charges, charges);
+            if(k == thetaE_charges.size())
+                thetaE_charges.push_back(charges);
+            thetaij.emplace_back(i, j);
+            thetaij_icharges.push_back(k);
+        };
+
+        for(auto i = 0; i < ications.size(); ++i)
             for(auto j = i + 1; j < ications.size(); ++j)
-                thetaij.emplace_back(ications[i], ications[j]);
+                addThetaPair(ications[i], ications[j]);
 
-        for(auto i = 0; i < ianions.size() - 1; ++i)
+        for(auto i = 0; i < ianions.size(); ++i)
             for(auto j = i + 1; j < ianions.size(); ++j)
-                thetaij.emplace_back(ianions[i], ianions[j]);
+                addThetaPair(ianions[i], ianions[j]);
 
-        auto const& z = solution.charges();
+        thetaE.resize(thetaE_charges.size());
+        thetaEP.resize(thetaE_charges.size());
 
-        for(auto const& entry : lambda)
+        for(auto k = 0; k < lambda.size(); ++k)
         {
-            auto const i1 = entry.ispecies[0];
-            auto const i2 = entry.ispecies[1];
+            auto const i1 = lambda.i0[k];
+            auto const i2 = lambda.i1[k];
             lambda_coeffs.push_back(determineLambdaCoeffs(z[i1], z[i2], i1, i2));
         }
 
-        for(auto const& entry : mu)
+        for(auto k = 0; k < mu.size(); ++k)
         {
-            auto const i1 = entry.ispecies[0];
-            auto const i2 = entry.ispecies[1];
-            auto const i3 = entry.ispecies[2];
+            auto const i1 = mu.i0[k];
+            auto const i2 = mu.i1[k];
+            auto const i3 = mu.i2[k];
             mu_coeffs.push_back(determineMuCoeffs(z[i1], z[i2], z[i3], i1, i2, i3));
         }
 
@@ -766,40 +851,42 @@ struct PitzerModel
         Aphi = memoizeLast(Aphi); // memoize so that subsequent repeated calls with same (T, P) return cached result.
     }
 
+    /// Return the index of a given value of \eq{\alpha} in `alphas`, which is appended to it if not yet present.
+    auto indexAlpha(real const& alpha) -> Index
+    {
+        auto const k = index(alphas, alpha);
+        if(k == alphas.size())
+            alphas.push_back(alpha);
+        return k;
+    }
+
     /// Update all Pitzer interaction parameters according to current temperature and pressure.
+    /// The interaction parameters depend only on temperature and pressure, and
+    /// so they are not updated again if these have not changed since last call.
     auto updateParams(real const& T, real const& P)
     {
-        auto const Pbar = P * 1e-5; // from Pa to bar
-
-        for(auto& param : beta0)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : beta1)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : beta2)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : Cphi)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : theta)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : psi)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : lambda)
-            param.value = param.model(T, Pbar);
-
-        for(auto& param : zeta)
-            param.value = param.model(T, Pbar);
+        if(paramsupdated && Memoization::isEnabled() && sameValueAndSeed(Tparams, T) && sameValueAndSeed(Pparams, P))
+            return;
 
-        for(auto& param : mu)
-            param.value = param.model(T, Pbar);
+        auto const Pbar = P * 1e-5; // from Pa to bar
 
-        for(auto& param : eta)
-            param.value = param.model(T, Pbar);
+        beta0.update(T, Pbar);
+        beta1.update(T, Pbar);
+        beta2.update(T, Pbar);
+        Cphi.update(T, Pbar);
+        theta.update(T, Pbar);
+        psi.update(T, Pbar);
+        lambda.update(T, Pbar);
+        zeta.update(T, Pbar);
+        mu.update(T, Pbar);
+        eta.update(T, Pbar);
+
+        for(auto k = 0; k < Cphi.size(); ++k)
+            Cphi.values[k] *= Cphi_factors[k];
+
+        Tparams = T;
+        Pparams = P;
+        paramsupdated = true;
     }
 
     /// Evaluate the Pitzer model and compute the properties of the aqueous solution.
@@ -846,64 +933,89 @@ struct PitzerModel
         // The osmotic coefficient of water in the Pitzer model
         OSMOT = -Aphi0*I*DI/(1 + B*DI);
 
-        for(auto const& param : beta0)
+        // Compute the functions of ionic strength shared by all beta1 and beta2 parameters with the same alpha
+        for(auto k = 0; k < alphas.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            LGAMMA[i0] += M[i1] * 2.0 * param.value;
-            LGAMMA[i1] += M[i0] * 2.0 * param.value;
-            OSMOT += M[i0] * M[i1] * param.value;
+            auto const x = alphas[k] * DI;
+            galpha[k] = G(x);
+            gpalpha[k] = GP(x)/I;
+            expalpha[k] = exp(-x);
         }
 
-        for(auto const& [i, param] : enumerate(beta1))
+        // Compute the electrostatic mixing terms shared by all species pairs with the same charges
+        for(auto k = 0; k < thetaE_charges.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-
-            F += M[i0] * M[i1] * param.value * GP(alpha1[i] * DI)/I;
-            LGAMMA[i0] += M[i1] * 2.0 * param.value * G(alpha1[i] * DI);
-            LGAMMA[i1] += M[i0] * 2.0 * param.value * G(alpha1[i] * DI);
-            OSMOT += M[i0] * M[i1] * param.value * exp(-alpha1[i] * DI);
+            auto const [zi, zj] = thetaE_charges[k];
+            auto const [etheta, ethetap] = computeThetaValuesInterpolation(I, DI, Aphi0, zi, zj);
+            thetaE[k] = etheta;
+            thetaEP[k] = ethetap;
         }
 
-        for(auto const& [i, param] : enumerate(beta2))
+        for(auto k = 0; k < beta0.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+            auto const i0 = beta0.i0[k];
+            auto const i1 = beta0.i1[k];
+            auto const& value = beta0.values[k];
 
-            F += M[i0] * M[i1] * param.value * GP(alpha2[i] * DI)/I;
-            LGAMMA[i0] += M[i1] * 2.0 * param.value * G(alpha2[i] * DI);
-            LGAMMA[i1] += M[i0] * 2.0 * param.value * G(alpha2[i] * DI);
-            OSMOT += M[i0] * M[i1] * param.value * exp(-alpha2[i] * DI);
+            LGAMMA[i0] += M[i1] * 2.0 * value;
+            LGAMMA[i1] += M[i0] * 2.0 * value;
+            OSMOT += M[i0] * M[i1] * value;
         }
 
-        for(auto const& param : Cphi)
+        for(auto k = 0; k < beta1.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+            auto const i0 = beta1.i0[k];
+            auto const i1 = beta1.i1[k];
+            auto const ia = ialpha1[k];
+            auto const& value = beta1.values[k];
+
+            F += M[i0] * M[i1] * value * gpalpha[ia];
+            LGAMMA[i0] += M[i1] * 2.0 * value * galpha[ia];
+            LGAMMA[i1] += M[i0] * 2.0 * value * galpha[ia];
+            OSMOT += M[i0] * M[i1] * value * expalpha[ia];
+        }
 
-            auto const aux = 2.0 * sqrt(abs(z[i0] * z[i1]));
+        for(auto k = 0; k < beta2.size(); ++k)
+        {
+            auto const i0 = beta2.i0[k];
+            auto const i1 = beta2.i1[k];
+            auto const ia = ialpha2[k];
+            auto const& value = beta2.values[k];
+
+            F += M[i0] * M[i1] * value * gpalpha[ia];
+            LGAMMA[i0] += M[i1] * 2.0 * value * galpha[ia];
+            LGAMMA[i1] += M[i0] * 2.0 * value * galpha[ia];
+            OSMOT += M[i0] * M[i1] * value * expalpha[ia];
+        }
 
-            CSUM += M[i0] * M[i1] * param.value/aux;
-            LGAMMA[i0] += M[i1] * BIGZ * param.value/aux;
-            LGAMMA[i1] += M[i0] * BIGZ * param.value/aux;
-            OSMOT += M[i0] * M[i1] * BIGZ * param.value/aux;
+        for(auto k = 0; k < Cphi.size(); ++k)
+        {
+            auto const i0 = Cphi.i0[k];
+            auto const i1 = Cphi.i1[k];
+            auto const& value = Cphi.values[k]; // already divided by 2*sqrt(|z0*z1|) in updateParams
+
+            CSUM += M[i0] * M[i1] * value;
+            LGAMMA[i0] += M[i1] * BIGZ * value;
+            LGAMMA[i1] += M[i0] * BIGZ * value;
+            OSMOT += M[i0] * M[i1] * BIGZ * value;
         }
 
-        for(auto const& param : theta)
+        for(auto k = 0; k < theta.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+            auto const i0 = theta.i0[k];
+            auto const i1 = theta.i1[k];
+            auto const& value = theta.values[k];
 
-            LGAMMA[i0] += 2.0 * M[i1] * param.value;
-            LGAMMA[i1] += 2.0 * M[i0] * param.value;
-            OSMOT += M[i0] * M[i1] * param.value;
+            LGAMMA[i0] += 2.0 * M[i1] * value;
+            LGAMMA[i1] += 2.0 * M[i0] * value;
+            OSMOT += M[i0] * M[i1] * value;
         }
 
-        for(auto const& [i0, i1] : thetaij)
+        for(auto const& [k, ij] : enumerate(thetaij))
         {
-            auto const [etheta, ethetap] = computeThetaValuesInterpolation(I, DI, Aphi0, z[i0], z[i1]);
+            auto const [i0, i1] = ij;
+            auto const& etheta = thetaE[thetaij_icharges[k]];
+            auto const& ethetap = thetaEP[thetaij_icharges[k]];
 
             F += M[i0] * M[i1] * ethetap;
             LGAMMA[i0] += 2.0 * M[i1] * etheta;
@@ -911,66 +1023,71 @@ struct PitzerModel
             OSMOT += M[i0] * M[i1] * (etheta + I*ethetap);
         }
 
-        for(auto const& param : psi)
+        for(auto k = 0; k < psi.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
+            auto const i0 = psi.i0[k];
+            auto const i1 = psi.i1[k];
+            auto const i2 = psi.i2[k];
+            auto const& value = psi.values[k];
+
+            LGAMMA[i0] += M[i1] * M[i2] * value;
+            LGAMMA[i1] += M[i0] * M[i2] * value;
+            LGAMMA[i2] += M[i0] * M[i1] * value;
+            OSMOT += M[i0] * M[i1] * M[i2] * value;
         }
 
-        for(auto const& [i, param] : enumerate(lambda))
+        for(auto k = 0; k < lambda.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
+            auto const i0 = lambda.i0[k];
+            auto const i1 = lambda.i1[k];
+            auto const& value = lambda.values[k];
 
-            auto const [clng0, clng1, cosm] = lambda_coeffs[i];
+            auto const [clng0, clng1, cosm] = lambda_coeffs[k];
 
-            LGAMMA[i0] += M[i1] * param.value * clng0;
-            LGAMMA[i1] += M[i0] * param.value * clng1;
-            OSMOT += M[i0] * M[i1] * param.value * cosm;
+            LGAMMA[i0] += M[i1] * value * clng0;
+            LGAMMA[i1] += M[i0] * value * clng1;
+            OSMOT += M[i0] * M[i1] * value * cosm;
         }
 
-        for(auto const& param : zeta)
+        for(auto k = 0; k < zeta.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
+            auto const i0 = zeta.i0[k];
+            auto const i1 = zeta.i1[k];
+            auto const i2 = zeta.i2[k];
+            auto const& value = zeta.values[k];
+
+            LGAMMA[i0] += M[i1] * M[i2] * value;
+            LGAMMA[i1] += M[i0] * M[i2] * value;
+            LGAMMA[i2] += M[i0] * M[i1] * value;
+            OSMOT += M[i0] * M[i1] * M[i2] * value;
         }
 
-        for(auto const& [i, param] : enumerate(mu))
+        for(auto k = 0; k < mu.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
+            auto const i0 = mu.i0[k];
+            auto const i1 = mu.i1[k];
+            auto const i2 = mu.i2[k];
+            auto const& value = mu.values[k];
 
-            auto const [clng0, clng1, clng2, cosm] = mu_coeffs[i];
+            auto const [clng0, clng1, clng2, cosm] = mu_coeffs[k];
 
-            LGAMMA[i0] += M[i1] * M[i2] * param.value * clng0;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value * clng1;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value * clng2;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value * cosm;
+            LGAMMA[i0] += M[i1] * M[i2] * value * clng0;
+            LGAMMA[i1] += M[i0] * M[i2] * value * clng1;
+            LGAMMA[i2] += M[i0] * M[i1] * value * clng2;
+            OSMOT += M[i0] * M[i1] * M[i2] * value * cosm;
         }
 
-        for(auto const& param : eta)
+        for(auto k = 0; k < eta.size(); ++k)
         {
-            auto const i0 = param.ispecies[0];
-            auto const i1 = param.ispecies[1];
-            auto const i2 = param.ispecies[2];
-
-            LGAMMA[i0] += M[i1] * M[i2] * param.value;
-            LGAMMA[i1] += M[i0] * M[i2] * param.value;
-            LGAMMA[i2] += M[i0] * M[i1] * param.value;
-            OSMOT += M[i0] * M[i1] * M[i2] * param.value;
+            auto const i0 = eta.i0[k];
+            auto const i1 = eta.i1[k];
+            auto const i2 = eta.i2[k];
+            auto const& value = eta.values[k];
+
+            LGAMMA[i0] += M[i1] * M[i2] * value;
+            LGAMMA[i1] += M[i0] * M[i2] * value;
+            LGAMMA[i2] += M[i0] * M[i1] * value;
+            OSMOT += M[i0] * M[i1] * M[i2] * value;
         }
 
         // Finalise the calculation of the activity coefficient by adding the missing F and CSUM contributions
@@ -1011,14 +1128,14 @@ auto createActivityModelPitzer(SpeciesList const& species, ActivityModelParamsPi
         auto const& [T, P, x] = args;
 
         // Evaluate the state of the aqueous solution
-        auto const& aqstate = *aqstateptr = solution.state(T, P, x);
+        solution.update(*aqstateptr, T, P, x);
+        auto const& aqstate = *aqstateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous solution and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = aqstateptr;
-        props.extra["AqueousMixture"] = aqsolutionptr;
+        exportAqueousMixture(props.extra, aqsolutionptr, aqstateptr);
 
         // Evaluate the Pitzer activity model with given aqueous state
         pzmodel.evaluate(aqstate, pzstate);
@@ -792,4 +792,48 @@ TEST_CASE("Testing ActivityModelPitzer", "[ActivityModelPitzer]")
         CHECK( props.ln_g[31]/ln10 == Approx( 0.239383000) ); // H4SiO4 (PHREEQC:  0.23937, difference: 5.43e-03 %)
         CHECK( props.ln_g[32]/ln10 == Approx(-1.906930000) ); // Sr+2 (PHREEQC: -1.90518, difference: 9.19e-02 %)
     }
+
+    WHEN("temperature-dependent parameters are reused between evaluations")
+    {
+        const auto species = SpeciesList("H2O H+ OH- Na+ Cl- Ca+2 Mg+2 SO4-2 HCO3- CO3-2 CO2");
+
+        const auto P = 1.0e+5;
+
+        const auto n = ArrayXr{{ 55.5062, 1e-7, 1e-7, 1.0, 1.2, 0.1, 0.05, 0.1, 0.01, 0.001, 0.001 }};
+
+        const auto x = n / n.sum();
+
+        ActivityModel fn = ActivityModelPitzer()(species);
+
+        ActivityProps props1 = ActivityProps::create(species.size());
+        ActivityProps props2 = ActivityProps::create(species.size());
+
+        fn(props1, {25.0 + 273.15, P, x});
+        fn(props2, {60.0 + 273.15, P, x});
+
+        ActivityProps expected = ActivityProps::create(species.size());
+
+        // Compare against a new model object that has never been evaluated at 25 °C
+        ActivityModelPitzer()(species)(expected, {60.0 + 273.15, P, x});
+
+        for(auto i = 0; i < species.size(); ++i)
+            CHECK( props2.ln_g[i] == Approx(expected.ln_g[i]) );
+
+        // Evaluate again at 25 °C, for which the parameters must be recomputed
+        fn(props2, {25.0 + 273.15, P, x});
+
+        for(auto i = 0; i < species.size(); ++i)
+            CHECK( props2.ln_g[i] == Approx(props1.ln_g[i]) );
+
+        // Evaluate again at 25 °C with T seeded, for which the parameters must be recomputed with their temperature derivatives
+        real T = 25.0 + 273.15;
+        T[1] = 1.0;
+
+        fn(props2, {T, P, x});
+
+        ActivityModelPitzer()(species)(expected, {T, P, x});
+
+        for(auto i = 0; i < species.size(); ++i)
+            CHECK( props2.ln_g[i][1] == Approx(expected.ln_g[i][1]) );
+    }
 }
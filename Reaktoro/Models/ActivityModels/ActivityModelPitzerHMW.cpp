@@ -26,6 +26,7 @@
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/ConvertUtils.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Common/NamingUtils.hpp>
 #include <Reaktoro/Common/Real.hpp>
 #include <Reaktoro/Common/StringUtils.hpp>
@@ -748,6 +749,67 @@ struct PitzerParams
     Table3D<real> zeta;
 
     BilinearInterpolator Aphi;
+
+    /// The temperature at which the temperature-dependent parameters below were last evaluated (in K).
+    real T_params;
+
+    /// The values of the parameters `beta0` at temperature `T_params` (cations by anions).
+    MatrixXr beta0_T;
+
+    /// The values of the parameters `beta1` at temperature `T_params` (cations by anions).
+    MatrixXr beta1_T;
+
+    /// The values of the parameters `beta2` at temperature `T_params` (cations by anions).
+    MatrixXr beta2_T;
+
+    /// The values of the terms \eq{C_{ca} = C^{\phi}_{ca}/(2\sqrt{|z_cz_a|})} at temperature `T_params` (cations by anions).
+    MatrixXr C_T;
+
+    /// The ionic strength at which the electrostatic mixing terms below were last evaluated (in molal).
+    real I_thetaE;
+
+    /// The Debye-Huckel coefficient at which the electrostatic mixing terms below were last evaluated.
+    real Aphi_thetaE;
+
+    /// The values of the electrostatic mixing terms \eq{^{E}\theta_{ij}} for all pairs of cations.
+    MatrixXr thetaE_cc_I;
+
+    /// The values of the electrostatic mixing terms \eq{^{E}\theta_{ij}} for all pairs of anions.
+    MatrixXr thetaE_aa_I;
+
+    /// The values of the electrostatic mixing terms \eq{^{E}\theta_{ij}^{\prime}} for all pairs of cations.
+    MatrixXr thetaE_prime_cc_I;
+
+    /// The values of the electrostatic mixing terms \eq{^{E}\theta_{ij}^{\prime}} for all pairs of anions.
+    MatrixXr thetaE_prime_aa_I;
+
+    /// The values of the terms \eq{B^{\phi}_{ca}} at the current state (cations by anions).
+    MatrixXr Bphi_state;
+
+    /// The values of the terms \eq{B_{ca}} at the current state (cations by anions).
+    MatrixXr B_state;
+
+    /// The values of the terms \eq{B^{\prime}_{ca}} at the current state (cations by anions).
+    MatrixXr B_prime_state;
+
+    /// The Debye-Huckel coefficient Aphi at the current state.
+    real Aphi_state;
+
+    /// The term F of the Harvie-Moller-Weare Pitzer's model at the current state.
+    real F_state;
+
+    /// The term Z of the Harvie-Moller-Weare Pitzer's model at the current state.
+    real Z_state;
+
+    /// The flag indicating whether the cached values above have been evaluated at least once.
+    bool initialized = false;
+
+    /// Update the cached parameters and terms for the current state of the aqueous mixture.
+    /// The temperature-dependent parameters are evaluated only when temperature
+    /// changes and the electrostatic mixing terms only when ionic strength (or
+    /// the Debye-Huckel coefficient) changes, so that evaluations at fixed
+    /// temperature (e.g., during Newton iterations) reduce to matrix arithmetic.
+    auto update(const AqueousMixtureState& state) -> void;
 };
 
 PitzerParams::PitzerParams()
@@ -796,106 +858,89 @@ PitzerParams::PitzerParams(const AqueousMixture& mixture)
     Aphi = BilinearInterpolator(temperatures, pressures, Aphi_data);
 }
 
-auto thetaE(const AqueousMixtureState& state, const PitzerParams& pitzer, real zi, real zj) -> real
+/// Return the electrostatic mixing terms \eq{^{E}\theta_{ij}} and \eq{^{E}\theta_{ij}^{\prime}} for ions with charges `zi` and `zj`.
+auto thetaE(real I, real Aphi, real zi, real zj) -> Pair<real, real>
 {
-    if(zi == zj) return 0.0;
+    if(zi == zj) return { 0.0, 0.0 };
 
-    const auto I     = state.Ie;
-    const auto T     = state.T;
-    const auto P     = state.P;
     const auto sqrtI = sqrt(I);
-    const auto Aphi  = pitzer.Aphi(T, P);
     const auto xij   = 6.0*zi*zj*Aphi*sqrtI;
     const auto xii   = 6.0*zi*zi*Aphi*sqrtI;
     const auto xjj   = 6.0*zj*zj*Aphi*sqrtI;
     const auto J0ij  = J0(xij);
     const auto J0ii  = J0(xii);
     const auto J0jj  = J0(xjj);
-
-    return zi*zj/(4*I) * (J0ij - 0.5*J0ii - 0.5*J0jj);
-}
-
-auto thetaE_prime(const AqueousMixtureState& state, const PitzerParams& pitzer, real zi, real zj) -> real
-{
-    if(zi == zj) return 0.0;
-
-    const auto I     = state.Ie;
-    const auto T     = state.T;
-    const auto P     = state.P;
-    const auto sqrtI = sqrt(I);
-    const auto Aphi  = pitzer.Aphi(T, P);
-    const auto xij   = 6.0*zi*zj*Aphi*sqrtI;
-    const auto xii   = 6.0*zi*zi*Aphi*sqrtI;
-    const auto xjj   = 6.0*zj*zj*Aphi*sqrtI;
     const auto J1ij  = J1(xij);
     const auto J1ii  = J1(xii);
     const auto J1jj  = J1(xjj);
 
-    return zi*zj/(8*I*I) * (J1ij - 0.5*J1ii - 0.5*J1jj) - thetaE(state, pitzer, zi, zj)/I;
-}
+    const auto thetaEij = zi*zj/(4*I) * (J0ij - 0.5*J0ii - 0.5*J0jj);
+    const auto thetaEij_prime = zi*zj/(8*I*I) * (J1ij - 0.5*J1ii - 0.5*J1jj) - thetaEij/I;
 
-auto thetaE_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
-{
-    const auto zi = pitzer.z_cations[i];
-    const auto zj = pitzer.z_cations[j];
-    return thetaE(state, pitzer, zi, zj);
+    return { thetaEij, thetaEij_prime };
 }
 
-auto thetaE_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
+/// Compute the electrostatic mixing terms for all pairs of ions with given charges.
+/// These terms depend only on the charges of the ions, and so they are
+/// computed only once for each distinct pair of charges.
+auto computeThetaE(real I, real Aphi, const ArrayXr& z, MatrixXr& thetaEvals, MatrixXr& thetaEvals_prime) -> void
 {
-    const auto zi = pitzer.z_anions[i];
-    const auto zj = pitzer.z_anions[j];
-    return thetaE(state, pitzer, zi, zj);
-}
+    const auto num = z.size();
 
-auto thetaE_prime_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
-{
-    const auto zi = pitzer.z_cations[i];
-    const auto zj = pitzer.z_cations[j];
-    return thetaE_prime(state, pitzer, zi, zj);
-}
+    thetaEvals.resize(num, num);
+    thetaEvals_prime.resize(num, num);
 
-auto thetaE_prime_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
-{
-    const auto zi = pitzer.z_anions[i];
-    const auto zj = pitzer.z_anions[j];
-    return thetaE_prime(state, pitzer, zi, zj);
+    Vec<Tuple<real, real, real, real>> computed; // the already computed tuples (zi, zj, thetaE, thetaE')
+
+    for(auto i = 0; i < num; ++i) for(auto j = i; j < num; ++j)
+    {
+        const auto k = indexfn(computed, RKT_LAMBDA(x, std::get<0>(x) == z[i] && std::get<1>(x) == z[j]));
+
+        if(k == computed.size())
+        {
+            const auto [thetaEij, thetaEij_prime] = thetaE(I, Aphi, z[i], z[j]);
+            computed.emplace_back(z[i], z[j], thetaEij, thetaEij_prime);
+        }
+
+        thetaEvals(i, j) = thetaEvals(j, i) = std::get<2>(computed[k]);
+        thetaEvals_prime(i, j) = thetaEvals_prime(j, i) = std::get<3>(computed[k]);
+    }
 }
 
 auto Phi_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
 {
     const auto thetaij = pitzer.theta_cc[i][j];
-    return thetaij + thetaE_cc(state, pitzer, i, j);
+    return thetaij + pitzer.thetaE_cc_I(i, j);
 }
 
 auto Phi_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
 {
     const auto thetaij = pitzer.theta_aa[i][j];
-    return thetaij + thetaE_aa(state, pitzer, i, j);
+    return thetaij + pitzer.thetaE_aa_I(i, j);
 }
 
 auto Phi_phi_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
 {
     const auto I = state.Ie;
     const auto thetaij = pitzer.theta_cc[i][j];
-    return thetaij + thetaE_cc(state, pitzer, i, j) + I * thetaE_prime_cc(state, pitzer, i, j);
+    return thetaij + pitzer.thetaE_cc_I(i, j) + I * pitzer.thetaE_prime_cc_I(i, j);
 }
 
 auto Phi_phi_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
 {
     const auto I = state.Ie;
     const auto thetaij = pitzer.theta_aa[i][j];
-    return thetaij + thetaE_aa(state, pitzer, i, j) + I * thetaE_prime_aa(state, pitzer, i, j);
+    return thetaij + pitzer.thetaE_aa_I(i, j) + I * pitzer.thetaE_prime_aa_I(i, j);
 }
 
 auto Phi_prime_cc(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
 {
-    return thetaE_prime_cc(state, pitzer, i, j);
+    return pitzer.thetaE_prime_cc_I(i, j);
 }
 
 auto Phi_prime_aa(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned i, unsigned j) -> real
 {
-    return thetaE_prime_aa(state, pitzer, i, j);
+    return pitzer.thetaE_prime_aa_I(i, j);
 }
 
 auto g(real x) -> real
@@ -914,61 +959,22 @@ const auto alpha2 = 12.0;
 
 auto B_phi(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned c, unsigned a) -> real
 {
-    const auto I     = state.Ie;
-    const auto T     = state.T;
-    const auto sqrtI = sqrt(I);
-    const auto zc    = pitzer.z_cations[c];
-    const auto za    = pitzer.z_anions[a];
-    const auto beta0 = pitzer.beta0[c][a](T);
-    const auto beta1 = pitzer.beta1[c][a](T);
-    const auto beta2 = pitzer.beta2[c][a](T);
-
-    if(abs(zc) == 2 && abs(za) == 2)
-        return beta0 + beta1 * exp(-alpha1*sqrtI) + beta2 * exp(-alpha2*sqrtI);
-    else
-        return beta0 + beta1 * exp(-alpha*sqrtI);
+    return pitzer.Bphi_state(c, a);
 }
 
 auto B(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned c, unsigned a) -> real
 {
-    const auto I     = state.Ie;
-    const auto T     = state.T;
-    const auto sqrtI = sqrt(I);
-    const auto zc    = pitzer.z_cations[c];
-    const auto za    = pitzer.z_anions[a];
-    const auto beta0 = pitzer.beta0[c][a](T);
-    const auto beta1 = pitzer.beta1[c][a](T);
-    const auto beta2 = pitzer.beta2[c][a](T);
-
-    if(abs(zc) == 2 && abs(za) == 2)
-        return beta0 + beta1 * g(alpha1*sqrtI) + beta2 * g(alpha2*sqrtI);
-    else
-        return beta0 + beta1 * g(alpha*sqrtI);
+    return pitzer.B_state(c, a);
 }
 
 auto B_prime(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned c, unsigned a) -> real
 {
-    const auto I     = state.Ie;
-    const auto T     = state.T;
-    const auto sqrtI = sqrt(I);
-    const auto zc    = pitzer.z_cations[c];
-    const auto za    = pitzer.z_anions[a];
-    const auto beta1 = pitzer.beta1[c][a](T);
-    const auto beta2 = pitzer.beta2[c][a](T);
-
-    if(abs(zc) == 2 && abs(za) == 2)
-        return beta1 * g_prime(alpha1*sqrtI)/I + beta2 * g_prime(alpha2*sqrtI)/I;
-    else
-        return beta1 * g_prime(alpha*sqrtI)/I;
+    return pitzer.B_prime_state(c, a);
 }
 
 auto C(const AqueousMixtureState& state, const PitzerParams& pitzer, unsigned c, unsigned a) -> real
 {
-    const auto T     = state.T;
-    const auto Cphi = pitzer.Cphi[c][a](T);
-    const auto zc   = pitzer.z_cations[c];
-    const auto za   = pitzer.z_anions[a];
-    return 0.5 * Cphi/sqrt(abs(zc*za));
+    return pitzer.C_T(c, a);
 }
 
 auto computeF(const AqueousMixtureState& state, const PitzerParams& pitzer) -> real
@@ -981,10 +987,6 @@ auto computeF(const AqueousMixtureState& state, const PitzerParams& pitzer) -> r
     const auto num_cations = idx_cations.size();
     const auto num_anions  = idx_anions.size();
 
-    // THe temperature and pressure in units of K and Pa respectively
-    const auto& T = state.T;
-    const auto& P = state.P;
-
     // The molalities of all aqueous species
     const auto& m = state.m;
 
@@ -993,7 +995,7 @@ auto computeF(const AqueousMixtureState& state, const PitzerParams& pitzer) -> r
     const auto sqrtI = sqrt(I);
 
     // The Debye-Huckel coefficient Aphi
-    const auto Aphi = pitzer.Aphi(T, P);
+    const auto Aphi = pitzer.Aphi_state;
 
     // The b parameter of the Harvie-Moller-Weare Pitzer's model
     const auto b = 1.2;
@@ -1006,11 +1008,11 @@ auto computeF(const AqueousMixtureState& state, const PitzerParams& pitzer) -> r
         F += m[idx_cations[c]] * m[idx_anions[a]] * B_prime(state, pitzer, c, a);
 
     // Iterate over all pairs of distinct cations
-    for(auto i = 0; i < num_cations - 1; ++i) for(auto j = i + 1; j < num_cations; ++j)
+    for(auto i = 0; i < num_cations; ++i) for(auto j = i + 1; j < num_cations; ++j)
         F += m[idx_cations[i]] * m[idx_cations[j]] * Phi_prime_cc(state, pitzer, i, j);
 
     // Iterate over all pairs of distinct anions
-    for(auto i = 0; i < num_anions - 1; ++i) for(auto j = i + 1; j < num_anions; ++j)
+    for(auto i = 0; i < num_anions; ++i) for(auto j = i + 1; j < num_anions; ++j)
         F += m[idx_anions[i]] * m[idx_anions[j]] * Phi_prime_aa(state, pitzer, i, j);
 
     return F;
@@ -1023,6 +1025,91 @@ auto computeZ(const AqueousMixtureState& state, const PitzerParams& pitzer) -> r
     return (mi * zi).sum();
 }
 
+auto PitzerParams::update(const AqueousMixtureState& state) -> void
+{
+    const auto& T = state.T;
+    const auto& P = state.P;
+    const auto& I = state.Ie;
+
+    const auto num_cations = idx_cations.size();
+    const auto num_anions  = idx_anions.size();
+
+    // The cached parameters below can only be reused if memoization is enabled
+    const auto reusable = initialized && Memoization::isEnabled();
+
+    // Evaluate the temperature-dependent single-salt parameters only if temperature (value or derivative seed) has changed
+    if(!reusable || !sameValueAndSeed(T_params, T))
+    {
+        beta0_T.resize(num_cations, num_anions);
+        beta1_T.resize(num_cations, num_anions);
+        beta2_T.resize(num_cations, num_anions);
+        C_T.resize(num_cations, num_anions);
+
+        for(auto c = 0; c < num_cations; ++c) for(auto a = 0; a < num_anions; ++a)
+        {
+            beta0_T(c, a) = beta0[c][a](T);
+            beta1_T(c, a) = beta1[c][a](T);
+            beta2_T(c, a) = beta2[c][a](T);
+            C_T(c, a) = 0.5 * Cphi[c][a](T)/sqrt(abs(z_cations[c]*z_anions[a]));
+        }
+
+        T_params = T;
+    }
+
+    Aphi_state = Aphi(T, P);
+
+    // Evaluate the electrostatic mixing terms only if ionic strength (or Aphi) has changed, including their derivative seeds
+    if(!reusable || !sameValueAndSeed(I_thetaE, I) || !sameValueAndSeed(Aphi_thetaE, Aphi_state))
+    {
+        computeThetaE(I, Aphi_state, z_cations, thetaE_cc_I, thetaE_prime_cc_I);
+        computeThetaE(I, Aphi_state, z_anions, thetaE_aa_I, thetaE_prime_aa_I);
+
+        I_thetaE = I;
+        Aphi_thetaE = Aphi_state;
+    }
+
+    initialized = true;
+
+    // The functions of ionic strength shared by all pairs of cations and anions
+    const auto sqrtI = sqrt(I);
+
+    const real exp_alpha  = exp(-alpha*sqrtI);
+    const real exp_alpha1 = exp(-alpha1*sqrtI);
+    const real exp_alpha2 = exp(-alpha2*sqrtI);
+
+    const real g_alpha  = g(alpha*sqrtI);
+    const real g_alpha1 = g(alpha1*sqrtI);
+    const real g_alpha2 = g(alpha2*sqrtI);
+
+    const real g_prime_alpha  = g_prime(alpha*sqrtI)/I;
+    const real g_prime_alpha1 = g_prime(alpha1*sqrtI)/I;
+    const real g_prime_alpha2 = g_prime(alpha2*sqrtI)/I;
+
+    Bphi_state.resize(num_cations, num_anions);
+    B_state.resize(num_cations, num_anions);
+    B_prime_state.resize(num_cations, num_anions);
+
+    for(auto c = 0; c < num_cations; ++c) for(auto a = 0; a < num_anions; ++a)
+    {
+        if(abs(z_cations[c]) == 2 && abs(z_anions[a]) == 2)
+        {
+            Bphi_state(c, a) = beta0_T(c, a) + beta1_T(c, a) * exp_alpha1 + beta2_T(c, a) * exp_alpha2;
+            B_state(c, a) = beta0_T(c, a) + beta1_T(c, a) * g_alpha1 + beta2_T(c, a) * g_alpha2;
+            B_prime_state(c, a) = beta1_T(c, a) * g_prime_alpha1 + beta2_T(c, a) * g_prime_alpha2;
+        }
+        else
+        {
+            Bphi_state(c, a) = beta0_T(c, a) + beta1_T(c, a) * exp_alpha;
+            B_state(c, a) = beta0_T(c, a) + beta1_T(c, a) * g_alpha;
+            B_prime_state(c, a) = beta1_T(c, a) * g_prime_alpha;
+        }
+    }
+
+    // The terms F and Z are the same for all species and computed only once per evaluation
+    F_state = computeF(state, *this);
+    Z_state = computeZ(state, *this);
+}
+
 /// Return the Pitzer activity coefficient of a cation (in natural log scale).
 /// @param state The state of the aqueous mixture
 /// @param pitzer The Pitzer parameters
@@ -1049,8 +1136,8 @@ auto lnActivityCoefficientCation(const AqueousMixtureState& state, const PitzerP
     const auto zM = pitzer.z_cations[M];
 
     // The terms F and Z of the Harvie-Moller-Weare Pitzer's model
-    const auto F = computeF(state, pitzer);
-    const auto Z = computeZ(state, pitzer);
+    const auto& F = pitzer.F_state;
+    const auto& Z = pitzer.Z_state;
 
     // The log of the activity coefficient of the M-th cation
     real ln_gammaM = {};
@@ -1086,7 +1173,7 @@ auto lnActivityCoefficientCation(const AqueousMixtureState& state, const PitzerP
     }
 
     // Iterate over all pairs of distinct anions
-    for(auto i = 0; i < num_anions - 1; ++i) for(auto j = i + 1; j < num_anions; ++j)
+    for(auto i = 0; i < num_anions; ++i) for(auto j = i + 1; j < num_anions; ++j)
     {
         const auto mi = m[idx_anions[i]];
         const auto mj = m[idx_anions[j]];
@@ -1141,8 +1228,8 @@ auto lnActivityCoefficientAnion(const AqueousMixtureState& state, const PitzerPa
     const auto zX = pitzer.z_anions[X];
 
     // The terms F and Z of the Harvie-Moller-Weare Pitzer's model
-    const auto F = computeF(state, pitzer);
-    const auto Z = computeZ(state, pitzer);
+    const auto& F = pitzer.F_state;
+    const auto& Z = pitzer.Z_state;
 
     // The log of the activity coefficient of the X-th anion
     real ln_gammaX = {};
@@ -1178,7 +1265,7 @@ auto lnActivityCoefficientAnion(const AqueousMixtureState& state, const PitzerPa
     }
 
     // Iterate over all pairs of distinct cations
-    for(auto i = 0; i < num_cations - 1; ++i) for(auto j = i + 1; j < num_cations; ++j)
+    for(auto i = 0; i < num_cations; ++i) for(auto j = i + 1; j < num_cations; ++j)
     {
         const auto mi = m[idx_cations[i]];
         const auto mj = m[idx_cations[j]];
@@ -1246,13 +1333,13 @@ auto lnActivityWater(const AqueousMixtureState& state, const PitzerParams& pitze
     const auto Mw = state.m[iH2O];
 
     // The Debye-Huckel coefficient Aphi
-    const auto Aphi = pitzer.Aphi(state.T, state.P);
+    const auto& Aphi = pitzer.Aphi_state;
 
     // The b parameter of the Harvie-Moller-Weare Pitzer's model
     const auto b = 1.2;
 
     // The term Z of the Harvie-Moller-Weare Pitzer's model
-    const auto Z = computeZ(state, pitzer);
+    const auto& Z = pitzer.Z_state;
 
     // The osmotic coefficient of the aqueous mixture
     real phi = -Aphi*I*sqrtI/(1 + b*sqrtI);
@@ -1269,7 +1356,7 @@ auto lnActivityWater(const AqueousMixtureState& state, const PitzerParams& pitze
     }
 
     // Iterate over all pairs of distinct cations
-    for(auto i = 0; i < num_cations - 1; ++i) for(auto j = i + 1; j < num_cations; ++j)
+    for(auto i = 0; i < num_cations; ++i) for(auto j = i + 1; j < num_cations; ++j)
     {
         const auto mi = m[idx_cations[i]];
         const auto mj = m[idx_cations[j]];
@@ -1290,7 +1377,7 @@ auto lnActivityWater(const AqueousMixtureState& state, const PitzerParams& pitze
     }
 
     // Iterate over all pairs of distinct anions
-    for(auto i = 0; i < num_anions - 1; ++i) for(auto j = i + 1; j < num_anions; ++j)
+    for(auto i = 0; i < num_anions; ++i) for(auto j = i + 1; j < num_anions; ++j)
     {
         const auto mi = m[idx_anions[i]];
         const auto mj = m[idx_anions[j]];
@@ -1400,14 +1487,17 @@ auto activityModelPitzerHMW(const SpeciesList& species) -> ActivityModel
         const auto& [T, P, x] = args;
 
         // Evaluate the state of the aqueous mixture
-        auto const& state = *stateptr = mixture.state(T, P, x);
+        mixture.update(*stateptr, T, P, x);
+        auto const& state = *stateptr;
 
         // Set the state of matter of the phase
         props.som = StateOfMatter::Liquid;
 
         // Export the aqueous mixture and its state via the `extra` data member
-        props.extra["AqueousMixtureState"] = stateptr;
-        props.extra["AqueousMixture"] = mixtureptr;
+        exportAqueousMixture(props.extra, mixtureptr, stateptr);
+
+        // Update the Pitzer parameters and terms that depend on temperature, ionic strength and molalities
+        pitzer.update(state);
 
         // Calculate the activity coefficients of the cations
         for(auto M = 0; M < pitzer.idx_cations.size(); ++M)
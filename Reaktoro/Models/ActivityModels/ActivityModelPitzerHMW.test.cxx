@@ -91,3 +91,41 @@ TEST_CASE("Testing ActivityModelPitzerHMW", "[ActivityModelPitzerHMW]")
 
     // checkActivities(x, props);
 }
+
+TEST_CASE("Testing ActivityModelPitzerHMW reuse of temperature-dependent parameters", "[ActivityModelPitzerHMW]")
+{
+    const auto species = SpeciesList("H2O H+ OH- Na+ Cl- Ca++ HCO3- CO3-- CO2");
+
+    ArrayXr n = ArrayXr::Constant(species.size(), 0.1);
+    n[0] = 55.508; // H2O
+    n[1] = 1e-7;   // H+
+    n[2] = 1e-7;   // OH-
+    n[3] = 0.3;    // Na+
+    n[4] = 0.3;    // Cl-
+
+    const ArrayXr x = n / n.sum();
+
+    const auto P = 12.3e5;
+
+    ActivityModel fn = ActivityModelPitzerHMW()(species);
+
+    ActivityProps props = ActivityProps::create(species.size());
+    ActivityProps expected = ActivityProps::create(species.size());
+
+    fn(props, {300.0, P, x});
+
+    // Evaluate again at the same temperature with T seeded, for which the parameters must be recomputed with their temperature derivatives
+    real T = 300.0;
+    T[1] = 1.0;
+
+    fn(props, {T, P, x});
+
+    ActivityModelPitzerHMW()(species)(expected, {T, P, x});
+
+    for(auto i = 0; i < species.size(); ++i)
+    {
+        INFO("i = " << i);
+        CHECK( props.ln_g[i][0] == Approx(expected.ln_g[i][0]) );
+        CHECK( props.ln_g[i][1] == Approx(expected.ln_g[i][1]) );
+    }
+}
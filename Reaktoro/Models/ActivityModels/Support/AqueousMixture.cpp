@@ -22,6 +22,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Singletons/DissociationReactions.hpp>
 #include <Reaktoro/Water/WaterElectroProps.hpp>
 #include <Reaktoro/Water/WaterElectroPropsJohnsonNorton.hpp>
@@ -236,6 +237,32 @@ struct AqueousMixture::Impl
         state.Is = stoichiometricIonicStrength(state.ms);
         return state;
     }
+
+    /// Update the state of the aqueous mixture in place.
+    auto update(AqueousMixtureState& state, real const& T, real const& P, ArrayXrConstRef x) const -> void
+    {
+        const auto reusable = state.m.size() == x.size() && Memoization::isEnabled() && sameValueAndSeed(state.T, T) && sameValueAndSeed(state.P, P);
+
+        if(!reusable)
+        {
+            state.T = T;
+            state.P = P;
+            state.rho = rho(T, P);
+            state.epsilon = epsilon(T, P);
+        }
+
+        const auto xw = x[idx_water];
+        const auto Mw = water.molarMass();
+        state.m.resize(x.size());
+        if(xw == 0.0) state.m.fill(0.0);
+        else state.m = x/(Mw * xw);
+
+        state.ms.resize(idx_charged_species.size());
+        state.ms.matrix() = state.m(idx_charged_species).matrix() + dissociation_matrix.transpose() * state.m(idx_neutral_species).matrix();
+
+        state.Ie = effectiveIonicStrength(state.m);
+        state.Is = stoichiometricIonicStrength(state.ms);
+    }
 };
 
 AqueousMixture::AqueousMixture()
@@ -342,6 +369,11 @@ auto AqueousMixture::state(real T, real P, ArrayXrConstRef x) const -> AqueousMi
     return pimpl->state(T, P, x);
 }
 
+auto AqueousMixture::update(AqueousMixtureState& state, real const& T, real const& P, ArrayXrConstRef x) const -> void
+{
+    pimpl->update(state, T, P, x);
+}
+
 auto AqueousMixture::setDefaultWaterDensityFn(Fn<real(real,real)> rho) -> void
 {
     detail::default_water_density_fn = std::move(rho);
@@ -362,4 +394,26 @@ auto AqueousMixture::resetDefaultWaterDielectricConstantFn() -> void
     detail::default_water_dielectric_constant_fn = detail::defaultWaterDielectricConstantFn();
 }
 
+namespace {
+
+/// Assign a shared pointer to an entry in the extra data of activity props only if the entry does not hold it already.
+template<typename T>
+auto exportSharedPtr(Map<String, Any>& extra, String const& key, SharedPtr<T> const& ptr) -> void
+{
+    auto& entry = extra[key];
+    auto const* current = std::any_cast<SharedPtr<T>>(&entry);
+    if(current == nullptr || *current != ptr)
+        entry = ptr;
+}
+
+} // namespace
+
+auto exportAqueousMixture(Map<String, Any>& extra, SharedPtr<AqueousMixture> const& mixture, SharedPtr<AqueousMixtureState> const& state) -> void
+{
+    static const String mixturekey = "AqueousMixture";
+    static const String statekey = "AqueousMixtureState";
+    exportSharedPtr(extra, statekey, state);
+    exportSharedPtr(extra, mixturekey, mixture);
+}
+
 } // namespace Reaktoro
@@ -133,6 +133,16 @@ public:
     /// @param x The mole fractions of the species in the mixture
     auto state(real T, real P, ArrayXrConstRef x) const -> AqueousMixtureState;
 
+    /// Update the state of the aqueous mixture in place.
+    /// The arrays in `state` are reused across calls, and the density and
+    /// dielectric constant of water are evaluated again only if temperature
+    /// or pressure (value or derivative seed) differ from those in `state`.
+    /// @param[in,out] state The state of the aqueous mixture
+    /// @param T The temperature (in K)
+    /// @param P The pressure (in Pa)
+    /// @param x The mole fractions of the species in the mixture
+    auto update(AqueousMixtureState& state, real const& T, real const& P, ArrayXrConstRef x) const -> void;
+
     /// Set the default function for water density calculation when creating AqueousMixture objects.
     static auto setDefaultWaterDensityFn(Fn<real(real,real)> rho) -> void;
 
@@ -155,4 +165,12 @@ private:
     SharedPtr<Impl> pimpl;
 };
 
+/// Export an aqueous mixture and its state via the extra data of the activity properties of an aqueous phase.
+/// This is used by the aqueous activity models that evaluate the state of the
+/// aqueous mixture so that the models chained after them (e.g., Drummond,
+/// Setschenow, Rumpf) reuse it instead of computing it again. The entries
+/// `"AqueousMixture"` and `"AqueousMixtureState"` in `extra` are assigned
+/// only if they do not refer already to the given objects.
+auto exportAqueousMixture(Map<String, Any>& extra, SharedPtr<AqueousMixture> const& mixture, SharedPtr<AqueousMixtureState> const& state) -> void;
+
 } // namespace Reaktoro
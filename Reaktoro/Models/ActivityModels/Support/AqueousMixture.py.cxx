@@ -59,6 +59,7 @@ void exportAqueousMixture(py::module& m)
         .def("state", [](AqueousMixture& self, real T, real P, ArrayXrConstRef x) { return self.state(T, P, x); }, "Calculate the state of the aqueous mixture.")
         .def("state", [](AqueousMixture& self, real T, real P, py::array_t<double> const& x) { return self.state(T, P, ArrayXr(ArrayXd::Map(x.data(), x.size()))); }, "Calculate the state of the aqueous mixture.")
         .def("state", &AqueousMixture::state, "Calculate the state of the aqueous mixture.")
+        .def("update", &AqueousMixture::update, "Update the state of the aqueous mixture in place.")
         .def_static("setDefaultWaterDensityFn", AqueousMixture::setDefaultWaterDensityFn, "Set the default function for water density calculation when creating AqueousMixture objects.")
         .def_static("setDefaultWaterDielectricConstantFn", AqueousMixture::setDefaultWaterDielectricConstantFn, "Set the default function for water dielectric constant calculation when creating AqueousMixture objects.")
         .def_static("resetDefaultWaterDensityFn", [](){ AqueousMixture::resetDefaultWaterDensityFn(); }, "Reset the default function for water density calculation when creating AqueousMixture objects.")
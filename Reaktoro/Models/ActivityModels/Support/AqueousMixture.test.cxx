@@ -19,6 +19,10 @@
 #include <catch2/catch.hpp>
 
 // Reaktoro includes
+#include <Reaktoro/Core/ActivityModel.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelDrummond.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelHKF.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelSetschenow.hpp>
 #include <Reaktoro/Models/ActivityModels/Support/AqueousMixture.hpp>
 #include <Reaktoro/Singletons/DissociationReactions.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
@@ -126,6 +130,59 @@ TEST_CASE("Testing AqueousMixture class", "[AqueousMixture]")
         CHECK( state.m.isApprox(m)   );
         CHECK( state.ms.isApprox(ms) );
 
+        WHEN("When the state of the aqueous mixture is updated in place")
+        {
+            AqueousMixtureState other;
+
+            mixture.update(other, T, P, x);
+
+            CHECK( other.T       == T                     );
+            CHECK( other.P       == P                     );
+            CHECK( other.Ie      == Approx(state.Ie)      );
+            CHECK( other.Is      == Approx(state.Is)      );
+            CHECK( other.rho     == Approx(state.rho)     );
+            CHECK( other.epsilon == Approx(state.epsilon) );
+
+            CHECK( other.m.isApprox(state.m)   );
+            CHECK( other.ms.isApprox(state.ms) );
+
+            const auto mdata = other.m.data();
+
+            const ArrayXr y = moleFractions(species.size());
+
+            mixture.update(other, T, P, y);
+
+            CHECK( other.m.data() == mdata ); // the arrays in the state are reused
+            CHECK( other.m.isApprox(mixture.state(T, P, y).m) );
+            CHECK( other.Ie == Approx(mixture.state(T, P, y).Ie) );
+
+            real Tseeded = T;
+            Tseeded[1] = 1.0; // seed T at the same value so that water density and dielectric constant are computed again with their derivatives
+
+            mixture.update(other, Tseeded, P, y);
+
+            CHECK( other.T[1] == 1.0 ); // the state is not reused, since the seed of T has changed
+        }
+
+        WHEN("When the aqueous mixture and its state are exported")
+        {
+            auto mixtureptr = std::make_shared<AqueousMixture>(mixture);
+            auto stateptr = std::make_shared<AqueousMixtureState>(state);
+
+            Map<String, Any> extra;
+
+            exportAqueousMixture(extra, mixtureptr, stateptr);
+
+            CHECK( std::any_cast<SharedPtr<AqueousMixture> const&>(extra["AqueousMixture"]) == mixtureptr );
+            CHECK( std::any_cast<SharedPtr<AqueousMixtureState> const&>(extra["AqueousMixtureState"]) == stateptr );
+
+            const auto* entry = &std::any_cast<SharedPtr<AqueousMixtureState> const&>(extra["AqueousMixtureState"]);
+
+            exportAqueousMixture(extra, mixtureptr, stateptr);
+
+            CHECK( &std::any_cast<SharedPtr<AqueousMixtureState> const&>(extra["AqueousMixtureState"]) == entry ); // the entry is not assigned again
+        }
+
         WHEN("When default density and dielectric constant functions are changed")
         {
             SpeciesList species("H2O H+ OH- Na+ Cl- Ca++ Mg++ HCO3- CO3-- K+ CO2 HCl NaCl NaOH CaCl2 MgCl2 CaCO3 MgCO3");
@@ -164,3 +221,31 @@ TEST_CASE("Testing AqueousMixture class", "[AqueousMixture]")
         }
     }
 }
+
+TEST_CASE("Benchmarking chained aqueous activity models", "[.benchmark]")
+{
+    SpeciesList species("H2O H+ OH- Na+ Cl- Ca++ Mg++ HCO3- CO3-- K+ CO2 HCl NaCl NaOH CaCl2 MgCl2 CaCO3 MgCO3");
+
+    const auto T = 345.67;
+    const auto P = 123.4e+5;
+    ArrayXr x = ArrayXr::Constant(species.size(), 0.1);
+    x[species.index("H2O")] = 55.508;
+    x /= x.sum();
+
+    ActivityModel hkf = ActivityModelHKF()(species);
+    ActivityModel chained = chain(ActivityModelHKF(), ActivityModelDrummond("CO2"), ActivityModelSetschenow("NaCl", 0.1))(species);
+
+    ActivityProps props = ActivityProps::create(species.size());
+
+    BENCHMARK("HKF")
+    {
+        hkf(props, {T, P, x});
+        return props.ln_g[0];
+    };
+
+    BENCHMARK("HKF + Drummond(CO2) + Setschenow(NaCl)")
+    {
+        chained(props, {T, P, x});
+        return props.ln_g[0];
+    };
+}
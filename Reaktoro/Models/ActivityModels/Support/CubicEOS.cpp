@@ -24,6 +24,7 @@
 #include <Reaktoro/Common/Algorithms.hpp>
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
 #include <Reaktoro/Math/Roots.hpp>
 
@@ -359,6 +360,15 @@ struct Equation::Impl
     ArrayXr abarT;
     ArrayXr bbar;
     Bip bip;
+    MatrixXr aij;
+    MatrixXr aijT;
+    MatrixXr aijTT;
+
+    /// The temperature at which the pure-component and binary interaction quantities above were last computed (in K).
+    real Tparams;
+
+    /// The flag indicating whether the pure-component and binary interaction quantities have been computed at least once.
+    bool paramsupdated = false;
 
     /// Construct an Equation::Impl object.
     Impl(EquationSpecs const& eqspecs)
@@ -384,22 +394,29 @@ struct Equation::Impl
         bip.k   = zeros(nspecies, nspecies);
         bip.kT  = zeros(nspecies, nspecies);
         bip.kTT = zeros(nspecies, nspecies);
+        aij     = zeros(nspecies, nspecies);
+        aijT    = zeros(nspecies, nspecies);
+        aijTT   = zeros(nspecies, nspecies);
+
+        for(auto i = 0; i < nspecies; ++i)
+            bbar[i] = b[i] = eqspecs.eqmodel.Omega*R*Tcr[i]/Pcr[i]; // Eq. (3.44), see also Eq. (13.95) and unnumbered equation before Eq. (13.99)
     }
 
-    auto compute(Props& props, real const& T, real const& P, ArrayXrConstRef const& x) -> void
+    /// Update the pure-component parameters \eq{a_i}, the binary interaction parameters \eq{k_{ij}} and the parameters \eq{a_{ij}} at given temperature.
+    /// These quantities do not depend on pressure and composition, and so they
+    /// are computed again only if temperature (value or derivative seed) has changed since last call
+    /// (e.g., not during the successive evaluations needed to assemble a
+    /// Jacobian matrix with respect to species amounts).
+    auto updateParams(real const& T) -> void
     {
-        // Check if the mole fractions are zero or non-initialized
-        if(x.size() == 0 || x.maxCoeff() <= 0.0)
+        if(paramsupdated && Memoization::isEnabled() && sameValueAndSeed(Tparams, T))
             return;
 
         // Auxiliary references
-        auto const& sigma   = eqspecs.eqmodel.sigma;
-        auto const& epsilon = eqspecs.eqmodel.epsilon;
-        auto const& Omega   = eqspecs.eqmodel.Omega;
         auto const& Psi     = eqspecs.eqmodel.Psi;
         auto const& alphafn = eqspecs.eqmodel.alphafn;
 
-        // Calculate the parameters `a` and `b` of the cubic equation of state for each species
+        // Calculate the parameters `a` of the cubic equation of state for each species
         for(auto k = 0; k < nspecies; ++k)
         {
             const auto factor = Psi*R*R*(Tcr[k]*Tcr[k])/Pcr[k]; // factor in Eq. (3.45) multiplying alpha
@@ -412,19 +429,13 @@ struct Equation::Impl
             a[k]       = factor*alphak; // see Eq. (3.45)
             aT[k]      = factor*alphaTk;
             aTT[k]     = factor*alphaTTk;
-            b[k]       = Omega*R*Tcr[k]/Pcr[k]; // Eq. (3.44)
         }
 
         // Calculate the binary interaction parameters and its temperature derivatives
         if(eqspecs.bipmodel.initialized())
             eqspecs.bipmodel(bip, { substances, T, Tcr, Pcr, omega, a, aT, aTT, alpha, alphaT, alphaTT, b });
 
-        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
-        real amix = {};
-        real amixT = {};
-        real amixTT = {};
-        abar.fill(0.0);
-        abarT.fill(0.0);
+        // Calculate the parameters `aij` and their temperature derivatives
         for(auto i = 0; i < nspecies; ++i)
         {
             for(auto j = 0; j < nspecies; ++j)
@@ -437,16 +448,45 @@ struct Equation::Impl
                 auto const sT  = 0.5*s/(a[i]*a[j]) * (aT[i]*a[j] + a[i]*aT[j]);
                 auto const sTT = 0.5*s/(a[i]*a[j]) * (aTT[i]*a[j] + 2*aT[i]*aT[j] + a[i]*aTT[j]) - sT*sT/s;
 
-                auto const aij   = r*s;
-                auto const aijT  = rT*s + r*sT;
-                auto const aijTT = rTT*s + 2.0*rT*sT + r*sTT;
+                aij(i, j)   = r*s;
+                aijT(i, j)  = rT*s + r*sT;
+                aijTT(i, j) = rTT*s + 2.0*rT*sT + r*sTT;
+            }
+        }
 
-                amix   += x[i] * x[j] * aij; // Eq. (13.92) of Smith et al. (2017)
-                amixT  += x[i] * x[j] * aijT;
-                amixTT += x[i] * x[j] * aijTT;
+        Tparams = T;
+        paramsupdated = true;
+    }
 
-                abar[i]  += 2 * x[j] * aij;  // see Eq. (13.94)
-                abarT[i] += 2 * x[j] * aijT;
+    auto compute(Props& props, real const& T, real const& P, ArrayXrConstRef const& x) -> void
+    {
+        // Check if the mole fractions are zero or non-initialized
+        if(x.size() == 0 || x.maxCoeff() <= 0.0)
+            return;
+
+        // Auxiliary references
+        auto const& sigma   = eqspecs.eqmodel.sigma;
+        auto const& epsilon = eqspecs.eqmodel.epsilon;
+
+        // Update the parameters `a`, `aij` and the binary interaction parameters if temperature has changed
+        updateParams(T);
+
+        // Calculate the parameter `amix` of the phase and the partial molar parameters `abar` of each species
+        real amix = {};
+        real amixT = {};
+        real amixTT = {};
+        abar.fill(0.0);
+        abarT.fill(0.0);
+        for(auto i = 0; i < nspecies; ++i)
+        {
+            for(auto j = 0; j < nspecies; ++j)
+            {
+                amix   += x[i] * x[j] * aij(i, j); // Eq. (13.92) of Smith et al. (2017)
+                amixT  += x[i] * x[j] * aijT(i, j);
+                amixTT += x[i] * x[j] * aijTT(i, j);
+
+                abar[i]  += 2 * x[j] * aij(i, j);  // see Eq. (13.94)
+                abarT[i] += 2 * x[j] * aijT(i, j);
             }
         }
 
@@ -457,15 +497,12 @@ struct Equation::Impl
             abarT[i] -= amixT;
         }
 
-        // Calculate the parameters bba[i] and bmix of the cubic equation of state
+        // Calculate the parameter bmix of the cubic equation of state
         //     bbar[i] = Omega*R*Tc[i]/Pc[i] as shown in Eq. (3.44)
         //     bmix = sum(x[i] * bbar[i])
         real bmix = {};
         for(auto i = 0; i < nspecies; ++i)
-        {
-            bbar[i] = Omega*R*Tcr[i]/Pcr[i]; // see Eq. (13.95) and unnumbered equation before Eq. (13.99)
             bmix += x[i] * bbar[i];  // Eq. (13.91) of Smith et al. (2017)
-        }
 
         // Calculate the temperature and pressure derivatives of bmix
         const auto bmixT = 0.0; // no temperature dependence!
@@ -585,6 +622,7 @@ struct Equation::Impl
             props.Vi[k] = R * T * Zk / P;
             props.ln_phi[k] = Zk - (Zk - betak)/(Z - beta) - log(Z - beta) + q*I - qk*I - q*Ik;
         }
+
     }
 };
 
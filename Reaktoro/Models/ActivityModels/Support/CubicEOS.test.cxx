@@ -89,6 +89,34 @@ TEST_CASE("Testing CubicEOS::Equation class", "[CubicEOS]")
 
             CHECK( props.som == StateOfMatter::Supercritical );
         }
+
+        WHEN("Temperature changes between evaluations")
+        {
+            const auto P = 100.0 * 1e5; // 100 bar
+
+            equation.compute(props, 60.0 + 273.15, P, x);
+            const ArrayXr ln_phi_60C = props.ln_phi;
+
+            equation.compute(props, 10.0 + 273.15, P, x);
+            const ArrayXr ln_phi_10C = props.ln_phi;
+
+            equation.compute(props, 60.0 + 273.15, P, x);
+            CHECK( props.ln_phi.isApprox(ln_phi_60C) );
+
+            equation.compute(props, 10.0 + 273.15, P, x);
+            CHECK( props.ln_phi.isApprox(ln_phi_10C) );
+
+            real T = 10.0 + 273.15;
+            T[1] = 1.0; // seed T at the same value so that the temperature-dependent parameters are recomputed with their derivatives
+
+            equation.compute(props, T, P, x);
+            const ArrayXd ln_phi_T = grad(props.ln_phi);
+
+            CubicEOS::Equation fresh(eqspecs);
+            fresh.compute(props, T, P, x);
+            CHECK( ln_phi_T.isApprox(grad(props.ln_phi)) );
+            CHECK( ln_phi_T.matrix().norm() > 0.0 );
+        }
     }
 
     //=============================================
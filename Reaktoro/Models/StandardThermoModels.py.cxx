@@ -38,6 +38,8 @@ void exportReactionStandardThermoModelFromData(py::module& m);
 
 void exportStandardVolumeModelConstant(py::module& m);
 
+void exportStandardThermoPropsInterpolator(py::module& m);
+
 void exportStandardThermoModels(py::module& m)
 {
     exportStandardThermoModelConstant(m);
@@ -59,4 +61,6 @@ void exportStandardThermoModels(py::module& m)
     exportReactionStandardThermoModelFromData(m);
 
     exportStandardVolumeModelConstant(m);
+
+    exportStandardThermoPropsInterpolator(m);
 }
@@ -23,13 +23,11 @@ using std::log;
 
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
-#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Models/StandardThermoModels/Support/SpeciesElectroProps.hpp>
 #include <Reaktoro/Models/StandardThermoModels/Support/SpeciesElectroPropsHKF.hpp>
 #include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
 #include <Reaktoro/Water/WaterElectroProps.hpp>
 #include <Reaktoro/Water/WaterElectroPropsJohnsonNorton.hpp>
-#include <Reaktoro/Water/WaterInterpolation.hpp>
 #include <Reaktoro/Water/WaterThermoProps.hpp>
 #include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
 
@@ -54,83 +52,107 @@ const auto theta = 228.0;
 /// The constant characteristics @eq{\Psi} of the solvent (in units of Pa)
 const auto psi = 2600.0e+05;
 
-/// Return a memoized function that computes thermodynamic properties of water using Wagner & Pruss (1999) model.
-auto createMemoizedWaterElectroPropsFnJohnsonNorton()
+} // namespace
+
+auto memoizedWaterElectroPropsJohnsonNortonFn() -> WaterElectroPropsMemoizedFn&
 {
-    Fn<WaterElectroProps(const real&, const real&)> fn = [](const real& T, const real& P)
+    static thread_local WaterElectroPropsMemoizedFn fn([](const real& T, const real& P)
     {
         const auto wtp = waterThermoPropsWagnerPrussMemoized(T, P, StateOfMatter::Liquid);
         return Reaktoro::waterElectroPropsJohnsonNorton(T, P, wtp);
-    };
-    return memoizeLast(fn);
+    });
+    return fn;
 }
 
-/// Return the computed electrostatic properties of water at @p T and @p P using Johnson and Norton (1991) model.
-auto memoizedWaterElectroPropsJohnsonNorton(const real& T, const real& P) -> WaterElectroProps
+auto StandardThermoModelContextHKF::compute(const real& T, const real& P) -> StandardThermoModelContextHKF
 {
-    static thread_local auto fn = createMemoizedWaterElectroPropsFnJohnsonNorton();
-    return fn(T, P);
+    StandardThermoModelContextHKF ctx;
+    ctx.T = T;
+    ctx.P = P;
+    ctx.wtp = waterThermoPropsWagnerPrussMemoized(T, P, StateOfMatter::Liquid);
+    ctx.wep = memoizedWaterElectroPropsJohnsonNortonFn()(T, P);
+    ctx.gstate = gHKF::compute(T, P, ctx.wtp);
+    return ctx;
 }
 
-} // namespace
+auto standardThermoModelContextHKF(const real& T, const real& P) -> const StandardThermoModelContextHKF&
+{
+    static thread_local StandardThermoModelContextHKF ctx;
+    static thread_local auto firsttime = true;
 
-auto StandardThermoModelHKF(const StandardThermoModelParamsHKF& params) -> StandardThermoModel
+    const auto cached = !firsttime && Memoization::isEnabled() && sameValueAndSeed(ctx.T, T) && sameValueAndSeed(ctx.P, P);
+
+    if(!cached)
+    {
+        ctx = StandardThermoModelContextHKF::compute(T, P);
+        firsttime = false;
+    }
+
+    return ctx;
+}
+
+namespace detail {
+
+auto computeStandardThermoPropsHKF(StandardThermoProps& props, const real& T, const real& P, const StandardThermoModelParamsHKF& params, const WaterElectroProps& wep, const gHKF& gstate) -> void
 {
-    waterThermoPropsWagnerPrussInterpData(StateOfMatter::Liquid); // this call exists to force an initialization operation so that when waterThermoPropsWagnerPrussInterp is called for the first time, this initialization has been performed already.
+    auto& [G0, H0, V0, Cp0, VT0, VP0] = props;
+    const auto& [Gf, Hf, Sr, a1, a2, a3, a4, c1, c2, wr, charge, Tmax] = params;
+
+    const auto aep = speciesElectroPropsHKF(gstate, params);
+
+    const auto& w   = aep.w;
+    const auto& wT  = aep.wT;
+    const auto& wP  = aep.wP;
+    const auto& wTP = aep.wTP;
+    const auto& wTT = aep.wTT;
+    const auto& wPP = aep.wPP;
+    const auto& Z   = wep.bornZ;
+    const auto& Y   = wep.bornY;
+    const auto& Q   = wep.bornQ;
+    const auto& U   = wep.bornU;
+    const auto& N   = wep.bornN;
+    const auto& X   = wep.bornX;
+    const auto Tth  = T - theta;
+    const auto Tth2 = Tth*Tth;
+    const auto Tth3 = Tth*Tth2;
+
+    V0 = a1 + a2/(psi + P) + (a3 + a4/(psi + P))/(T - theta) - w*Q - (Z + 1)*wP;
+
+    VT0 = -(a3 + a4/(psi + P))/((T - theta)*(T - theta)) - wT*Q - w*U - Y*wP - (Z + 1)*wTP;
+
+    VP0 = -a2/((psi + P)*(psi + P)) + (-a4/((psi + P)*(psi + P)))/(T - theta) - wP*Q - w*N - Q*wP - (Z + 1)*wPP;
+
+    G0 = Gf - Sr*(T - Tr) - c1*(T*log(T/Tr) - T + Tr)
+        + a1*(P - Pr) + a2*log((psi + P)/(psi + Pr))
+        - c2*((1.0/(T - theta) - 1.0/(Tr - theta))*(theta - T)/theta
+        - T/(theta*theta)*log(Tr/T * (T - theta)/(Tr - theta)))
+        + 1.0/(T - theta)*(a3*(P - Pr) + a4*log((psi + P)/(psi + Pr)))
+        - w*(Z + 1) + wr*(Zr + 1) + wr*Yr*(T - Tr);
+
+    H0 = Hf + c1*(T - Tr) - c2*(1.0/(T - theta) - 1.0/(Tr - theta))
+        + a1*(P - Pr) + a2*log((psi + P)/(psi + Pr))
+        + (2.0*T - theta)/Tth2*(a3*(P - Pr)
+        + a4*log((psi + P)/(psi + Pr)))
+        - w*(Z + 1) + w*T*Y + T*(Z + 1)*wT + wr*(Zr + 1) - wr*Tr*Yr;
+
+    Cp0 = c1 + c2/Tth2 - 2.0*T/Tth3*(a3*(P - Pr) + a4*log((psi + P)/(psi + Pr))) + w*T*X + 2.0*T*Y*wT + T*(Z + 1.0)*wTT;
+
+    // S0 = Sr + c1*log(T/Tr)
+    //     - c2/theta*(1.0/(T - theta)
+    //     - 1.0/(Tr - theta) + log(Tr/T * (T - theta)/(Tr - theta))/theta)
+    //     + 1.0/Tth2*(a3*(P - Pr)
+    //     + a4*log((psi + P)/(psi + Pr)))
+    //     + w*Y + (Z + 1)*wT - wr*Yr;
+}
+
+} // namespace detail
 
+auto StandardThermoModelHKF(const StandardThermoModelParamsHKF& params) -> StandardThermoModel
+{
     auto evalfn = [=](StandardThermoProps& props, real T, real P)
     {
-        auto& [G0, H0, V0, Cp0, VT0, VP0] = props;
-        const auto& [Gf, Hf, Sr, a1, a2, a3, a4, c1, c2, wr, charge, Tmax] = params;
-
-        const auto wtp = waterThermoPropsWagnerPrussMemoized(T, P, StateOfMatter::Liquid);
-        const auto wep = memoizedWaterElectroPropsJohnsonNorton(T, P);
-        const auto gstate = gHKF::compute(T, P, wtp);
-        const auto aep = speciesElectroPropsHKF(gstate, params);
-
-        const auto& w   = aep.w;
-        const auto& wT  = aep.wT;
-        const auto& wP  = aep.wP;
-        const auto& wTP = aep.wTP;
-        const auto& wTT = aep.wTT;
-        const auto& wPP = aep.wPP;
-        const auto& Z   = wep.bornZ;
-        const auto& Y   = wep.bornY;
-        const auto& Q   = wep.bornQ;
-        const auto& U   = wep.bornU;
-        const auto& N   = wep.bornN;
-        const auto& X   = wep.bornX;
-        const auto Tth  = T - theta;
-        const auto Tth2 = Tth*Tth;
-        const auto Tth3 = Tth*Tth2;
-
-        V0 = a1 + a2/(psi + P) + (a3 + a4/(psi + P))/(T - theta) - w*Q - (Z + 1)*wP;
-
-        VT0 = -(a3 + a4/(psi + P))/((T - theta)*(T - theta)) - wT*Q - w*U - Y*wP - (Z + 1)*wTP;
-
-        VP0 = -a2/((psi + P)*(psi + P)) + (-a4/((psi + P)*(psi + P)))/(T - theta) - wP*Q - w*N - Q*wP - (Z + 1)*wPP;
-
-        G0 = Gf - Sr*(T - Tr) - c1*(T*log(T/Tr) - T + Tr)
-            + a1*(P - Pr) + a2*log((psi + P)/(psi + Pr))
-            - c2*((1.0/(T - theta) - 1.0/(Tr - theta))*(theta - T)/theta
-            - T/(theta*theta)*log(Tr/T * (T - theta)/(Tr - theta)))
-            + 1.0/(T - theta)*(a3*(P - Pr) + a4*log((psi + P)/(psi + Pr)))
-            - w*(Z + 1) + wr*(Zr + 1) + wr*Yr*(T - Tr);
-
-        H0 = Hf + c1*(T - Tr) - c2*(1.0/(T - theta) - 1.0/(Tr - theta))
-            + a1*(P - Pr) + a2*log((psi + P)/(psi + Pr))
-            + (2.0*T - theta)/Tth2*(a3*(P - Pr)
-            + a4*log((psi + P)/(psi + Pr)))
-            - w*(Z + 1) + w*T*Y + T*(Z + 1)*wT + wr*(Zr + 1) - wr*Tr*Yr;
-
-        Cp0 = c1 + c2/Tth2 - 2.0*T/Tth3*(a3*(P - Pr) + a4*log((psi + P)/(psi + Pr))) + w*T*X + 2.0*T*Y*wT + T*(Z + 1.0)*wTT;
-
-        // S0 = Sr + c1*log(T/Tr)
-        //     - c2/theta*(1.0/(T - theta)
-        //     - 1.0/(Tr - theta) + log(Tr/T * (T - theta)/(Tr - theta))/theta)
-        //     + 1.0/Tth2*(a3*(P - Pr)
-        //     + a4*log((psi + P)/(psi + Pr)))
-        //     + w*Y + (Z + 1)*wT - wr*Yr;
+        const auto& ctx = standardThermoModelContextHKF(T, P);
+        detail::computeStandardThermoPropsHKF(props, T, P, params, ctx.wep, ctx.gstate);
     };
 
     Data paramsdata;
@@ -18,7 +18,11 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Core/StandardThermoModel.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/SpeciesElectroPropsHKF.hpp>
+#include <Reaktoro/Water/WaterElectroProps.hpp>
+#include <Reaktoro/Water/WaterThermoProps.hpp>
 
 namespace Reaktoro {
 
@@ -62,7 +66,68 @@ struct StandardThermoModelParamsHKF
     real Tmax;
 };
 
+/// The quantities in the HKF model that depend only on temperature and pressure.
+/// These are the thermodynamic and electrostatic (Born function) properties of
+/// water and the *g* function state, which are identical for all aqueous
+/// solutes evaluated at the same temperature and pressure. They are thus
+/// computed once per temperature and pressure and shared among all solutes.
+struct StandardThermoModelContextHKF
+{
+    /// The temperature of the context (in K).
+    real T;
+
+    /// The pressure of the context (in Pa).
+    real P;
+
+    /// The thermodynamic properties of liquid water computed with the Wagner and Pruss (1995) equation of state.
+    WaterThermoProps wtp;
+
+    /// The electrostatic properties of water computed with the Johnson and Norton (1991) model.
+    WaterElectroProps wep;
+
+    /// The *g* function state of the HKF model.
+    gHKF gstate;
+
+    /// Compute the HKF context at given temperature and pressure.
+    static auto compute(const real& T, const real& P) -> StandardThermoModelContextHKF;
+};
+
+/// Return the HKF context at given temperature and pressure shared by all aqueous solutes (of the calling thread).
+/// The context is recomputed only when the temperature or pressure differs
+/// from the last call, in which case the memoized water functions are used
+/// (see @ref memoizedWaterElectroPropsJohnsonNortonFn). The returned reference
+/// remains valid until the next call to this function in the same thread.
+auto standardThermoModelContextHKF(const real& T, const real& P) -> const StandardThermoModelContextHKF&;
+
 /// Return a function that calculates thermodynamic properties of an aqueous solute using the HKF model.
 auto StandardThermoModelHKF(const StandardThermoModelParamsHKF& params) -> StandardThermoModel;
 
+/// The type of the memoized function used in the HKF model to calculate the electrostatic properties of water.
+using WaterElectroPropsMemoizedFn = MemoizedFn<WaterElectroProps(const real&, const real&)>;
+
+/// Return the memoized function used in the HKF model to calculate the electrostatic properties of water with the Johnson and Norton (1991) model (of the calling thread).
+/// By default, only its last invocation is cached. Use it to select the
+/// capacity of its cache and to inspect its cache hits and misses.
+auto memoizedWaterElectroPropsJohnsonNortonFn() -> WaterElectroPropsMemoizedFn&;
+
+//=================================================================================================
+// AUXILIARY METHODS
+//=================================================================================================
+
+namespace detail {
+
+/// Compute the standard thermodynamic properties of an aqueous solute with the HKF model.
+/// The electrostatic properties of water and the *g* function state depend
+/// only on temperature and pressure, so they can be computed once and shared
+/// among all aqueous solutes evaluated at the same conditions.
+/// @param props The standard thermodynamic properties of the aqueous solute to be computed
+/// @param T The temperature (in K)
+/// @param P The pressure (in Pa)
+/// @param params The parameters in the HKF model for the aqueous solute
+/// @param wep The electrostatic properties of water at @p T and @p P
+/// @param gstate The *g* function state at @p T and @p P
+auto computeStandardThermoPropsHKF(StandardThermoProps& props, const real& T, const real& P, const StandardThermoModelParamsHKF& params, const WaterElectroProps& wep, const gHKF& gstate) -> void;
+
+} // namespace detail
+
 } // namespace Reaktoro
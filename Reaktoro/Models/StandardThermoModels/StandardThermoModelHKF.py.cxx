@@ -41,4 +41,14 @@ void exportStandardThermoModelHKF(py::module& m)
         ;
 
     m.def("StandardThermoModelHKF", StandardThermoModelHKF);
+
+    py::class_<WaterElectroPropsMemoizedFn>(m, "WaterElectroPropsMemoizedFn")
+        .def("setCapacity", &WaterElectroPropsMemoizedFn::setCapacity, "Set the maximum number of calls cached (the current cache is discarded).")
+        .def("capacity", &WaterElectroPropsMemoizedFn::capacity, "Return the maximum number of calls cached.")
+        .def("stats", &WaterElectroPropsMemoizedFn::stats, return_internal_ref, "Return the counters of cache hits and misses.")
+        .def("resetStats", &WaterElectroPropsMemoizedFn::resetStats, "Reset the counters of cache hits and misses.")
+        .def("__call__", &WaterElectroPropsMemoizedFn::operator())
+        ;
+
+    m.def("memoizedWaterElectroPropsJohnsonNortonFn", memoizedWaterElectroPropsJohnsonNortonFn, py::return_value_policy::reference, "Return the memoized function used in the HKF model to calculate the electrostatic properties of water with the Johnson and Norton (1991) model (of the calling thread).");
 }
@@ -186,3 +186,95 @@ TEST_CASE("Testing StandardThermoModelHKF class", "[StandardThermoModelHKF]")
         CHECK( props.Cp0 == Approx(10.2122)      );
     }
 }
+
+TEST_CASE("Testing StandardThermoModelContextHKF", "[StandardThermoModelHKF]")
+{
+    const auto T = 75.0 + 273.15; // 75 degC (in K)
+    const auto P = 1000.0 * 1e5;  // 1kbar (in Pa)
+
+    const auto expected = StandardThermoModelContextHKF::compute(T, P);
+
+    const auto& ctx = standardThermoModelContextHKF(T, P);
+
+    CHECK( ctx.T == T );
+    CHECK( ctx.P == P );
+    CHECK( ctx.wtp.D == expected.wtp.D );
+    CHECK( ctx.wep.bornZ == expected.wep.bornZ );
+    CHECK( ctx.gstate.g == expected.gstate.g );
+
+    CHECK( &standardThermoModelContextHKF(T, P) == &ctx ); // the same shared context object is used
+
+    StandardThermoModelParamsHKF params;
+    params.Gf     = -453984.92;
+    params.Hf     = -465959.53;
+    params.Sr     = -138.072;
+    params.a1     = -3.4379928e-06;
+    params.a2     = -3597.8216;
+    params.a3     =  0.0003510376;
+    params.a4     = -99997.6;
+    params.c1     =  87.0272;
+    params.c2     = -246521.28;
+    params.wref   =  643164.48;
+    params.charge =  2.0;
+
+    const auto model1 = StandardThermoModelHKF(params);
+    params.charge = 1.0;
+    const auto model2 = StandardThermoModelHKF(params);
+
+    auto& wepfn = memoizedWaterElectroPropsJohnsonNortonFn();
+    wepfn.resetStats();
+
+    // Many aqueous solutes evaluated at the same temperature and pressure share the context computed above
+    for(auto i = 0; i < 5; ++i)
+    {
+        model1(T, P);
+        model2(T, P);
+    }
+
+    CHECK( wepfn.stats().hits == 0 );
+    CHECK( wepfn.stats().misses == 0 );
+
+    // A different temperature triggers a single computation of the context
+    model1(T + 10.0, P);
+    model2(T + 10.0, P);
+
+    CHECK( ctx.T == T + 10.0 );
+    CHECK( wepfn.stats().hits + wepfn.stats().misses == 1 );
+}
+
+TEST_CASE("Testing StandardThermoModelContextHKF with temperature derivatives", "[StandardThermoModelHKF]")
+{
+    StandardThermoModelParamsHKF params;
+    params.Gf     = -453984.92;
+    params.Hf     = -465959.53;
+    params.Sr     = -138.072;
+    params.a1     = -3.4379928e-06;
+    params.a2     = -3597.8216;
+    params.a3     =  0.0003510376;
+    params.a4     = -99997.6;
+    params.c1     =  87.0272;
+    params.c2     = -246521.28;
+    params.wref   =  643164.48;
+    params.charge =  2.0;
+
+    const auto model = StandardThermoModelHKF(params);
+
+    const real P = 1000.0 * 1e5; // 1kbar (in Pa)
+
+    real T = 75.0 + 273.15; // 75 degC (in K)
+
+    model(T, P); // the shared context is now computed without derivatives with respect to T
+
+    T[1] = 1.0; // seed T at the same value so that derivatives with respect to T are computed
+
+    const auto props = model(T, P);
+
+    Memoization::disable();
+    const auto expected = model(T, P);
+    Memoization::enable();
+
+    CHECK( props.G0[1] != 0.0 );
+    CHECK( props.G0[1] == Approx(expected.G0[1]) );
+    CHECK( props.V0[1] == Approx(expected.V0[1]) );
+    CHECK( standardThermoModelContextHKF(T, P).T[1] == 1.0 );
+}
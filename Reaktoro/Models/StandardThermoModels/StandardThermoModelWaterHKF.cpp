@@ -20,7 +20,6 @@
 // Reaktoro includes
 #include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
-#include <Reaktoro/Water/WaterInterpolation.hpp>
 #include <Reaktoro/Water/WaterThermoProps.hpp>
 #include <Reaktoro/Water/WaterThermoPropsUtils.hpp>
 
@@ -28,8 +27,6 @@ namespace Reaktoro {
 
 auto StandardThermoModelWaterHKF(const StandardThermoModelParamsWaterHKF& params) -> StandardThermoModel
 {
-    waterThermoPropsWagnerPrussInterpData(StateOfMatter::Liquid); // this call exists to force an initialization operation so that when waterThermoPropsWagnerPrussInterp is called for the first time, this initialization has been performed already.
-
     auto evalfn = [=](StandardThermoProps& props, real T, real P)
     {
         auto& [G0, H0, V0, Cp0, VT0, VP0] = props;
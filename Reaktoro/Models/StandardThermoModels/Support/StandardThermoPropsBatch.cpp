@@ -0,0 +1,465 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "StandardThermoPropsBatch.hpp"
+
+// Reaktoro includes
+#include <Reaktoro/Common/Algorithms.hpp>
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Core/SpeciesList.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelConstant.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHKF.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHollandPowell.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelMaierKelley.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelNasa.hpp>
+#include <Reaktoro/Serialization/Models/StandardThermoModels.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The reference temperature of 25 C (in K)
+const auto Tr = 298.15;
+
+/// The reference pressure of 1 bar (in Pa)
+const auto Pr = 1.0e5;
+
+/// Return the name of the standard thermodynamic model of a species if it consists of a single model, or an empty string otherwise.
+auto modelName(const Data& params) -> String
+{
+    if(!params.isDict() || params.asDict().size() != 1)
+        return {};
+    return params.asDict().front().first;
+}
+
+/// Return the parameters of the standard thermodynamic model of a species with a single model.
+auto modelParams(const Data& params) -> const Data&
+{
+    return params.asDict().front().second;
+}
+
+/// Assign `val + valT*Tgrad + valP*Pgrad` as the value and derivative of the entries of `out` with indices `idx`.
+auto scatter(ArrayXrRef out, const Indices& idx, const ArrayXd& val, const ArrayXd& valT, const ArrayXd& valP, double Tgrad, double Pgrad) -> void
+{
+    for(auto k = 0; k < idx.size(); ++k)
+    {
+        auto& y = out[idx[k]];
+        y = val[k];
+        y[1] = valT[k]*Tgrad + valP[k]*Pgrad;
+    }
+}
+
+/// Assign `val + valT*Tgrad` as the value and derivative of the entries of `out` with indices `idx`.
+auto scatter(ArrayXrRef out, const Indices& idx, const ArrayXd& val, const ArrayXd& valT, double Tgrad) -> void
+{
+    for(auto k = 0; k < idx.size(); ++k)
+    {
+        auto& y = out[idx[k]];
+        y = val[k];
+        y[1] = valT[k]*Tgrad;
+    }
+}
+
+/// Assign a constant value to the entries of `out` with indices `idx`.
+auto scatter(ArrayXrRef out, const Indices& idx, const ArrayXd& val) -> void
+{
+    for(auto k = 0; k < idx.size(); ++k)
+        out[idx[k]] = val[k];
+}
+
+/// Assign zero to the entries of `out` with indices `idx`.
+auto scatterZero(ArrayXrRef out, const Indices& idx) -> void
+{
+    for(auto k = 0; k < idx.size(); ++k)
+        out[idx[k]] = 0.0;
+}
+
+/// Assign the standard thermodynamic properties of a species to the entry `i` of the given arrays.
+auto assign(Index i, const StandardThermoProps& props, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) -> void
+{
+    G0[i]  = props.G0;
+    H0[i]  = props.H0;
+    V0[i]  = props.V0;
+    VT0[i] = props.VT0;
+    VP0[i] = props.VP0;
+    Cp0[i] = props.Cp0;
+}
+
+/// The group of species whose standard thermodynamic properties are constant.
+struct GroupConstant
+{
+    Indices idx;
+    Vec<StandardThermoProps> props;
+};
+
+/// The group of species with Maier-Kelley model (and Holland-Powell model with zero compressibility, in which case `d` is non-zero).
+struct GroupHeatCapacity
+{
+    Indices idx;
+    ArrayXd Gf, Hf, Sr, Vr, a, b, c, d;
+};
+
+/// The group of species with NASA polynomial model.
+struct GroupNasa
+{
+    Indices idx;
+    Vec<StandardThermoModelParamsNasa> params;
+};
+
+/// The group of aqueous solutes with HKF model.
+struct GroupHKF
+{
+    Indices idx;
+    Vec<StandardThermoModelParamsHKF> params;
+};
+
+/// The group of species evaluated with their own standard thermodynamic model functions.
+struct GroupOther
+{
+    Indices idx;
+    Vec<StandardThermoModel> models;
+};
+
+/// The group of species with formation reactions, together with the reactant species they depend on.
+/// The nodes of this dependency graph are stored in topological order, so
+/// that the reactants of a species always come before it and the standard
+/// thermodynamic properties of every node are computed exactly once.
+struct GroupFormation
+{
+    /// The species in the dependency graph in topological order.
+    Vec<Species> nodes;
+
+    /// The index of each node in the batch list of species (or `Index(-1)` if not in the list).
+    Indices idx;
+
+    /// The node indices of the reactants of each node (empty if the node has no formation reaction).
+    Vec<Indices> reactants;
+
+    /// The number of nodes with a formation reaction that are also in the batch list of species.
+    Index count = 0;
+
+    /// The workspace for the standard thermodynamic properties of the nodes in each evaluation.
+    mutable Vec<StandardThermoProps> props;
+
+    /// The workspace for the standard thermodynamic properties of the reactants of a node in each evaluation.
+    mutable Vec<StandardThermoProps> reactants_props;
+};
+
+/// Initialize the structure of arrays in a GroupHeatCapacity object with given rows of parameters.
+auto initGroupHeatCapacity(GroupHeatCapacity& group, const Vec<Array<double, 8>>& rows) -> void
+{
+    const auto m = rows.size();
+    for(auto* arr : { &group.Gf, &group.Hf, &group.Sr, &group.Vr, &group.a, &group.b, &group.c, &group.d })
+        arr->resize(m);
+    for(auto k = 0; k < m; ++k)
+    {
+        const auto& r = rows[k];
+        group.Gf[k] = r[0]; group.Hf[k] = r[1]; group.Sr[k] = r[2]; group.Vr[k] = r[3];
+        group.a[k]  = r[4]; group.b[k]  = r[5]; group.c[k]  = r[6]; group.d[k]  = r[7];
+    }
+}
+
+/// Return the address that identifies a Species object and its copies, which share the same underlying data.
+/// Names cannot be used for this, since the species in a chemical system may
+/// have been renamed to be unique, and a reactant species in a formation
+/// reaction may have the name of a different species in the batch list.
+auto identity(const Species& s) -> const void*
+{
+    return &s.standardThermoModel();
+}
+
+/// Initialize a GroupFormation object with the species in the batch list that have a formation reaction.
+auto initGroupFormation(GroupFormation& group, const SpeciesList& species, const Indices& iformation) -> void
+{
+    Map<const void*, Index> ilist; // the index in the batch list of each species
+    for(auto i = 0; i < species.size(); ++i)
+        ilist.emplace(identity(species[i]), i);
+
+    Map<const void*, Index> inode; // the node index of each species visited so far
+    Vec<const void*> visiting; // the species whose reactants are being visited (used to detect cyclic dependencies)
+
+    Fn<Index(const Species&)> addNode = [&](const Species& s) -> Index
+    {
+        const auto id = identity(s);
+
+        const auto it = inode.find(id);
+        if(it != inode.end())
+            return it->second;
+
+        errorif(contains(visiting, id), "Could not resolve the formation reactions of the species "
+            "because species ", s.name(), " depends on itself through its reactants.");
+
+        Indices ireactants;
+        if(s.reaction().initialized())
+        {
+            visiting.push_back(id);
+            for(const auto& [reactant, coeff] : s.reaction().reactants())
+                ireactants.push_back(addNode(reactant));
+            visiting.pop_back();
+        }
+
+        const auto jt = ilist.find(id);
+        const auto k = group.nodes.size();
+        group.nodes.push_back(s);
+        group.idx.push_back(jt != ilist.end() ? jt->second : Index(-1));
+        group.reactants.push_back(ireactants);
+        inode[id] = k;
+        return k;
+    };
+
+    for(auto i : iformation)
+        addNode(species[i]);
+
+    group.count = iformation.size();
+    group.props.resize(group.nodes.size());
+}
+
+/// Return the standard thermodynamic properties stored in the entry `i` of the given arrays.
+auto extract(Index i, ArrayXrConstRef G0, ArrayXrConstRef H0, ArrayXrConstRef V0, ArrayXrConstRef VT0, ArrayXrConstRef VP0, ArrayXrConstRef Cp0) -> StandardThermoProps
+{
+    StandardThermoProps props;
+    props.G0  = G0[i];
+    props.H0  = H0[i];
+    props.V0  = V0[i];
+    props.VT0 = VT0[i];
+    props.VP0 = VP0[i];
+    props.Cp0 = Cp0[i];
+    return props;
+}
+
+} // namespace
+
+struct StandardThermoPropsBatch::Impl
+{
+    /// The number of species in the batch.
+    Index size = 0;
+
+    /// The group of species with constant standard thermodynamic properties.
+    GroupConstant constant;
+
+    /// The group of species with Maier-Kelley or incompressible Holland-Powell models.
+    GroupHeatCapacity heatcapacity;
+
+    /// The group of species with NASA polynomial model.
+    GroupNasa nasa;
+
+    /// The group of aqueous solutes with HKF model.
+    GroupHKF hkf;
+
+    /// The group of species evaluated with their own standard thermodynamic model functions.
+    GroupOther other;
+
+    /// The group of species with formation reactions.
+    GroupFormation formation;
+
+    Impl()
+    {}
+
+    Impl(const SpeciesList& species)
+    : size(species.size())
+    {
+        Vec<Array<double, 8>> heatcapacity_rows;
+        Indices iformation;
+
+        for(auto i = 0; i < size; ++i)
+        {
+            if(species[i].reaction().initialized())
+            {
+                iformation.push_back(i);
+                continue;
+            }
+
+            const auto& model = species[i].standardThermoModel();
+            const auto& data = model.params();
+            const auto name = modelName(data);
+
+            if(name == "Constant")
+            {
+                const auto params = modelParams(data).as<StandardThermoModelParamsConstant>();
+                constant.idx.push_back(i);
+                constant.props.push_back({ params.G0, params.H0, params.V0, params.Cp0, params.VT0, params.VP0 });
+            }
+            else if(name == "MaierKelley")
+            {
+                const auto params = modelParams(data).as<StandardThermoModelParamsMaierKelley>();
+                heatcapacity.idx.push_back(i);
+                heatcapacity_rows.push_back({ params.Gf.val(), params.Hf.val(), params.Sr.val(), params.Vr.val(), params.a.val(), params.b.val(), params.c.val(), 0.0 });
+            }
+            else if(name == "HollandPowell" && modelParams(data).as<StandardThermoModelParamsHollandPowell>().kappa0 == 0.0)
+            {
+                const auto params = modelParams(data).as<StandardThermoModelParamsHollandPowell>();
+                heatcapacity.idx.push_back(i);
+                heatcapacity_rows.push_back({ params.Gf.val(), params.Hf.val(), params.Sr.val(), params.Vr.val(), params.a.val(), params.b.val(), params.c.val(), params.d.val() });
+            }
+            else if(name == "Nasa")
+            {
+                nasa.idx.push_back(i);
+                nasa.params.push_back(modelParams(data).as<StandardThermoModelParamsNasa>());
+            }
+            else if(name == "HKF")
+            {
+                hkf.idx.push_back(i);
+                hkf.params.push_back(modelParams(data).as<StandardThermoModelParamsHKF>());
+            }
+            else
+            {
+                other.idx.push_back(i);
+                other.models.push_back(model);
+            }
+        }
+
+        initGroupHeatCapacity(heatcapacity, heatcapacity_rows);
+        initGroupFormation(formation, species, iformation);
+    }
+
+    auto evalConstant(ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void
+    {
+        for(auto k = 0; k < constant.idx.size(); ++k)
+            assign(constant.idx[k], constant.props[k], G0, H0, V0, VT0, VP0, Cp0);
+    }
+
+    auto evalHeatCapacity(const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void
+    {
+        const auto& [idx, Gf, Hf, Sr, Vr, a, b, c, d] = heatcapacity;
+
+        if(idx.empty())
+            return;
+
+        const auto t = T.val();
+        const auto p = P.val();
+        const auto t2 = t*t;
+        const auto t05 = std::sqrt(t);
+        const auto Tr2 = Tr*Tr;
+        const auto Tr05 = std::sqrt(Tr);
+
+        // The Cp model below is `a + b*T + c/T² + d/√T`, in which `d` is zero for Maier-Kelley species
+        const ArrayXd Cp     = a + b*t + c/t2 + d/t05;
+        const ArrayXd CpT    = b - 2.0*c/(t2*t) - 0.5*d/(t*t05);
+        const ArrayXd CpdT   = a*(t - Tr) + 0.5*b*(t2 - Tr2) - c*(1.0/t - 1.0/Tr) + 2.0*d*(t05 - Tr05);
+        const ArrayXd CpdlnT = a*std::log(t/Tr) + b*(t - Tr) - 0.5*c*(1.0/t2 - 1.0/Tr2) - 2.0*d*(1.0/t05 - 1.0/Tr05);
+        const ArrayXd VdP    = Vr*(p - Pr);
+
+        const ArrayXd G  = Gf - Sr*(t - Tr) + CpdT - t*CpdlnT + VdP;
+        const ArrayXd GT = -Sr - CpdlnT; // from dG0/dT = -S0
+        const ArrayXd H  = Hf + CpdT + VdP;
+
+        scatter(G0, idx, G, GT, Vr, T[1], P[1]);
+        scatter(H0, idx, H, Cp, Vr, T[1], P[1]);
+        scatter(V0, idx, Vr);
+        scatter(Cp0, idx, Cp, CpT, T[1]);
+        scatterZero(VT0, idx);
+        scatterZero(VP0, idx);
+    }
+
+    auto evalNasa(const real& T, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void
+    {
+        for(auto k = 0; k < nasa.idx.size(); ++k)
+            assign(nasa.idx[k], detail::computeStandardThermoProps(nasa.params[k], T), G0, H0, V0, VT0, VP0, Cp0);
+    }
+
+    auto evalHKF(const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void
+    {
+        if(hkf.idx.empty())
+            return;
+
+        // The water, Born and g function quantities depend only on T and P and so are shared by all aqueous solutes
+        const auto& ctx = standardThermoModelContextHKF(T, P);
+
+        StandardThermoProps props;
+        for(auto k = 0; k < hkf.idx.size(); ++k)
+        {
+            detail::computeStandardThermoPropsHKF(props, T, P, hkf.params[k], ctx.wep, ctx.gstate);
+            assign(hkf.idx[k], props, G0, H0, V0, VT0, VP0, Cp0);
+        }
+    }
+
+    auto evalOther(const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void
+    {
+        for(auto k = 0; k < other.idx.size(); ++k)
+            assign(other.idx[k], other.models[k](T, P), G0, H0, V0, VT0, VP0, Cp0);
+    }
+
+    auto evalFormation(const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void
+    {
+        const auto& [nodes, idx, reactants, count, props, reactants_props] = formation;
+
+        if(nodes.empty())
+            return;
+
+        for(auto k = 0; k < nodes.size(); ++k)
+        {
+            if(reactants[k].empty())
+            {
+                // Reactants in the batch list have already been evaluated in their groups
+                props[k] = idx[k] != Index(-1) ?
+                    extract(idx[k], G0, H0, V0, VT0, VP0, Cp0) :
+                    nodes[k].standardThermoProps(T, P);
+            }
+            else
+            {
+                reactants_props.clear();
+                for(auto j : reactants[k])
+                    reactants_props.push_back(props[j]);
+                props[k] = nodes[k].reaction().standardThermoProps(T, P, reactants_props);
+                if(idx[k] != Index(-1))
+                    assign(idx[k], props[k], G0, H0, V0, VT0, VP0, Cp0);
+            }
+        }
+    }
+};
+
+StandardThermoPropsBatch::StandardThermoPropsBatch()
+: pimpl(new Impl())
+{}
+
+StandardThermoPropsBatch::StandardThermoPropsBatch(const SpeciesList& species)
+: pimpl(new Impl(species))
+{}
+
+auto StandardThermoPropsBatch::size() const -> Index
+{
+    return pimpl->size;
+}
+
+auto StandardThermoPropsBatch::numUngroupedSpecies() const -> Index
+{
+    return pimpl->other.idx.size();
+}
+
+auto StandardThermoPropsBatch::numFormationReactionSpecies() const -> Index
+{
+    return pimpl->formation.count;
+}
+
+auto StandardThermoPropsBatch::eval(const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void
+{
+    assert(G0.size() == size());
+    assert(H0.size() == size());
+    assert(V0.size() == size());
+    assert(VT0.size() == size());
+    assert(VP0.size() == size());
+    assert(Cp0.size() == size());
+
+    pimpl->evalConstant(G0, H0, V0, VT0, VP0, Cp0);
+    pimpl->evalHeatCapacity(T, P, G0, H0, V0, VT0, VP0, Cp0);
+    pimpl->evalNasa(T, G0, H0, V0, VT0, VP0, Cp0);
+    pimpl->evalHKF(T, P, G0, H0, V0, VT0, VP0, Cp0);
+    pimpl->evalOther(T, P, G0, H0, V0, VT0, VP0, Cp0);
+    pimpl->evalFormation(T, P, G0, H0, V0, VT0, VP0, Cp0); // must be last, since it uses the properties above of reactant species
+}
+
+} // namespace Reaktoro
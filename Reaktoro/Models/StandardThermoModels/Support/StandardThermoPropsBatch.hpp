@@ -0,0 +1,90 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class SpeciesList;
+
+/// Used to evaluate the standard thermodynamic properties of a list of species all at once.
+/// The species are grouped by the family of their standard thermodynamic
+/// models (Constant, MaierKelley, HollandPowell, Nasa, HKF), identified from
+/// the parameters attached to each model. The parameters of the Maier-Kelley
+/// and Holland-Powell (incompressible) groups are stored as structure of
+/// arrays and evaluated with vectorized kernels in `double`, in which the
+/// derivatives with respect to temperature and pressure are computed
+/// analytically and then combined with the derivative seeds of `T` and `P`.
+/// The aqueous solutes in the HKF group share the same water thermodynamic,
+/// electrostatic and *g* function properties, which are computed only once
+/// per evaluation. Species with a formation reaction are evaluated last, in
+/// topological order of their formation dependencies, so that the standard
+/// thermodynamic properties of each reactant (e.g., master species in PHREEQC
+/// databases) are computed only once per evaluation, even when it is not in
+/// the list. Species with any other model (e.g., chained models) are
+/// evaluated with their own model functions. A species is evaluated as a
+/// formation reaction species only if its formation reaction determines its
+/// standard thermodynamic model (see Species::withStandardThermoModel).
+/// Different from Species::standardThermoProps, the grouped species are
+/// evaluated without memoization of their model functions, which would
+/// require the per-species function calls, checks and copies that the
+/// vectorized evaluation avoids. Repeated evaluations at the same temperature
+/// and pressure are instead skipped by the callers (e.g., ChemicalProps).
+/// The evaluation uses workspace stored in the object, so, as with the
+/// memoized model functions of the species, the same object must not be
+/// evaluated by multiple threads at the same time.
+class StandardThermoPropsBatch
+{
+public:
+    /// Construct a default StandardThermoPropsBatch object.
+    StandardThermoPropsBatch();
+
+    /// Construct a StandardThermoPropsBatch object for given list of species.
+    explicit StandardThermoPropsBatch(const SpeciesList& species);
+
+    /// Return the number of species in the batch.
+    auto size() const -> Index;
+
+    /// Return the number of species evaluated with their own model functions instead of a vectorized group.
+    auto numUngroupedSpecies() const -> Index;
+
+    /// Return the number of species with a formation reaction.
+    auto numFormationReactionSpecies() const -> Index;
+
+    /// Evaluate the standard thermodynamic properties of all species directly into the given arrays.
+    /// @param T The temperature for the calculation (in K)
+    /// @param P The pressure for the calculation (in Pa)
+    /// @param[out] G0 The standard molar Gibbs energies of the species (in J/mol)
+    /// @param[out] H0 The standard molar enthalpies of the species (in J/mol)
+    /// @param[out] V0 The standard molar volumes of the species (in m³/mol)
+    /// @param[out] VT0 The temperature derivatives of the standard molar volumes of the species (in m³/(mol·K))
+    /// @param[out] VP0 The pressure derivatives of the standard molar volumes of the species (in m³/(mol·Pa))
+    /// @param[out] Cp0 The standard molar isobaric heat capacities of the species (in J/(mol·K))
+    auto eval(const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void;
+
+private:
+    struct Impl;
+
+    SharedPtr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
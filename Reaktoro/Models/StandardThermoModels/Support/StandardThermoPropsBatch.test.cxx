@@ -0,0 +1,239 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Memoization.hpp>
+#include <Reaktoro/Core/SpeciesList.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelConstant.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHKF.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelHollandPowell.hpp>
+#include <Reaktoro/Models/StandardThermoModels/StandardThermoModelMaierKelley.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsBatch.hpp>
+using namespace Reaktoro;
+
+namespace test {
+
+auto createSpeciesListForStandardThermoPropsBatch() -> SpeciesList
+{
+    StandardThermoModelParamsMaierKelley mk;
+    mk.Gf = -1129177.0;
+    mk.Hf = -1207339.0;
+    mk.Sr =  92.68;
+    mk.Vr =  3.6934e-05;
+    mk.a  =  104.5;
+    mk.b  =  0.02192;
+    mk.c  = -2594080.0;
+
+    StandardThermoModelParamsHollandPowell hp0; // incompressible
+    hp0.Gf = -856280.0;
+    hp0.Hf = -910700.0;
+    hp0.Sr =  41.43;
+    hp0.Vr =  2.269e-05;
+    hp0.a  =  92.9;
+    hp0.b  = -0.000642;
+    hp0.c  = -714900.0;
+    hp0.d  = -716.1;
+
+    StandardThermoModelParamsHollandPowell hp1 = hp0; // compressible
+    hp1.alpha0   =  0.0;
+    hp1.kappa0   =  73000000000.0;
+    hp1.kappa0p  =  6.0;
+    hp1.kappa0pp = -8.2e-11;
+    hp1.numatoms =  3.0;
+
+    StandardThermoModelParamsHKF hkf;
+    hkf.Gf     = -552790.0;
+    hkf.Hf     = -543083.0;
+    hkf.Sr     = -56.484;
+    hkf.a1     = -1.94342e-05;
+    hkf.a2     = -725.2;
+    hkf.a3     =  5.2966e-05;
+    hkf.a4     = -104.81e+03;
+    hkf.c1     =  37.656;
+    hkf.c2     = -100.754e+04;
+    hkf.wref   =  5.1313e+05;
+    hkf.charge =  2.0;
+
+    StandardThermoModelParamsConstant cst;
+    cst.G0  = -237181.0;
+    cst.H0  = -285837.0;
+    cst.V0  =  1.8068e-05;
+    cst.Cp0 =  75.35;
+
+    auto chained = chain(StandardThermoModelMaierKelley(mk), StandardThermoModelConstant(cst)); // a model that cannot be grouped
+
+    return SpeciesList({
+        Species("CaCO3").withName("Calcite").withStandardThermoModel(StandardThermoModelMaierKelley(mk)),
+        Species("SiO2").withName("QuartzA").withStandardThermoModel(StandardThermoModelHollandPowell(hp0)),
+        Species("SiO2").withName("QuartzB").withStandardThermoModel(StandardThermoModelHollandPowell(hp1)),
+        Species("Ca+2").withStandardThermoModel(StandardThermoModelHKF(hkf)),
+        Species("H2O").withStandardThermoModel(StandardThermoModelConstant(cst)),
+        Species("CaCO3").withName("Aragonite").withStandardThermoModel(chained),
+    });
+}
+
+} // namespace test
+
+TEST_CASE("Testing StandardThermoPropsBatch class", "[StandardThermoPropsBatch]")
+{
+    const auto species = test::createSpeciesListForStandardThermoPropsBatch();
+    const auto N = species.size();
+
+    StandardThermoPropsBatch batch(species);
+
+    CHECK( batch.size() == N );
+    CHECK( batch.numUngroupedSpecies() == 2 ); // QuartzB (compressible Holland-Powell) and Aragonite (chained model)
+
+    ArrayXr G0(N), H0(N), V0(N), VT0(N), VP0(N), Cp0(N);
+
+    const auto checkAgainstSpeciesModels = [&](const real& T, const real& P)
+    {
+        batch.eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+
+        for(auto i = 0; i < N; ++i)
+        {
+            INFO("species: " << species[i].name());
+            const auto expected = species[i].standardThermoProps(T, P);
+            CHECK( G0[i]  == Approx(expected.G0)  );
+            CHECK( H0[i]  == Approx(expected.H0)  );
+            CHECK( V0[i]  == Approx(expected.V0)  );
+            CHECK( VT0[i] == Approx(expected.VT0) );
+            CHECK( VP0[i] == Approx(expected.VP0) );
+            CHECK( Cp0[i] == Approx(expected.Cp0) );
+            CHECK( grad(G0[i])  == Approx(grad(expected.G0))  );
+            CHECK( grad(H0[i])  == Approx(grad(expected.H0))  );
+            CHECK( grad(V0[i])  == Approx(grad(expected.V0))  );
+            CHECK( grad(Cp0[i]) == Approx(grad(expected.Cp0)) );
+        }
+    };
+
+    real T = 60.0 + 273.15;
+    real P = 100.0 * 1e5;
+
+    SECTION("Checking values and temperature derivatives")
+    {
+        autodiff::seed(T);
+        checkAgainstSpeciesModels(T, P);
+    }
+
+    SECTION("Checking values and pressure derivatives")
+    {
+        autodiff::seed(P);
+        checkAgainstSpeciesModels(T, P);
+    }
+}
+
+TEST_CASE("Testing StandardThermoPropsBatch class with formation reactions", "[StandardThermoPropsBatch]")
+{
+    // FORMATION REACTIONS CONSIDERED IN THE TESTS BELOW (A and B have their own models)
+    //    A + 2B = C
+    //    B + 3C = D
+    //    C - 2D = E
+
+    auto counter = 0; // the number of evaluations of the standard thermodynamic model of A
+
+    StandardThermoModel modelA = [&](real T, real P)
+    {
+        counter += 1;
+        StandardThermoProps props;
+        props.G0 = -1000.0 * T;
+        props.H0 = -2000.0 * T;
+        props.V0 = 1.0e-9 * P;
+        props.Cp0 = 10.0 * T;
+        return props;
+    };
+
+    const auto A = Species().withName("A").withStandardThermoModel(modelA);
+    const auto B = Species().withName("B").withStandardGibbsEnergy(-100.0);
+
+    const auto C = Species().withName("C").withFormationReaction(
+        FormationReaction().withReactants({{A, 1}, {B, 2}}).withEquilibriumConstant(1.234));
+
+    const auto D = Species().withName("D").withFormationReaction(
+        FormationReaction().withReactants({{B, 1}, {C, 3}}).withEquilibriumConstant(2.345));
+
+    const auto E = Species().withName("E").withFormationReaction(
+        FormationReaction().withReactants({{C, 1}, {D, -2}}).withEquilibriumConstant(3.456));
+
+    const auto checkAgainstSpeciesModels = [&](const SpeciesList& species, const real& T, const real& P)
+    {
+        const auto N = species.size();
+
+        ArrayXr G0(N), H0(N), V0(N), VT0(N), VP0(N), Cp0(N);
+
+        StandardThermoPropsBatch batch(species);
+
+        Memoization::disable(); // disable memoization so that every evaluation of A counts
+
+        counter = 0;
+        batch.eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+
+        CHECK( counter == 1 ); // A is evaluated exactly once, whether in the list or not
+
+        for(auto i = 0; i < N; ++i)
+        {
+            INFO("species: " << species[i].name());
+            const auto expected = species[i].standardThermoProps(T, P);
+            CHECK( G0[i]  == Approx(expected.G0)  );
+            CHECK( H0[i]  == Approx(expected.H0)  );
+            CHECK( V0[i]  == Approx(expected.V0)  );
+            CHECK( Cp0[i] == Approx(expected.Cp0) );
+            CHECK( grad(G0[i])  == Approx(grad(expected.G0))  );
+            CHECK( grad(H0[i])  == Approx(grad(expected.H0))  );
+            CHECK( grad(Cp0[i]) == Approx(grad(expected.Cp0)) );
+        }
+
+        Memoization::enable();
+
+        return batch;
+    };
+
+    real T = 350.0;
+    real P = 1.0e7;
+
+    autodiff::seed(T);
+
+    SECTION("Checking when all reactant species are in the list (in reverse order of dependency)")
+    {
+        const auto batch = checkAgainstSpeciesModels(SpeciesList({ E, D, C, B, A }), T, P);
+        CHECK( batch.numFormationReactionSpecies() == 3 );
+    }
+
+    SECTION("Checking when some reactant species are not in the list")
+    {
+        const auto batch = checkAgainstSpeciesModels(SpeciesList({ E, B }), T, P);
+        CHECK( batch.numFormationReactionSpecies() == 1 );
+    }
+
+    SECTION("Checking when a species with a formation reaction has its standard thermodynamic model overridden")
+    {
+        const auto Dx = D.withStandardGibbsEnergy(-5000.0); // the formation reaction of D no longer determines the properties of Dx
+        const auto batch = checkAgainstSpeciesModels(SpeciesList({ Dx, C, B, A }), T, P);
+        CHECK( batch.numFormationReactionSpecies() == 1 );
+        CHECK( batch.numUngroupedSpecies() == 1 ); // A (Dx and B are in the group of constant models)
+    }
+
+    SECTION("Checking when a reactant species has the same name as a different species in the list")
+    {
+        const auto Dx = D.withStandardGibbsEnergy(-5000.0); // named D, as the reactant D of E, but a different species
+        const auto batch = checkAgainstSpeciesModels(SpeciesList({ E, Dx }), T, P);
+        CHECK( batch.numFormationReactionSpecies() == 1 );
+    }
+}
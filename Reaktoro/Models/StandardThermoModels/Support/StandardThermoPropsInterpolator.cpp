@@ -0,0 +1,339 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "StandardThermoPropsInterpolator.hpp"
+
+// C++ includes
+#include <cmath>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsBatch.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// The number of tabulated standard thermodynamic properties (G0, H0, V0, VT0, VP0, Cp0).
+const auto numprops = 6;
+
+/// The number π.
+const auto pi = 3.14159265358979323846;
+
+/// The maximum degree of the Chebyshev polynomials along each axis.
+const auto maxdegree = 10;
+
+/// The type of the arrays of Chebyshev polynomials along an axis (stored on the stack).
+using ChebyshevArray = Eigen::Array<double, Eigen::Dynamic, 1, Eigen::ColMajor, maxdegree + 1, 1>;
+
+/// The type of the matrix of the tensor product basis and its temperature and pressure derivatives (stored on the stack).
+using ChebyshevBasis = Eigen::Matrix<double, Eigen::Dynamic, 3, Eigen::ColMajor, (maxdegree + 1)*(maxdegree + 1), 3>;
+
+/// Return the index of the cell containing `x` along an axis and set `xi` as the coordinate of `x` in the cell mapped to [-1, 1].
+auto locate(double x, double xmin, double h, Index numcells, double& xi) -> Index
+{
+    const auto i = std::min<long>(std::max<long>(std::floor((x - xmin)/h), 0), numcells - 1);
+    xi = 2.0*(x - xmin - i*h)/h - 1.0;
+    return i;
+}
+
+/// Compute the Chebyshev polynomials of the first kind and their derivatives at `x` in [-1, 1] up to a given degree.
+auto chebyshev(double x, Index degree, ArrayXdRef b, ArrayXdRef db) -> void
+{
+    b[0] = 1.0;
+    db[0] = 0.0;
+    if(degree == 0)
+        return;
+    b[1] = x;
+    db[1] = 1.0;
+    for(auto k = 2; k <= degree; ++k)
+    {
+        b[k] = 2.0*x*b[k - 1] - b[k - 2];
+        db[k] = 2.0*b[k - 1] + 2.0*x*db[k - 1] - db[k - 2];
+    }
+}
+
+/// Return the matrix of the discrete Chebyshev transform whose entry *(j, k)* is the weight of the value at the *j*-th node in the *k*-th coefficient.
+auto chebyshevTransform(Index degree) -> MatrixXd
+{
+    const auto n = degree + 1;
+    MatrixXd A(n, n);
+    for(auto j = 0; j < n; ++j)
+        for(auto k = 0; k < n; ++k)
+            A(j, k) = (k == 0 ? 1.0 : 2.0)/n * std::cos(pi*k*(j + 0.5)/n);
+    return A;
+}
+
+/// Return the Chebyshev nodes in [-1, 1] for a given polynomial degree.
+auto chebyshevNodes(Index degree) -> ArrayXd
+{
+    const auto n = degree + 1;
+    ArrayXd x(n);
+    for(auto j = 0; j < n; ++j)
+        x[j] = std::cos(pi*(j + 0.5)/n);
+    return x;
+}
+
+} // namespace
+
+struct StandardThermoPropsInterpolator::Impl
+{
+    /// The evaluator of the exact standard thermodynamic properties of the species.
+    StandardThermoPropsBatch batch;
+
+    /// The options used for the tabulation.
+    StandardThermoPropsInterpolatorOptions options;
+
+    /// The number of species in the tabulation.
+    Index size = 0;
+
+    /// The width of the cells along the temperature axis (in K).
+    double hT = 0.0;
+
+    /// The width of the cells along the pressure axis (in Pa).
+    double hP = 0.0;
+
+    /// The Chebyshev coefficients in each cell, with columns ordered as G0, H0, V0, VT0, VP0, Cp0 for all species (cell index `iT + numcellsT*iP`).
+    Vec<MatrixXd> coeffs;
+
+    /// Construct a default StandardThermoPropsInterpolator::Impl object.
+    Impl()
+    {}
+
+    /// Construct a StandardThermoPropsInterpolator::Impl object.
+    Impl(const StandardThermoPropsBatch& batch, const StandardThermoPropsInterpolatorOptions& options)
+    : batch(batch), options(options), size(batch.size())
+    {
+        const auto& [Tmin, Tmax, Pmin, Pmax, numcellsT, numcellsP, degreeT, degreeP] = options;
+
+        errorif(Tmin <= 0.0 || Tmax <= Tmin, "Expecting 0 < Tmin < Tmax in the tabulation of standard thermodynamic properties, but got Tmin = ", Tmin, " K and Tmax = ", Tmax, " K.");
+        errorif(Pmin < 0.0 || Pmax <= Pmin, "Expecting 0 <= Pmin < Pmax in the tabulation of standard thermodynamic properties, but got Pmin = ", Pmin, " Pa and Pmax = ", Pmax, " Pa.");
+        errorif(numcellsT == 0 || numcellsP == 0, "Expecting at least one cell along each axis in the tabulation of standard thermodynamic properties.");
+        errorif(degreeT > maxdegree || degreeP > maxdegree, "Expecting Chebyshev polynomials of degree at most ", maxdegree, " in the tabulation of standard thermodynamic properties, but got degreeT = ", degreeT, " and degreeP = ", degreeP, ".");
+
+        hT = (Tmax - Tmin)/numcellsT;
+        hP = (Pmax - Pmin)/numcellsP;
+
+        const auto nT = degreeT + 1;
+        const auto nP = degreeP + 1;
+        const auto N = size;
+
+        // The transform from the values at the nodes (a, c) into the coefficients (p, q) of the tensor product, with indices a + nT*c and p + nT*q
+        const MatrixXd AT = chebyshevTransform(degreeT);
+        const MatrixXd AP = chebyshevTransform(degreeP);
+        MatrixXd K(nT*nP, nT*nP);
+        for(auto c = 0; c < nP; ++c)
+            for(auto q = 0; q < nP; ++q)
+                K.block(c*nT, q*nT, nT, nT) = AP(c, q) * AT;
+
+        const ArrayXd xT = chebyshevNodes(degreeT);
+        const ArrayXd xP = chebyshevNodes(degreeP);
+
+        ArrayXr G0(N), H0(N), V0(N), VT0(N), VP0(N), Cp0(N);
+        MatrixXd F(numprops*N, nT*nP);
+
+        coeffs.resize(numcellsT*numcellsP);
+
+        for(auto iP = 0; iP < numcellsP; ++iP)
+        {
+            for(auto iT = 0; iT < numcellsT; ++iT)
+            {
+                for(auto c = 0; c < nP; ++c)
+                {
+                    for(auto a = 0; a < nT; ++a)
+                    {
+                        const auto T = Tmin + (iT + 0.5*(xT[a] + 1.0))*hT;
+                        const auto P = Pmin + (iP + 0.5*(xP[c] + 1.0))*hP;
+                        batch.eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+                        auto col = F.col(a + nT*c);
+                        for(auto i = 0; i < N; ++i)
+                        {
+                            col[i + 0*N] = G0[i].val();
+                            col[i + 1*N] = H0[i].val();
+                            col[i + 2*N] = V0[i].val();
+                            col[i + 3*N] = VT0[i].val();
+                            col[i + 4*N] = VP0[i].val();
+                            col[i + 5*N] = Cp0[i].val();
+                        }
+                    }
+                }
+                coeffs[iT + numcellsT*iP] = (F * K).transpose();
+            }
+        }
+    }
+
+    /// Return true if given temperature and pressure are inside the tabulation domain.
+    auto contains(double T, double P) const -> bool
+    {
+        return !coeffs.empty() && options.Tmin <= T && T <= options.Tmax && options.Pmin <= P && P <= options.Pmax;
+    }
+
+    /// Compute the tensor product basis and its temperature and pressure derivatives (columns) at given temperature and pressure and return the index of the containing cell.
+    auto basis(double T, double P, ChebyshevBasis& B) const -> Index
+    {
+        const auto& [Tmin, Tmax, Pmin, Pmax, numcellsT, numcellsP, degreeT, degreeP] = options;
+
+        const auto nT = degreeT + 1;
+        const auto nP = degreeP + 1;
+
+        double xi = 0.0, eta = 0.0;
+        const auto iT = locate(T, Tmin, hT, numcellsT, xi);
+        const auto iP = locate(P, Pmin, hP, numcellsP, eta);
+
+        ChebyshevArray bT(nT), dbT(nT), bP(nP), dbP(nP);
+        chebyshev(xi, degreeT, bT, dbT);
+        chebyshev(eta, degreeP, bP, dbP);
+
+        B.resize(nT*nP, 3);
+        for(auto q = 0; q < nP; ++q)
+        {
+            B.col(0).segment(q*nT, nT) = bT * bP[q];
+            B.col(1).segment(q*nT, nT) = dbT * (bP[q] * 2.0/hT);
+            B.col(2).segment(q*nT, nT) = bT * (dbP[q] * 2.0/hP);
+        }
+
+        return iT + numcellsT*iP;
+    }
+
+    /// Evaluate the standard thermodynamic properties of all species by interpolation.
+    auto eval(const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void
+    {
+        errorif(!contains(T.val(), P.val()), "Cannot interpolate the standard thermodynamic properties of the species at T = ", T.val(), " K and P = ", P.val(), " Pa, "
+            "which is outside the tabulation domain [", options.Tmin, ", ", options.Tmax, "] K x [", options.Pmin, ", ", options.Pmax, "] Pa.");
+
+        ChebyshevBasis B;
+        const auto& C = coeffs[basis(T.val(), P.val(), B)];
+
+        const auto N = size;
+        const auto Tgrad = T[1];
+        const auto Pgrad = P[1];
+
+        const auto assign = [&](ArrayXrRef out, Index offset)
+        {
+            for(auto i = 0; i < N; ++i)
+            {
+                const Eigen::Vector3d f = B.transpose() * C.col(offset + i);
+                auto& y = out[i];
+                y = f[0];
+                y[1] = f[1]*Tgrad + f[2]*Pgrad;
+            }
+        };
+
+        assign(G0,  0*N);
+        assign(H0,  1*N);
+        assign(V0,  2*N);
+        assign(VT0, 3*N);
+        assign(VP0, 4*N);
+        assign(Cp0, 5*N);
+    }
+
+    /// Return the maximum absolute errors of the interpolation against the exact models of the species.
+    auto errors(Index numpointsT, Index numpointsP) const -> StandardThermoPropsInterpolatorErrors
+    {
+        errorif(coeffs.empty(), "Cannot compute the errors of an empty StandardThermoPropsInterpolator object.");
+        errorif(numpointsT < 2 || numpointsP < 2, "Expecting at least two points along each axis when computing the errors of a StandardThermoPropsInterpolator object.");
+
+        const auto& [Tmin, Tmax, Pmin, Pmax, numcellsT, numcellsP, degreeT, degreeP] = options;
+
+        const auto N = size;
+
+        StandardThermoPropsInterpolatorErrors res;
+        res.G0 = res.H0 = res.V0 = res.VT0 = res.VP0 = res.Cp0 = res.S0 = res.G0T = ArrayXd::Zero(N);
+
+        ArrayXr G0(N), H0(N), V0(N), VT0(N), VP0(N), Cp0(N);
+        ChebyshevBasis B;
+
+        for(auto j = 0; j < numpointsP; ++j)
+        {
+            for(auto i = 0; i < numpointsT; ++i)
+            {
+                real T = Tmin + i*(Tmax - Tmin)/(numpointsT - 1);
+                real P = Pmin + j*(Pmax - Pmin)/(numpointsP - 1);
+
+                autodiff::seed(T);
+                batch.eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+                autodiff::unseed(T);
+
+                const MatrixXd F = coeffs[basis(T.val(), P.val(), B)].transpose() * B;
+
+                const auto Tval = T.val();
+
+                for(auto k = 0; k < N; ++k)
+                {
+                    const auto S0 = (H0[k].val() - G0[k].val())/Tval; // from G0 = H0 - T*S0
+                    const auto S0i = (F(k + 1*N, 0) - F(k + 0*N, 0))/Tval;
+                    res.G0[k]  = std::max(res.G0[k],  std::abs(F(k + 0*N, 0) - G0[k].val()));
+                    res.H0[k]  = std::max(res.H0[k],  std::abs(F(k + 1*N, 0) - H0[k].val()));
+                    res.V0[k]  = std::max(res.V0[k],  std::abs(F(k + 2*N, 0) - V0[k].val()));
+                    res.VT0[k] = std::max(res.VT0[k], std::abs(F(k + 3*N, 0) - VT0[k].val()));
+                    res.VP0[k] = std::max(res.VP0[k], std::abs(F(k + 4*N, 0) - VP0[k].val()));
+                    res.Cp0[k] = std::max(res.Cp0[k], std::abs(F(k + 5*N, 0) - Cp0[k].val()));
+                    res.S0[k]  = std::max(res.S0[k],  std::abs(S0i - S0));
+                    res.G0T[k] = std::max(res.G0T[k], std::abs(F(k + 0*N, 1) - G0[k][1]));
+                }
+            }
+        }
+
+        return res;
+    }
+};
+
+StandardThermoPropsInterpolator::StandardThermoPropsInterpolator()
+: pimpl(new Impl())
+{}
+
+StandardThermoPropsInterpolator::StandardThermoPropsInterpolator(const StandardThermoPropsBatch& batch, const StandardThermoPropsInterpolatorOptions& options)
+: pimpl(new Impl(batch, options))
+{}
+
+auto StandardThermoPropsInterpolator::size() const -> Index
+{
+    return pimpl->size;
+}
+
+auto StandardThermoPropsInterpolator::empty() const -> bool
+{
+    return pimpl->coeffs.empty();
+}
+
+auto StandardThermoPropsInterpolator::options() const -> const StandardThermoPropsInterpolatorOptions&
+{
+    return pimpl->options;
+}
+
+auto StandardThermoPropsInterpolator::contains(double T, double P) const -> bool
+{
+    return pimpl->contains(T, P);
+}
+
+auto StandardThermoPropsInterpolator::eval(const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void
+{
+    assert(G0.size() == size());
+    assert(H0.size() == size());
+    assert(V0.size() == size());
+    assert(VT0.size() == size());
+    assert(VP0.size() == size());
+    assert(Cp0.size() == size());
+
+    pimpl->eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+}
+
+auto StandardThermoPropsInterpolator::errors(Index numpointsT, Index numpointsP) const -> StandardThermoPropsInterpolatorErrors
+{
+    return pimpl->errors(numpointsT, numpointsP);
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,149 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/Types.hpp>
+
+namespace Reaktoro {
+
+// Forward declarations
+class StandardThermoPropsBatch;
+
+/// The options for the tabulation of standard thermodynamic properties with StandardThermoPropsInterpolator.
+struct StandardThermoPropsInterpolatorOptions
+{
+    /// The minimum temperature of the tabulation domain (in K).
+    double Tmin = 273.15;
+
+    /// The maximum temperature of the tabulation domain (in K).
+    double Tmax = 573.15;
+
+    /// The minimum pressure of the tabulation domain (in Pa).
+    double Pmin = 1.0e5;
+
+    /// The maximum pressure of the tabulation domain (in Pa).
+    double Pmax = 1000.0e5;
+
+    /// The number of cells along the temperature axis of the tabulation grid.
+    Index numcellsT = 10;
+
+    /// The number of cells along the pressure axis of the tabulation grid.
+    Index numcellsP = 4;
+
+    /// The degree of the Chebyshev polynomials along the temperature axis in each cell (at most 10).
+    Index degreeT = 5;
+
+    /// The degree of the Chebyshev polynomials along the pressure axis in each cell (at most 10).
+    Index degreeP = 3;
+};
+
+/// The maximum absolute errors of the interpolated standard thermodynamic properties of each species.
+/// These errors are computed against the exact standard thermodynamic
+/// models of the species with StandardThermoPropsInterpolator::errors.
+struct StandardThermoPropsInterpolatorErrors
+{
+    /// The maximum absolute errors of the standard molar Gibbs energies of the species (in J/mol).
+    ArrayXd G0;
+
+    /// The maximum absolute errors of the standard molar enthalpies of the species (in J/mol).
+    ArrayXd H0;
+
+    /// The maximum absolute errors of the standard molar volumes of the species (in m³/mol).
+    ArrayXd V0;
+
+    /// The maximum absolute errors of the temperature derivatives of the standard molar volumes of the species (in m³/(mol·K)).
+    ArrayXd VT0;
+
+    /// The maximum absolute errors of the pressure derivatives of the standard molar volumes of the species (in m³/(mol·Pa)).
+    ArrayXd VP0;
+
+    /// The maximum absolute errors of the standard molar isobaric heat capacities of the species (in J/(mol·K)).
+    ArrayXd Cp0;
+
+    /// The maximum absolute errors of the standard molar entropies of the species computed as `(H0 - G0)/T` (in J/(mol·K)).
+    ArrayXd S0;
+
+    /// The maximum absolute errors of the temperature derivatives of the standard molar Gibbs energies of the species (in J/(mol·K)).
+    ArrayXd G0T;
+};
+
+/// Used to evaluate the standard thermodynamic properties of a list of species by interpolation over a temperature-pressure domain.
+/// The standard thermodynamic properties of all species are tabulated once
+/// on a shared grid of cells covering the domain, with the exact models
+/// evaluated by a StandardThermoPropsBatch object at the Chebyshev nodes of
+/// each cell. In each cell, every property of every species is represented by
+/// a tensor product of Chebyshev polynomials in temperature and pressure,
+/// with the coefficients of each property of each species stored
+/// contiguously. An evaluation thus consists of a single cell lookup
+/// followed by the products of these coefficients with the tensor product
+/// basis, which compute the values and the temperature and pressure
+/// derivatives of all properties of all species, then combined with the
+/// derivative seeds of `T` and `P`. The evaluation allocates no memory and
+/// mutates no state, so it can run concurrently on the same object. Use
+/// @ref errors to assess the accuracy of the interpolation against the exact
+/// models.
+class StandardThermoPropsInterpolator
+{
+public:
+    /// Construct a default StandardThermoPropsInterpolator object.
+    StandardThermoPropsInterpolator();
+
+    /// Construct a StandardThermoPropsInterpolator object tabulating the species in a StandardThermoPropsBatch object.
+    /// @param batch The evaluator of the exact standard thermodynamic properties of the species
+    /// @param options The options for the tabulation of the standard thermodynamic properties
+    StandardThermoPropsInterpolator(const StandardThermoPropsBatch& batch, const StandardThermoPropsInterpolatorOptions& options);
+
+    /// Return the number of species in the tabulation.
+    auto size() const -> Index;
+
+    /// Return true if there are no tabulated standard thermodynamic properties.
+    auto empty() const -> bool;
+
+    /// Return the options used for the tabulation of the standard thermodynamic properties.
+    auto options() const -> const StandardThermoPropsInterpolatorOptions&;
+
+    /// Return true if given temperature and pressure are inside the tabulation domain.
+    auto contains(double T, double P) const -> bool;
+
+    /// Evaluate the standard thermodynamic properties of all species by interpolation directly into the given arrays.
+    /// @param T The temperature for the calculation (in K)
+    /// @param P The pressure for the calculation (in Pa)
+    /// @param[out] G0 The standard molar Gibbs energies of the species (in J/mol)
+    /// @param[out] H0 The standard molar enthalpies of the species (in J/mol)
+    /// @param[out] V0 The standard molar volumes of the species (in m³/mol)
+    /// @param[out] VT0 The temperature derivatives of the standard molar volumes of the species (in m³/(mol·K))
+    /// @param[out] VP0 The pressure derivatives of the standard molar volumes of the species (in m³/(mol·Pa))
+    /// @param[out] Cp0 The standard molar isobaric heat capacities of the species (in J/(mol·K))
+    auto eval(const real& T, const real& P, ArrayXrRef G0, ArrayXrRef H0, ArrayXrRef V0, ArrayXrRef VT0, ArrayXrRef VP0, ArrayXrRef Cp0) const -> void;
+
+    /// Return the maximum absolute errors of the interpolation against the exact models of the species.
+    /// The errors are computed on a uniform grid over the tabulation domain
+    /// whose points do not coincide with the nodes used in the tabulation.
+    /// @param numpointsT The number of points along the temperature axis
+    /// @param numpointsP The number of points along the pressure axis
+    auto errors(Index numpointsT = 51, Index numpointsP = 21) const -> StandardThermoPropsInterpolatorErrors;
+
+private:
+    struct Impl;
+
+    SharedPtr<Impl> pimpl;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,60 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// pybind11 includes
+#include <Reaktoro/pybind11.hxx>
+
+// Reaktoro includes
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsBatch.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsInterpolator.hpp>
+using namespace Reaktoro;
+
+void exportStandardThermoPropsInterpolator(py::module& m)
+{
+    py::class_<StandardThermoPropsInterpolatorOptions>(m, "StandardThermoPropsInterpolatorOptions")
+        .def(py::init<>())
+        .def_readwrite("Tmin",      &StandardThermoPropsInterpolatorOptions::Tmin)
+        .def_readwrite("Tmax",      &StandardThermoPropsInterpolatorOptions::Tmax)
+        .def_readwrite("Pmin",      &StandardThermoPropsInterpolatorOptions::Pmin)
+        .def_readwrite("Pmax",      &StandardThermoPropsInterpolatorOptions::Pmax)
+        .def_readwrite("numcellsT", &StandardThermoPropsInterpolatorOptions::numcellsT)
+        .def_readwrite("numcellsP", &StandardThermoPropsInterpolatorOptions::numcellsP)
+        .def_readwrite("degreeT",   &StandardThermoPropsInterpolatorOptions::degreeT)
+        .def_readwrite("degreeP",   &StandardThermoPropsInterpolatorOptions::degreeP)
+        ;
+
+    py::class_<StandardThermoPropsInterpolatorErrors>(m, "StandardThermoPropsInterpolatorErrors")
+        .def(py::init<>())
+        .def_readwrite("G0",  &StandardThermoPropsInterpolatorErrors::G0)
+        .def_readwrite("H0",  &StandardThermoPropsInterpolatorErrors::H0)
+        .def_readwrite("V0",  &StandardThermoPropsInterpolatorErrors::V0)
+        .def_readwrite("VT0", &StandardThermoPropsInterpolatorErrors::VT0)
+        .def_readwrite("VP0", &StandardThermoPropsInterpolatorErrors::VP0)
+        .def_readwrite("Cp0", &StandardThermoPropsInterpolatorErrors::Cp0)
+        .def_readwrite("S0",  &StandardThermoPropsInterpolatorErrors::S0)
+        .def_readwrite("G0T", &StandardThermoPropsInterpolatorErrors::G0T)
+        ;
+
+    py::class_<StandardThermoPropsInterpolator>(m, "StandardThermoPropsInterpolator")
+        .def(py::init<>())
+        .def("size", &StandardThermoPropsInterpolator::size)
+        .def("empty", &StandardThermoPropsInterpolator::empty)
+        .def("options", &StandardThermoPropsInterpolator::options, return_internal_ref)
+        .def("contains", &StandardThermoPropsInterpolator::contains)
+        .def("errors", &StandardThermoPropsInterpolator::errors, "numpointsT"_a = 51, "numpointsP"_a = 21)
+        ;
+}
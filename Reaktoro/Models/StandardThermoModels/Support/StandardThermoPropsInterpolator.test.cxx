@@ -0,0 +1,130 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Core/SpeciesList.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsBatch.hpp>
+#include <Reaktoro/Models/StandardThermoModels/Support/StandardThermoPropsInterpolator.hpp>
+using namespace Reaktoro;
+
+namespace test {
+
+extern auto createSpeciesListForStandardThermoPropsBatch() -> SpeciesList;
+
+} // namespace test
+
+TEST_CASE("Testing StandardThermoPropsInterpolator class", "[StandardThermoPropsInterpolator]")
+{
+    const auto species = test::createSpeciesListForStandardThermoPropsBatch();
+    const auto N = species.size();
+
+    StandardThermoPropsBatch batch(species);
+
+    StandardThermoPropsInterpolatorOptions options;
+    options.Tmin = 273.15;
+    options.Tmax = 473.15;
+    options.Pmin = 50.0e5; // above the saturation pressure of water at Tmax, as required by the HKF model of Ca+2
+    options.Pmax = 1000.0e5;
+
+    StandardThermoPropsInterpolator interpolator(batch, options);
+
+    CHECK( interpolator.size() == N );
+    CHECK( interpolator.empty() == false );
+
+    CHECK( interpolator.contains(300.0, 500.0e5) );
+    CHECK( interpolator.contains(options.Tmin, options.Pmin) );
+    CHECK( interpolator.contains(options.Tmax, options.Pmax) );
+    CHECK_FALSE( interpolator.contains(250.0, 500.0e5) );
+    CHECK_FALSE( interpolator.contains(300.0, 2000.0e5) );
+
+    CHECK( StandardThermoPropsInterpolator().empty() );
+    CHECK_FALSE( StandardThermoPropsInterpolator().contains(300.0, 500.0e5) );
+
+    ArrayXr G0(N), H0(N), V0(N), VT0(N), VP0(N), Cp0(N);
+    ArrayXr eG0(N), eH0(N), eV0(N), eVT0(N), eVP0(N), eCp0(N);
+
+    const auto checkAgainstExactModels = [&](const real& T, const real& P)
+    {
+        interpolator.eval(T, P, G0, H0, V0, VT0, VP0, Cp0);
+        batch.eval(T, P, eG0, eH0, eV0, eVT0, eVP0, eCp0);
+
+        for(auto i = 0; i < N; ++i)
+        {
+            INFO("species: " << species[i].name());
+            CHECK( G0[i]  == Approx(eG0[i]).epsilon(1e-8)  );
+            CHECK( H0[i]  == Approx(eH0[i]).epsilon(1e-8)  );
+            CHECK( V0[i]  == Approx(eV0[i]).epsilon(1e-6)  );
+            CHECK( Cp0[i] == Approx(eCp0[i]).epsilon(1e-6) );
+            CHECK( grad(G0[i])  == Approx(grad(eG0[i])).epsilon(1e-4).margin(1e-6)  );
+            CHECK( grad(H0[i])  == Approx(grad(eH0[i])).epsilon(1e-4).margin(1e-6)  );
+            CHECK( grad(V0[i])  == Approx(grad(eV0[i])).epsilon(1e-3).margin(1e-18) );
+            CHECK( grad(Cp0[i]) == Approx(grad(eCp0[i])).epsilon(1e-3).margin(1e-6) );
+        }
+    };
+
+    real T = 60.0 + 273.15;
+    real P = 123.0 * 1e5;
+
+    SECTION("Checking values and temperature derivatives")
+    {
+        autodiff::seed(T);
+        checkAgainstExactModels(T, P);
+    }
+
+    SECTION("Checking values and pressure derivatives")
+    {
+        autodiff::seed(P);
+        checkAgainstExactModels(T, P);
+    }
+
+    SECTION("Checking the errors against the exact models")
+    {
+        const auto errors = interpolator.errors();
+
+        CHECK( errors.G0.size() == N );
+
+        for(auto i = 0; i < N; ++i)
+        {
+            INFO("species: " << species[i].name());
+            CHECK( errors.G0[i]  < 1e-2 ); // J/mol
+            CHECK( errors.H0[i]  < 1e-1 ); // J/mol
+            CHECK( errors.S0[i]  < 1e-2 ); // J/(mol·K)
+            CHECK( errors.G0T[i] < 1e-2 ); // J/(mol·K)
+            CHECK( errors.Cp0[i] < 1e-2 ); // J/(mol·K)
+            CHECK( errors.V0[i]  < 1e-10 ); // m³/mol
+        }
+    }
+
+    SECTION("Checking evaluation outside the tabulation domain")
+    {
+        CHECK_THROWS( interpolator.eval(250.0, P, G0, H0, V0, VT0, VP0, Cp0) );
+    }
+
+    SECTION("Checking invalid options")
+    {
+        auto invalid = options;
+        invalid.Tmax = invalid.Tmin;
+        CHECK_THROWS( StandardThermoPropsInterpolator(batch, invalid) );
+
+        invalid = options;
+        invalid.degreeT = 11;
+        CHECK_THROWS( StandardThermoPropsInterpolator(batch, invalid) );
+    }
+}
@@ -28,6 +28,10 @@
 #include <Reaktoro/Core/Species.hpp>
 #include <Reaktoro/Core/SpeciesList.hpp>
 #include <Reaktoro/Core/Support/DatabaseParser.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIdealAqueous.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIdealGas.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIdealIonExchange.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIdealSolution.hpp>
 #include <Reaktoro/Models/StandardThermoModels.hpp>
 #include <Reaktoro/Serialization/Common.hpp>
 #include <Reaktoro/Serialization/Models/ReactionRateModels.hpp>
@@ -49,14 +53,122 @@ REAKTORO_DATA_DECODE_DEFINE(ChemicalFormula)
 
 //=====================================================================================================================
 
+namespace {
+
+/// Return the ideal activity model used by default for a phase with given aggregate state and state of matter (as in AqueousPhase, GaseousPhase, etc.).
+auto defaultIdealActivityModel(AggregateState aggregatestate, StateOfMatter stateofmatter) -> ActivityModelGenerator
+{
+    switch(aggregatestate)
+    {
+        case AggregateState::Aqueous: return ActivityModelIdealAqueous();
+        case AggregateState::Gas: return ActivityModelIdealGas();
+        case AggregateState::IonExchange: return ActivityModelIdealIonExchange();
+        default: return ActivityModelIdealSolution(stateofmatter == StateOfMatter::Liquid ? StateOfMatter::Liquid : StateOfMatter::Solid);
+    }
+}
+
+/// Return true if the activity model of a phase is the default ideal one used when the phase is restored from Data.
+/// Activity models are functions that cannot be compared, so the ideal activity models are identified by their parameters
+/// (e.g., `IdealAqueous`). Any other activity model (including a chain of models) is not considered a default one,
+/// even if it produces the same results.
+auto hasDefaultActivityModel(Phase const& phase) -> bool
+{
+    auto const& params = phase.activityModel().params();
+    if(params.isNull())
+        return false; // e.g., a phase without activity model or whose activity model has no identifying parameters
+
+    try
+    {
+        auto const ideal_model = defaultIdealActivityModel(phase.aggregateState(), phase.stateOfMatter())(phase.species());
+        return params.repr() == ideal_model.params().repr();
+    }
+    catch(...)
+    {
+        return false; // e.g., an aqueous phase without water, for which the default ideal activity model cannot be created
+    }
+}
+
+} // namespace
+
 REAKTORO_DATA_ENCODE_DEFINE(ChemicalSystem)
 {
-    errorif(true, "Implement REAKTORO_DATA_ENCODE_DEFINE(ChemicalSystem)");
+    errorif(obj.reactions().size(), "Could not convert ChemicalSystem object to Data because it contains reactions, whose rate models cannot be serialized.");
+    errorif(obj.surfaces().size(), "Could not convert ChemicalSystem object to Data because it contains surfaces, whose area models cannot be serialized.");
+
+    auto& elements_data = data["Elements"];
+    auto& species_data = data["Species"];
+    auto& phases_data = data["Phases"];
+
+    for(auto const& element : obj.elements())
+        elements_data[element.symbol()] = element;
+
+    // Add the species in the system and, recursively, the reactants in their formation reactions (not necessarily in the system, e.g., master species in PHREEQC databases)
+    Fn<void(Species const&)> addSpecies = [&](Species const& species)
+    {
+        if(species_data.exists(species.name()))
+            return;
+
+        auto const& reaction = species.reaction();
+        auto const& model_params = reaction.reactants().size() ? reaction.reactionThermoModel().params() : species.standardThermoModel().params();
+        errorif(model_params.isNull(), "Could not convert ChemicalSystem object to Data because species ", species.name(), " has a thermodynamic model without parameters (e.g., a model that depends on an external library), which cannot be serialized.");
+
+        species_data[species.name()] = species;
+
+        for(auto const& [element, coeff] : species.elements())
+            if(!elements_data.exists(element.symbol()))
+                elements_data[element.symbol()] = element;
+
+        for(auto const& [reactant, coeff] : reaction.reactants())
+            addSpecies(reactant);
+    };
+
+    for(auto const& species : obj.species())
+        addSpecies(species);
+
+    for(auto const& phase : obj.phases())
+        phases_data.add(phase);
+
+    // The formula matrix is stored so that it can be checked against the one of the restored system
+    auto const A = obj.formulaMatrix();
+    auto& formula_matrix_data = data["FormulaMatrix"];
+    for(auto i = 0; i < A.rows(); ++i)
+        formula_matrix_data.add(Vec<double>(A.row(i).begin(), A.row(i).end()));
 }
 
 REAKTORO_DATA_DECODE_DEFINE(ChemicalSystem)
 {
-    errorif(true, "Implement REAKTORO_DATA_DECODE_DEFINE(ChemicalSystem)");
+    Database db = DatabaseParser(data);
+
+    PhaseList phases;
+    for(auto const& phase_data : data.required("Phases").asList())
+    {
+        SpeciesList species;
+        for(auto const& name : phase_data.required("Species").asList())
+            species.append(db.species(name.asString()));
+
+        auto const stateofmatter = phase_data.required("StateOfMatter").as<StateOfMatter>();
+        auto const aggregatestate = phase_data.required("AggregateState").as<AggregateState>();
+        auto const model = defaultIdealActivityModel(aggregatestate, stateofmatter);
+
+        phases.append(Phase()
+            .withName(phase_data.required("Name").asString())
+            .withStateOfMatter(stateofmatter)
+            .withSpecies(species)
+            .withActivityModel(model(species))
+            .withIdealActivityModel(model(species)));
+    }
+
+    obj = ChemicalSystem(db, phases);
+
+    if(data.exists("FormulaMatrix"))
+    {
+        auto const& rows = data["FormulaMatrix"].asList();
+        auto const A = obj.formulaMatrix();
+        errorif(rows.size() != A.rows(), "Could not convert Data to ChemicalSystem object because the stored formula matrix has ", rows.size(), " rows instead of ", A.rows(), ".");
+        for(auto i = 0; i < A.rows(); ++i)
+            errorif(rows[i].as<Vec<double>>() != Vec<double>(A.row(i).begin(), A.row(i).end()),
+                "Could not convert Data to ChemicalSystem object because the stored formula matrix differs from the one of the restored system in the row of ", i < obj.elements().size() ? obj.element(i).symbol() : String("electric charge"), ".");
+    }
 }
 
 //=====================================================================================================================
@@ -148,12 +260,18 @@ REAKTORO_DATA_DECODE_DEFINE(FormationReaction)
 
 REAKTORO_DATA_ENCODE_DEFINE(Phase)
 {
-    errorif(true, "Implement REAKTORO_DATA_ENCODE_DEFINE(Phase)");
+    data["Name"] = obj.name();
+    data["StateOfMatter"] = obj.stateOfMatter();
+    data["AggregateState"] = obj.aggregateState();
+    data["DefaultActivityModel"] = hasDefaultActivityModel(obj); // false if the activity model must be given again when the phase is restored
+    auto& species_data = data["Species"];
+    for(auto const& species : obj.species())
+        species_data.add(species.name());
 }
 
 REAKTORO_DATA_DECODE_DEFINE(Phase)
 {
-    errorif(true, "Implement REAKTORO_DATA_DECODE_DEFINE(Phase)");
+    errorif(true, "Converting YAML to Phase is not supported directly."); // because only species names are present in YAML representation of Phase (see decoding of ChemicalSystem)
 }
 
 //=====================================================================================================================
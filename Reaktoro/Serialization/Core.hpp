@@ -18,11 +18,13 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/AggregateState.hpp>
 #include <Reaktoro/Core/Data.hpp>
 #include <Reaktoro/Core/ElementList.hpp>
 #include <Reaktoro/Core/SpeciesList.hpp>
+#include <Reaktoro/Core/StateOfMatter.hpp>
 
 namespace Reaktoro {
 
@@ -76,11 +78,15 @@ REAKTORO_DATA_DECODE_DECLARE(SpeciesList);
 REAKTORO_DATA_ENCODE_DECLARE(StandardThermoModel);
 REAKTORO_DATA_DECODE_DECLARE(StandardThermoModel);
 
+REAKTORO_DATA_ENCODE_DECLARE(StateOfMatter);
+REAKTORO_DATA_DECODE_DECLARE(StateOfMatter);
+
 //--------------------------------------------------------------------------------
 // ATTENTION!
 //--------------------------------------------------------------------------------
 // Linking error if using g++ 12.1 if these encode/decode definitions for
-// AggregateState are implemented in cpp file and not here in this header file!
+// AggregateState and StateOfMatter are implemented in cpp file and not here in
+// this header file!
 //--------------------------------------------------------------------------------
 
 inline REAKTORO_DATA_ENCODE_DEFINE(AggregateState)
@@ -95,4 +101,23 @@ inline REAKTORO_DATA_DECODE_DEFINE(AggregateState)
     obj = parseAggregateState(data.asString());
 }
 
+inline REAKTORO_DATA_ENCODE_DEFINE(StateOfMatter)
+{
+    std::stringstream ss;
+    ss << obj;
+    data = ss.str();
+}
+
+inline REAKTORO_DATA_DECODE_DEFINE(StateOfMatter)
+{
+    const auto str = data.asString();
+    for(auto option : { StateOfMatter::Unspecified, StateOfMatter::Solid, StateOfMatter::Liquid, StateOfMatter::Gas, StateOfMatter::Supercritical, StateOfMatter::Plasma, StateOfMatter::Fluid, StateOfMatter::Condensed })
+    {
+        std::stringstream ss;
+        ss << option;
+        if(ss.str() == str) { obj = option; return; }
+    }
+    errorif(true, "Could not convert `", str, "` to a StateOfMatter value. The valid values are Unspecified, Solid, Liquid, Gas, Supercritical, Plasma, Fluid, and Condensed.");
+}
+
 } // namespace Reaktoro
@@ -26,6 +26,8 @@ using namespace Catch;
 #include <Reaktoro/Core/Element.hpp>
 #include <Reaktoro/Core/Phase.hpp>
 #include <Reaktoro/Core/Species.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIdealAqueous.hpp>
+#include <Reaktoro/Models/ActivityModels/ActivityModelIdealSolution.hpp>
 #include <Reaktoro/Models/StandardThermoModels.hpp>
 #include <Reaktoro/Serialization/Common.hpp>
 #include <Reaktoro/Serialization/Core.hpp>
@@ -57,6 +59,22 @@ TEST_CASE("Testing Data encoder/decoder for AggregateState", "[Serialization][Co
     CHECK( aggstate == AggregateState::Undefined );
 }
 
+TEST_CASE("Testing Data encoder/decoder for StateOfMatter", "[Serialization][Core]")
+{
+    Data data;
+
+    data = StateOfMatter::Liquid;
+    CHECK( data.asString() == "Liquid" );
+    CHECK( data.as<StateOfMatter>() == StateOfMatter::Liquid );
+
+    data = StateOfMatter::Unspecified;
+    CHECK( data.asString() == "Unspecified" );
+    CHECK( data.as<StateOfMatter>() == StateOfMatter::Unspecified );
+
+    data = "Liquidus";
+    CHECK_THROWS( data.as<StateOfMatter>() );
+}
+
 TEST_CASE("Testing Data encoder/decoder for ChemicalFormula", "[Serialization][Core]")
 {
     Data data;
@@ -335,7 +353,45 @@ TEST_CASE("Testing Data encoder/decoder for Phase", "[Serialization][Core]")
     Data data;
     Phase phase;
 
-    // TODO: Implement Data encoding/decoding test for Phase.
+    phase = phase.withName("AqueousPhase");
+    phase = phase.withStateOfMatter(StateOfMatter::Liquid);
+    phase = phase.withSpecies({ Species("H2O(aq)").withStandardGibbsEnergy(0.0), Species("H+(aq)").withStandardGibbsEnergy(0.0) });
+
+    data = phase;
+
+    CHECK( data["Name"].asString() == "AqueousPhase" );
+    CHECK( data["StateOfMatter"].as<StateOfMatter>() == StateOfMatter::Liquid );
+    CHECK( data["AggregateState"].as<AggregateState>() == AggregateState::Aqueous );
+    CHECK( data["Species"].as<Strings>() == Strings{"H2O(aq)", "H+(aq)"} );
+    CHECK( data["DefaultActivityModel"].asBoolean() == false ); // the phase has no activity model
+
+    phase = phase.withActivityModel(ActivityModelIdealAqueous()(phase.species()));
+
+    data = phase;
+
+    CHECK( data["DefaultActivityModel"].asBoolean() == true );
+
+    phase = phase.withActivityModel(ActivityModel(ActivityModelIdealAqueous()(phase.species()).evaluatorFn()));
+
+    data = phase;
+
+    CHECK( data["DefaultActivityModel"].asBoolean() == false ); // an activity model identical to the default one, but not identified as such
+
+    phase = phase.withStateOfMatter(StateOfMatter::Solid);
+    phase = phase.withSpecies({ Species("CaCO3(s)").withStandardGibbsEnergy(0.0) });
+    phase = phase.withActivityModel(ActivityModelIdealSolution(StateOfMatter::Solid)(phase.species()));
+
+    data = phase;
+
+    CHECK( data["DefaultActivityModel"].asBoolean() == true );
+
+    phase = phase.withActivityModel(ActivityModelIdealSolution(StateOfMatter::Liquid)(phase.species()));
+
+    data = phase;
+
+    CHECK( data["DefaultActivityModel"].asBoolean() == false ); // the default ideal activity model of a solid phase is for a solid solution
+
+    CHECK_THROWS( data.as<Phase>() ); // only species names are stored in the Data representation of a Phase object
 }
 
 TEST_CASE("Testing Data encoder/decoder for ReactionStandardThermoModel", "[Serialization][Core]")
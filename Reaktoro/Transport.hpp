@@ -17,4 +17,6 @@
 
 #pragma once
 
+#include <Reaktoro/Transport/DiffusionSolverADI.hpp>
 #include <Reaktoro/Transport/TransportSolver.hpp>
+#include <Reaktoro/Transport/TridiagonalMatrix.hpp>
@@ -0,0 +1,119 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "DiffusionSolverADI.hpp"
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+namespace {
+
+/// Assemble and factorize the matrix `I - Δt D δ²` along a direction with `n` cells of length `h` and zero-flux boundaries.
+auto assembleDirectionalMatrix(TridiagonalMatrix& A, Index n, double h, double D, double dt) -> void
+{
+    const auto beta = D*dt/(h*h);
+
+    A.resize(n);
+
+    if(n == 1)
+        A.setRow(0, 0.0, 1.0, 0.0);
+    else
+    {
+        A.setRow(0, 0.0, 1.0 + beta, -beta);
+        for(Index i = 1; i < n - 1; ++i)
+            A.setRow(i, -beta, 1.0 + 2.0*beta, -beta);
+        A.setRow(n - 1, -beta, 1.0 + beta, 0.0);
+    }
+
+    A.factorize();
+}
+
+/// Solve along every line of cells whose first cell is `icell` and whose consecutive cells are `jump` cells apart.
+auto solveAlongLine(const TridiagonalMatrix& A, MatrixXdRowMajorRef U, Index icell, Index jump) -> void
+{
+    const auto os = U.outerStride();
+    const auto offset = Eigen::Index(icell) * os;
+    const auto stride = Eigen::Index(jump) * os;
+    MatrixXdRowMajorMap line(U.data() + offset, A.size(), U.cols(), Eigen::OuterStride<>(stride));
+    A.solveBatch(line);
+}
+
+} // namespace
+
+DiffusionSolverADI::DiffusionSolverADI()
+{}
+
+DiffusionSolverADI::DiffusionSolverADI(const StructuredGrid& grid)
+: m_grid(grid)
+{}
+
+auto DiffusionSolverADI::setGrid(const StructuredGrid& grid) -> void
+{
+    m_grid = grid;
+    m_initialized = false;
+}
+
+auto DiffusionSolverADI::setDiffusionCoeff(double val) -> void
+{
+    m_diffusion = val;
+    m_initialized = false;
+}
+
+auto DiffusionSolverADI::setTimeStep(double val) -> void
+{
+    m_dt = val;
+    m_initialized = false;
+}
+
+auto DiffusionSolverADI::initialize() -> void
+{
+    errorif(m_grid.numCells() == 0, "Could not initialize DiffusionSolverADI because the structured grid has no cells.");
+
+    assembleDirectionalMatrix(m_Ax, m_grid.nx, m_grid.dx, m_diffusion, m_dt);
+    assembleDirectionalMatrix(m_Ay, m_grid.ny, m_grid.dy, m_diffusion, m_dt);
+    assembleDirectionalMatrix(m_Az, m_grid.nz, m_grid.dz, m_diffusion, m_dt);
+
+    m_initialized = true;
+}
+
+auto DiffusionSolverADI::step(MatrixXdRowMajorRef U) const -> void
+{
+    const auto nx = m_grid.nx;
+    const auto ny = m_grid.ny;
+    const auto nz = m_grid.nz;
+
+    errorif(!m_initialized, "Could not step DiffusionSolverADI because method DiffusionSolverADI::initialize has not been called.");
+    errorif(Index(U.rows()) != m_grid.numCells(), "Could not step DiffusionSolverADI because the given matrix has ", U.rows(), " rows instead of ", m_grid.numCells(), " (the number of cells).");
+
+    if(nx > 1)
+        for(Index iz = 0; iz < nz; ++iz)
+            for(Index iy = 0; iy < ny; ++iy)
+                solveAlongLine(m_Ax, U, nx*(iy + ny*iz), 1);
+
+    if(ny > 1)
+        for(Index iz = 0; iz < nz; ++iz)
+            for(Index ix = 0; ix < nx; ++ix)
+                solveAlongLine(m_Ay, U, ix + nx*ny*iz, nx);
+
+    if(nz > 1)
+        for(Index iy = 0; iy < ny; ++iy)
+            for(Index ix = 0; ix < nx; ++ix)
+                solveAlongLine(m_Az, U, ix + nx*iy, nx*ny);
+}
+
+} // namespace Reaktoro
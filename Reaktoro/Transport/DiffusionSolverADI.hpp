@@ -0,0 +1,95 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Transport/TridiagonalMatrix.hpp>
+
+namespace Reaktoro {
+
+/// Used to describe a uniform structured grid of cells in one, two or three dimensions.
+/// The cells are numbered with `icell = ix + nx*(iy + ny*iz)`.
+struct StructuredGrid
+{
+    /// The number of cells along the x, y and z directions.
+    Index nx = 1, ny = 1, nz = 1;
+
+    /// The length of the cells along the x, y and z directions (in m).
+    double dx = 1.0, dy = 1.0, dz = 1.0;
+
+    /// Return the total number of cells in the grid.
+    auto numCells() const -> Index { return nx * ny * nz; }
+};
+
+/// Used for solving implicit diffusion of many chemical components on a structured grid.
+/// Each time step is performed with a locally one-dimensional alternating
+/// direction implicit scheme, in which `(I - Δt D δ²)` is inverted along x,
+/// then y, then z. All lines along a direction share the same tridiagonal
+/// matrix, which is factorized only once in @ref initialize. In @ref step,
+/// every line is solved for all components at once directly on the given
+/// row-major storage (cells along rows, components along columns), using
+/// strided views and thus without any copies. Zero-flux conditions are
+/// imposed on all boundaries.
+class DiffusionSolverADI
+{
+public:
+    /// Construct a default DiffusionSolverADI object.
+    DiffusionSolverADI();
+
+    /// Construct a DiffusionSolverADI object with given structured grid.
+    explicit DiffusionSolverADI(const StructuredGrid& grid);
+
+    /// Set the structured grid for the diffusion problem.
+    auto setGrid(const StructuredGrid& grid) -> void;
+
+    /// Set the diffusion coefficient for the diffusion problem (in m²/s).
+    auto setDiffusionCoeff(double val) -> void;
+
+    /// Set the time step for the diffusion problem (in s).
+    auto setTimeStep(double val) -> void;
+
+    /// Return the structured grid of the diffusion problem.
+    auto grid() const -> const StructuredGrid& { return m_grid; }
+
+    /// Assemble and factorize the tridiagonal matrices along each direction.
+    auto initialize() -> void;
+
+    /// Advance the diffusion problem by one time step.
+    /// @param[in,out] U The amounts of every component in every cell (rows are cells, columns are components).
+    auto step(MatrixXdRowMajorRef U) const -> void;
+
+private:
+    /// The structured grid of the diffusion problem.
+    StructuredGrid m_grid;
+
+    /// The diffusion coefficient (in m²/s).
+    double m_diffusion = 0.0;
+
+    /// The time step (in s).
+    double m_dt = 0.0;
+
+    /// The factorized tridiagonal matrices along the x, y and z directions.
+    TridiagonalMatrix m_Ax, m_Ay, m_Az;
+
+    /// The flag indicating whether method @ref initialize has been called after the last change in the setup.
+    bool m_initialized = false;
+};
+
+} // namespace Reaktoro
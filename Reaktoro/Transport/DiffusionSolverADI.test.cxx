@@ -0,0 +1,90 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Transport/DiffusionSolverADI.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing DiffusionSolverADI", "[DiffusionSolverADI]")
+{
+    const auto D = 1.0e-9;  // diffusion coefficient (in m2/s)
+    const auto dt = 1.0e+5; // time step (in s)
+    const auto m = 5;       // the number of chemical components
+
+    SECTION("Testing one-dimensional grid against an explicitly assembled tridiagonal matrix")
+    {
+        StructuredGrid grid;
+        grid.nx = 15;
+        grid.dx = 0.01;
+
+        DiffusionSolverADI solver(grid);
+        solver.setDiffusionCoeff(D);
+        solver.setTimeStep(dt);
+        solver.initialize();
+
+        const MatrixXdRowMajor U0 = MatrixXd::Random(grid.nx, m).cwiseAbs();
+        MatrixXdRowMajor U = U0;
+        solver.step(U);
+
+        const auto beta = D*dt/(grid.dx*grid.dx);
+        const auto n = grid.nx;
+
+        MatrixXd A = zeros(n, n);
+        for(auto i = 0; i < n; ++i)
+        {
+            A(i, i) = 1.0 + 2.0*beta;
+            if(i > 0) A(i, i - 1) = -beta;
+            if(i < n - 1) A(i, i + 1) = -beta;
+        }
+        A(0, 0) = A(n - 1, n - 1) = 1.0 + beta;
+
+        CHECK( (A*U - U0).norm() == Approx(0.0).margin(1e-12) );
+    }
+
+    SECTION("Testing conservation of amounts on two- and three-dimensional grids")
+    {
+        StructuredGrid grid;
+        grid.nx = 6;
+        grid.ny = 4;
+        grid.nz = GENERATE(1, 3);
+        grid.dx = 0.01;
+        grid.dy = 0.02;
+        grid.dz = 0.03;
+
+        DiffusionSolverADI solver(grid);
+        solver.setDiffusionCoeff(D);
+        solver.setTimeStep(dt);
+        solver.initialize();
+
+        MatrixXdRowMajor U = zeros(grid.numCells(), m);
+        U.row(0).setConstant(1.0); // put all amounts in the first cell
+
+        const RowVectorXd totals0 = U.colwise().sum();
+
+        for(auto k = 0; k < 10; ++k)
+            solver.step(U);
+
+        const RowVectorXd totals = U.colwise().sum();
+
+        CHECK( (totals - totals0).norm() == Approx(0.0).margin(1e-12) );
+        CHECK( U.minCoeff() > 0.0 ); // amounts have spread to every cell
+        CHECK( U(0, 0) < 1.0 );
+    }
+}
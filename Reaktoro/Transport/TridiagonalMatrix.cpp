@@ -0,0 +1,138 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#include "TridiagonalMatrix.hpp"
+
+// C++ includes
+#include <cassert>
+
+// Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
+
+namespace Reaktoro {
+
+TridiagonalMatrix::TridiagonalMatrix()
+: TridiagonalMatrix(0)
+{}
+
+TridiagonalMatrix::TridiagonalMatrix(Index size)
+{
+    resize(size);
+}
+
+auto TridiagonalMatrix::resize(Index size) -> void
+{
+    m_a = zeros(size);
+    m_b = zeros(size);
+    m_c = zeros(size);
+    m_l = zeros(size);
+    m_uinv = zeros(size);
+    m_factorized = false;
+}
+
+auto TridiagonalMatrix::setRow(Index i, double a, double b, double c) -> void
+{
+    assert(i < size());
+    m_a[i] = a;
+    m_b[i] = b;
+    m_c[i] = c;
+    m_factorized = false;
+}
+
+auto TridiagonalMatrix::factorize() -> void
+{
+    const auto n = size();
+
+    if(n == 0)
+        return;
+
+    errorif(m_b[0] == 0.0, "Could not factorize the tridiagonal matrix because of a zero pivot at row 0.");
+
+    m_l[0] = 0.0;
+    m_uinv[0] = 1.0/m_b[0];
+
+    for(Index i = 1; i < n; ++i)
+    {
+        m_l[i] = m_a[i] * m_uinv[i - 1]; // the multiplier eliminating a[i] using the previous pivot row
+        const auto u = m_b[i] - m_l[i] * m_c[i - 1]; // the pivot on the current row
+        errorif(u == 0.0, "Could not factorize the tridiagonal matrix because of a zero pivot at row ", i, ".");
+        m_uinv[i] = 1.0/u;
+    }
+
+    m_factorized = true;
+}
+
+auto TridiagonalMatrix::solve(VectorXdRef x) const -> void
+{
+    const auto n = size();
+
+    errorif(!m_factorized, "Could not solve the tridiagonal system because method TridiagonalMatrix::factorize has not been called.");
+    errorif(Index(x.size()) != n, "Could not solve the tridiagonal system because the right-hand side has ", x.size(), " entries instead of ", n, ".");
+
+    if(n == 0)
+        return;
+
+    for(Index i = 1; i < n; ++i)
+        x[i] -= m_l[i] * x[i - 1];
+
+    x[n - 1] *= m_uinv[n - 1];
+
+    for(Index k = 2; k <= n; ++k)
+    {
+        const auto i = n - k;
+        x[i] = (x[i] - m_c[i] * x[i + 1]) * m_uinv[i];
+    }
+}
+
+auto TridiagonalMatrix::solveBatch(MatrixXdRowMajorRef X) const -> void
+{
+    const auto n = size();
+
+    errorif(!m_factorized, "Could not solve the tridiagonal system because method TridiagonalMatrix::factorize has not been called.");
+    errorif(Index(X.rows()) != n, "Could not solve the tridiagonal system because the right-hand side matrix has ", X.rows(), " rows instead of ", n, ".");
+
+    if(n == 0)
+        return;
+
+    // Each row of X is contiguous in memory, so the operations below are
+    // vectorized across all right-hand sides (e.g., chemical components).
+    for(Index i = 1; i < n; ++i)
+        X.row(i) -= m_l[i] * X.row(i - 1);
+
+    X.row(n - 1) *= m_uinv[n - 1];
+
+    for(Index k = 2; k <= n; ++k)
+    {
+        const auto i = n - k;
+        X.row(i) = (X.row(i) - m_c[i] * X.row(i + 1)) * m_uinv[i];
+    }
+}
+
+TridiagonalMatrix::operator MatrixXd() const
+{
+    const auto n = size();
+    MatrixXd res = zeros(n, n);
+    for(Index i = 0; i < n; ++i)
+    {
+        if(i > 0) res(i, i - 1) = m_a[i];
+        res(i, i) = m_b[i];
+        if(i < n - 1) res(i, i + 1) = m_c[i];
+    }
+    return res;
+}
+
+} // namespace Reaktoro
@@ -0,0 +1,117 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Common/Matrix.hpp>
+
+namespace Reaktoro {
+
+/// Used to represent a tridiagonal matrix whose LU factors are shared among many right-hand sides.
+/// The matrix is stored as three diagonals `a` (lower), `b` (main) and `c`
+/// (upper), all of length `n`, with `a[0]` and `c[n-1]` being ignored. Once
+/// @ref factorize is called, the LU factors can be used to solve `A x = d`
+/// for a single vector with @ref solve or for many right-hand sides at once
+/// with @ref solveBatch. In the latter case, the right-hand sides are the columns of
+/// a row-major matrix `X` (e.g., rows are cells and columns are chemical
+/// components), so that each elimination step updates a contiguous row and
+/// is vectorized across all components. No pivoting is performed, which is
+/// appropriate for the diagonally dominant matrices of implicit transport.
+class TridiagonalMatrix
+{
+public:
+    /// Construct a default TridiagonalMatrix object.
+    TridiagonalMatrix();
+
+    /// Construct a TridiagonalMatrix object with given dimension.
+    explicit TridiagonalMatrix(Index size);
+
+    /// Resize this tridiagonal matrix (its coefficients are not preserved).
+    auto resize(Index size) -> void;
+
+    /// Return the dimension of this tridiagonal matrix.
+    auto size() const -> Index { return m_a.size(); }
+
+    /// Return the lower diagonal of this tridiagonal matrix (with `a[0]` ignored).
+    /// The current LU factors are discarded, since the coefficients may be changed via the returned reference.
+    auto a() -> VectorXdRef { m_factorized = false; return m_a; }
+
+    /// Return the lower diagonal of this tridiagonal matrix (with `a[0]` ignored).
+    auto a() const -> VectorXdConstRef { return m_a; }
+
+    /// Return the main diagonal of this tridiagonal matrix.
+    /// The current LU factors are discarded, since the coefficients may be changed via the returned reference.
+    auto b() -> VectorXdRef { m_factorized = false; return m_b; }
+
+    /// Return the main diagonal of this tridiagonal matrix.
+    auto b() const -> VectorXdConstRef { return m_b; }
+
+    /// Return the upper diagonal of this tridiagonal matrix (with `c[n-1]` ignored).
+    /// The current LU factors are discarded, since the coefficients may be changed via the returned reference.
+    auto c() -> VectorXdRef { m_factorized = false; return m_c; }
+
+    /// Return the upper diagonal of this tridiagonal matrix (with `c[n-1]` ignored).
+    auto c() const -> VectorXdConstRef { return m_c; }
+
+    /// Set the coefficients `a`, `b`, `c` on the `i`-th row of this tridiagonal matrix.
+    auto setRow(Index i, double a, double b, double c) -> void;
+
+    /// Compute the LU factors of this tridiagonal matrix for subsequent calls to @ref solve and @ref solveBatch.
+    /// This method must be called again whenever the coefficients are changed via @ref a, @ref b, @ref c or @ref setRow.
+    /// References returned by @ref a, @ref b and @ref c before this call must not be used to change the coefficients afterwards.
+    auto factorize() -> void;
+
+    /// Return true if @ref factorize has been called after the last change in the coefficients.
+    auto factorized() const -> bool { return m_factorized; }
+
+    /// Solve the linear system `A x = d` in place, with `x` containing `d` on entry.
+    auto solve(VectorXdRef x) const -> void;
+
+    /// Solve the linear systems `A X = D` in place, with `X` containing `D` on entry.
+    /// The rows of `X` correspond to the rows of this tridiagonal matrix and
+    /// its columns are the right-hand sides (e.g., the chemical components).
+    /// The outer stride of `X` can be larger than its number of columns,
+    /// which permits solving directly on a block of a larger row-major
+    /// storage (e.g., every `k`-th cell of a structured grid) without copies.
+    auto solveBatch(MatrixXdRowMajorRef X) const -> void;
+
+    /// Convert this tridiagonal matrix into a dense matrix (using its original coefficients).
+    operator MatrixXd() const;
+
+private:
+    /// The lower diagonal of the tridiagonal matrix.
+    VectorXd m_a;
+
+    /// The main diagonal of the tridiagonal matrix.
+    VectorXd m_b;
+
+    /// The upper diagonal of the tridiagonal matrix.
+    VectorXd m_c;
+
+    /// The multipliers of the unit lower bidiagonal factor `L`.
+    VectorXd m_l;
+
+    /// The reciprocals of the diagonal entries of the upper bidiagonal factor `U`.
+    VectorXd m_uinv;
+
+    /// The flag indicating whether the LU factors are up to date.
+    bool m_factorized = false;
+};
+
+} // namespace Reaktoro
@@ -0,0 +1,102 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// C++ includes
+#include <utility>
+
+// Reaktoro includes
+#include <Reaktoro/Transport/TridiagonalMatrix.hpp>
+using namespace Reaktoro;
+
+TEST_CASE("Testing TridiagonalMatrix", "[TridiagonalMatrix]")
+{
+    const auto n = GENERATE(1, 2, 7, 20);
+
+    INFO("n = " << n);
+
+    TridiagonalMatrix A(n);
+
+    for(auto i = 0; i < n; ++i)
+        A.setRow(i, -1.0 - 0.1*i, 4.0 + 0.2*i, -1.5 + 0.05*i);
+
+    A.factorize();
+
+    const MatrixXd Adense = A;
+
+    SECTION("Testing method TridiagonalMatrix::solve")
+    {
+        const VectorXd d = random(n);
+        VectorXd x = d;
+        A.solve(x);
+        CHECK( (Adense*x - d).norm() == Approx(0.0).margin(1e-12) );
+    }
+
+    SECTION("Testing method TridiagonalMatrix::solveBatch")
+    {
+        const auto m = 13; // the number of right-hand sides (e.g., chemical components)
+
+        const MatrixXdRowMajor D = MatrixXd::Random(n, m);
+        MatrixXdRowMajor X = D;
+        A.solveBatch(X);
+
+        for(auto j = 0; j < m; ++j)
+        {
+            VectorXd x = D.col(j);
+            A.solve(x);
+            CHECK( (X.col(j) - x).norm() == Approx(0.0).margin(1e-12) );
+        }
+    }
+
+    SECTION("Testing method TridiagonalMatrix::solveBatch with a block of a larger storage")
+    {
+        MatrixXdRowMajor S = MatrixXd::Random(n, 10);
+        const MatrixXdRowMajor S0 = S;
+
+        A.solveBatch(S.middleCols(3, 4)); // solve only for the columns 3, 4, 5, 6 in place
+
+        CHECK( S.leftCols(3) == S0.leftCols(3) );
+        CHECK( S.rightCols(3) == S0.rightCols(3) );
+        CHECK( (Adense*S.middleCols(3, 4) - S0.middleCols(3, 4)).norm() == Approx(0.0).margin(1e-12) );
+    }
+
+    SECTION("Testing that changing the coefficients discards the LU factors")
+    {
+        CHECK( A.factorized() );
+
+        A.b() *= 2.0;
+
+        CHECK_FALSE( A.factorized() );
+
+        VectorXd x = random(n);
+        CHECK_THROWS( A.solve(x) );
+
+        A.factorize();
+
+        const MatrixXd Bdense = A;
+        const VectorXd d = random(n);
+        x = d;
+        A.solve(x);
+        CHECK( (Bdense*x - d).norm() == Approx(0.0).margin(1e-12) );
+
+        std::as_const(A).a(); // read-only access keeps the LU factors
+
+        CHECK( A.factorized() );
+    }
+}
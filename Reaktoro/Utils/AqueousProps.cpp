@@ -19,6 +19,7 @@
 
 // C++ includes
 #include <fstream>
+#include <mutex>
 
 // cpp-tabulate includes
 #include <tabulate/table.hpp>
@@ -32,6 +33,7 @@ using namespace tabulate;
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Enumerate.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Common/Warnings.hpp>
 #include <Reaktoro/Core/ChemicalProps.hpp>
 #include <Reaktoro/Core/ChemicalState.hpp>
@@ -46,6 +48,13 @@ using namespace tabulate;
 namespace Reaktoro {
 namespace {
 
+/// A mutex that can be a member of a copyable object (the copy gets its own unlocked mutex).
+struct CopyableMutex : std::mutex
+{
+    CopyableMutex() = default;
+    CopyableMutex(CopyableMutex const&) : std::mutex() {}
+};
+
 /// Return the index of the first aqueous phase in the system.
 auto indexAqueousPhase(ChemicalSystem const& system) -> Index
 {
@@ -65,19 +74,50 @@ auto indexAqueousPhase(ChemicalSystem const& system) -> Index
 // activity model. Note: this method is relevant for computation of saturation indices.
 auto chemicalPotentialModel(Species const& species, ActivityModelGenerator const& generator) -> Fn<real(ChemicalProps const&)>
 {
-    const auto activitymodel = generator({species}); // TODO: Use .withMemoization() here to avoid full recomputations when same T and P are given.
+    const auto activitymodel = generator({species});
     const auto R = universalGasConstant;
     const auto x = ArrayXr{{1.0}}; // the mole fraction of the single species in a pure phase
     auto actprops = ActivityProps::create(1);
 
+    // The temperature and pressure (value and derivative seed) of the last evaluation and the chemical potential computed then (the activity model is evaluated at fixed composition)
+    real Tlast = NaN;
+    real Plast = NaN;
+    real ulast = NaN;
+
     return [=](ChemicalProps const& props) mutable -> real
     {
         const auto T = props.temperature();
         const auto P = props.pressure();
+        if(Memoization::isEnabled() && sameValueAndSeed(Tlast, T) && sameValueAndSeed(Plast, P))
+            return ulast;
         activitymodel(actprops, {T, P, x}); // evaluate the activity model
         const auto G0 = species.standardThermoProps(T, P).G0;
         const auto ln_a = actprops.ln_a[0];
-        return G0 + R*T*ln_a;
+        Tlast = T;
+        Plast = P;
+        ulast = G0 + R*T*ln_a;
+        return ulast;
+    };
+}
+
+// Return a chemical potential function for a non-aqueous species that depends only on temperature and pressure.
+// The function is evaluated again only when temperature or pressure (value or derivative seed) change.
+auto chemicalPotentialModelTP(Fn<real(real const&, real const&)> const& fn) -> Fn<real(ChemicalProps const&)>
+{
+    real Tlast = NaN;
+    real Plast = NaN;
+    real ulast = NaN;
+
+    return [=](ChemicalProps const& props) mutable -> real
+    {
+        const auto T = props.temperature();
+        const auto P = props.pressure();
+        if(Memoization::isEnabled() && sameValueAndSeed(Tlast, T) && sameValueAndSeed(Plast, P))
+            return ulast;
+        Tlast = T;
+        Plast = P;
+        ulast = fn(T, P);
+        return ulast;
     };
 }
 
@@ -102,24 +142,20 @@ auto defaultChemicalPotentialModel(Species const& species, ChemicalSystem const&
         };
     // Case II: when species is a gas and it does not exist in the chemical system
     else if(species.aggregateState() == AggregateState::Gas)
-        return [=](ChemicalProps const& props) -> real
+        return chemicalPotentialModelTP([=](real const& T, real const& P) -> real
         {
-            const auto T = props.temperature();
-            const auto P = props.pressure();
             const auto Pbar = P*1e-5; // from Pa to bar
             const auto RT = universalGasConstant * T;
             const auto G0 = species.standardThermoProps(T, P).G0;
             return G0 + RT*log(Pbar);
-        };
+        });
     // Case III: when species is not a gas and it does not exist in the chemical system
     else
-        return [=](ChemicalProps const& props) -> real
+        return chemicalPotentialModelTP([=](real const& T, real const& P) -> real
         {
-            const auto T = props.temperature();
-            const auto P = props.pressure();
             const auto G0 = species.standardThermoProps(T, P).G0;
             return G0;
-        };
+        });
 }
 
 // Return a vector with default chemical potential functions for every given chemical species.
@@ -162,14 +198,38 @@ struct AqueousProps::Impl
     /// The chemical properties of the system.
     ChemicalProps props;
 
+    // The properties below are computed on demand after each update and cached until the next update.
+    // Each cache is guarded by its own mutex so that const methods can be called concurrently.
+
     /// The state of the aqueous solution.
-    AqueousMixtureState aqstate;
+    mutable AqueousMixtureState aqstate;
 
     /// The amounts of the species in the aqueous phase (to be used with echelonizer - not for any computation, since it does not have autodiff propagation!).
-    VectorXd naq;
+    mutable VectorXd naq;
 
     /// The chemical potentials of the elements in the aqueous phase
-    VectorXr lambda;
+    mutable VectorXr lambda;
+
+    /// The natural log of the saturation ratios of the non-aqueous species computed since last update.
+    mutable ArrayXr lnOmega;
+
+    /// The flag indicating whether `aqstate` is consistent with the last update.
+    mutable bool aqstate_updated = false;
+
+    /// The flag indicating whether `lambda` is consistent with the last update.
+    mutable bool lambda_updated = false;
+
+    /// The flags indicating which entries in `lnOmega` are consistent with the last update.
+    mutable Vec<bool> lnOmega_updated;
+
+    /// The mutex guarding the computation of `aqstate`.
+    mutable CopyableMutex aqstate_mutex;
+
+    /// The mutex guarding the computation of `naq`, `lambda` and the use of `echelonizer`.
+    mutable CopyableMutex lambda_mutex;
+
+    /// The mutex guarding the computation of `lnOmega` and the evaluation of the chemical potential models (which cache their last result).
+    mutable CopyableMutex lnOmega_mutex;
 
     /// The non-aqueous species in the database for which saturation indices are calculated.
     SpeciesList nonaqueous;
@@ -181,7 +241,7 @@ struct AqueousProps::Impl
     MatrixXd Anon;
 
     /// The echelon form of the formula matrix `Aaqs` of the aqueous species.
-    Optima::Echelonizer echelonizer;
+    mutable Optima::Echelonizer echelonizer;
 
     /// The chemical potential models for the non-aqueous species (as if they were pure phases) for the computation of their saturation indices.
     Vec<Fn<real(ChemicalProps const&)>> chemical_potential_models;
@@ -212,11 +272,13 @@ struct AqueousProps::Impl
         // The aqueous species in the aqueous phase
         auto const& aqspecies = phase.species();
 
-        // Collect the species from the database that contains the elements in the aqueous phase
-        const auto species_same_elements = system.database().species().withElements(symbols);
-
-        // Collect the non-aqueous species from the database that contains the elements in the aqueous phase
-        nonaqueous = removefn(species_same_elements, RKT_LAMBDA(x, x.aggregateState() == AggregateState::Aqueous));
+        // Collect the non-aqueous species from the database that contains the elements in the aqueous phase (without copying the others)
+        const auto& infos = system.database().speciesInfo();
+        Indices inonaqueous;
+        for(auto i = 0; i < infos.size(); ++i)
+            if(infos[i].aggregate_state != AggregateState::Aqueous && contained(infos[i].elements, symbols))
+                inonaqueous.push_back(i);
+        nonaqueous = system.database().speciesWithIndices(inonaqueous);
 
         // Ensure non-aqueous species are sorted by aggregate state (gases, solids, etc)
         std::sort(nonaqueous.begin(), nonaqueous.end(),
@@ -230,6 +292,10 @@ struct AqueousProps::Impl
         // Initialize the chemical potential models for the non-aqueous species, as if they were pure phases
         chemical_potential_models = defaultChemicalPotentialModels(nonaqueous, system);
 
+        // Initialize the cached saturation ratios of the non-aqueous species
+        lnOmega.setConstant(nonaqueous.size(), NaN);
+        lnOmega_updated.assign(nonaqueous.size(), false);
+
         // Initialize the aqueous state properties
         aqstate.T = NaN;
         aqstate.P = NaN;
@@ -288,6 +354,25 @@ struct AqueousProps::Impl
             "present in the aqueous phase. This error will occur, for example, if you are calculating the saturation ratio of Quartz (SiO2) "
             "but the aqueous phase has no species with element Si.");
         chemical_potential_models[i] = chemicalPotentialModel(nonaqueous[i], generator);
+        lnOmega_updated[i] = false;
+    }
+
+    auto setSaturationSpecies(StringList const& names) -> void
+    {
+        Indices inon;
+        for(auto const& name : names)
+        {
+            const auto i = nonaqueous.find(name);
+            errorif(i >= nonaqueous.size(), "Could not set `", name, "` as a saturation species. "
+                "This species must be non-aqueous and exist in the list of species returned by AqueousProps::saturationSpecies.");
+            inon.push_back(i);
+        }
+
+        nonaqueous = SpeciesList(extract(nonaqueous.data(), inon));
+        Anon = Anon(Eigen::all, inon).eval();
+        chemical_potential_models = extract(chemical_potential_models, inon);
+        lnOmega = lnOmega(inon).eval();
+        lnOmega_updated = extract(lnOmega_updated, inon);
     }
 
     auto update(ChemicalState const& state) -> void
@@ -298,17 +383,42 @@ struct AqueousProps::Impl
 
     auto update(ChemicalProps const& cprops) -> void
     {
-        // Auxiliary variables
-        auto const& aqprops = cprops.phaseProps(iphase);
+        // Update the internal properties of the chemical system
+        props = cprops;
+
+        // Mark all properties computed on demand as outdated
+        aqstate_updated = false;
+        lambda_updated = false;
+        std::fill(lnOmega_updated.begin(), lnOmega_updated.end(), false);
+    }
+
+    /// Update the state of the aqueous solution, if not yet done since last update.
+    auto updateAqueousState() const -> void
+    {
+        std::lock_guard<std::mutex> lock(aqstate_mutex);
+
+        if(aqstate_updated)
+            return;
+
+        auto const& aqprops = props.phaseProps(iphase);
         auto const& T = aqprops.temperature();
         auto const& P = aqprops.pressure();
         auto const& x = aqprops.speciesMoleFractions();
 
-        // Update the internal properties of the chemical system
-        props = cprops;
+        aqsolution.update(aqstate, T, P, x);
 
-        // Update the internal aqueous state object
-        aqstate = aqsolution.state(T, P, x);
+        aqstate_updated = true;
+    }
+
+    /// Update the chemical potentials of the elements in the aqueous phase, if not yet done since last update.
+    auto updateElementChemicalPotentials() const -> void
+    {
+        std::lock_guard<std::mutex> lock(lambda_mutex);
+
+        if(lambda_updated)
+            return;
+
+        auto const& aqprops = props.phaseProps(iphase);
 
         // Update auxiliary vector naq to be used in the echelonization below
         naq = aqprops.speciesAmounts();
@@ -323,6 +433,8 @@ struct AqueousProps::Impl
         const auto Rb = R.topRows(ib.size());
         const VectorXr ub = u(ib);
         lambda = Rb.transpose() * ub;
+
+        lambda_updated = true;
     }
 
     auto temperature() const -> real
@@ -358,6 +470,7 @@ struct AqueousProps::Impl
     auto elementMolality(StringOrIndex const& symbol) const -> real
     {
         const auto idx = detail::resolveElementIndexOrRaiseError(phase, symbol);
+        updateAqueousState();
         auto const& m = aqstate.m.matrix();
         return Aaqs.row(idx) * m;
     }
@@ -365,6 +478,7 @@ struct AqueousProps::Impl
     auto elementMolalities() const -> ArrayXr
     {
         const auto E = phase.elements().size();
+        updateAqueousState();
         auto const& m = aqstate.m.matrix();
         return Aaqs.topRows(E) * m;
     }
@@ -372,21 +486,25 @@ struct AqueousProps::Impl
     auto speciesMolality(StringOrIndex const& name) const -> real
     {
         const auto idx = detail::resolveSpeciesIndexOrRaiseError(phase, name);
+        updateAqueousState();
         return aqstate.m[idx];
     }
 
     auto speciesMolalities() const -> ArrayXr
     {
+        updateAqueousState();
         return aqstate.m;
     }
 
     auto ionicStrength() const -> real
     {
+        updateAqueousState();
         return aqstate.Ie;
     }
 
     auto ionicStrengthStoichiometric() const -> real
     {
+        updateAqueousState();
         return aqstate.Is;
     }
 
@@ -399,6 +517,7 @@ struct AqueousProps::Impl
 
     auto pE() const -> real
     {
+        updateElementChemicalPotentials();
         const auto T = props.temperature();
         const auto E = phase.elements().size();
         const auto lambdaZ = lambda[E];
@@ -462,22 +581,30 @@ struct AqueousProps::Impl
             "and exist in the thermodynamic database. It must also be composed of chemical elements "
             "present in the aqueous phase. This error will occur, for example, if you are calculating "
             "the saturation ratio of Quartz (SiO2) but the aqueous phase has no species with element Si.");
+        std::lock_guard<std::mutex> lock(lnOmega_mutex);
+        return saturationRatioLn(i);
+    }
+
+    /// Return the natural log of the saturation ratio of the i-th non-aqueous species, computing it if not yet done since last update (`lnOmega_mutex` must be locked).
+    auto saturationRatioLn(Index i) const -> real
+    {
+        if(lnOmega_updated[i])
+            return lnOmega[i];
+        updateElementChemicalPotentials();
         const auto RT = universalGasConstant * props.temperature();
         const auto ui = chemical_potential_models[i](props);
         const auto li = Anon.col(i).dot(lambda);
-        const auto lnOmegai = (li - ui)/RT;
-        return lnOmegai;
+        lnOmega[i] = (li - ui)/RT;
+        lnOmega_updated[i] = true;
+        return lnOmega[i];
     }
 
     auto saturationRatiosLn() const -> ArrayXr
     {
-        const auto RT = universalGasConstant * props.temperature();
+        std::lock_guard<std::mutex> lock(lnOmega_mutex);
         const auto num_nonaqueous = nonaqueous.size();
-        ArrayXr lnOmega(num_nonaqueous);
-        lnOmega = Anon.transpose() * lambda;
         for(auto i = 0; i < num_nonaqueous; ++i)
-            lnOmega[i] -= chemical_potential_models[i](props);
-        lnOmega /= RT;
+            saturationRatioLn(i);
         return lnOmega;
     }
 };
@@ -539,6 +666,11 @@ auto AqueousProps::setActivityModel(StringOrIndex const& species, ActivityModelG
     pimpl->setActivityModel(species, generator);
 }
 
+auto AqueousProps::setSaturationSpecies(StringList const& species) -> void
+{
+    pimpl->setSaturationSpecies(species);
+}
+
 auto AqueousProps::update(ChemicalState const& state) -> void
 {
     pimpl->update(state);
@@ -19,6 +19,7 @@
 
 // Reaktoro includes
 #include <Reaktoro/Common/Matrix.hpp>
+#include <Reaktoro/Common/StringList.hpp>
 #include <Reaktoro/Common/Types.hpp>
 #include <Reaktoro/Core/ActivityModel.hpp>
 
@@ -33,6 +34,15 @@ class Species;
 class SpeciesList;
 
 /// The chemical properties of an aqueous phase.
+/// The properties are computed on demand after each update, and the computed
+/// values are reused until the next update. For example, the state of the
+/// aqueous solution (molalities and ionic strength) is only computed if one of
+/// these quantities is requested, and the saturation index of a non-aqueous
+/// species is only computed if it is requested (individually or with all
+/// others). Use @ref setSaturationSpecies to restrict the list of non-aqueous
+/// species for which saturation indices are computed. The const methods can
+/// be called concurrently from multiple threads, but not concurrently with the
+/// non-const ones (e.g., @ref update).
 class AqueousProps
 {
 public:
@@ -72,6 +82,10 @@ public:
     /// @param generator The activity model generator to be assigned for the non-aqueous species.
     auto setActivityModel(StringOrIndex const& species, ActivityModelGenerator const& generator) -> void;
 
+    /// Set the non-aqueous species for which saturation indices are calculated.
+    /// @param species The names of the non-aqueous species, which must be among the ones returned by @ref saturationSpecies.
+    auto setSaturationSpecies(StringList const& species) -> void;
+
     /// Update the aqueous properties with given chemical state of the system.
     auto update(ChemicalState const& state) -> void;
 
@@ -40,6 +40,7 @@ void exportAqueousProps(py::module& m)
         .def(py::init<const ChemicalProps&>())
         .def_static("compute", &AqueousProps::compute, "Compute an AqueousProps object with given ChemicalProps object.")
         .def("setActivityModel", &AqueousProps::setActivityModel, "Set an activity model for a non-aqueous species that will be used in the calculation of its saturation index.")
+        .def("setSaturationSpecies", &AqueousProps::setSaturationSpecies, "Set the non-aqueous species for which saturation indices are calculated.")
         .def("update", py::overload_cast<const ChemicalState&>(&AqueousProps::update), "Update the aqueous properties with given chemical state of the system.")
         .def("update", py::overload_cast<const ChemicalProps&>(&AqueousProps::update), "Update the aqueous properties with given chemical properties of the system.")
         .def("temperature", &AqueousProps::temperature, "Return the temperature of the aqueous phase (in K).")
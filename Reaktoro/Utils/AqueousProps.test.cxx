@@ -15,6 +15,9 @@
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
 
+// C++ includes
+#include <thread>
+
 // Catch includes
 #include <catch2/catch.hpp>
 
@@ -193,6 +196,111 @@ TEST_CASE("Testing AqueousProps class", "[AqueousProps]")
         CHECK( aqprops.saturationIndex("CO(g)") == Approx(0.000339846/ln10) );
     }
 
+    SECTION("Testing when the saturation species are restricted")
+    {
+        ArrayXd n = ArrayXd::Ones(num_species);
+
+        ChemicalState state(system);
+        state.setTemperature(T, "celsius");
+        state.setPressure(P, "bar");
+        state.setSpeciesAmounts(n);
+
+        aqprops.setSaturationSpecies({"CaMg(CO3)2(s)", "CO(g)"});
+
+        CHECK( aqprops.saturationSpecies().size() == 2 );
+        CHECK( aqprops.saturationSpecies()[0].name() == "CaMg(CO3)2(s)" );
+        CHECK( aqprops.saturationSpecies()[1].name() == "CO(g)"         );
+
+        CHECK_THROWS( aqprops.setSaturationSpecies({"NaCl(aq)"}) );
+
+        aqprops.update(state);
+
+        CHECK( aqprops.saturationIndex("CO(g)") == Approx(-1.500230/ln10) );
+
+        auto lnOmega = aqprops.saturationRatiosLn();
+
+        CHECK( lnOmega.size() == 2 );
+        CHECK( lnOmega[0] == Approx( 0.102009) );
+        CHECK( lnOmega[1] == Approx(-1.500230) );
+
+        // Check the properties computed on demand are refreshed after a new update
+        n[species.index("CO2(aq)")] = 10.0;
+        state.setSpeciesAmounts(n);
+
+        aqprops.update(state);
+
+        AqueousProps expected(state);
+
+        CHECK( aqprops.ionicStrength()          == Approx(expected.ionicStrength())          );
+        CHECK( aqprops.pE()                     == Approx(expected.pE())                     );
+        CHECK( aqprops.saturationIndex("CO(g)") == Approx(expected.saturationIndex("CO(g)")) );
+    }
+
+    SECTION("Testing when the temperature is seeded after an update at the same temperature")
+    {
+        const ArrayXr n = ArrayXr::Ones(num_species);
+        const real TK = T + 273.15; // in K
+        const real Pa = P * 1e+5;   // in Pa
+
+        ChemicalProps props(system);
+        props.update(TK, Pa, n);
+        aqprops.update(props);
+        aqprops.saturationRatiosLn(); // evaluate the chemical potentials of the saturation species without derivatives
+
+        real Tseeded = TK;
+        Tseeded[1] = 1.0; // same temperature value but now seeded for derivatives
+
+        props.update(Tseeded, Pa, n);
+        aqprops.update(props);
+
+        AqueousProps expected(props);
+
+        const ArrayXr lnOmega = aqprops.saturationRatiosLn();
+        const ArrayXr lnOmegaExpected = expected.saturationRatiosLn();
+
+        for(auto i = 0; i < lnOmega.size(); ++i)
+        {
+            INFO( "saturation species: " << aqprops.saturationSpecies()[i].name() );
+            CHECK( lnOmega[i][1] == Approx(lnOmegaExpected[i][1]) ); // the derivatives with respect to temperature are not lost because of the cached chemical potentials
+        }
+    }
+
+    SECTION("Testing when the properties computed on demand are requested from multiple threads")
+    {
+        ChemicalState state(system);
+        state.setTemperature(T, "celsius");
+        state.setPressure(P, "bar");
+        state.setSpeciesAmounts(1.0);
+
+        aqprops.update(state);
+
+        AqueousProps expected(state);
+
+        const auto num_threads = 4;
+
+        Vec<real> I(num_threads);
+        Vec<real> pE(num_threads);
+        Vec<ArrayXr> lnOmega(num_threads);
+
+        Vec<std::thread> threads;
+        for(auto k = 0; k < num_threads; ++k)
+            threads.emplace_back([&, k]
+            {
+                I[k] = aqprops.ionicStrength();
+                pE[k] = aqprops.pE();
+                lnOmega[k] = aqprops.saturationRatiosLn();
+            });
+        for(auto& thread : threads)
+            thread.join();
+
+        for(auto k = 0; k < num_threads; ++k)
+        {
+            CHECK( I[k] == Approx(expected.ionicStrength()) );
+            CHECK( pE[k] == Approx(expected.pE()) );
+            CHECK( lnOmega[k].isApprox(expected.saturationRatiosLn()) );
+        }
+    }
+
     SECTION("Testing static method AqueousProps::compute")
     {
         ChemicalState state(system);
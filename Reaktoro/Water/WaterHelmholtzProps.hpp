@@ -18,6 +18,8 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Index.hpp>
+#include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Real.hpp>
 
 namespace Reaktoro {
@@ -55,4 +57,71 @@ struct WaterHelmholtzProps
     real helmholtzDDD = {};
 };
 
+/// Used to store the Helmholtz free energy states of water at many temperature-density pairs.
+/// Each array has one entry per temperature-density pair, so that the states
+/// of all pairs can be evaluated at once with vectorized kernels in `double`.
+/// @see WaterHelmholtzProps
+struct WaterHelmholtzPropsArrays
+{
+    /// The specific Helmholtz free energies of water (in units of J/kg)
+    ArrayXd helmholtz;
+
+    /// The first-order partial derivatives of the specific Helmholtz free energies of water with respect to temperature
+    ArrayXd helmholtzT;
+
+    /// The first-order partial derivatives of the specific Helmholtz free energies of water with respect to density
+    ArrayXd helmholtzD;
+
+    /// The second-order partial derivatives of the specific Helmholtz free energies of water with respect to temperature
+    ArrayXd helmholtzTT;
+
+    /// The second-order partial derivatives of the specific Helmholtz free energies of water with respect to temperature and density
+    ArrayXd helmholtzTD;
+
+    /// The second-order partial derivatives of the specific Helmholtz free energies of water with respect to density
+    ArrayXd helmholtzDD;
+
+    /// The third-order partial derivatives of the specific Helmholtz free energies of water with respect to temperature
+    ArrayXd helmholtzTTT;
+
+    /// The third-order partial derivatives of the specific Helmholtz free energies of water with respect to temperature, temperature, and density
+    ArrayXd helmholtzTTD;
+
+    /// The third-order partial derivatives of the specific Helmholtz free energies of water with respect to temperature, density, and density
+    ArrayXd helmholtzTDD;
+
+    /// The third-order partial derivatives of the specific Helmholtz free energies of water with respect to density
+    ArrayXd helmholtzDDD;
+
+    /// Resize all arrays to a given number of temperature-density pairs (their values are not preserved).
+    auto resize(Index size) -> void
+    {
+        for(auto* x : { &helmholtz, &helmholtzT, &helmholtzD, &helmholtzTT, &helmholtzTD, &helmholtzDD, &helmholtzTTT, &helmholtzTTD, &helmholtzTDD, &helmholtzDDD })
+            x->resize(size);
+    }
+
+    /// Return the number of temperature-density pairs.
+    auto size() const -> Index
+    {
+        return helmholtz.size();
+    }
+
+    /// Return the Helmholtz free energy state of water at the `i`-th temperature-density pair.
+    auto operator[](Index i) const -> WaterHelmholtzProps
+    {
+        WaterHelmholtzProps res;
+        res.helmholtz    = helmholtz[i];
+        res.helmholtzT   = helmholtzT[i];
+        res.helmholtzD   = helmholtzD[i];
+        res.helmholtzTT  = helmholtzTT[i];
+        res.helmholtzTD  = helmholtzTD[i];
+        res.helmholtzDD  = helmholtzDD[i];
+        res.helmholtzTTT = helmholtzTTT[i];
+        res.helmholtzTTD = helmholtzTTD[i];
+        res.helmholtzTDD = helmholtzTDD[i];
+        res.helmholtzDDD = helmholtzDDD[i];
+        return res;
+    }
+};
+
 } // namespace Reaktoro
@@ -37,4 +37,22 @@ void exportWaterHelmholtzProps(py::module& m)
         .def_readwrite("helmholtzTDD", &WaterHelmholtzProps::helmholtzTDD)
         .def_readwrite("helmholtzDDD", &WaterHelmholtzProps::helmholtzDDD)
         ;
+
+    py::class_<WaterHelmholtzPropsArrays>(m, "WaterHelmholtzPropsArrays")
+        .def(py::init<>())
+        .def_readwrite("helmholtz", &WaterHelmholtzPropsArrays::helmholtz)
+        .def_readwrite("helmholtzT", &WaterHelmholtzPropsArrays::helmholtzT)
+        .def_readwrite("helmholtzD", &WaterHelmholtzPropsArrays::helmholtzD)
+        .def_readwrite("helmholtzTT", &WaterHelmholtzPropsArrays::helmholtzTT)
+        .def_readwrite("helmholtzTD", &WaterHelmholtzPropsArrays::helmholtzTD)
+        .def_readwrite("helmholtzDD", &WaterHelmholtzPropsArrays::helmholtzDD)
+        .def_readwrite("helmholtzTTT", &WaterHelmholtzPropsArrays::helmholtzTTT)
+        .def_readwrite("helmholtzTTD", &WaterHelmholtzPropsArrays::helmholtzTTD)
+        .def_readwrite("helmholtzTDD", &WaterHelmholtzPropsArrays::helmholtzTDD)
+        .def_readwrite("helmholtzDDD", &WaterHelmholtzPropsArrays::helmholtzDDD)
+        .def("resize", &WaterHelmholtzPropsArrays::resize)
+        .def("size", &WaterHelmholtzPropsArrays::size)
+        .def("__len__", &WaterHelmholtzPropsArrays::size)
+        .def("__getitem__", &WaterHelmholtzPropsArrays::operator[])
+        ;
 }
@@ -23,6 +23,7 @@ using std::log;
 using std::pow;
 
 // Reaktoro includes
+#include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Water/WaterHelmholtzProps.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
 
@@ -389,4 +390,271 @@ auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps
     return res;
 }
 
+auto waterHelmholtzPropsWagnerPrussBatch(ArrayXdConstRef T, ArrayXdConstRef D, WaterHelmholtzPropsArrays& res) -> void
+{
+    const auto N = T.size();
+
+    errorif(D.size() != N, "Expecting temperature and density arrays with the same size in waterHelmholtzPropsWagnerPrussBatch, but got sizes ", N, " and ", D.size(), ".");
+
+    res.resize(N);
+
+    const ArrayXd tau     = waterCriticalTemperature/T;
+    const ArrayXd delta   = D/waterCriticalDensity;
+    const ArrayXd itau    = tau.inverse();
+    const ArrayXd idelta  = delta.inverse();
+    const ArrayXd lntau   = tau.log();
+    const ArrayXd lndelta = delta.log();
+
+    //=============================================================================================
+    // The ideal-gas part of the reduced Helmholtz free energy (the derivatives with respect to
+    // delta are 1/delta, -1/delta**2 and 2/delta**3 and all mixed derivatives are zero)
+    //=============================================================================================
+    ArrayXd phio     = lndelta + no[1] + no[2]*tau + no[3]*lntau;
+    ArrayXd phio_t   = no[2] + no[3]*itau;
+    ArrayXd phio_tt  = -no[3]*itau.square();
+    ArrayXd phio_ttt = 2.0*no[3]*itau.cube();
+
+    ArrayXd ee(N), gg(N);
+
+    for(int i = 4; i <= 8; ++i)
+    {
+        const int j = i - 4;
+
+        ee = (gammao[j] * tau).exp();
+        gg = gammao[j]/(ee - 1.0);
+
+        phio     += no[i] * (1.0 - ee.inverse()).log();
+        phio_t   += no[i] * gg;
+        phio_tt  -= no[i] * ee * gg.square();
+        phio_ttt += no[i] * ee * (1.0 + ee) * gg.cube();
+    }
+
+    //=============================================================================================
+    // The polynomial (i = 1..7) and exponential (i = 8..51) terms of the residual part, whose
+    // derivatives are accumulated scaled by the powers of delta and tau of their order, e.g.,
+    // S_dt = delta*tau*sum(d2/(dd*dt) term), so that these powers are divided only once.
+    //=============================================================================================
+    ArrayXd S      = ArrayXd::Zero(N);
+    ArrayXd S_d    = ArrayXd::Zero(N);
+    ArrayXd S_t    = ArrayXd::Zero(N);
+    ArrayXd S_dd   = ArrayXd::Zero(N);
+    ArrayXd S_tt   = ArrayXd::Zero(N);
+    ArrayXd S_dt   = ArrayXd::Zero(N);
+    ArrayXd S_ddd  = ArrayXd::Zero(N);
+    ArrayXd S_ttt  = ArrayXd::Zero(N);
+    ArrayXd S_dtt  = ArrayXd::Zero(N);
+    ArrayXd S_ddt  = ArrayXd::Zero(N);
+
+    ArrayXd term(N);
+
+    for(int i = 1; i <= 7; ++i)
+    {
+        const auto di = d[i];
+        const auto ti = t[i];
+
+        term = n[i] * (di*lndelta + ti*lntau).exp(); // n*delta**d * tau**t
+
+        S     += term;
+        S_d   += di * term;
+        S_t   += ti * term;
+        S_dd  += di*(di - 1) * term;
+        S_tt  += ti*(ti - 1) * term;
+        S_dt  += di*ti * term;
+        S_ddd += di*(di - 1)*(di - 2) * term;
+        S_ttt += ti*(ti - 1)*(ti - 2) * term;
+        S_dtt += di*ti*(ti - 1) * term;
+        S_ddt += di*(di - 1)*ti * term;
+    }
+
+    // The integer powers delta**c for c = 1..6 shared by the exponential terms
+    ArrayXd deltapow[7];
+    deltapow[1] = delta;
+    for(int k = 2; k <= 6; ++k)
+        deltapow[k] = deltapow[k - 1] * delta;
+
+    ArrayXd kk(N), ck(N), kkk(N);
+
+    for(int i = 8; i <= 51; ++i)
+    {
+        const auto ci = c[i];
+        const auto di = d[i];
+        const auto ti = t[i];
+
+        const auto& dci = deltapow[static_cast<int>(ci)];
+
+        term = n[i] * (di*lndelta + ti*lntau - dci).exp(); // n*delta**d * tau**t * exp(-delta**c)
+        kk   = di - ci*dci;                                // delta * B_d/B
+        ck   = ci*ci*dci;
+        kkk  = kk*(kk - 1) - ck;                           // delta**2 * B_dd/B
+
+        S     += term;
+        S_d   += kk * term;
+        S_t   += ti * term;
+        S_dd  += kkk * term;
+        S_tt  += ti*(ti - 1) * term;
+        S_dt  += ti * kk * term;
+        S_ddd += ((kk - 1)*kkk - (kk - 1 + 2*ck)*kk - (ci - 2)*ck) * term;
+        S_ttt += ti*(ti - 1)*(ti - 2) * term;
+        S_dtt += ti*(ti - 1) * kk * term;
+        S_ddt += ti * kkk * term;
+    }
+
+    ArrayXd phir     = S;
+    ArrayXd phir_d   = S_d * idelta;
+    ArrayXd phir_t   = S_t * itau;
+    ArrayXd phir_dd  = S_dd * idelta.square();
+    ArrayXd phir_tt  = S_tt * itau.square();
+    ArrayXd phir_dt  = S_dt * idelta * itau;
+    ArrayXd phir_ddd = S_ddd * idelta.cube();
+    ArrayXd phir_ttt = S_ttt * itau.cube();
+    ArrayXd phir_dtt = S_dtt * idelta * itau.square();
+    ArrayXd phir_ddt = S_ddt * idelta.square() * itau;
+
+    //=============================================================================================
+    // The Gaussian (i = 52..54) terms of the residual part
+    //=============================================================================================
+    for(int i = 52; i <= 54; ++i)
+    {
+        const int j = i - 52;
+
+        const ArrayXd aux1d = d[i]*idelta - 2*alpha[j]*(delta - epsilon[j]);
+        const ArrayXd aux1t = t[i]*itau - 2*beta[j]*(tau - gamma[j]);
+
+        const ArrayXd aux2d = d[i]*idelta.square() + 2*alpha[j];
+        const ArrayXd aux2t = t[i]*itau.square() + 2*beta[j];
+
+        const ArrayXd C    = n[i] * (d[i]*lndelta + t[i]*lntau - alpha[j]*(delta - epsilon[j]).square() - beta[j]*(tau - gamma[j]).square()).exp();
+        const ArrayXd C_d  = aux1d * C;
+        const ArrayXd C_t  = aux1t * C;
+        const ArrayXd C_dd = aux1d * C_d - aux2d * C;
+        const ArrayXd C_tt = aux1t * C_t - aux2t * C;
+        const ArrayXd C_dt = aux1d * aux1t * C;
+
+        phir     += C;
+        phir_d   += C_d;
+        phir_t   += C_t;
+        phir_dd  += C_dd;
+        phir_tt  += C_tt;
+        phir_dt  += C_dt;
+        phir_ddd += aux1d * C_dd - 2*aux2d * C_d + 2*d[i]*idelta.cube() * C;
+        phir_ttt += aux1t * C_tt - 2*aux2t * C_t + 2*t[i]*itau.cube() * C;
+        phir_dtt += aux1t * C_dt - aux2t * C_d;
+        phir_ddt += aux1d * C_dt - aux2d * C_t;
+    }
+
+    //=============================================================================================
+    // The non-analytic (i = 55..56) terms of the residual part
+    //=============================================================================================
+    const ArrayXd delta1 = delta - 1;
+    const ArrayXd tau1   = tau - 1;
+    const ArrayXd dd     = delta1.square();
+    const ArrayXd tt     = tau1.square();
+
+    for(int i = 55; i <= 56; ++i)
+    {
+        const int j = i - 55;
+
+        const ArrayXd theta     = (1 - tau) + A[j]*dd.pow(0.5/E[j]);
+        const ArrayXd theta_d   = (theta + tau1)/delta1/E[j];
+        const ArrayXd theta_dd  = (1.0/E[j] - 1) * theta_d/delta1;
+        const ArrayXd theta_ddd = (1.0/E[j] - 1) * (theta_dd/delta1 - theta_d/dd);
+
+        const ArrayXd psi     = (-C[j]*dd - F[j]*tt).exp();
+        const ArrayXd psi_d   = -2*C[j]*delta1 * psi;
+        const ArrayXd psi_t   = -2*F[j]*tau1 * psi;
+        const ArrayXd psi_dd  = -2*C[j]*(psi + delta1 * psi_d);
+        const ArrayXd psi_tt  = -2*F[j]*(psi + tau1 * psi_t);
+        const ArrayXd psi_dt  =  4*C[j]*F[j]*delta1*tau1 * psi;
+        const ArrayXd psi_ddd = -2*C[j]*(2*psi_d + delta1 * psi_dd);
+        const ArrayXd psi_ttt = -2*F[j]*(2*psi_t + tau1 * psi_tt);
+        const ArrayXd psi_dtt = -2*F[j]*(psi_d + tau1 * psi_dt);
+        const ArrayXd psi_ddt = -2*C[j]*(psi_t + delta1 * psi_dt);
+
+        // The derivatives Delta_tt = 2 and Delta_ttt = Delta_dtt = 0 are used directly below
+        const ArrayXd Delta     = theta.square() + B[j]*dd.pow(a[j]);
+        const ArrayXd Delta_d   = 2*(theta*theta_d + a[j]*(Delta - theta.square())/delta1);
+        const ArrayXd Delta_t   = -2*theta;
+        const ArrayXd Delta_dd  = 2*(theta_d.square() + theta*theta_dd + a[j] * ((Delta_d - 2*theta*theta_d)/delta1 - (Delta - theta.square())/dd));
+        const ArrayXd Delta_dt  = -2*theta_d;
+        const ArrayXd Delta_ddd = 2*(3*theta_d*theta_dd + theta*theta_ddd + a[j] * ((Delta_dd - 2*theta_d.square() - 2*theta*theta_dd)/delta1 - 2*(Delta_d - 2*theta*theta_d)/dd + 2*(Delta - theta.square())/(dd*delta1)));
+        const ArrayXd Delta_ddt = -2*theta_dd;
+
+        const auto bj = b[j];
+        const auto b1 = bj*(bj - 1);
+        const auto b2 = bj*(bj - 1)*(bj - 2);
+
+        const ArrayXd iDelta = Delta.inverse();
+        const ArrayXd Delta_d_ = Delta_d * iDelta;
+        const ArrayXd Delta_t_ = Delta_t * iDelta;
+
+        const ArrayXd DeltaPow     =  Delta.pow(bj);
+        const ArrayXd DeltaPow_d   =  bj*Delta_d_ * DeltaPow;
+        const ArrayXd DeltaPow_t   =  bj*Delta_t_ * DeltaPow;
+        const ArrayXd DeltaPow_dd  = (bj*Delta_dd*iDelta + b1*Delta_d_.square()) * DeltaPow;
+        const ArrayXd DeltaPow_tt  = (bj*2*iDelta + b1*Delta_t_.square()) * DeltaPow;
+        const ArrayXd DeltaPow_dt  = (bj*Delta_dt*iDelta + b1*Delta_d_*Delta_t_) * DeltaPow;
+        const ArrayXd DeltaPow_ddd = (bj*Delta_ddd*iDelta + 3*b1*Delta_d_*Delta_dd*iDelta + b2*Delta_d_.cube()) * DeltaPow;
+        const ArrayXd DeltaPow_ttt = (3*b1*Delta_t_*2*iDelta + b2*Delta_t_.cube()) * DeltaPow;
+        const ArrayXd DeltaPow_dtt = (b1*(Delta_d*2 + 2*Delta_t*Delta_dt)*iDelta.square() + b2*Delta_t_.square()*Delta_d_) * DeltaPow;
+        const ArrayXd DeltaPow_ddt = (bj*Delta_ddt*iDelta + b1*(Delta_t*Delta_dd + 2*Delta_d*Delta_dt)*iDelta.square() + b2*Delta_d_.square()*Delta_t_) * DeltaPow;
+
+        phir     += n[i]*DeltaPow*delta*psi;
+        phir_d   += n[i]*(DeltaPow*(psi + delta*psi_d) + DeltaPow_d*delta*psi);
+        phir_t   += n[i]*delta*(DeltaPow_t*psi + DeltaPow*psi_t);
+        phir_dd  += n[i]*(DeltaPow*(2*psi_d + delta*psi_dd) + 2*DeltaPow_d*(psi + delta*psi_d) + DeltaPow_dd*delta*psi);
+        phir_tt  += n[i]*delta*(DeltaPow_tt*psi + 2*DeltaPow_t*psi_t + DeltaPow*psi_tt);
+        phir_dt  += n[i]*(DeltaPow*(psi_t + delta*psi_dt) + delta*DeltaPow_d*psi_t + DeltaPow_t*(psi + delta*psi_d) + DeltaPow_dt*delta*psi);
+        phir_ddd += n[i]*(DeltaPow_ddd*delta*psi + 3*DeltaPow_dd*(psi + delta*psi_d) + 3*DeltaPow_d*(2*psi_d + delta*psi_dd) + DeltaPow*(3*psi_dd + delta*psi_ddd));
+        phir_ttt += n[i]*delta*(DeltaPow_ttt*psi + 3*DeltaPow_tt*psi_t + 3*DeltaPow_t*psi_tt + DeltaPow*psi_ttt);
+        phir_dtt += n[i]*(DeltaPow_tt*psi + 2*DeltaPow_t*psi_t + DeltaPow*psi_tt) + n[i]*delta*(DeltaPow_dtt*psi + DeltaPow_tt*psi_d + 2*DeltaPow_dt*psi_t + 2*DeltaPow_t*psi_dt + DeltaPow_d*psi_tt + DeltaPow*psi_dtt);
+        phir_ddt += n[i]*(DeltaPow_ddt*delta*psi + 2*DeltaPow_dt*(psi + delta*psi_d) + DeltaPow_dd*delta*psi_t + DeltaPow_t*(2*psi_d + delta*psi_dd) + 2*DeltaPow_d*(psi_t + delta*psi_dt) + DeltaPow*(2*psi_dt + delta*psi_ddt));
+    }
+
+    const ArrayXd phi     = phio + phir;
+    const ArrayXd phi_d   = idelta + phir_d;
+    const ArrayXd phi_t   = phio_t + phir_t;
+    const ArrayXd phi_dd  = phir_dd - idelta.square();
+    const ArrayXd phi_tt  = phio_tt + phir_tt;
+    const ArrayXd phi_dt  = phir_dt;
+    const ArrayXd phi_ddd = phir_ddd + 2*idelta.cube();
+    const ArrayXd phi_ttt = phio_ttt + phir_ttt;
+    const ArrayXd phi_dtt = phir_dtt;
+    const ArrayXd phi_ddt = phir_ddt;
+
+    const auto Tcr = waterCriticalTemperature;
+    const auto Dcr = waterCriticalDensity;
+
+    const ArrayXd iT   = T.inverse();
+    const ArrayXd tT   = -Tcr*iT.square();
+    const ArrayXd tTT  =  2*Tcr*iT.cube();
+    const ArrayXd tTTT = -6*Tcr*iT.square().square();
+    const auto dD      =  1/Dcr;
+
+    const ArrayXd phiT   = phi_t*tT;
+    const ArrayXd phiD   = phi_d*dD;
+    const ArrayXd phiTT  = phi_tt*tT*tT + phi_t*tTT;
+    const ArrayXd phiTD  = phi_dt*tT*dD;
+    const ArrayXd phiDD  = phi_dd*dD*dD;
+    const ArrayXd phiTTT = phi_ttt*tT*tT*tT + 3*phi_tt*tT*tTT + phi_t*tTTT;
+    const ArrayXd phiTTD = phi_dtt*tT*tT*dD + phi_dt*tTT*dD;
+    const ArrayXd phiTDD = phi_ddt*tT*dD*dD;
+    const ArrayXd phiDDD = phi_ddd*dD*dD*dD;
+
+    // The specific gas constant in units of J/(kg*K)
+    const auto R = 461.51805;
+
+    const ArrayXd RT = R*T;
+
+    res.helmholtz    = RT*phi;
+    res.helmholtzT   = RT*phiT + R*phi;
+    res.helmholtzD   = RT*phiD;
+    res.helmholtzTT  = RT*phiTT + 2*R*phiT;
+    res.helmholtzTD  = RT*phiTD + R*phiD;
+    res.helmholtzDD  = RT*phiDD;
+    res.helmholtzTTT = RT*phiTTT + 3*R*phiTT;
+    res.helmholtzTTD = RT*phiTTD + 2*R*phiTD;
+    res.helmholtzTDD = RT*phiTDD + R*phiDD;
+    res.helmholtzDDD = RT*phiDDD;
+}
+
 } // namespace Reaktoro
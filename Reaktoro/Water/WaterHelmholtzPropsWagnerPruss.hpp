@@ -18,12 +18,14 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Real.hpp>
 
 namespace Reaktoro {
 
 // Forward declarations
 struct WaterHelmholtzProps;
+struct WaterHelmholtzPropsArrays;
 
 /// Calculate the Helmholtz free energy state of water using the Wagner and Pruss (1995) equation of state
 /// @param T The temperature of water (in units of K)
@@ -32,4 +34,17 @@ struct WaterHelmholtzProps;
 /// @see WaterHelmholtzProps
 auto waterHelmholtzPropsWagnerPruss(real T, real D) -> WaterHelmholtzProps;
 
+/// Calculate the Helmholtz free energy states of water at many temperature-density pairs using the Wagner and Pruss (1995) equation of state.
+/// The pairs are evaluated all at once in `double`, term by term, with each
+/// term computed for all pairs over contiguous arrays (vectorized). The powers
+/// of the reduced density and inverse reduced temperature in the polynomial,
+/// exponential and Gaussian terms are fused into a single exponential of their
+/// logarithms, and the derivatives of the polynomial and exponential terms are
+/// accumulated with coefficients that depend only on the term exponents.
+/// @param T The temperatures of water (in units of K)
+/// @param D The densities of water (in units of kg/m3)
+/// @param[out] res The Helmholtz free energy states of water at each temperature-density pair
+/// @see WaterHelmholtzPropsArrays
+auto waterHelmholtzPropsWagnerPrussBatch(ArrayXdConstRef T, ArrayXdConstRef D, WaterHelmholtzPropsArrays& res) -> void;
+
 } // namespace Reaktoro
@@ -26,4 +26,11 @@ using namespace Reaktoro;
 void exportWaterHelmholtzPropsWagnerPruss(py::module& m)
 {
     m.def("waterHelmholtzPropsWagnerPruss", waterHelmholtzPropsWagnerPruss);
+
+    m.def("waterHelmholtzPropsWagnerPrussBatch", [](ArrayXdConstRef T, ArrayXdConstRef D)
+    {
+        WaterHelmholtzPropsArrays res;
+        waterHelmholtzPropsWagnerPrussBatch(T, D, res);
+        return res;
+    });
 }
@@ -0,0 +1,60 @@
+// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Catch includes
+#include <catch2/catch.hpp>
+
+// Reaktoro includes
+#include <Reaktoro/Water/WaterHelmholtzProps.hpp>
+#include <Reaktoro/Water/WaterHelmholtzPropsWagnerPruss.hpp>
+using namespace Reaktoro;
+
+// The margin accounts for round-off in the cancellation of the terms of the Helmholtz free energy (of order 1e6 J/kg) near the triple point
+#define CHECK_HELMHOLTZ_PROP(prop) CHECK( hbatch.prop[i] == Approx(h.prop.val()).epsilon(1e-10).margin(1e-7) )
+
+TEST_CASE("Testing waterHelmholtzPropsWagnerPrussBatch", "[WaterHelmholtzPropsWagnerPruss]")
+{
+    // Liquid, vapor and supercritical states, including points near the critical point
+    const ArrayXd T = ArrayXd{{ 273.16, 298.15, 373.15, 473.15, 573.15, 647.0, 650.0, 773.15, 1273.15, 298.15, 473.15, 773.15 }};
+    const ArrayXd D = ArrayXd{{ 999.8, 997.0, 958.4, 864.7, 712.1, 300.0, 330.0, 50.0, 100.0, 0.02, 2.5, 1200.0 }};
+
+    WaterHelmholtzPropsArrays hbatch;
+
+    waterHelmholtzPropsWagnerPrussBatch(T, D, hbatch);
+
+    REQUIRE( hbatch.size() == T.size() );
+
+    for(auto i = 0; i < T.size(); ++i)
+    {
+        INFO("T = " << T[i] << " K, D = " << D[i] << " kg/m3");
+
+        const auto h = waterHelmholtzPropsWagnerPruss(T[i], D[i]);
+
+        CHECK_HELMHOLTZ_PROP(helmholtz);
+        CHECK_HELMHOLTZ_PROP(helmholtzT);
+        CHECK_HELMHOLTZ_PROP(helmholtzD);
+        CHECK_HELMHOLTZ_PROP(helmholtzTT);
+        CHECK_HELMHOLTZ_PROP(helmholtzTD);
+        CHECK_HELMHOLTZ_PROP(helmholtzDD);
+        CHECK_HELMHOLTZ_PROP(helmholtzTTT);
+        CHECK_HELMHOLTZ_PROP(helmholtzTTD);
+        CHECK_HELMHOLTZ_PROP(helmholtzTDD);
+        CHECK_HELMHOLTZ_PROP(helmholtzDDD);
+    }
+
+    CHECK_THROWS( waterHelmholtzPropsWagnerPrussBatch(T, D.head(3), hbatch) );
+}
@@ -18,175 +18,267 @@
 #include "WaterInterpolation.hpp"
 
 // C++ includes
-#include <sstream>
+#include <algorithm>
+#include <iterator>
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
 #include <Reaktoro/Common/InterpolationUtils.hpp>
-#include <Reaktoro/Core/Embedded.hpp>
+#include <Reaktoro/Water/WaterInterpolationData.hpp>
 #include <Reaktoro/Water/WaterThermoProps.hpp>
 
 namespace Reaktoro {
 
+namespace {
+
+using namespace detail;
+
 /// The pressures for interpolation of water properties (in MPa).
 /// Pressures are the same used in Table 13.2 of *Wagner, W., Pruss, A. (2002). The IAPWS
 /// Formulation 1995 for the Thermodynamic Properties of Ordinary Water Substance for General and
 /// Scientific Use. Journal of Physical and Chemical Reference Data, 31(2), 387.
 /// https://doi.org/10.1063/1.1461829*.
-const Vec<double> pressures = { 0.05, 0.1, 0.101325, 0.25, 0.5, 0.75, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 10, 12.5, 15.0, 17.5, 20.0, 22.5, 25.0, 30.0, 40.0, 50.0, 75.0, 100, 200, 400, 600, 800, 1000 };
+const auto& pressures = waterInterpPressures;
 
-/// The temperatures for interpolation of water properties (in K).
-/// Temperatures are the same used in Table 13.2 of *Wagner, W., Pruss, A. (2002). The IAPWS
-/// Formulation 1995 for the Thermodynamic Properties of Ordinary Water Substance for General and
-/// Scientific Use. Journal of Physical and Chemical Reference Data, 31(2), 387.
-/// https://doi.org/10.1063/1.1461829*.
-const Vec<Vec<double>> temperatures =
+/// The number of pressures for interpolation of water properties.
+constexpr auto numpressures = std::size(waterInterpPressures);
+
+/// The total number of temperature-pressure points for interpolation of water properties.
+constexpr auto numpoints = waterInterpOffsets[numpressures];
+
+/// The density of water (tentatively at the liquid state even when water is stable as vapor) at the temperatures and pressures used for interpolation (in kg/m3).
+/// Density values obtained from running the script generate-water-liquid-vapor-density-for-interpolation-wagner-pruss.py and copying its liquid density and pasting below.
+constexpr double densities_liquid[] =
 {
-    { 273.156, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 354.467, 354.467, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 273.153, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 372.756, 372.756, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 273.153, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 373.124, 373.124, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 273.142, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 400.561, 400.561, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 273.123, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 424.981, 424.981, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 273.105, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 440.899, 440.899, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 273.086, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 453.028, 453.028, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 273.012, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 485.527, 485.527, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 272.938, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 507.003, 507.003, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 272.863, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 523.504, 523.504, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 272.788, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 537.091, 537.091, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 272.713, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 548.735, 548.735, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 272.638, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 558.979, 558.979, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 272.562, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 568.158, 568.158, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 272.410, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 584.147, 584.147, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 272.218, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 600.963, 600.963, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 272.025, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 615.305, 615.305, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 271.830, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 627.821, 627.821, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 271.633, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 638.899, 638.899, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 271.435, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 271.235, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 270.829, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 269.997, 270.000, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 269.134, 270.000, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 266.843, 270.000, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 264.347, 265.000, 270.000, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 252.462, 255.000, 260.000, 265.000, 270.000, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 259.820, 260.000, 265.000, 270.000, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 271.691, 275.000, 280.000, 285.000, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 286.725, 290.000, 295.000, 300.000, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
-    { 300.243, 305.000, 310.000, 315.000, 320.000, 325.000, 330.000, 335.000, 340.000, 345.000, 350.000, 355.000, 360.000, 365.000, 370.000, 375.000, 380.000, 385.000, 390.000, 395.000, 400.000, 410.000, 420.000, 430.000, 440.000, 450.000, 460.000, 470.000, 480.000, 490.000, 500.000, 510.000, 520.000, 530.000, 540.000, 550.000, 560.000, 570.000, 580.000, 590.000, 600.000, 610.000, 620.000, 630.000, 640.000, 650.000, 675.000, 700.000, 725.000, 750.000, 775.000, 800.000, 825.000, 850.000, 900.000, 950.000, 1000.000, 1050.000, 1100.000, 1150.000, 1200.000, 1250.000, 1273.000 },
+    // P = 0.05 MPa
+    9.998174e+02, 9.999122e+02, 9.998860e+02, 9.994930e+02, 9.987801e+02, 9.977841e+02, 9.965339e+02, 9.950531e+02, 9.933610e+02, 9.914736e+02, 9.894044e+02, 9.871648e+02, 9.847644e+02, 9.822115e+02, 9.795135e+02, 9.766764e+02, 9.737056e+02, 9.709421e+02, 9.709421e+02, 9.706056e+02, 9.673806e+02, 9.640338e+02, 9.605682e+02, 9.569861e+02, 9.532896e+02, 9.494803e+02, 9.455593e+02, 9.415275e+02, 9.373853e+02, 9.287704e+02, 9.197117e+02, 9.102008e+02, 9.002236e+02, 8.897600e+02, 8.787824e+02, 8.672550e+02, 8.551321e+02, 8.423549e+02, 8.288484e+02, 8.145151e+02, 7.992266e+02, 7.828085e+02, 7.650159e+02, 7.454862e+02, 7.236426e+02, 6.984614e+02, 6.677430e+02, 6.238842e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 1.667973e-01, 1.606036e-01, 1.548548e-01, 1.495044e-01, 1.445123e-01, 1.398434e-01, 1.354673e-01, 1.313572e-01, 1.274895e-01, 1.204002e-01, 1.140585e-01, 1.083519e-01, 1.031896e-01, 9.849703e-02, 9.421292e-02, 9.028610e-02, 8.667365e-02, 8.510727e-02,
+    // P = 0.1 MPa
+    9.998426e+02, 9.999373e+02, 9.999104e+02, 9.995167e+02, 9.988033e+02, 9.978068e+02, 9.965563e+02, 9.950753e+02, 9.933830e+02, 9.914955e+02, 9.894263e+02, 9.871866e+02, 9.847862e+02, 9.822334e+02, 9.795355e+02, 9.766985e+02, 9.737279e+02, 9.706281e+02, 9.674033e+02, 9.640568e+02, 9.605914e+02, 9.586315e+02, 9.586315e+02, 9.570097e+02, 9.533136e+02, 9.495046e+02, 9.455840e+02, 9.415527e+02, 9.374111e+02, 9.287972e+02, 9.197397e+02, 9.102303e+02, 9.002548e+02, 8.897930e+02, 8.788176e+02, 8.672927e+02, 8.551727e+02, 8.423990e+02, 8.288965e+02, 8.145682e+02, 7.992858e+02, 7.828754e+02, 7.650928e+02, 7.455767e+02, 7.237528e+02, 6.986032e+02, 6.679464e+02, 6.243076e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 3.338417e-01, 3.214130e-01, 3.098821e-01, 2.991542e-01, 2.891477e-01, 2.797915e-01, 2.710240e-01, 2.627910e-01, 2.550448e-01, 2.408493e-01, 2.281536e-01, 2.167315e-01, 2.063999e-01, 1.970097e-01, 1.884375e-01, 1.805809e-01, 1.733536e-01, 1.702199e-01,
+    // P = 0.101325 MPa
+    9.998433e+02, 9.999379e+02, 9.999110e+02, 9.995173e+02, 9.988039e+02, 9.978074e+02, 9.965569e+02, 9.950759e+02, 9.933836e+02, 9.914961e+02, 9.894268e+02, 9.871872e+02, 9.847868e+02, 9.822340e+02, 9.795361e+02, 9.766991e+02, 9.737284e+02, 9.706287e+02, 9.674039e+02, 9.640574e+02, 9.605921e+02, 9.583677e+02, 9.583677e+02, 9.570103e+02, 9.533142e+02, 9.495053e+02, 9.455847e+02, 9.415534e+02, 9.374118e+02, 9.287980e+02, 9.197405e+02, 9.102310e+02, 9.002556e+02, 8.897939e+02, 8.788185e+02, 8.672937e+02, 8.551738e+02, 8.424001e+02, 8.288978e+02, 8.145696e+02, 7.992874e+02, 7.828772e+02, 7.650949e+02, 7.455791e+02, 7.237557e+02, 6.986069e+02, 6.679517e+02, 6.243188e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 3.382718e-01, 3.256773e-01, 3.139927e-01, 3.031219e-01, 2.929822e-01, 2.835016e-01, 2.746175e-01, 2.662750e-01, 2.584259e-01, 2.440418e-01, 2.311776e-01, 2.196039e-01, 2.091353e-01, 1.996205e-01, 1.909347e-01, 1.829738e-01, 1.756507e-01, 1.724755e-01,
+    // P = 0.25 MPa
+    9.999182e+02, 1.000013e+03, 9.999833e+02, 9.995877e+02, 9.988728e+02, 9.978751e+02, 9.966237e+02, 9.951419e+02, 9.934491e+02, 9.915613e+02, 9.894918e+02, 9.872520e+02, 9.848517e+02, 9.822991e+02, 9.796015e+02, 9.767649e+02, 9.737947e+02, 9.706956e+02, 9.674715e+02, 9.641258e+02, 9.606613e+02, 9.570805e+02, 9.533855e+02, 9.495777e+02, 9.456584e+02, 9.416284e+02, 9.374882e+02, 9.370168e+02, 9.370168e+02, 9.288777e+02, 9.198239e+02, 9.103187e+02, 9.003481e+02, 8.898920e+02, 8.789230e+02, 8.674057e+02, 8.552945e+02, 8.425310e+02, 8.290409e+02, 8.147274e+02, 7.994632e+02, 7.830758e+02, 7.653231e+02, 7.458476e+02, 7.240824e+02, 6.990268e+02, 6.685519e+02, 6.255474e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 8.364699e-01, 8.050845e-01, 7.760048e-01, 7.489799e-01, 7.237954e-01, 7.002662e-01, 6.782321e-01, 6.575531e-01, 6.381065e-01, 6.024909e-01, 5.706594e-01, 5.420359e-01, 5.161560e-01, 4.926418e-01, 4.711817e-01, 4.515172e-01, 4.334313e-01, 4.255903e-01,
+    // P = 0.5 MPa
+    1.000044e+03, 1.000138e+03, 1.000105e+03, 9.997060e+02, 9.989886e+02, 9.979889e+02, 9.967358e+02, 9.952529e+02, 9.935592e+02, 9.916707e+02, 9.896009e+02, 9.873610e+02, 9.849608e+02, 9.824086e+02, 9.797114e+02, 9.768755e+02, 9.739062e+02, 9.708080e+02, 9.675851e+02, 9.642406e+02, 9.607777e+02, 9.571985e+02, 9.535052e+02, 9.496994e+02, 9.457821e+02, 9.417544e+02, 9.376167e+02, 9.290116e+02, 9.199640e+02, 9.152901e+02, 9.152901e+02, 9.104660e+02, 9.005036e+02, 8.900568e+02, 8.790986e+02, 8.675938e+02, 8.554971e+02, 8.427508e+02, 8.292810e+02, 8.149921e+02, 7.997582e+02, 7.834089e+02, 7.657056e+02, 7.462971e+02, 7.246287e+02, 6.997270e+02, 6.695472e+02, 6.275222e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 1.679236e+00, 1.615397e+00, 1.556380e+00, 1.501635e+00, 1.450698e+00, 1.403172e+00, 1.358716e+00, 1.317033e+00, 1.277868e+00, 1.206211e+00, 1.142239e+00, 1.084764e+00, 1.032833e+00, 9.856754e-01, 9.426565e-01, 9.032512e-01, 8.670200e-01, 8.513154e-01,
+    // P = 0.75 MPa
+    1.000170e+03, 1.000263e+03, 1.000226e+03, 9.998243e+02, 9.991043e+02, 9.981026e+02, 9.968480e+02, 9.953638e+02, 9.936692e+02, 9.917802e+02, 9.897100e+02, 9.874700e+02, 9.850699e+02, 9.825180e+02, 9.798213e+02, 9.769860e+02, 9.740175e+02, 9.709204e+02, 9.676986e+02, 9.643555e+02, 9.608939e+02, 9.573164e+02, 9.536249e+02, 9.498210e+02, 9.459058e+02, 9.418804e+02, 9.377451e+02, 9.291454e+02, 9.201041e+02, 9.106131e+02, 9.006589e+02, 8.997406e+02, 8.997406e+02, 8.902214e+02, 8.792740e+02, 8.677816e+02, 8.556994e+02, 8.429701e+02, 8.295206e+02, 8.152561e+02, 8.000522e+02, 7.837407e+02, 7.660865e+02, 7.467442e+02, 7.251710e+02, 7.004201e+02, 6.705255e+02, 6.293973e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 2.528446e+00, 2.431040e+00, 2.341198e+00, 2.258019e+00, 2.180747e+00, 2.108746e+00, 2.041471e+00, 1.978456e+00, 1.919295e+00, 1.811166e+00, 1.714742e+00, 1.628186e+00, 1.550033e+00, 1.479102e+00, 1.414425e+00, 1.355202e+00, 1.300766e+00, 1.277175e+00,
+    // P = 1.0 MPa
+    1.000296e+03, 1.000389e+03, 1.000348e+03, 9.999425e+02, 9.992200e+02, 9.982162e+02, 9.969600e+02, 9.954746e+02, 9.937792e+02, 9.918895e+02, 9.898190e+02, 9.875789e+02, 9.851789e+02, 9.826273e+02, 9.799311e+02, 9.770965e+02, 9.741288e+02, 9.710327e+02, 9.678120e+02, 9.644702e+02, 9.610101e+02, 9.574342e+02, 9.537444e+02, 9.499424e+02, 9.460294e+02, 9.420062e+02, 9.378733e+02, 9.292790e+02, 9.202439e+02, 9.107601e+02, 9.008139e+02, 8.903858e+02, 8.871293e+02, 8.871293e+02, 8.794491e+02, 8.679691e+02, 8.559013e+02, 8.431890e+02, 8.297596e+02, 8.155195e+02, 8.003454e+02, 7.840714e+02, 7.664657e+02, 7.471889e+02, 7.257095e+02, 7.011062e+02, 6.714878e+02, 6.311863e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 3.384255e+00, 3.252120e+00, 3.130535e+00, 3.018184e+00, 2.913980e+00, 2.817015e+00, 2.726519e+00, 2.641836e+00, 2.562399e+00, 2.417364e+00, 2.288173e+00, 2.172304e+00, 2.067756e+00, 1.972921e+00, 1.886486e+00, 1.807370e+00, 1.734670e+00, 1.703170e+00,
+    // P = 2.0 MPa
+    1.000798e+03, 1.000889e+03, 1.000832e+03, 1.000415e+03, 9.996820e+02, 9.986702e+02, 9.974077e+02, 9.959174e+02, 9.942184e+02, 9.923264e+02, 9.902545e+02, 9.880139e+02, 9.856143e+02, 9.830639e+02, 9.803696e+02, 9.775377e+02, 9.745733e+02, 9.714811e+02, 9.682650e+02, 9.649283e+02, 9.614740e+02, 9.579045e+02, 9.542218e+02, 9.504275e+02, 9.465227e+02, 9.425085e+02, 9.383853e+02, 9.298124e+02, 9.208019e+02, 9.113463e+02, 9.014324e+02, 8.910412e+02, 8.801469e+02, 8.687160e+02, 8.567053e+02, 8.497988e+02, 8.497988e+02, 8.440600e+02, 8.307103e+02, 8.165660e+02, 8.015093e+02, 7.853823e+02, 7.679662e+02, 7.489439e+02, 7.278263e+02, 7.037848e+02, 6.751885e+02, 6.376637e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 6.876710e+00, 6.593041e+00, 6.334623e+00, 6.097765e+00, 5.879552e+00, 5.677628e+00, 5.490063e+00, 5.315248e+00, 5.151827e+00, 4.854707e+00, 4.591245e+00, 4.355779e+00, 4.143907e+00, 3.952143e+00, 3.777677e+00, 3.618215e+00, 3.471862e+00, 3.408497e+00,
+    // P = 3.0 MPa
+    1.001300e+03, 1.001388e+03, 1.001316e+03, 1.000886e+03, 1.000143e+03, 9.991232e+02, 9.978543e+02, 9.963593e+02, 9.946567e+02, 9.927622e+02, 9.906890e+02, 9.884480e+02, 9.860488e+02, 9.834995e+02, 9.808071e+02, 9.779777e+02, 9.750166e+02, 9.719283e+02, 9.687167e+02, 9.653852e+02, 9.619366e+02, 9.583735e+02, 9.546977e+02, 9.509110e+02, 9.470144e+02, 9.430091e+02, 9.388954e+02, 9.303438e+02, 9.213577e+02, 9.119299e+02, 9.020479e+02, 8.916931e+02, 8.808407e+02, 8.694581e+02, 8.575036e+02, 8.449242e+02, 8.316524e+02, 8.219006e+02, 8.219006e+02, 8.176017e+02, 8.026594e+02, 7.866749e+02, 7.694416e+02, 7.506628e+02, 7.298868e+02, 7.063653e+02, 6.786786e+02, 6.433363e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 1.048838e+01, 1.003023e+01, 9.617437e+00, 9.242389e+00, 8.899319e+00, 8.583723e+00, 8.292008e+00, 8.021249e+00, 7.769032e+00, 7.312447e+00, 6.909452e+00, 6.550558e+00, 6.228527e+00, 5.937704e+00, 5.673588e+00, 5.432540e+00, 5.211576e+00, 5.115980e+00,
+    // P = 4.0 MPa
+    1.001802e+03, 1.001886e+03, 1.001799e+03, 1.001356e+03, 1.000603e+03, 9.995753e+02, 9.983001e+02, 9.968002e+02, 9.950941e+02, 9.931972e+02, 9.911225e+02, 9.888810e+02, 9.864822e+02, 9.839340e+02, 9.812435e+02, 9.784167e+02, 9.754588e+02, 9.723744e+02, 9.691672e+02, 9.658408e+02, 9.623980e+02, 9.588411e+02, 9.551722e+02, 9.513930e+02, 9.475046e+02, 9.435080e+02, 9.394038e+02, 9.308733e+02, 9.219113e+02, 9.125110e+02, 9.026604e+02, 8.923417e+02, 8.815306e+02, 8.701956e+02, 8.582963e+02, 8.457816e+02, 8.325862e+02, 8.186271e+02, 8.037961e+02, 7.983678e+02, 7.983678e+02, 7.879500e+02, 7.708931e+02, 7.523473e+02, 7.318948e+02, 7.088568e+02, 6.819871e+02, 6.484322e+02, 5.951743e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 1.423186e+01, 1.357203e+01, 1.298463e+01, 1.245597e+01, 1.197604e+01, 1.153727e+01, 1.113378e+01, 1.076088e+01, 1.041478e+01, 9.791003e+00, 9.243023e+00, 8.756768e+00, 8.321682e+00, 7.929638e+00, 7.574237e+00, 7.250352e+00, 6.953811e+00, 6.825614e+00,
+    // P = 5.0 MPa
+    1.002302e+03, 1.002383e+03, 1.002280e+03, 1.001825e+03, 1.001062e+03, 1.000026e+03, 9.987449e+02, 9.972402e+02, 9.955305e+02, 9.936312e+02, 9.915551e+02, 9.893131e+02, 9.869146e+02, 9.843676e+02, 9.816789e+02, 9.788546e+02, 9.758999e+02, 9.728193e+02, 9.696166e+02, 9.662952e+02, 9.628580e+02, 9.593073e+02, 9.556453e+02, 9.518735e+02, 9.479931e+02, 9.440053e+02, 9.399104e+02, 9.314007e+02, 9.224626e+02, 9.130896e+02, 9.032701e+02, 8.929869e+02, 8.822166e+02, 8.709285e+02, 8.590836e+02, 8.466324e+02, 8.335120e+02, 8.196423e+02, 8.049199e+02, 7.892081e+02, 7.773685e+02, 7.773685e+02, 7.723215e+02, 7.539991e+02, 7.338536e+02, 7.112666e+02, 6.851369e+02, 6.530873e+02, 6.067892e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 1.812173e+01, 1.722777e+01, 1.644240e+01, 1.574273e+01, 1.511265e+01, 1.454034e+01, 1.401685e+01, 1.353520e+01, 1.308985e+01, 1.229079e+01, 1.159219e+01, 1.097453e+01, 1.042344e+01, 9.927978e+00, 9.479636e+00, 9.071651e+00, 8.698561e+00, 8.537396e+00,
+    // P = 6.0 MPa
+    1.002802e+03, 1.002879e+03, 1.002761e+03, 1.002293e+03, 1.001520e+03, 1.000477e+03, 9.991888e+02, 9.976792e+02, 9.959660e+02, 9.940643e+02, 9.919867e+02, 9.897443e+02, 9.873461e+02, 9.848001e+02, 9.821133e+02, 9.792915e+02, 9.763399e+02, 9.732630e+02, 9.700647e+02, 9.667483e+02, 9.633167e+02, 9.597722e+02, 9.561169e+02, 9.523525e+02, 9.484801e+02, 9.445009e+02, 9.404153e+02, 9.319263e+02, 9.230117e+02, 9.136657e+02, 9.038770e+02, 8.936289e+02, 8.828987e+02, 8.716569e+02, 8.598655e+02, 8.474766e+02, 8.344297e+02, 8.206476e+02, 8.060311e+02, 7.904497e+02, 7.737278e+02, 7.579981e+02, 7.579981e+02, 7.556200e+02, 7.357661e+02, 7.136015e+02, 6.881464e+02, 6.573909e+02, 6.153366e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 2.217488e+01, 2.100798e+01, 1.999756e+01, 1.910721e+01, 1.831224e+01, 1.759509e+01, 1.694275e+01, 1.634532e+01, 1.579502e+01, 1.481224e+01, 1.395717e+01, 1.320397e+01, 1.253386e+01, 1.193275e+01, 1.138979e+01, 1.089644e+01, 1.044582e+01, 1.025132e+01,
+    // P = 7.0 MPa
+    1.003301e+03, 1.003374e+03, 1.003240e+03, 1.002760e+03, 1.001978e+03, 1.000926e+03, 9.996317e+02, 9.981173e+02, 9.964006e+02, 9.944964e+02, 9.924174e+02, 9.901744e+02, 9.877765e+02, 9.852317e+02, 9.825466e+02, 9.797273e+02, 9.767788e+02, 9.737057e+02, 9.705117e+02, 9.672002e+02, 9.637741e+02, 9.602357e+02, 9.565872e+02, 9.528300e+02, 9.489656e+02, 9.449949e+02, 9.409185e+02, 9.324499e+02, 9.235587e+02, 9.142393e+02, 9.044810e+02, 8.942675e+02, 8.835771e+02, 8.723808e+02, 8.606421e+02, 8.483145e+02, 8.353397e+02, 8.216433e+02, 8.071300e+02, 7.916755e+02, 7.751129e+02, 7.572112e+02, 7.397236e+02, 7.397236e+02, 7.376351e+02, 7.158670e+02, 6.910307e+02, 6.614056e+02, 6.224177e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 2.641118e+01, 2.492459e+01, 2.365760e+01, 2.255431e+01, 2.157812e+01, 2.070379e+01, 1.991307e+01, 1.919234e+01, 1.853110e+01, 1.735575e+01, 1.633820e+01, 1.544519e+01, 1.465299e+01, 1.394398e+01, 1.330472e+01, 1.272471e+01, 1.219559e+01, 1.196737e+01,
+    // P = 8.0 MPa
+    1.003799e+03, 1.003867e+03, 1.003718e+03, 1.003226e+03, 1.002434e+03, 1.001374e+03, 1.000074e+03, 9.985546e+02, 9.968342e+02, 9.949276e+02, 9.928472e+02, 9.906037e+02, 9.882060e+02, 9.856622e+02, 9.829789e+02, 9.801620e+02, 9.772166e+02, 9.741472e+02, 9.709575e+02, 9.676509e+02, 9.642303e+02, 9.606980e+02, 9.570560e+02, 9.533061e+02, 9.494495e+02, 9.454873e+02, 9.414200e+02, 9.329716e+02, 9.241036e+02, 9.148106e+02, 9.050822e+02, 8.949030e+02, 8.842517e+02, 8.731003e+02, 8.614135e+02, 8.491462e+02, 8.362421e+02, 8.226295e+02, 8.082171e+02, 7.928859e+02, 7.764776e+02, 7.587742e+02, 7.394631e+02, 7.221957e+02, 7.221957e+02, 7.180684e+02, 6.938025e+02, 6.651772e+02, 6.285755e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 3.085415e+01, 2.899114e+01, 2.743085e+01, 2.608935e+01, 2.491379e+01, 2.386880e+01, 2.292944e+01, 2.207742e+01, 2.129891e+01, 1.992175e+01, 1.873547e+01, 1.769831e+01, 1.678090e+01, 1.596168e+01, 1.522441e+01, 1.455646e+01, 1.394785e+01, 1.368554e+01,
+    // P = 10 MPa
+    1.004794e+03, 1.004851e+03, 1.004672e+03, 1.004156e+03, 1.003343e+03, 1.002268e+03, 1.000955e+03, 9.994262e+02, 9.976988e+02, 9.957873e+02, 9.937039e+02, 9.914593e+02, 9.890622e+02, 9.865203e+02, 9.838405e+02, 9.810284e+02, 9.780890e+02, 9.750269e+02, 9.718457e+02, 9.685487e+02, 9.651388e+02, 9.616185e+02, 9.579896e+02, 9.542540e+02, 9.504129e+02, 9.464673e+02, 9.424180e+02, 9.340094e+02, 9.251869e+02, 9.159458e+02, 9.062765e+02, 8.961646e+02, 8.855900e+02, 8.745266e+02, 8.629411e+02, 8.507913e+02, 8.380247e+02, 8.245746e+02, 8.103569e+02, 7.952627e+02, 7.791486e+02, 7.618204e+02, 7.430047e+02, 7.222960e+02, 6.990495e+02, 6.884241e+02, 6.884241e+02, 6.721233e+02, 6.390876e+02, 5.918565e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 4.047886e+01, 3.763853e+01, 3.535487e+01, 3.344674e+01, 3.180969e+01, 3.037789e+01, 2.910718e+01, 2.796648e+01, 2.693300e+01, 2.512288e+01, 2.357961e+01, 2.224065e+01, 2.106319e+01, 2.001659e+01, 1.907811e+01, 1.823037e+01, 1.745981e+01, 1.712821e+01,
+    // P = 12.5 MPa
+    1.006033e+03, 1.006074e+03, 1.005858e+03, 1.005311e+03, 1.004475e+03, 1.003380e+03, 1.002051e+03, 1.000511e+03, 9.987744e+02, 9.968567e+02, 9.947697e+02, 9.925235e+02, 9.901269e+02, 9.875875e+02, 9.849118e+02, 9.821055e+02, 9.791735e+02, 9.761202e+02, 9.729494e+02, 9.696642e+02, 9.662676e+02, 9.627618e+02, 9.591490e+02, 9.554308e+02, 9.516086e+02, 9.476835e+02, 9.436561e+02, 9.352963e+02, 9.265295e+02, 9.173517e+02, 9.077544e+02, 8.977242e+02, 8.872428e+02, 8.762860e+02, 8.648229e+02, 8.528147e+02, 8.402129e+02, 8.269570e+02, 8.129704e+02, 7.981554e+02, 7.823850e+02, 7.654899e+02, 7.472367e+02, 7.272894e+02, 7.051352e+02, 6.799228e+02, 6.500386e+02, 6.468076e+02, 6.468076e+02, 6.115335e+02, 5.331214e+02, 4.945548e+02, 4.425148e+02, 5.432590e+01, 4.962472e+01, 4.608487e+01, 4.325173e+01, 4.089396e+01, 3.887801e+01, 3.711989e+01, 3.556340e+01, 3.416897e+01, 3.175810e+01, 2.972984e+01, 2.798722e+01, 2.646614e+01, 2.512189e+01, 2.392202e+01, 2.284216e+01, 2.186357e+01, 2.144324e+01,
+    // P = 15.0 MPa
+    1.007268e+03, 1.007291e+03, 1.007038e+03, 1.006461e+03, 1.005600e+03, 1.004486e+03, 1.003142e+03, 1.001590e+03, 9.998443e+02, 9.979205e+02, 9.958297e+02, 9.935819e+02, 9.911858e+02, 9.886486e+02, 9.859769e+02, 9.831762e+02, 9.802514e+02, 9.772068e+02, 9.740461e+02, 9.707724e+02, 9.673887e+02, 9.638972e+02, 9.603001e+02, 9.565990e+02, 9.527953e+02, 9.488901e+02, 9.448841e+02, 9.365719e+02, 9.278594e+02, 9.187433e+02, 9.092160e+02, 8.992652e+02, 8.888741e+02, 8.780203e+02, 8.666751e+02, 8.548028e+02, 8.423589e+02, 8.292876e+02, 8.155197e+02, 8.009670e+02, 7.855166e+02, 7.690198e+02, 7.512757e+02, 7.320026e+02, 7.107848e+02, 6.869671e+02, 6.594072e+02, 6.257473e+02, 6.035199e+02, 6.035199e+02, 5.788581e+02, 4.945548e+02, 4.425148e+02, 7.118580e+01, 6.333707e+01, 5.794182e+01, 5.384969e+01, 5.056403e+01, 4.782595e+01, 4.548363e+01, 4.344073e+01, 4.163230e+01, 3.854785e+01, 3.598840e+01, 3.381126e+01, 3.192515e+01, 3.026797e+01, 2.879555e+01, 2.747529e+01, 2.628241e+01, 2.577100e+01,
+    // P = 17.5 MPa
+    1.008498e+03, 1.008500e+03, 1.008211e+03, 1.007605e+03, 1.006720e+03, 1.005586e+03, 1.004227e+03, 1.002663e+03, 1.000909e+03, 9.989787e+02, 9.968840e+02, 9.946346e+02, 9.922388e+02, 9.897038e+02, 9.870359e+02, 9.842407e+02, 9.813229e+02, 9.782867e+02, 9.751358e+02, 9.718734e+02, 9.685023e+02, 9.650248e+02, 9.614430e+02, 9.577586e+02, 9.539730e+02, 9.500872e+02, 9.461023e+02, 9.378365e+02, 9.291769e+02, 9.201210e+02, 9.106618e+02, 9.007882e+02, 8.904846e+02, 8.797304e+02, 8.684990e+02, 8.567574e+02, 8.444645e+02, 8.315694e+02, 8.180088e+02, 8.037032e+02, 7.885515e+02, 7.724228e+02, 7.551427e+02, 7.364723e+02, 7.160697e+02, 6.934177e+02, 6.676711e+02, 6.372714e+02, 5.986164e+02, 5.546652e+02, 5.546652e+02, 5.364441e+02, 4.425148e+02, 9.322429e+01, 7.947183e+01, 7.123026e+01, 6.539625e+01, 6.090735e+01, 5.727385e+01, 5.423083e+01, 5.161932e+01, 4.933668e+01, 4.549820e+01, 4.235791e+01, 3.971381e+01, 3.744048e+01, 3.545473e+01, 3.369844e+01, 3.212941e+01, 3.071600e+01, 3.011116e+01,
+    // P = 20.0 MPa
+    1.009724e+03, 1.009703e+03, 1.009378e+03, 1.008743e+03, 1.007834e+03, 1.006681e+03, 1.005307e+03, 1.003731e+03, 1.001968e+03, 1.000031e+03, 9.979328e+02, 9.956817e+02, 9.932861e+02, 9.907531e+02, 9.880889e+02, 9.852990e+02, 9.823879e+02, 9.793600e+02, 9.762187e+02, 9.729673e+02, 9.696085e+02, 9.661447e+02, 9.625779e+02, 9.589098e+02, 9.551419e+02, 9.512752e+02, 9.473107e+02, 9.390903e+02, 9.304825e+02, 9.214851e+02, 9.120922e+02, 9.022936e+02, 8.920750e+02, 8.814171e+02, 8.702956e+02, 8.586798e+02, 8.465318e+02, 8.338049e+02, 8.204413e+02, 8.063689e+02, 7.914972e+02, 7.757099e+02, 7.588551e+02, 7.407281e+02, 7.210440e+02, 6.993864e+02, 6.751089e+02, 6.471129e+02, 6.132290e+02, 5.676445e+02, 4.902055e+02, 4.902055e+02, 4.660584e+02, 1.264857e+02, 9.922039e+01, 8.638009e+01, 7.808826e+01, 7.202671e+01, 6.728001e+01, 6.339638e+01, 6.012078e+01, 5.729581e+01, 5.261480e+01, 4.884071e+01, 4.569563e+01, 4.301221e+01, 4.068191e+01, 3.863030e+01, 3.680412e+01, 3.516393e+01, 3.446335e+01,
+    // P = 22.5 MPa
+    1.010946e+03, 1.010899e+03, 1.010539e+03, 1.009875e+03, 1.008942e+03, 1.007770e+03, 1.006381e+03, 1.004793e+03, 1.003021e+03, 1.001079e+03, 9.989761e+02, 9.967231e+02, 9.943276e+02, 9.917966e+02, 9.891360e+02, 9.863511e+02, 9.834467e+02, 9.804268e+02, 9.772949e+02, 9.740542e+02, 9.707075e+02, 9.672570e+02, 9.637049e+02, 9.600528e+02, 9.563021e+02, 9.524541e+02, 9.485097e+02, 9.403336e+02, 9.317763e+02, 9.228361e+02, 9.135078e+02, 9.037821e+02, 8.936459e+02, 8.830814e+02, 8.720660e+02, 8.605714e+02, 8.485625e+02, 8.359964e+02, 8.228202e+02, 8.089686e+02, 7.943599e+02, 7.788907e+02, 7.624276e+02, 7.447941e+02, 7.257499e+02, 7.049544e+02, 6.819004e+02, 6.557778e+02, 6.251491e+02, 5.869270e+02, 5.313893e+02, 3.714391e+02, 1.248674e+02, 1.040183e+02, 9.217762e+01, 8.404311e+01, 7.790914e+01, 7.301728e+01, 6.896721e+01, 6.552324e+01, 5.990292e+01, 5.543868e+01, 5.175720e+01, 4.864018e+01, 4.594910e+01, 4.359064e+01, 4.149893e+01, 3.962574e+01, 3.882710e+01,
+    // P = 25.0 MPa
+    1.012163e+03, 1.012088e+03, 1.011693e+03, 1.011000e+03, 1.010045e+03, 1.008854e+03, 1.007450e+03, 1.005850e+03, 1.004069e+03, 1.002120e+03, 1.000014e+03, 9.977591e+02, 9.953636e+02, 9.928343e+02, 9.901772e+02, 9.873973e+02, 9.844993e+02, 9.814872e+02, 9.783645e+02, 9.751343e+02, 9.717994e+02, 9.683620e+02, 9.648242e+02, 9.611877e+02, 9.574540e+02, 9.536242e+02, 9.496993e+02, 9.415667e+02, 9.330586e+02, 9.241742e+02, 9.149088e+02, 9.052541e+02, 8.951979e+02, 8.847240e+02, 8.738112e+02, 8.624334e+02, 8.505582e+02, 8.381461e+02, 8.251486e+02, 8.115063e+02, 7.971454e+02, 7.819735e+02, 7.658728e+02, 7.486902e+02, 7.302210e+02, 7.101827e+02, 6.881690e+02, 6.635626e+02, 6.353495e+02, 6.016355e+02, 5.579797e+02, 4.888479e+02, 1.615977e+02, 1.250920e+02, 1.079863e+02, 9.709792e+01, 8.923223e+01, 8.313217e+01, 7.818086e+01, 7.403213e+01, 6.736725e+01, 6.215329e+01, 5.789868e+01, 5.432402e+01, 5.125575e+01, 4.857886e+01, 4.621324e+01, 4.410090e+01, 4.320192e+01,
+    // P = 30.0 MPa
+    1.014586e+03, 1.014447e+03, 1.013983e+03, 1.013234e+03, 1.012233e+03, 1.011005e+03, 1.009571e+03, 1.007948e+03, 1.006149e+03, 1.004188e+03, 1.002074e+03, 9.998147e+02, 9.974190e+02, 9.948930e+02, 9.922423e+02, 9.894719e+02, 9.865862e+02, 9.835892e+02, 9.804843e+02, 9.772744e+02, 9.739622e+02, 9.705501e+02, 9.670401e+02, 9.634339e+02, 9.597330e+02, 9.559385e+02, 9.520515e+02, 9.440027e+02, 9.355899e+02, 9.268131e+02, 9.176688e+02, 9.081505e+02, 8.982477e+02, 8.879467e+02, 8.772294e+02, 8.660732e+02, 8.544507e+02, 8.423279e+02, 8.296642e+02, 8.164100e+02, 8.025045e+02, 7.878734e+02, 7.724235e+02, 7.560374e+02, 7.385630e+02, 7.197994e+02, 6.994734e+02, 6.771996e+02, 6.524086e+02, 6.242028e+02, 5.910111e+02, 5.496409e+02, 3.325171e+02, 1.842362e+02, 1.465147e+02, 1.269950e+02, 1.142706e+02, 1.050030e+02, 9.779601e+01, 9.194265e+01, 8.283961e+01, 7.593573e+01, 7.042025e+01, 6.585664e+01, 6.198437e+01, 5.863598e+01, 5.569772e+01, 5.308891e+01, 5.198255e+01,
+    // P = 40.0 MPa
+    1.019382e+03, 1.019381e+03, 1.019085e+03, 1.018490e+03, 1.017633e+03, 1.016543e+03, 1.015242e+03, 1.013750e+03, 1.012080e+03, 1.010247e+03, 1.008261e+03, 1.006130e+03, 1.003863e+03, 1.001465e+03, 9.989448e+02, 9.963056e+02, 9.935525e+02, 9.906896e+02, 9.877207e+02, 9.846488e+02, 9.814769e+02, 9.782075e+02, 9.748430e+02, 9.713851e+02, 9.678358e+02, 9.641964e+02, 9.604682e+02, 9.566524e+02, 9.487607e+02, 9.405260e+02, 9.319498e+02, 9.230308e+02, 9.137648e+02, 9.041449e+02, 8.941610e+02, 8.837999e+02, 8.730450e+02, 8.618761e+02, 8.502684e+02, 8.381925e+02, 8.256132e+02, 8.124886e+02, 7.987683e+02, 7.843921e+02, 7.692865e+02, 7.533616e+02, 7.365055e+02, 7.185771e+02, 6.993956e+02, 6.787247e+02, 6.562491e+02, 6.315359e+02, 6.039681e+02, 5.154824e+02, 3.830212e+02, 2.646496e+02, 2.069828e+02, 1.760340e+02, 1.562968e+02, 1.422661e+02, 1.315795e+02, 1.160083e+02, 1.049029e+02, 9.638940e+01, 8.954988e+01, 8.387274e+01, 7.904615e+01, 7.486698e+01, 7.119602e+01, 6.964959e+01,
+    // P = 50.0 MPa
+    1.024113e+03, 1.024067e+03, 1.023621e+03, 1.022901e+03, 1.021941e+03, 1.020765e+03, 1.019395e+03, 1.017846e+03, 1.016132e+03, 1.014265e+03, 1.012253e+03, 1.010106e+03, 1.007829e+03, 1.005429e+03, 1.002913e+03, 1.000283e+03, 9.975455e+02, 9.947032e+02, 9.917598e+02, 9.887182e+02, 9.855812e+02, 9.823511e+02, 9.790303e+02, 9.756205e+02, 9.721236e+02, 9.685410e+02, 9.648739e+02, 9.611236e+02, 9.533765e+02, 9.453052e+02, 9.369124e+02, 9.281985e+02, 9.191614e+02, 9.097964e+02, 9.000967e+02, 8.900527e+02, 8.796522e+02, 8.688802e+02, 8.577185e+02, 8.461456e+02, 8.341361e+02, 8.216602e+02, 8.086829e+02, 7.951632e+02, 7.810530e+02, 7.662952e+02, 7.508220e+02, 7.345520e+02, 7.173870e+02, 6.992073e+02, 6.798668e+02, 6.591852e+02, 6.369399e+02, 5.724985e+02, 4.910329e+02, 3.948506e+02, 3.099351e+02, 2.537562e+02, 2.180703e+02, 1.938882e+02, 1.763137e+02, 1.520343e+02, 1.356158e+02, 1.234808e+02, 1.139850e+02, 1.062569e+02, 9.978588e+01, 9.424991e+01, 8.943402e+01, 8.741749e+01,
+    // P = 75.0 MPa
+    1.035675e+03, 1.035311e+03, 1.034531e+03, 1.033530e+03, 1.032334e+03, 1.030961e+03, 1.029428e+03, 1.027747e+03, 1.025927e+03, 1.023976e+03, 1.021903e+03, 1.019713e+03, 1.017411e+03, 1.015002e+03, 1.012491e+03, 1.009880e+03, 1.007173e+03, 1.004374e+03, 1.001485e+03, 9.985089e+02, 9.954475e+02, 9.923031e+02, 9.890778e+02, 9.857733e+02, 9.823911e+02, 9.789326e+02, 9.753993e+02, 9.717922e+02, 9.643607e+02, 9.566447e+02, 9.486492e+02, 9.403770e+02, 9.318294e+02, 9.230061e+02, 9.139049e+02, 9.045223e+02, 8.948531e+02, 8.848905e+02, 8.746263e+02, 8.640502e+02, 8.531509e+02, 8.419148e+02, 8.303268e+02, 8.183697e+02, 8.060243e+02, 7.932691e+02, 7.800804e+02, 7.664315e+02, 7.522934e+02, 7.376341e+02, 7.224185e+02, 7.066088e+02, 6.901648e+02, 6.460069e+02, 5.970435e+02, 5.431697e+02, 4.859275e+02, 4.291799e+02, 3.775639e+02, 3.342222e+02, 2.994701e+02, 2.500002e+02, 2.174557e+02, 1.944393e+02, 1.771357e+02, 1.635139e+02, 1.524136e+02, 1.431262e+02, 1.351940e+02, 1.319110e+02,
+    // P = 100 MPa
+    1.046869e+03, 1.046776e+03, 1.045924e+03, 1.044863e+03, 1.043620e+03, 1.042218e+03, 1.040672e+03, 1.038993e+03, 1.037191e+03, 1.035274e+03, 1.033247e+03, 1.031115e+03, 1.028883e+03, 1.026555e+03, 1.024134e+03, 1.021622e+03, 1.019024e+03, 1.016341e+03, 1.013576e+03, 1.010730e+03, 1.007807e+03, 1.004808e+03, 1.001735e+03, 9.985895e+02, 9.953728e+02, 9.920866e+02, 9.887321e+02, 9.853107e+02, 9.818234e+02, 9.746552e+02, 9.672349e+02, 9.595680e+02, 9.516590e+02, 9.435111e+02, 9.351261e+02, 9.265048e+02, 9.176470e+02, 9.085511e+02, 8.992149e+02, 8.896351e+02, 8.798075e+02, 8.697269e+02, 8.593876e+02, 8.487826e+02, 8.379047e+02, 8.267459e+02, 8.152972e+02, 8.035495e+02, 7.914929e+02, 7.791170e+02, 7.664116e+02, 7.533657e+02, 7.399691e+02, 7.262117e+02, 6.901849e+02, 6.517742e+02, 6.110746e+02, 5.685166e+02, 5.250603e+02, 4.822269e+02, 4.416603e+02, 4.046580e+02, 3.436137e+02, 2.986056e+02, 2.654456e+02, 2.403167e+02, 2.206230e+02, 2.047123e+02, 1.915258e+02, 1.803659e+02, 1.757761e+02,
+    // P = 200 MPa
+    1.087977e+03, 1.087461e+03, 1.086210e+03, 1.084721e+03, 1.083060e+03, 1.081269e+03, 1.079378e+03, 1.077407e+03, 1.075366e+03, 1.073263e+03, 1.071102e+03, 1.068887e+03, 1.066619e+03, 1.064298e+03, 1.061925e+03, 1.059499e+03, 1.057022e+03, 1.054494e+03, 1.051913e+03, 1.049282e+03, 1.046600e+03, 1.043868e+03, 1.041086e+03, 1.038255e+03, 1.035376e+03, 1.032448e+03, 1.029474e+03, 1.026454e+03, 1.023388e+03, 1.020277e+03, 1.017122e+03, 1.010684e+03, 1.004079e+03, 9.973122e+02, 9.903898e+02, 9.833164e+02, 9.760964e+02, 9.687341e+02, 9.612330e+02, 9.535965e+02, 9.458276e+02, 9.379290e+02, 9.299031e+02, 9.217521e+02, 9.134782e+02, 9.050831e+02, 8.965688e+02, 8.879369e+02, 8.791893e+02, 8.703277e+02, 8.613542e+02, 8.522706e+02, 8.430791e+02, 8.337823e+02, 8.243826e+02, 8.148830e+02, 7.907183e+02, 7.660104e+02, 7.408368e+02, 7.152972e+02, 6.895177e+02, 6.636545e+02, 6.378931e+02, 6.124458e+02, 5.633760e+02, 5.180297e+02, 4.773775e+02, 4.416587e+02, 4.106034e+02, 3.836956e+02, 3.603498e+02, 3.400056e+02, 3.315164e+02,
+    // P = 400 MPa
+    1.144464e+03, 1.144394e+03, 1.142346e+03, 1.140147e+03, 1.137845e+03, 1.135473e+03, 1.133056e+03, 1.130609e+03, 1.128142e+03, 1.125662e+03, 1.123170e+03, 1.120670e+03, 1.118160e+03, 1.115640e+03, 1.113109e+03, 1.110565e+03, 1.108008e+03, 1.105436e+03, 1.102847e+03, 1.100241e+03, 1.097616e+03, 1.094972e+03, 1.092308e+03, 1.089623e+03, 1.086917e+03, 1.084191e+03, 1.081442e+03, 1.078673e+03, 1.075882e+03, 1.073069e+03, 1.067382e+03, 1.061611e+03, 1.055760e+03, 1.049832e+03, 1.043830e+03, 1.037757e+03, 1.031616e+03, 1.025410e+03, 1.019143e+03, 1.012818e+03, 1.006438e+03, 1.000005e+03, 9.935232e+02, 9.869944e+02, 9.804214e+02, 9.738069e+02, 9.671532e+02, 9.604629e+02, 9.537382e+02, 9.469816e+02, 9.401953e+02, 9.333815e+02, 9.265425e+02, 9.196807e+02, 9.127981e+02, 8.955157e+02, 8.781528e+02, 8.607440e+02, 8.433248e+02, 8.259298e+02, 8.085937e+02, 7.913508e+02, 7.742351e+02, 7.405206e+02, 7.077210e+02, 6.761060e+02, 6.459306e+02, 6.174111e+02, 5.906939e+02, 5.658425e+02, 5.428404e+02, 5.328608e+02,
+    // P = 600 MPa
+    1.183596e+03, 1.181960e+03, 1.179448e+03, 1.176904e+03, 1.174341e+03, 1.171769e+03, 1.169194e+03, 1.166621e+03, 1.164051e+03, 1.161486e+03, 1.158924e+03, 1.156367e+03, 1.153812e+03, 1.151259e+03, 1.148705e+03, 1.146151e+03, 1.143594e+03, 1.141033e+03, 1.138467e+03, 1.135896e+03, 1.133317e+03, 1.130732e+03, 1.128138e+03, 1.125535e+03, 1.122924e+03, 1.120302e+03, 1.117672e+03, 1.112381e+03, 1.107050e+03, 1.101679e+03, 1.096270e+03, 1.090823e+03, 1.085340e+03, 1.079823e+03, 1.074274e+03, 1.068695e+03, 1.063089e+03, 1.057456e+03, 1.051799e+03, 1.046121e+03, 1.040423e+03, 1.034707e+03, 1.028975e+03, 1.023229e+03, 1.017470e+03, 1.011701e+03, 1.005923e+03, 1.000137e+03, 9.943452e+02, 9.885493e+02, 9.827506e+02, 9.769505e+02, 9.624531e+02, 9.479778e+02, 9.335450e+02, 9.191742e+02, 9.048842e+02, 8.906924e+02, 8.766153e+02, 8.626680e+02, 8.352177e+02, 8.084381e+02, 7.824085e+02, 7.571939e+02, 7.328543e+02, 7.094426e+02, 6.870068e+02, 6.655873e+02, 6.560838e+02,
+    // P = 800 MPa
+    1.212689e+03, 1.210985e+03, 1.208384e+03, 1.205789e+03, 1.203201e+03, 1.200623e+03, 1.198054e+03, 1.195496e+03, 1.192948e+03, 1.190409e+03, 1.187879e+03, 1.185356e+03, 1.182839e+03, 1.180327e+03, 1.177818e+03, 1.175313e+03, 1.172809e+03, 1.170306e+03, 1.167803e+03, 1.165300e+03, 1.162795e+03, 1.160288e+03, 1.157779e+03, 1.155267e+03, 1.150233e+03, 1.145185e+03, 1.140122e+03, 1.135043e+03, 1.129948e+03, 1.124838e+03, 1.119714e+03, 1.114576e+03, 1.109426e+03, 1.104265e+03, 1.099095e+03, 1.093916e+03, 1.088731e+03, 1.083539e+03, 1.078344e+03, 1.073145e+03, 1.067944e+03, 1.062743e+03, 1.057543e+03, 1.052344e+03, 1.047148e+03, 1.041955e+03, 1.036768e+03, 1.031587e+03, 1.026412e+03, 1.013512e+03, 1.000675e+03, 9.879137e+02, 9.752405e+02, 9.626667e+02, 9.502029e+02, 9.378588e+02, 9.256426e+02, 9.016275e+02, 8.782105e+02, 8.554302e+02, 8.333125e+02, 8.118729e+02, 7.911193e+02, 7.710556e+02, 7.516838e+02, 7.430055e+02,
+    // P = 1000 MPa
+    1.237391e+03, 1.234940e+03, 1.232378e+03, 1.229829e+03, 1.227295e+03, 1.224773e+03, 1.222265e+03, 1.219768e+03, 1.217282e+03, 1.214806e+03, 1.212339e+03, 1.209879e+03, 1.207427e+03, 1.204981e+03, 1.202540e+03, 1.200104e+03, 1.197672e+03, 1.195242e+03, 1.192815e+03, 1.190390e+03, 1.187967e+03, 1.183123e+03, 1.178281e+03, 1.173440e+03, 1.168598e+03, 1.163755e+03, 1.158910e+03, 1.154064e+03, 1.149216e+03, 1.144368e+03, 1.139520e+03, 1.134673e+03, 1.129827e+03, 1.124984e+03, 1.120143e+03, 1.115307e+03, 1.110475e+03, 1.105649e+03, 1.100829e+03, 1.096017e+03, 1.091213e+03, 1.086416e+03, 1.081630e+03, 1.076854e+03, 1.072088e+03, 1.067334e+03, 1.055502e+03, 1.043755e+03, 1.032099e+03, 1.020544e+03, 1.009096e+03, 9.977616e+02, 9.865465e+02, 9.754563e+02, 9.536690e+02, 9.324316e+02, 9.117668e+02, 8.916883e+02, 8.722007e+02, 8.533039e+02, 8.349908e+02, 8.172512e+02, 8.092803e+02,
 };
 
-/// The state of matter of water at the temperatures and pressures used for interpolation (L: liquid, G: gaseous, S: supercritical).
-const Vec<Vec<char>> stateofmatter =
+/// The density of water (tentatively at the vapor state even when water is stable as liquid) at the temperatures and pressures used for interpolation (in kg/m3).
+/// Density values obtained from running the script generate-water-liquid-vapor-density-for-interpolation-wagner-pruss.py and copying its vapor density and pasting below.
+constexpr double densities_vapor[] =
 {
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 0.05MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 0.1MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 0.101325MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 0.25MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 0.5MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 0.75MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 1.0MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 2.0MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 3.0MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 4.0MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 5.0MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 6.0MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 7.0MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 8.0MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 10MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 12.5MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 15.0MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 17.5MPa
-    { 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'L', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G', 'G' },           // 20.0MPa
-    { 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S' },                     // 22.5MPa
-    { 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S' },                     // 25.0MPa
-    { 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S' },                     // 30.0MPa
-    { 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S' },                // 40.0MPa
-    { 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S' },                // 50.0MPa
-    { 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S' },                // 75.0MPa
-    { 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S' },           // 100MPa
-    { 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S' }, // 200MPa
-    { 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S' },      // 400MPa
-    { 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S' },                     // 600MPa
-    { 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S' },                                    // 800MPa
-    { 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S' },                                                   // 1000MPa
+    // P = 0.05 MPa
+    9.643203e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 3.722587e-01, 3.560796e-01, 3.467036e-01, 3.396070e-01, 3.334991e-01, 3.279102e-01, 3.226479e-01, 3.176261e-01, 3.128021e-01, 3.086393e-01, 3.086393e-01, 3.081512e-01, 3.036578e-01, 2.993099e-01, 2.950983e-01, 2.910148e-01, 2.870523e-01, 2.832046e-01, 2.794658e-01, 2.758306e-01, 2.722942e-01, 2.655003e-01, 2.590517e-01, 2.529204e-01, 2.470818e-01, 2.415140e-01, 2.361976e-01, 2.311151e-01, 2.262507e-01, 2.215902e-01, 2.171207e-01, 2.128302e-01, 2.087080e-01, 2.047441e-01, 2.009294e-01, 1.972556e-01, 1.937147e-01, 1.902997e-01, 1.870038e-01, 1.838208e-01, 1.807450e-01, 1.777710e-01, 1.748938e-01, 1.721086e-01, 1.694111e-01, 1.667973e-01, 1.606036e-01, 1.548548e-01, 1.495044e-01, 1.445123e-01, 1.398434e-01, 1.354673e-01, 1.313572e-01, 1.274895e-01, 1.204002e-01, 1.140585e-01, 1.083519e-01, 1.031896e-01, 9.849703e-02, 9.421292e-02, 9.028610e-02, 8.667365e-02, 8.510727e-02,
+    // P = 0.1 MPa
+    9.641478e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 7.034598e-01, 6.746542e-01, 6.576878e-01, 6.446624e-01, 6.333829e-01, 6.230439e-01, 6.133101e-01, 6.040269e-01, 5.951150e-01, 5.903439e-01, 5.903439e-01, 5.865280e-01, 5.782353e-01, 5.702138e-01, 5.624452e-01, 5.549136e-01, 5.476054e-01, 5.336113e-01, 5.203780e-01, 5.078347e-01, 4.959207e-01, 4.845841e-01, 4.737793e-01, 4.634662e-01, 4.536093e-01, 4.441768e-01, 4.351401e-01, 4.264734e-01, 4.181534e-01, 4.101588e-01, 4.024700e-01, 3.950693e-01, 3.879402e-01, 3.810676e-01, 3.744376e-01, 3.680373e-01, 3.618546e-01, 3.558784e-01, 3.500984e-01, 3.445048e-01, 3.390888e-01, 3.338417e-01, 3.214130e-01, 3.098821e-01, 2.991542e-01, 2.891477e-01, 2.797915e-01, 2.710240e-01, 2.627910e-01, 2.550448e-01, 2.408493e-01, 2.281536e-01, 2.167315e-01, 2.063999e-01, 1.970097e-01, 1.884375e-01, 1.805809e-01, 1.733536e-01, 1.702199e-01,
+    // P = 0.101325 MPa
+    9.641478e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 7.158796e-01, 6.846696e-01, 6.669484e-01, 6.535480e-01, 6.420268e-01, 6.315024e-01, 6.216101e-01, 6.121836e-01, 6.031381e-01, 5.976573e-01, 5.976573e-01, 5.944247e-01, 5.860113e-01, 5.778742e-01, 5.699943e-01, 5.623555e-01, 5.549439e-01, 5.407530e-01, 5.273351e-01, 5.146177e-01, 5.025394e-01, 4.910471e-01, 4.800944e-01, 4.696406e-01, 4.596496e-01, 4.500890e-01, 4.409300e-01, 4.321461e-01, 4.237138e-01, 4.156114e-01, 4.078192e-01, 4.003190e-01, 3.930942e-01, 3.861294e-01, 3.794105e-01, 3.729244e-01, 3.666590e-01, 3.606028e-01, 3.547455e-01, 3.490773e-01, 3.435889e-01, 3.382718e-01, 3.256773e-01, 3.139927e-01, 3.031219e-01, 2.929822e-01, 2.835016e-01, 2.746175e-01, 2.662750e-01, 2.584259e-01, 2.440418e-01, 2.311776e-01, 2.196039e-01, 2.091353e-01, 1.996205e-01, 1.909347e-01, 1.829738e-01, 1.756507e-01, 1.724755e-01,
+    // P = 0.25 MPa
+    9.635155e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.730628e+00, 1.597375e+00, 1.545910e+00, 1.511319e+00, 1.483336e+00, 1.458605e+00, 1.435780e+00, 1.414256e+00, 1.393731e+00, 1.391482e+00, 1.391482e+00, 1.355080e+00, 1.319089e+00, 1.285357e+00, 1.253604e+00, 1.223613e+00, 1.195206e+00, 1.168233e+00, 1.142569e+00, 1.118104e+00, 1.094744e+00, 1.072406e+00, 1.051016e+00, 1.030510e+00, 1.010828e+00, 9.919167e-01, 9.737292e-01, 9.562215e-01, 9.393538e-01, 9.230895e-01, 9.073953e-01, 8.922401e-01, 8.775955e-01, 8.634349e-01, 8.497340e-01, 8.364699e-01, 8.050845e-01, 7.760048e-01, 7.489799e-01, 7.237954e-01, 7.002662e-01, 6.782321e-01, 6.575531e-01, 6.381065e-01, 6.024909e-01, 5.706594e-01, 5.420359e-01, 5.161560e-01, 4.926418e-01, 4.711817e-01, 4.515172e-01, 4.334313e-01, 4.255903e-01,
+    // P = 0.5 MPa
+    9.624243e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.160772e+00, 2.995788e+00, 2.910289e+00, 2.796735e+00, 2.708054e+00, 2.668049e+00, 2.668049e+00, 2.629677e+00, 2.557902e+00, 2.491282e+00, 2.429003e+00, 2.370491e+00, 2.315304e+00, 2.263086e+00, 2.213541e+00, 2.166422e+00, 2.121517e+00, 2.078643e+00, 2.037643e+00, 1.998375e+00, 1.960719e+00, 1.924562e+00, 1.889807e+00, 1.856364e+00, 1.824154e+00, 1.793103e+00, 1.763145e+00, 1.734217e+00, 1.706265e+00, 1.679236e+00, 1.615397e+00, 1.556380e+00, 1.501635e+00, 1.450698e+00, 1.403172e+00, 1.358716e+00, 1.317033e+00, 1.277868e+00, 1.206211e+00, 1.142239e+00, 1.084764e+00, 1.032833e+00, 9.856754e-01, 9.426565e-01, 9.032512e-01, 8.670200e-01, 8.513154e-01,
+    // P = 0.75 MPa
+    9.613914e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 4.496590e+00, 4.210763e+00, 4.052196e+00, 3.924348e+00, 3.913667e+00, 3.913667e+00, 3.810941e+00, 3.707260e+00, 3.611252e+00, 3.521687e+00, 3.437685e+00, 3.358570e+00, 3.283796e+00, 3.212914e+00, 3.145552e+00, 3.081390e+00, 3.020156e+00, 2.961616e+00, 2.905561e+00, 2.851812e+00, 2.800206e+00, 2.750600e+00, 2.702864e+00, 2.656882e+00, 2.612548e+00, 2.569765e+00, 2.528446e+00, 2.431040e+00, 2.341198e+00, 2.258019e+00, 2.180747e+00, 2.108746e+00, 2.041471e+00, 1.978456e+00, 1.919295e+00, 1.811166e+00, 1.714742e+00, 1.628186e+00, 1.550033e+00, 1.479102e+00, 1.414425e+00, 1.355202e+00, 1.300766e+00, 1.277175e+00,
+    // P = 1.0 MPa
+    9.603023e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.288643e+00, 5.619888e+00, 5.376223e+00, 5.194523e+00, 5.145038e+00, 5.145038e+00, 5.037634e+00, 4.895984e+00, 4.765814e+00, 4.645054e+00, 4.532294e+00, 4.426478e+00, 4.326770e+00, 4.232495e+00, 4.143093e+00, 4.058099e+00, 3.977113e+00, 3.899795e+00, 3.825849e+00, 3.755018e+00, 3.687072e+00, 3.621810e+00, 3.559051e+00, 3.498634e+00, 3.440413e+00, 3.384255e+00, 3.252120e+00, 3.130535e+00, 3.018184e+00, 2.913980e+00, 2.817015e+00, 2.726519e+00, 2.641836e+00, 2.562399e+00, 2.417364e+00, 2.288173e+00, 2.172304e+00, 2.067756e+00, 1.972921e+00, 1.886486e+00, 1.807370e+00, 1.734670e+00, 1.703170e+00,
+    // P = 2.0 MPa
+    9.560707e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.142081e+01, 1.069025e+01, 1.024615e+01, 1.004168e+01, 1.004168e+01, 9.889017e+00, 9.578059e+00, 9.298997e+00, 9.044662e+00, 8.810524e+00, 8.593373e+00, 8.390767e+00, 8.200801e+00, 8.021947e+00, 7.852958e+00, 7.692802e+00, 7.540614e+00, 7.395656e+00, 7.257300e+00, 7.124998e+00, 6.998274e+00, 6.876710e+00, 6.593041e+00, 6.334623e+00, 6.097765e+00, 5.879552e+00, 5.677628e+00, 5.490063e+00, 5.315248e+00, 5.151827e+00, 4.854707e+00, 4.591245e+00, 4.355779e+00, 4.143907e+00, 3.952143e+00, 3.777677e+00, 3.618215e+00, 3.471862e+00, 3.408497e+00,
+    // P = 3.0 MPa
+    9.518557e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 1.795674e+01, 1.625885e+01, 1.544460e+01, 1.500052e+01, 1.500052e+01, 1.482836e+01, 1.430857e+01, 1.385195e+01, 1.344248e+01, 1.307038e+01, 1.272894e+01, 1.241323e+01, 1.211947e+01, 1.184471e+01, 1.158660e+01, 1.134318e+01, 1.111289e+01, 1.089438e+01, 1.068653e+01, 1.048838e+01, 1.003023e+01, 9.617438e+00, 9.242389e+00, 8.899319e+00, 8.583723e+00, 8.292008e+00, 8.021249e+00, 7.769032e+00, 7.312447e+00, 6.909452e+00, 6.550558e+00, 6.228527e+00, 5.937704e+00, 5.673588e+00, 5.432540e+00, 5.211576e+00, 5.115980e+00,
+    // P = 4.0 MPa
+    9.476005e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.345840e+01, 2.151971e+01, 2.041049e+01, 2.008995e+01, 2.008995e+01, 1.955280e+01, 1.883130e+01, 1.820210e+01, 1.764201e+01, 1.713638e+01, 1.667503e+01, 1.625053e+01, 1.585721e+01, 1.549070e+01, 1.514749e+01, 1.482475e+01, 1.452019e+01, 1.423186e+01, 1.357203e+01, 1.298463e+01, 1.245597e+01, 1.197604e+01, 1.153727e+01, 1.113378e+01, 1.076088e+01, 1.041478e+01, 9.791003e+00, 9.243024e+00, 8.756768e+00, 8.321683e+00, 7.929638e+00, 7.574237e+00, 7.250352e+00, 6.953811e+00, 6.825614e+00,
+    // P = 5.0 MPa
+    9.433622e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 2.819669e+01, 2.631333e+01, 2.535112e+01, 2.535112e+01, 2.500357e+01, 2.395107e+01, 2.305828e+01, 2.227910e+01, 2.158632e+01, 2.096192e+01, 2.039317e+01, 1.987068e+01, 1.938731e+01, 1.893750e+01, 1.851683e+01, 1.812173e+01, 1.722777e+01, 1.644240e+01, 1.574273e+01, 1.511265e+01, 1.454034e+01, 1.401685e+01, 1.353520e+01, 1.308985e+01, 1.229079e+01, 1.159219e+01, 1.097453e+01, 1.042344e+01, 9.927978e+00, 9.479636e+00, 9.071651e+00, 8.698561e+00, 8.537396e+00,
+    // P = 6.0 MPa
+    9.391406e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 3.552054e+01, 3.248816e+01, 3.081844e+01, 3.081844e+01, 3.061085e+01, 2.916581e+01, 2.797096e+01, 2.694664e+01, 2.604822e+01, 2.524720e+01, 2.452403e+01, 2.386457e+01, 2.325832e+01, 2.269720e+01, 2.217488e+01, 2.100799e+01, 1.999756e+01, 1.910720e+01, 1.831224e+01, 1.759509e+01, 1.694275e+01, 1.634532e+01, 1.579502e+01, 1.481224e+01, 1.395717e+01, 1.320397e+01, 1.253386e+01, 1.193275e+01, 1.138979e+01, 1.089644e+01, 1.044582e+01, 1.025132e+01,
+    // P = 7.0 MPa
+    9.349359e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 4.343613e+01, 3.884294e+01, 3.652505e+01, 3.652505e+01, 3.630381e+01, 3.441891e+01, 3.289368e+01, 3.160604e+01, 3.048965e+01, 2.950337e+01, 2.861954e+01, 2.781857e+01, 2.708609e+01, 2.641118e+01, 2.492459e+01, 2.365762e+01, 2.255430e+01, 2.157812e+01, 2.070378e+01, 1.991307e+01, 1.919234e+01, 1.853110e+01, 1.735575e+01, 1.633820e+01, 1.544519e+01, 1.465299e+01, 1.394398e+01, 1.330472e+01, 1.272471e+01, 1.219559e+01, 1.196737e+01,
+    // P = 8.0 MPa
+    9.306921e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.165864e+01, 4.524712e+01, 4.250674e+01, 4.250674e+01, 4.199660e+01, 3.964672e+01, 3.777701e+01, 3.621777e+01, 3.487832e+01, 3.370359e+01, 3.265714e+01, 3.171349e+01, 3.085415e+01, 2.899114e+01, 2.743087e+01, 2.608935e+01, 2.491378e+01, 2.386880e+01, 2.292944e+01, 2.207742e+01, 2.129891e+01, 1.992175e+01, 1.873547e+01, 1.769831e+01, 1.678090e+01, 1.596168e+01, 1.522441e+01, 1.455646e+01, 1.394785e+01, 1.368554e+01,
+    // P = 10 MPa
+    9.222559e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 6.672203e+01, 5.760496e+01, 5.546294e+01, 5.546294e+01, 5.301851e+01, 4.977258e+01, 4.723653e+01, 4.515102e+01, 4.337971e+01, 4.184014e+01, 4.047887e+01, 3.763857e+01, 3.535487e+01, 3.344674e+01, 3.180969e+01, 3.037789e+01, 2.910718e+01, 2.796647e+01, 2.693300e+01, 2.512288e+01, 2.357961e+01, 2.224065e+01, 2.106319e+01, 2.001659e+01, 1.907811e+01, 1.823037e+01, 1.745981e+01, 1.712821e+01,
+    // P = 12.5 MPa
+    9.116970e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 9.269212e+01, 7.495014e+01, 7.409722e+01, 7.409722e+01, 6.791117e+01, 6.318829e+01, 5.961163e+01, 5.673285e+01, 5.432569e+01, 4.962471e+01, 4.608487e+01, 4.325173e+01, 4.089396e+01, 3.887801e+01, 3.711991e+01, 3.556338e+01, 3.416896e+01, 3.175810e+01, 2.972984e+01, 2.798722e+01, 2.646614e+01, 2.512189e+01, 2.392202e+01, 2.284216e+01, 2.186357e+01, 2.144324e+01,
+    // P = 15.0 MPa
+    9.011918e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.095163e+02, 9.672252e+01, 9.672252e+01, 9.036233e+01, 8.155192e+01, 7.564007e+01, 7.118580e+01, 6.333709e+01, 5.794180e+01, 5.384969e+01, 5.056406e+01, 4.782595e+01, 4.548363e+01, 4.344073e+01, 4.163231e+01, 3.854786e+01, 3.598840e+01, 3.381126e+01, 3.192515e+01, 3.026797e+01, 2.879555e+01, 2.747529e+01, 2.628241e+01, 2.577100e+01,
+    // P = 17.5 MPa
+    8.906876e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.261091e+02, 1.261091e+02, 1.195595e+02, 1.026708e+02, 9.322313e+01, 7.947183e+01, 7.123001e+01, 6.539625e+01, 6.090735e+01, 5.727385e+01, 5.423083e+01, 5.161932e+01, 4.933668e+01, 4.549818e+01, 4.235792e+01, 3.971381e+01, 3.744048e+01, 3.545473e+01, 3.369844e+01, 3.212941e+01, 3.071600e+01, 3.011116e+01,
+    // P = 20.0 MPa
+    8.801870e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 1.704959e+02, 1.704959e+02, 1.604910e+02, 1.264833e+02, 9.922053e+01, 8.638009e+01, 7.808827e+01, 7.202670e+01, 6.728001e+01, 6.339638e+01, 6.012079e+01, 5.729581e+01, 5.261480e+01, 4.884071e+01, 4.569563e+01, 4.301221e+01, 4.068191e+01, 3.863030e+01, 3.680412e+01, 3.516393e+01, 3.446335e+01,
+    // P = 22.5 MPa
+    8.697450e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496711e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 2.120814e+02, 2.180843e+02, 1.248678e+02, 1.040182e+02, 9.217763e+01, 8.404303e+01, 7.790913e+01, 7.301728e+01, 6.896722e+01, 6.552324e+01, 5.990292e+01, 5.543866e+01, 5.175720e+01, 4.864018e+01, 4.594910e+01, 4.359064e+01, 4.149893e+01, 3.962574e+01, 3.882710e+01,
+    // P = 25.0 MPa
+    8.593104e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496711e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 2.120807e+02, 4.888569e+02, 1.615916e+02, 1.250914e+02, 1.079863e+02, 9.709792e+01, 8.923220e+01, 8.313225e+01, 7.818087e+01, 7.403213e+01, 6.736725e+01, 6.215329e+01, 5.789867e+01, 5.432402e+01, 5.125575e+01, 4.857886e+01, 4.621325e+01, 4.410090e+01, 4.320192e+01,
+    // P = 30.0 MPa
+    8.384736e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 2.120816e+02, 5.496396e+02, 3.325120e+02, 1.842364e+02, 1.465143e+02, 1.269952e+02, 1.142706e+02, 1.050031e+02, 9.779601e+01, 9.194265e+01, 8.283961e+01, 7.593573e+01, 7.042023e+01, 6.585664e+01, 6.198437e+01, 5.863598e+01, 5.569772e+01, 5.308891e+01, 5.198255e+01,
+    // P = 40.0 MPa
+    1.019382e+03, 1.019381e+03, 1.019085e+03, 1.018490e+03, 1.878941e-01, 1.016543e+03, 1.015242e+03, 1.013750e+03, 1.012080e+03, 1.010247e+03, 1.008261e+03, 1.006130e+03, 1.003863e+03, 1.001465e+03, 9.989448e+02, 8.118511e+02, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 2.120816e+02, 6.039681e+02, 5.154816e+02, 3.830216e+02, 2.646496e+02, 2.069820e+02, 1.760340e+02, 1.562968e+02, 1.422659e+02, 1.315795e+02, 1.160083e+02, 1.049029e+02, 9.638941e+01, 8.954986e+01, 8.387274e+01, 7.904615e+01, 7.486698e+01, 7.119602e+01, 6.964959e+01,
+    // P = 50.0 MPa
+    1.024113e+03, 1.024067e+03, 1.023621e+03, 1.022901e+03, 1.021941e+03, 1.020765e+03, 1.019395e+03, 8.568299e+02, 4.357790e-01, 8.452750e+02, 1.012253e+03, 1.010106e+03, 1.007829e+03, 1.005429e+03, 1.002913e+03, 1.000283e+03, 9.975455e+02, 3.220000e+02, 3.220000e+02, 1.886713e+00, 2.792723e+02, 9.823511e+02, 9.790303e+02, 9.756205e+02, 9.721236e+02, 9.685410e+02, 9.648739e+02, 9.611236e+02, 9.533765e+02, 9.453052e+02, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 2.120816e+02, 6.369397e+02, 5.724986e+02, 4.910329e+02, 3.948506e+02, 3.099346e+02, 2.537562e+02, 2.180703e+02, 1.938883e+02, 1.763136e+02, 1.520343e+02, 1.356158e+02, 1.234808e+02, 1.139850e+02, 1.062569e+02, 9.978590e+01, 9.424991e+01, 8.943402e+01, 8.741749e+01,
+    // P = 75.0 MPa
+    8.953265e+02, 8.914262e+02, 8.853085e+02, 8.792579e+02, 8.732677e+02, 8.673318e+02, 8.614440e+02, 8.555989e+02, 8.497910e+02, 8.440152e+02, 8.382668e+02, 8.325411e+02, 8.268335e+02, 8.211398e+02, 8.154557e+02, 8.097772e+02, 8.041003e+02, 7.984210e+02, 7.927352e+02, 7.870391e+02, 7.813288e+02, 7.756001e+02, 7.698490e+02, 7.640714e+02, 7.582628e+02, 7.524189e+02, 7.465350e+02, 7.406063e+02, 9.643607e+02, 9.566447e+02, 9.486492e+02, 9.403770e+02, 6.775178e+02, 9.230061e+02, 3.220230e+02, 3.223187e+02, 3.245625e+02, 3.318334e+02, 3.332405e+01, 3.006904e+02, 3.016625e+02, 3.020157e+02, 3.021493e+02, 3.021839e+02, 3.441326e+02, 6.108897e+02, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 2.120807e+02, 6.901647e+02, 6.460069e+02, 5.970437e+02, 5.431698e+02, 4.859275e+02, 4.291793e+02, 3.775647e+02, 3.342221e+02, 2.994707e+02, 2.500002e+02, 2.174557e+02, 1.944393e+02, 1.771357e+02, 1.635139e+02, 1.524136e+02, 1.431262e+02, 1.351940e+02, 1.319110e+02,
+    // P = 100 MPa
+    8.972144e+02, 8.964058e+02, 8.902515e+02, 8.841602e+02, 8.781269e+02, 8.721464e+02, 8.662135e+02, 8.603231e+02, 8.544702e+02, 8.486499e+02, 8.428575e+02, 8.370883e+02, 8.313380e+02, 8.256022e+02, 8.198766e+02, 8.141572e+02, 8.084399e+02, 8.027205e+02, 7.969951e+02, 7.912596e+02, 7.855100e+02, 7.797421e+02, 7.739519e+02, 7.681349e+02, 7.622869e+02, 7.564032e+02, 7.504791e+02, 7.445096e+02, 7.384894e+02, 7.262743e+02, 7.137846e+02, 7.009626e+02, 6.877399e+02, 6.740326e+02, 6.597361e+02, 6.447189e+02, 6.289229e+02, 6.139811e+02, 6.060230e+02, 6.035214e+02, 6.013613e+02, 3.993695e+02, 3.997873e+02, 3.999468e+02, 3.999891e+02, 3.999530e+02, 6.108897e+02, 3.018248e+02, 3.460542e+02, 3.570470e+02, 5.303403e+02, 1.742462e+02, 2.120795e+02, 7.262117e+02, 6.901849e+02, 6.517738e+02, 6.110747e+02, 5.685166e+02, 5.250601e+02, 4.822256e+02, 4.416603e+02, 4.046582e+02, 3.436142e+02, 2.986055e+02, 2.654456e+02, 2.403167e+02, 2.206230e+02, 2.047124e+02, 1.915258e+02, 1.803659e+02, 1.757761e+02,
+    // P = 200 MPa
+    1.087977e+03, 1.087461e+03, 1.086210e+03, 1.084721e+03, 1.083060e+03, 1.081269e+03, 1.079378e+03, 1.077407e+03, 1.075366e+03, 1.073263e+03, 1.071102e+03, 1.068887e+03, 1.066619e+03, 1.064298e+03, 1.061925e+03, 1.059499e+03, 1.057022e+03, 1.054494e+03, 1.051913e+03, 1.049282e+03, 1.046600e+03, 1.043868e+03, 1.041086e+03, 1.038255e+03, 1.035376e+03, 1.032448e+03, 1.029474e+03, 1.026454e+03, 1.023388e+03, 1.020277e+03, 1.017122e+03, 1.010684e+03, 1.004079e+03, 9.973122e+02, 9.903898e+02, 9.833164e+02, 9.760964e+02, 9.687341e+02, 9.612330e+02, 9.535965e+02, 9.458276e+02, 9.379289e+02, 3.879915e+01, 5.910107e+02, 5.850534e+02, 5.765475e+02, 6.821543e+01, 6.251988e+02, 6.108897e+02, 5.950220e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 8.148830e+02, 7.907183e+02, 7.660104e+02, 7.408368e+02, 7.152972e+02, 6.895182e+02, 6.636541e+02, 6.378931e+02, 6.124468e+02, 5.633760e+02, 5.180302e+02, 4.773775e+02, 4.416588e+02, 4.106034e+02, 3.836958e+02, 3.603498e+02, 3.400057e+02, 3.315167e+02,
+    // P = 400 MPa
+    1.144464e+03, 1.144394e+03, 1.142346e+03, 1.140147e+03, 1.137845e+03, 1.135473e+03, 1.133056e+03, 1.130609e+03, 1.128142e+03, 1.125662e+03, 1.123170e+03, 1.120670e+03, 1.118160e+03, 1.115640e+03, 1.113109e+03, 1.110565e+03, 1.108008e+03, 1.105436e+03, 1.102847e+03, 1.100241e+03, 1.097616e+03, 1.094972e+03, 1.092308e+03, 1.089623e+03, 1.086917e+03, 1.084191e+03, 1.081442e+03, 1.078673e+03, 1.075882e+03, 1.073069e+03, 1.067382e+03, 1.061611e+03, 1.055760e+03, 1.049832e+03, 1.043830e+03, 1.037757e+03, 1.031616e+03, 1.025410e+03, 1.019143e+03, 1.012818e+03, 1.006438e+03, 1.000005e+03, 9.935232e+02, 9.869944e+02, 9.804214e+02, 9.738070e+02, 9.671533e+02, 9.604629e+02, 9.537382e+02, 9.469816e+02, 9.401953e+02, 9.333815e+02, 9.265425e+02, 9.196806e+02, 9.127981e+02, 8.955158e+02, 8.781527e+02, 8.607440e+02, 8.433248e+02, 8.259298e+02, 8.085937e+02, 7.913511e+02, 7.742352e+02, 7.405206e+02, 7.077209e+02, 6.761056e+02, 6.459309e+02, 6.174111e+02, 5.906939e+02, 5.658425e+02, 5.428404e+02, 5.328608e+02,
+    // P = 600 MPa
+    1.183596e+03, 1.181960e+03, 1.179448e+03, 1.176904e+03, 1.174341e+03, 1.171769e+03, 1.169194e+03, 1.166621e+03, 1.164051e+03, 1.161486e+03, 1.158924e+03, 1.156367e+03, 1.153812e+03, 1.151259e+03, 1.148705e+03, 1.146151e+03, 1.143594e+03, 1.141033e+03, 1.138467e+03, 1.135896e+03, 1.133317e+03, 1.130732e+03, 1.128138e+03, 1.125535e+03, 1.122924e+03, 1.120302e+03, 1.117672e+03, 1.112381e+03, 1.107050e+03, 1.101679e+03, 1.096270e+03, 1.090823e+03, 1.085340e+03, 1.079823e+03, 1.074274e+03, 1.068696e+03, 1.063089e+03, 1.057456e+03, 1.051799e+03, 1.046121e+03, 1.040423e+03, 1.034707e+03, 1.028975e+03, 1.023229e+03, 1.017470e+03, 1.011701e+03, 1.005923e+03, 1.000137e+03, 9.943451e+02, 9.885492e+02, 9.827504e+02, 9.769502e+02, 9.624531e+02, 9.479778e+02, 9.335454e+02, 9.191744e+02, 9.048842e+02, 8.906924e+02, 8.766153e+02, 8.626680e+02, 8.352181e+02, 8.084379e+02, 7.824078e+02, 7.571939e+02, 7.328547e+02, 7.094426e+02, 6.870068e+02, 6.655873e+02, 6.560838e+02,
+    // P = 800 MPa
+    1.212689e+03, 1.210985e+03, 1.208384e+03, 1.205789e+03, 1.203201e+03, 1.200623e+03, 1.198054e+03, 1.195496e+03, 1.192948e+03, 1.190409e+03, 1.187879e+03, 1.185356e+03, 1.182839e+03, 1.180327e+03, 1.177818e+03, 1.175313e+03, 1.172809e+03, 1.170306e+03, 1.167803e+03, 1.165300e+03, 1.162795e+03, 1.160288e+03, 1.157779e+03, 1.155267e+03, 1.150233e+03, 1.145185e+03, 1.140122e+03, 1.135042e+03, 1.129948e+03, 1.124838e+03, 1.119714e+03, 1.114576e+03, 1.109426e+03, 1.104265e+03, 1.099095e+03, 1.093916e+03, 1.088731e+03, 1.083539e+03, 1.078344e+03, 1.073145e+03, 1.067944e+03, 1.062744e+03, 1.057543e+03, 1.052344e+03, 1.047148e+03, 1.041955e+03, 1.036768e+03, 1.031587e+03, 1.026412e+03, 1.013512e+03, 1.000675e+03, 9.879137e+02, 9.752404e+02, 9.626668e+02, 9.502027e+02, 9.378584e+02, 9.256426e+02, 9.016275e+02, 8.782105e+02, 8.554304e+02, 8.333125e+02, 8.118729e+02, 7.911193e+02, 7.710561e+02, 7.516838e+02, 7.430054e+02,
+    // P = 1000 MPa
+    1.237391e+03, 1.234940e+03, 1.232378e+03, 1.229829e+03, 1.227295e+03, 1.224773e+03, 1.222265e+03, 1.219768e+03, 1.217282e+03, 1.214806e+03, 1.212339e+03, 1.209879e+03, 1.207427e+03, 1.204981e+03, 1.202540e+03, 1.200104e+03, 1.197672e+03, 1.195242e+03, 1.192815e+03, 1.190390e+03, 1.187967e+03, 1.183123e+03, 1.178281e+03, 1.173440e+03, 1.168598e+03, 1.163755e+03, 1.158910e+03, 1.154064e+03, 1.149216e+03, 1.144368e+03, 1.139520e+03, 1.134673e+03, 1.129827e+03, 1.124984e+03, 1.120143e+03, 1.115307e+03, 1.110475e+03, 1.105649e+03, 1.100829e+03, 1.096017e+03, 1.091213e+03, 1.086416e+03, 1.081630e+03, 1.076854e+03, 1.072088e+03, 1.067334e+03, 1.055502e+03, 1.043755e+03, 1.032100e+03, 1.020544e+03, 1.009096e+03, 9.977622e+02, 9.865466e+02, 9.754563e+02, 9.536690e+02, 9.324319e+02, 9.117666e+02, 8.916878e+02, 8.722007e+02, 8.533039e+02, 8.349913e+02, 8.172513e+02, 8.092803e+02,
 };
 
-/// The first temperature index, for each pressure row, at which water has changed its state of matter from liquid to gas. The index 99 is used for pressures above supercritical value.
-const Vec<Index> transitions = { 18, 22, 22, 28, 30, 32, 33, 36, 38, 40, 41, 42, 43, 44, 46, 48, 49, 50, 51, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99 };
+static_assert(std::size(waterInterpTransitions) == numpressures);
+static_assert(std::size(waterInterpTemperatures) == numpoints);
+static_assert(std::size(densities_liquid) == numpoints);
+static_assert(std::size(densities_vapor) == numpoints);
+static_assert(std::size(waterInterpThermoPropsLiquid) == numpoints * waterInterpNumThermoProps);
+static_assert(std::size(waterInterpThermoPropsVapor) == numpoints * waterInterpNumThermoProps);
 
-/// The density of water (tentatively at the liquid state even when water is stable as vapor) at the temperatures and pressures used for interpolation (in kg/m3).
-/// Density values obtained from running the script generate-water-liquid-vapor-density-for-interpolation-wagner-pruss.py and copying its liquid density and pasting below.
-const Vec<Vec<double>> densities_liquid =
+/// Used to view the entries of a flattened interpolation table along the row of a given pressure.
+template<typename T>
+struct Row
 {
-    { 9.998174e+02, 9.999122e+02, 9.998860e+02, 9.994930e+02, 9.987801e+02, 9.977841e+02, 9.965339e+02, 9.950531e+02, 9.933610e+02, 9.914736e+02, 9.894044e+02, 9.871648e+02, 9.847644e+02, 9.822115e+02, 9.795135e+02, 9.766764e+02, 9.737056e+02, 9.709421e+02, 9.709421e+02, 9.706056e+02, 9.673806e+02, 9.640338e+02, 9.605682e+02, 9.569861e+02, 9.532896e+02, 9.494803e+02, 9.455593e+02, 9.415275e+02, 9.373853e+02, 9.287704e+02, 9.197117e+02, 9.102008e+02, 9.002236e+02, 8.897600e+02, 8.787824e+02, 8.672550e+02, 8.551321e+02, 8.423549e+02, 8.288484e+02, 8.145151e+02, 7.992266e+02, 7.828085e+02, 7.650159e+02, 7.454862e+02, 7.236426e+02, 6.984614e+02, 6.677430e+02, 6.238842e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 1.667973e-01, 1.606036e-01, 1.548548e-01, 1.495044e-01, 1.445123e-01, 1.398434e-01, 1.354673e-01, 1.313572e-01, 1.274895e-01, 1.204002e-01, 1.140585e-01, 1.083519e-01, 1.031896e-01, 9.849703e-02, 9.421292e-02, 9.028610e-02, 8.667365e-02, 8.510727e-02 },
-    { 9.998426e+02, 9.999373e+02, 9.999104e+02, 9.995167e+02, 9.988033e+02, 9.978068e+02, 9.965563e+02, 9.950753e+02, 9.933830e+02, 9.914955e+02, 9.894263e+02, 9.871866e+02, 9.847862e+02, 9.822334e+02, 9.795355e+02, 9.766985e+02, 9.737279e+02, 9.706281e+02, 9.674033e+02, 9.640568e+02, 9.605914e+02, 9.586315e+02, 9.586315e+02, 9.570097e+02, 9.533136e+02, 9.495046e+02, 9.455840e+02, 9.415527e+02, 9.374111e+02, 9.287972e+02, 9.197397e+02, 9.102303e+02, 9.002548e+02, 8.897930e+02, 8.788176e+02, 8.672927e+02, 8.551727e+02, 8.423990e+02, 8.288965e+02, 8.145682e+02, 7.992858e+02, 7.828754e+02, 7.650928e+02, 7.455767e+02, 7.237528e+02, 6.986032e+02, 6.679464e+02, 6.243076e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 3.338417e-01, 3.214130e-01, 3.098821e-01, 2.991542e-01, 2.891477e-01, 2.797915e-01, 2.710240e-01, 2.627910e-01, 2.550448e-01, 2.408493e-01, 2.281536e-01, 2.167315e-01, 2.063999e-01, 1.970097e-01, 1.884375e-01, 1.805809e-01, 1.733536e-01, 1.702199e-01 },
-    { 9.998433e+02, 9.999379e+02, 9.999110e+02, 9.995173e+02, 9.988039e+02, 9.978074e+02, 9.965569e+02, 9.950759e+02, 9.933836e+02, 9.914961e+02, 9.894268e+02, 9.871872e+02, 9.847868e+02, 9.822340e+02, 9.795361e+02, 9.766991e+02, 9.737284e+02, 9.706287e+02, 9.674039e+02, 9.640574e+02, 9.605921e+02, 9.583677e+02, 9.583677e+02, 9.570103e+02, 9.533142e+02, 9.495053e+02, 9.455847e+02, 9.415534e+02, 9.374118e+02, 9.287980e+02, 9.197405e+02, 9.102310e+02, 9.002556e+02, 8.897939e+02, 8.788185e+02, 8.672937e+02, 8.551738e+02, 8.424001e+02, 8.288978e+02, 8.145696e+02, 7.992874e+02, 7.828772e+02, 7.650949e+02, 7.455791e+02, 7.237557e+02, 6.986069e+02, 6.679517e+02, 6.243188e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 3.382718e-01, 3.256773e-01, 3.139927e-01, 3.031219e-01, 2.929822e-01, 2.835016e-01, 2.746175e-01, 2.662750e-01, 2.584259e-01, 2.440418e-01, 2.311776e-01, 2.196039e-01, 2.091353e-01, 1.996205e-01, 1.909347e-01, 1.829738e-01, 1.756507e-01, 1.724755e-01 },
-    { 9.999182e+02, 1.000013e+03, 9.999833e+02, 9.995877e+02, 9.988728e+02, 9.978751e+02, 9.966237e+02, 9.951419e+02, 9.934491e+02, 9.915613e+02, 9.894918e+02, 9.872520e+02, 9.848517e+02, 9.822991e+02, 9.796015e+02, 9.767649e+02, 9.737947e+02, 9.706956e+02, 9.674715e+02, 9.641258e+02, 9.606613e+02, 9.570805e+02, 9.533855e+02, 9.495777e+02, 9.456584e+02, 9.416284e+02, 9.374882e+02, 9.370168e+02, 9.370168e+02, 9.288777e+02, 9.198239e+02, 9.103187e+02, 9.003481e+02, 8.898920e+02, 8.789230e+02, 8.674057e+02, 8.552945e+02, 8.425310e+02, 8.290409e+02, 8.147274e+02, 7.994632e+02, 7.830758e+02, 7.653231e+02, 7.458476e+02, 7.240824e+02, 6.990268e+02, 6.685519e+02, 6.255474e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 8.364699e-01, 8.050845e-01, 7.760048e-01, 7.489799e-01, 7.237954e-01, 7.002662e-01, 6.782321e-01, 6.575531e-01, 6.381065e-01, 6.024909e-01, 5.706594e-01, 5.420359e-01, 5.161560e-01, 4.926418e-01, 4.711817e-01, 4.515172e-01, 4.334313e-01, 4.255903e-01 },
-    { 1.000044e+03, 1.000138e+03, 1.000105e+03, 9.997060e+02, 9.989886e+02, 9.979889e+02, 9.967358e+02, 9.952529e+02, 9.935592e+02, 9.916707e+02, 9.896009e+02, 9.873610e+02, 9.849608e+02, 9.824086e+02, 9.797114e+02, 9.768755e+02, 9.739062e+02, 9.708080e+02, 9.675851e+02, 9.642406e+02, 9.607777e+02, 9.571985e+02, 9.535052e+02, 9.496994e+02, 9.457821e+02, 9.417544e+02, 9.376167e+02, 9.290116e+02, 9.199640e+02, 9.152901e+02, 9.152901e+02, 9.104660e+02, 9.005036e+02, 8.900568e+02, 8.790986e+02, 8.675938e+02, 8.554971e+02, 8.427508e+02, 8.292810e+02, 8.149921e+02, 7.997582e+02, 7.834089e+02, 7.657056e+02, 7.462971e+02, 7.246287e+02, 6.997270e+02, 6.695472e+02, 6.275222e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 1.679236e+00, 1.615397e+00, 1.556380e+00, 1.501635e+00, 1.450698e+00, 1.403172e+00, 1.358716e+00, 1.317033e+00, 1.277868e+00, 1.206211e+00, 1.142239e+00, 1.084764e+00, 1.032833e+00, 9.856754e-01, 9.426565e-01, 9.032512e-01, 8.670200e-01, 8.513154e-01 },
-    { 1.000170e+03, 1.000263e+03, 1.000226e+03, 9.998243e+02, 9.991043e+02, 9.981026e+02, 9.968480e+02, 9.953638e+02, 9.936692e+02, 9.917802e+02, 9.897100e+02, 9.874700e+02, 9.850699e+02, 9.825180e+02, 9.798213e+02, 9.769860e+02, 9.740175e+02, 9.709204e+02, 9.676986e+02, 9.643555e+02, 9.608939e+02, 9.573164e+02, 9.536249e+02, 9.498210e+02, 9.459058e+02, 9.418804e+02, 9.377451e+02, 9.291454e+02, 9.201041e+02, 9.106131e+02, 9.006589e+02, 8.997406e+02, 8.997406e+02, 8.902214e+02, 8.792740e+02, 8.677816e+02, 8.556994e+02, 8.429701e+02, 8.295206e+02, 8.152561e+02, 8.000522e+02, 7.837407e+02, 7.660865e+02, 7.467442e+02, 7.251710e+02, 7.004201e+02, 6.705255e+02, 6.293973e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 2.528446e+00, 2.431040e+00, 2.341198e+00, 2.258019e+00, 2.180747e+00, 2.108746e+00, 2.041471e+00, 1.978456e+00, 1.919295e+00, 1.811166e+00, 1.714742e+00, 1.628186e+00, 1.550033e+00, 1.479102e+00, 1.414425e+00, 1.355202e+00, 1.300766e+00, 1.277175e+00 },
-    { 1.000296e+03, 1.000389e+03, 1.000348e+03, 9.999425e+02, 9.992200e+02, 9.982162e+02, 9.969600e+02, 9.954746e+02, 9.937792e+02, 9.918895e+02, 9.898190e+02, 9.875789e+02, 9.851789e+02, 9.826273e+02, 9.799311e+02, 9.770965e+02, 9.741288e+02, 9.710327e+02, 9.678120e+02, 9.644702e+02, 9.610101e+02, 9.574342e+02, 9.537444e+02, 9.499424e+02, 9.460294e+02, 9.420062e+02, 9.378733e+02, 9.292790e+02, 9.202439e+02, 9.107601e+02, 9.008139e+02, 8.903858e+02, 8.871293e+02, 8.871293e+02, 8.794491e+02, 8.679691e+02, 8.559013e+02, 8.431890e+02, 8.297596e+02, 8.155195e+02, 8.003454e+02, 7.840714e+02, 7.664657e+02, 7.471889e+02, 7.257095e+02, 7.011062e+02, 6.714878e+02, 6.311863e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 3.384255e+00, 3.252120e+00, 3.130535e+00, 3.018184e+00, 2.913980e+00, 2.817015e+00, 2.726519e+00, 2.641836e+00, 2.562399e+00, 2.417364e+00, 2.288173e+00, 2.172304e+00, 2.067756e+00, 1.972921e+00, 1.886486e+00, 1.807370e+00, 1.734670e+00, 1.703170e+00 },
-    { 1.000798e+03, 1.000889e+03, 1.000832e+03, 1.000415e+03, 9.996820e+02, 9.986702e+02, 9.974077e+02, 9.959174e+02, 9.942184e+02, 9.923264e+02, 9.902545e+02, 9.880139e+02, 9.856143e+02, 9.830639e+02, 9.803696e+02, 9.775377e+02, 9.745733e+02, 9.714811e+02, 9.682650e+02, 9.649283e+02, 9.614740e+02, 9.579045e+02, 9.542218e+02, 9.504275e+02, 9.465227e+02, 9.425085e+02, 9.383853e+02, 9.298124e+02, 9.208019e+02, 9.113463e+02, 9.014324e+02, 8.910412e+02, 8.801469e+02, 8.687160e+02, 8.567053e+02, 8.497988e+02, 8.497988e+02, 8.440600e+02, 8.307103e+02, 8.165660e+02, 8.015093e+02, 7.853823e+02, 7.679662e+02, 7.489439e+02, 7.278263e+02, 7.037848e+02, 6.751885e+02, 6.376637e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 6.876710e+00, 6.593041e+00, 6.334623e+00, 6.097765e+00, 5.879552e+00, 5.677628e+00, 5.490063e+00, 5.315248e+00, 5.151827e+00, 4.854707e+00, 4.591245e+00, 4.355779e+00, 4.143907e+00, 3.952143e+00, 3.777677e+00, 3.618215e+00, 3.471862e+00, 3.408497e+00 },
-    { 1.001300e+03, 1.001388e+03, 1.001316e+03, 1.000886e+03, 1.000143e+03, 9.991232e+02, 9.978543e+02, 9.963593e+02, 9.946567e+02, 9.927622e+02, 9.906890e+02, 9.884480e+02, 9.860488e+02, 9.834995e+02, 9.808071e+02, 9.779777e+02, 9.750166e+02, 9.719283e+02, 9.687167e+02, 9.653852e+02, 9.619366e+02, 9.583735e+02, 9.546977e+02, 9.509110e+02, 9.470144e+02, 9.430091e+02, 9.388954e+02, 9.303438e+02, 9.213577e+02, 9.119299e+02, 9.020479e+02, 8.916931e+02, 8.808407e+02, 8.694581e+02, 8.575036e+02, 8.449242e+02, 8.316524e+02, 8.219006e+02, 8.219006e+02, 8.176017e+02, 8.026594e+02, 7.866749e+02, 7.694416e+02, 7.506628e+02, 7.298868e+02, 7.063653e+02, 6.786786e+02, 6.433363e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 1.048838e+01, 1.003023e+01, 9.617437e+00, 9.242389e+00, 8.899319e+00, 8.583723e+00, 8.292008e+00, 8.021249e+00, 7.769032e+00, 7.312447e+00, 6.909452e+00, 6.550558e+00, 6.228527e+00, 5.937704e+00, 5.673588e+00, 5.432540e+00, 5.211576e+00, 5.115980e+00 },
-    { 1.001802e+03, 1.001886e+03, 1.001799e+03, 1.001356e+03, 1.000603e+03, 9.995753e+02, 9.983001e+02, 9.968002e+02, 9.950941e+02, 9.931972e+02, 9.911225e+02, 9.888810e+02, 9.864822e+02, 9.839340e+02, 9.812435e+02, 9.784167e+02, 9.754588e+02, 9.723744e+02, 9.691672e+02, 9.658408e+02, 9.623980e+02, 9.588411e+02, 9.551722e+02, 9.513930e+02, 9.475046e+02, 9.435080e+02, 9.394038e+02, 9.308733e+02, 9.219113e+02, 9.125110e+02, 9.026604e+02, 8.923417e+02, 8.815306e+02, 8.701956e+02, 8.582963e+02, 8.457816e+02, 8.325862e+02, 8.186271e+02, 8.037961e+02, 7.983678e+02, 7.983678e+02, 7.879500e+02, 7.708931e+02, 7.523473e+02, 7.318948e+02, 7.088568e+02, 6.819871e+02, 6.484322e+02, 5.951743e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 1.423186e+01, 1.357203e+01, 1.298463e+01, 1.245597e+01, 1.197604e+01, 1.153727e+01, 1.113378e+01, 1.076088e+01, 1.041478e+01, 9.791003e+00, 9.243023e+00, 8.756768e+00, 8.321682e+00, 7.929638e+00, 7.574237e+00, 7.250352e+00, 6.953811e+00, 6.825614e+00 },
-    { 1.002302e+03, 1.002383e+03, 1.002280e+03, 1.001825e+03, 1.001062e+03, 1.000026e+03, 9.987449e+02, 9.972402e+02, 9.955305e+02, 9.936312e+02, 9.915551e+02, 9.893131e+02, 9.869146e+02, 9.843676e+02, 9.816789e+02, 9.788546e+02, 9.758999e+02, 9.728193e+02, 9.696166e+02, 9.662952e+02, 9.628580e+02, 9.593073e+02, 9.556453e+02, 9.518735e+02, 9.479931e+02, 9.440053e+02, 9.399104e+02, 9.314007e+02, 9.224626e+02, 9.130896e+02, 9.032701e+02, 8.929869e+02, 8.822166e+02, 8.709285e+02, 8.590836e+02, 8.466324e+02, 8.335120e+02, 8.196423e+02, 8.049199e+02, 7.892081e+02, 7.773685e+02, 7.773685e+02, 7.723215e+02, 7.539991e+02, 7.338536e+02, 7.112666e+02, 6.851369e+02, 6.530873e+02, 6.067892e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 1.812173e+01, 1.722777e+01, 1.644240e+01, 1.574273e+01, 1.511265e+01, 1.454034e+01, 1.401685e+01, 1.353520e+01, 1.308985e+01, 1.229079e+01, 1.159219e+01, 1.097453e+01, 1.042344e+01, 9.927978e+00, 9.479636e+00, 9.071651e+00, 8.698561e+00, 8.537396e+00 },
-    { 1.002802e+03, 1.002879e+03, 1.002761e+03, 1.002293e+03, 1.001520e+03, 1.000477e+03, 9.991888e+02, 9.976792e+02, 9.959660e+02, 9.940643e+02, 9.919867e+02, 9.897443e+02, 9.873461e+02, 9.848001e+02, 9.821133e+02, 9.792915e+02, 9.763399e+02, 9.732630e+02, 9.700647e+02, 9.667483e+02, 9.633167e+02, 9.597722e+02, 9.561169e+02, 9.523525e+02, 9.484801e+02, 9.445009e+02, 9.404153e+02, 9.319263e+02, 9.230117e+02, 9.136657e+02, 9.038770e+02, 8.936289e+02, 8.828987e+02, 8.716569e+02, 8.598655e+02, 8.474766e+02, 8.344297e+02, 8.206476e+02, 8.060311e+02, 7.904497e+02, 7.737278e+02, 7.579981e+02, 7.579981e+02, 7.556200e+02, 7.357661e+02, 7.136015e+02, 6.881464e+02, 6.573909e+02, 6.153366e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 2.217488e+01, 2.100798e+01, 1.999756e+01, 1.910721e+01, 1.831224e+01, 1.759509e+01, 1.694275e+01, 1.634532e+01, 1.579502e+01, 1.481224e+01, 1.395717e+01, 1.320397e+01, 1.253386e+01, 1.193275e+01, 1.138979e+01, 1.089644e+01, 1.044582e+01, 1.025132e+01 },
-    { 1.003301e+03, 1.003374e+03, 1.003240e+03, 1.002760e+03, 1.001978e+03, 1.000926e+03, 9.996317e+02, 9.981173e+02, 9.964006e+02, 9.944964e+02, 9.924174e+02, 9.901744e+02, 9.877765e+02, 9.852317e+02, 9.825466e+02, 9.797273e+02, 9.767788e+02, 9.737057e+02, 9.705117e+02, 9.672002e+02, 9.637741e+02, 9.602357e+02, 9.565872e+02, 9.528300e+02, 9.489656e+02, 9.449949e+02, 9.409185e+02, 9.324499e+02, 9.235587e+02, 9.142393e+02, 9.044810e+02, 8.942675e+02, 8.835771e+02, 8.723808e+02, 8.606421e+02, 8.483145e+02, 8.353397e+02, 8.216433e+02, 8.071300e+02, 7.916755e+02, 7.751129e+02, 7.572112e+02, 7.397236e+02, 7.397236e+02, 7.376351e+02, 7.158670e+02, 6.910307e+02, 6.614056e+02, 6.224177e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 2.641118e+01, 2.492459e+01, 2.365760e+01, 2.255431e+01, 2.157812e+01, 2.070379e+01, 1.991307e+01, 1.919234e+01, 1.853110e+01, 1.735575e+01, 1.633820e+01, 1.544519e+01, 1.465299e+01, 1.394398e+01, 1.330472e+01, 1.272471e+01, 1.219559e+01, 1.196737e+01 },
-    { 1.003799e+03, 1.003867e+03, 1.003718e+03, 1.003226e+03, 1.002434e+03, 1.001374e+03, 1.000074e+03, 9.985546e+02, 9.968342e+02, 9.949276e+02, 9.928472e+02, 9.906037e+02, 9.882060e+02, 9.856622e+02, 9.829789e+02, 9.801620e+02, 9.772166e+02, 9.741472e+02, 9.709575e+02, 9.676509e+02, 9.642303e+02, 9.606980e+02, 9.570560e+02, 9.533061e+02, 9.494495e+02, 9.454873e+02, 9.414200e+02, 9.329716e+02, 9.241036e+02, 9.148106e+02, 9.050822e+02, 8.949030e+02, 8.842517e+02, 8.731003e+02, 8.614135e+02, 8.491462e+02, 8.362421e+02, 8.226295e+02, 8.082171e+02, 7.928859e+02, 7.764776e+02, 7.587742e+02, 7.394631e+02, 7.221957e+02, 7.221957e+02, 7.180684e+02, 6.938025e+02, 6.651772e+02, 6.285755e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 3.085415e+01, 2.899114e+01, 2.743085e+01, 2.608935e+01, 2.491379e+01, 2.386880e+01, 2.292944e+01, 2.207742e+01, 2.129891e+01, 1.992175e+01, 1.873547e+01, 1.769831e+01, 1.678090e+01, 1.596168e+01, 1.522441e+01, 1.455646e+01, 1.394785e+01, 1.368554e+01 },
-    { 1.004794e+03, 1.004851e+03, 1.004672e+03, 1.004156e+03, 1.003343e+03, 1.002268e+03, 1.000955e+03, 9.994262e+02, 9.976988e+02, 9.957873e+02, 9.937039e+02, 9.914593e+02, 9.890622e+02, 9.865203e+02, 9.838405e+02, 9.810284e+02, 9.780890e+02, 9.750269e+02, 9.718457e+02, 9.685487e+02, 9.651388e+02, 9.616185e+02, 9.579896e+02, 9.542540e+02, 9.504129e+02, 9.464673e+02, 9.424180e+02, 9.340094e+02, 9.251869e+02, 9.159458e+02, 9.062765e+02, 8.961646e+02, 8.855900e+02, 8.745266e+02, 8.629411e+02, 8.507913e+02, 8.380247e+02, 8.245746e+02, 8.103569e+02, 7.952627e+02, 7.791486e+02, 7.618204e+02, 7.430047e+02, 7.222960e+02, 6.990495e+02, 6.884241e+02, 6.884241e+02, 6.721233e+02, 6.390876e+02, 5.918565e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 4.047886e+01, 3.763853e+01, 3.535487e+01, 3.344674e+01, 3.180969e+01, 3.037789e+01, 2.910718e+01, 2.796648e+01, 2.693300e+01, 2.512288e+01, 2.357961e+01, 2.224065e+01, 2.106319e+01, 2.001659e+01, 1.907811e+01, 1.823037e+01, 1.745981e+01, 1.712821e+01 },
-    { 1.006033e+03, 1.006074e+03, 1.005858e+03, 1.005311e+03, 1.004475e+03, 1.003380e+03, 1.002051e+03, 1.000511e+03, 9.987744e+02, 9.968567e+02, 9.947697e+02, 9.925235e+02, 9.901269e+02, 9.875875e+02, 9.849118e+02, 9.821055e+02, 9.791735e+02, 9.761202e+02, 9.729494e+02, 9.696642e+02, 9.662676e+02, 9.627618e+02, 9.591490e+02, 9.554308e+02, 9.516086e+02, 9.476835e+02, 9.436561e+02, 9.352963e+02, 9.265295e+02, 9.173517e+02, 9.077544e+02, 8.977242e+02, 8.872428e+02, 8.762860e+02, 8.648229e+02, 8.528147e+02, 8.402129e+02, 8.269570e+02, 8.129704e+02, 7.981554e+02, 7.823850e+02, 7.654899e+02, 7.472367e+02, 7.272894e+02, 7.051352e+02, 6.799228e+02, 6.500386e+02, 6.468076e+02, 6.468076e+02, 6.115335e+02, 5.331214e+02, 4.945548e+02, 4.425148e+02, 5.432590e+01, 4.962472e+01, 4.608487e+01, 4.325173e+01, 4.089396e+01, 3.887801e+01, 3.711989e+01, 3.556340e+01, 3.416897e+01, 3.175810e+01, 2.972984e+01, 2.798722e+01, 2.646614e+01, 2.512189e+01, 2.392202e+01, 2.284216e+01, 2.186357e+01, 2.144324e+01 },
-    { 1.007268e+03, 1.007291e+03, 1.007038e+03, 1.006461e+03, 1.005600e+03, 1.004486e+03, 1.003142e+03, 1.001590e+03, 9.998443e+02, 9.979205e+02, 9.958297e+02, 9.935819e+02, 9.911858e+02, 9.886486e+02, 9.859769e+02, 9.831762e+02, 9.802514e+02, 9.772068e+02, 9.740461e+02, 9.707724e+02, 9.673887e+02, 9.638972e+02, 9.603001e+02, 9.565990e+02, 9.527953e+02, 9.488901e+02, 9.448841e+02, 9.365719e+02, 9.278594e+02, 9.187433e+02, 9.092160e+02, 8.992652e+02, 8.888741e+02, 8.780203e+02, 8.666751e+02, 8.548028e+02, 8.423589e+02, 8.292876e+02, 8.155197e+02, 8.009670e+02, 7.855166e+02, 7.690198e+02, 7.512757e+02, 7.320026e+02, 7.107848e+02, 6.869671e+02, 6.594072e+02, 6.257473e+02, 6.035199e+02, 6.035199e+02, 5.788581e+02, 4.945548e+02, 4.425148e+02, 7.118580e+01, 6.333707e+01, 5.794182e+01, 5.384969e+01, 5.056403e+01, 4.782595e+01, 4.548363e+01, 4.344073e+01, 4.163230e+01, 3.854785e+01, 3.598840e+01, 3.381126e+01, 3.192515e+01, 3.026797e+01, 2.879555e+01, 2.747529e+01, 2.628241e+01, 2.577100e+01 },
-    { 1.008498e+03, 1.008500e+03, 1.008211e+03, 1.007605e+03, 1.006720e+03, 1.005586e+03, 1.004227e+03, 1.002663e+03, 1.000909e+03, 9.989787e+02, 9.968840e+02, 9.946346e+02, 9.922388e+02, 9.897038e+02, 9.870359e+02, 9.842407e+02, 9.813229e+02, 9.782867e+02, 9.751358e+02, 9.718734e+02, 9.685023e+02, 9.650248e+02, 9.614430e+02, 9.577586e+02, 9.539730e+02, 9.500872e+02, 9.461023e+02, 9.378365e+02, 9.291769e+02, 9.201210e+02, 9.106618e+02, 9.007882e+02, 8.904846e+02, 8.797304e+02, 8.684990e+02, 8.567574e+02, 8.444645e+02, 8.315694e+02, 8.180088e+02, 8.037032e+02, 7.885515e+02, 7.724228e+02, 7.551427e+02, 7.364723e+02, 7.160697e+02, 6.934177e+02, 6.676711e+02, 6.372714e+02, 5.986164e+02, 5.546652e+02, 5.546652e+02, 5.364441e+02, 4.425148e+02, 9.322429e+01, 7.947183e+01, 7.123026e+01, 6.539625e+01, 6.090735e+01, 5.727385e+01, 5.423083e+01, 5.161932e+01, 4.933668e+01, 4.549820e+01, 4.235791e+01, 3.971381e+01, 3.744048e+01, 3.545473e+01, 3.369844e+01, 3.212941e+01, 3.071600e+01, 3.011116e+01 },
-    { 1.009724e+03, 1.009703e+03, 1.009378e+03, 1.008743e+03, 1.007834e+03, 1.006681e+03, 1.005307e+03, 1.003731e+03, 1.001968e+03, 1.000031e+03, 9.979328e+02, 9.956817e+02, 9.932861e+02, 9.907531e+02, 9.880889e+02, 9.852990e+02, 9.823879e+02, 9.793600e+02, 9.762187e+02, 9.729673e+02, 9.696085e+02, 9.661447e+02, 9.625779e+02, 9.589098e+02, 9.551419e+02, 9.512752e+02, 9.473107e+02, 9.390903e+02, 9.304825e+02, 9.214851e+02, 9.120922e+02, 9.022936e+02, 8.920750e+02, 8.814171e+02, 8.702956e+02, 8.586798e+02, 8.465318e+02, 8.338049e+02, 8.204413e+02, 8.063689e+02, 7.914972e+02, 7.757099e+02, 7.588551e+02, 7.407281e+02, 7.210440e+02, 6.993864e+02, 6.751089e+02, 6.471129e+02, 6.132290e+02, 5.676445e+02, 4.902055e+02, 4.902055e+02, 4.660584e+02, 1.264857e+02, 9.922039e+01, 8.638009e+01, 7.808826e+01, 7.202671e+01, 6.728001e+01, 6.339638e+01, 6.012078e+01, 5.729581e+01, 5.261480e+01, 4.884071e+01, 4.569563e+01, 4.301221e+01, 4.068191e+01, 3.863030e+01, 3.680412e+01, 3.516393e+01, 3.446335e+01 },
-    { 1.010946e+03, 1.010899e+03, 1.010539e+03, 1.009875e+03, 1.008942e+03, 1.007770e+03, 1.006381e+03, 1.004793e+03, 1.003021e+03, 1.001079e+03, 9.989761e+02, 9.967231e+02, 9.943276e+02, 9.917966e+02, 9.891360e+02, 9.863511e+02, 9.834467e+02, 9.804268e+02, 9.772949e+02, 9.740542e+02, 9.707075e+02, 9.672570e+02, 9.637049e+02, 9.600528e+02, 9.563021e+02, 9.524541e+02, 9.485097e+02, 9.403336e+02, 9.317763e+02, 9.228361e+02, 9.135078e+02, 9.037821e+02, 8.936459e+02, 8.830814e+02, 8.720660e+02, 8.605714e+02, 8.485625e+02, 8.359964e+02, 8.228202e+02, 8.089686e+02, 7.943599e+02, 7.788907e+02, 7.624276e+02, 7.447941e+02, 7.257499e+02, 7.049544e+02, 6.819004e+02, 6.557778e+02, 6.251491e+02, 5.869270e+02, 5.313893e+02, 3.714391e+02, 1.248674e+02, 1.040183e+02, 9.217762e+01, 8.404311e+01, 7.790914e+01, 7.301728e+01, 6.896721e+01, 6.552324e+01, 5.990292e+01, 5.543868e+01, 5.175720e+01, 4.864018e+01, 4.594910e+01, 4.359064e+01, 4.149893e+01, 3.962574e+01, 3.882710e+01 },
-    { 1.012163e+03, 1.012088e+03, 1.011693e+03, 1.011000e+03, 1.010045e+03, 1.008854e+03, 1.007450e+03, 1.005850e+03, 1.004069e+03, 1.002120e+03, 1.000014e+03, 9.977591e+02, 9.953636e+02, 9.928343e+02, 9.901772e+02, 9.873973e+02, 9.844993e+02, 9.814872e+02, 9.783645e+02, 9.751343e+02, 9.717994e+02, 9.683620e+02, 9.648242e+02, 9.611877e+02, 9.574540e+02, 9.536242e+02, 9.496993e+02, 9.415667e+02, 9.330586e+02, 9.241742e+02, 9.149088e+02, 9.052541e+02, 8.951979e+02, 8.847240e+02, 8.738112e+02, 8.624334e+02, 8.505582e+02, 8.381461e+02, 8.251486e+02, 8.115063e+02, 7.971454e+02, 7.819735e+02, 7.658728e+02, 7.486902e+02, 7.302210e+02, 7.101827e+02, 6.881690e+02, 6.635626e+02, 6.353495e+02, 6.016355e+02, 5.579797e+02, 4.888479e+02, 1.615977e+02, 1.250920e+02, 1.079863e+02, 9.709792e+01, 8.923223e+01, 8.313217e+01, 7.818086e+01, 7.403213e+01, 6.736725e+01, 6.215329e+01, 5.789868e+01, 5.432402e+01, 5.125575e+01, 4.857886e+01, 4.621324e+01, 4.410090e+01, 4.320192e+01 },
-    { 1.014586e+03, 1.014447e+03, 1.013983e+03, 1.013234e+03, 1.012233e+03, 1.011005e+03, 1.009571e+03, 1.007948e+03, 1.006149e+03, 1.004188e+03, 1.002074e+03, 9.998147e+02, 9.974190e+02, 9.948930e+02, 9.922423e+02, 9.894719e+02, 9.865862e+02, 9.835892e+02, 9.804843e+02, 9.772744e+02, 9.739622e+02, 9.705501e+02, 9.670401e+02, 9.634339e+02, 9.597330e+02, 9.559385e+02, 9.520515e+02, 9.440027e+02, 9.355899e+02, 9.268131e+02, 9.176688e+02, 9.081505e+02, 8.982477e+02, 8.879467e+02, 8.772294e+02, 8.660732e+02, 8.544507e+02, 8.423279e+02, 8.296642e+02, 8.164100e+02, 8.025045e+02, 7.878734e+02, 7.724235e+02, 7.560374e+02, 7.385630e+02, 7.197994e+02, 6.994734e+02, 6.771996e+02, 6.524086e+02, 6.242028e+02, 5.910111e+02, 5.496409e+02, 3.325171e+02, 1.842362e+02, 1.465147e+02, 1.269950e+02, 1.142706e+02, 1.050030e+02, 9.779601e+01, 9.194265e+01, 8.283961e+01, 7.593573e+01, 7.042025e+01, 6.585664e+01, 6.198437e+01, 5.863598e+01, 5.569772e+01, 5.308891e+01, 5.198255e+01 },
-    { 1.019382e+03, 1.019381e+03, 1.019085e+03, 1.018490e+03, 1.017633e+03, 1.016543e+03, 1.015242e+03, 1.013750e+03, 1.012080e+03, 1.010247e+03, 1.008261e+03, 1.006130e+03, 1.003863e+03, 1.001465e+03, 9.989448e+02, 9.963056e+02, 9.935525e+02, 9.906896e+02, 9.877207e+02, 9.846488e+02, 9.814769e+02, 9.782075e+02, 9.748430e+02, 9.713851e+02, 9.678358e+02, 9.641964e+02, 9.604682e+02, 9.566524e+02, 9.487607e+02, 9.405260e+02, 9.319498e+02, 9.230308e+02, 9.137648e+02, 9.041449e+02, 8.941610e+02, 8.837999e+02, 8.730450e+02, 8.618761e+02, 8.502684e+02, 8.381925e+02, 8.256132e+02, 8.124886e+02, 7.987683e+02, 7.843921e+02, 7.692865e+02, 7.533616e+02, 7.365055e+02, 7.185771e+02, 6.993956e+02, 6.787247e+02, 6.562491e+02, 6.315359e+02, 6.039681e+02, 5.154824e+02, 3.830212e+02, 2.646496e+02, 2.069828e+02, 1.760340e+02, 1.562968e+02, 1.422661e+02, 1.315795e+02, 1.160083e+02, 1.049029e+02, 9.638940e+01, 8.954988e+01, 8.387274e+01, 7.904615e+01, 7.486698e+01, 7.119602e+01, 6.964959e+01 },
-    { 1.024113e+03, 1.024067e+03, 1.023621e+03, 1.022901e+03, 1.021941e+03, 1.020765e+03, 1.019395e+03, 1.017846e+03, 1.016132e+03, 1.014265e+03, 1.012253e+03, 1.010106e+03, 1.007829e+03, 1.005429e+03, 1.002913e+03, 1.000283e+03, 9.975455e+02, 9.947032e+02, 9.917598e+02, 9.887182e+02, 9.855812e+02, 9.823511e+02, 9.790303e+02, 9.756205e+02, 9.721236e+02, 9.685410e+02, 9.648739e+02, 9.611236e+02, 9.533765e+02, 9.453052e+02, 9.369124e+02, 9.281985e+02, 9.191614e+02, 9.097964e+02, 9.000967e+02, 8.900527e+02, 8.796522e+02, 8.688802e+02, 8.577185e+02, 8.461456e+02, 8.341361e+02, 8.216602e+02, 8.086829e+02, 7.951632e+02, 7.810530e+02, 7.662952e+02, 7.508220e+02, 7.345520e+02, 7.173870e+02, 6.992073e+02, 6.798668e+02, 6.591852e+02, 6.369399e+02, 5.724985e+02, 4.910329e+02, 3.948506e+02, 3.099351e+02, 2.537562e+02, 2.180703e+02, 1.938882e+02, 1.763137e+02, 1.520343e+02, 1.356158e+02, 1.234808e+02, 1.139850e+02, 1.062569e+02, 9.978588e+01, 9.424991e+01, 8.943402e+01, 8.741749e+01 },
-    { 1.035675e+03, 1.035311e+03, 1.034531e+03, 1.033530e+03, 1.032334e+03, 1.030961e+03, 1.029428e+03, 1.027747e+03, 1.025927e+03, 1.023976e+03, 1.021903e+03, 1.019713e+03, 1.017411e+03, 1.015002e+03, 1.012491e+03, 1.009880e+03, 1.007173e+03, 1.004374e+03, 1.001485e+03, 9.985089e+02, 9.954475e+02, 9.923031e+02, 9.890778e+02, 9.857733e+02, 9.823911e+02, 9.789326e+02, 9.753993e+02, 9.717922e+02, 9.643607e+02, 9.566447e+02, 9.486492e+02, 9.403770e+02, 9.318294e+02, 9.230061e+02, 9.139049e+02, 9.045223e+02, 8.948531e+02, 8.848905e+02, 8.746263e+02, 8.640502e+02, 8.531509e+02, 8.419148e+02, 8.303268e+02, 8.183697e+02, 8.060243e+02, 7.932691e+02, 7.800804e+02, 7.664315e+02, 7.522934e+02, 7.376341e+02, 7.224185e+02, 7.066088e+02, 6.901648e+02, 6.460069e+02, 5.970435e+02, 5.431697e+02, 4.859275e+02, 4.291799e+02, 3.775639e+02, 3.342222e+02, 2.994701e+02, 2.500002e+02, 2.174557e+02, 1.944393e+02, 1.771357e+02, 1.635139e+02, 1.524136e+02, 1.431262e+02, 1.351940e+02, 1.319110e+02 },
-    { 1.046869e+03, 1.046776e+03, 1.045924e+03, 1.044863e+03, 1.043620e+03, 1.042218e+03, 1.040672e+03, 1.038993e+03, 1.037191e+03, 1.035274e+03, 1.033247e+03, 1.031115e+03, 1.028883e+03, 1.026555e+03, 1.024134e+03, 1.021622e+03, 1.019024e+03, 1.016341e+03, 1.013576e+03, 1.010730e+03, 1.007807e+03, 1.004808e+03, 1.001735e+03, 9.985895e+02, 9.953728e+02, 9.920866e+02, 9.887321e+02, 9.853107e+02, 9.818234e+02, 9.746552e+02, 9.672349e+02, 9.595680e+02, 9.516590e+02, 9.435111e+02, 9.351261e+02, 9.265048e+02, 9.176470e+02, 9.085511e+02, 8.992149e+02, 8.896351e+02, 8.798075e+02, 8.697269e+02, 8.593876e+02, 8.487826e+02, 8.379047e+02, 8.267459e+02, 8.152972e+02, 8.035495e+02, 7.914929e+02, 7.791170e+02, 7.664116e+02, 7.533657e+02, 7.399691e+02, 7.262117e+02, 6.901849e+02, 6.517742e+02, 6.110746e+02, 5.685166e+02, 5.250603e+02, 4.822269e+02, 4.416603e+02, 4.046580e+02, 3.436137e+02, 2.986056e+02, 2.654456e+02, 2.403167e+02, 2.206230e+02, 2.047123e+02, 1.915258e+02, 1.803659e+02, 1.757761e+02 },
-    { 1.087977e+03, 1.087461e+03, 1.086210e+03, 1.084721e+03, 1.083060e+03, 1.081269e+03, 1.079378e+03, 1.077407e+03, 1.075366e+03, 1.073263e+03, 1.071102e+03, 1.068887e+03, 1.066619e+03, 1.064298e+03, 1.061925e+03, 1.059499e+03, 1.057022e+03, 1.054494e+03, 1.051913e+03, 1.049282e+03, 1.046600e+03, 1.043868e+03, 1.041086e+03, 1.038255e+03, 1.035376e+03, 1.032448e+03, 1.029474e+03, 1.026454e+03, 1.023388e+03, 1.020277e+03, 1.017122e+03, 1.010684e+03, 1.004079e+03, 9.973122e+02, 9.903898e+02, 9.833164e+02, 9.760964e+02, 9.687341e+02, 9.612330e+02, 9.535965e+02, 9.458276e+02, 9.379290e+02, 9.299031e+02, 9.217521e+02, 9.134782e+02, 9.050831e+02, 8.965688e+02, 8.879369e+02, 8.791893e+02, 8.703277e+02, 8.613542e+02, 8.522706e+02, 8.430791e+02, 8.337823e+02, 8.243826e+02, 8.148830e+02, 7.907183e+02, 7.660104e+02, 7.408368e+02, 7.152972e+02, 6.895177e+02, 6.636545e+02, 6.378931e+02, 6.124458e+02, 5.633760e+02, 5.180297e+02, 4.773775e+02, 4.416587e+02, 4.106034e+02, 3.836956e+02, 3.603498e+02, 3.400056e+02, 3.315164e+02 },
-    { 1.144464e+03, 1.144394e+03, 1.142346e+03, 1.140147e+03, 1.137845e+03, 1.135473e+03, 1.133056e+03, 1.130609e+03, 1.128142e+03, 1.125662e+03, 1.123170e+03, 1.120670e+03, 1.118160e+03, 1.115640e+03, 1.113109e+03, 1.110565e+03, 1.108008e+03, 1.105436e+03, 1.102847e+03, 1.100241e+03, 1.097616e+03, 1.094972e+03, 1.092308e+03, 1.089623e+03, 1.086917e+03, 1.084191e+03, 1.081442e+03, 1.078673e+03, 1.075882e+03, 1.073069e+03, 1.067382e+03, 1.061611e+03, 1.055760e+03, 1.049832e+03, 1.043830e+03, 1.037757e+03, 1.031616e+03, 1.025410e+03, 1.019143e+03, 1.012818e+03, 1.006438e+03, 1.000005e+03, 9.935232e+02, 9.869944e+02, 9.804214e+02, 9.738069e+02, 9.671532e+02, 9.604629e+02, 9.537382e+02, 9.469816e+02, 9.401953e+02, 9.333815e+02, 9.265425e+02, 9.196807e+02, 9.127981e+02, 8.955157e+02, 8.781528e+02, 8.607440e+02, 8.433248e+02, 8.259298e+02, 8.085937e+02, 7.913508e+02, 7.742351e+02, 7.405206e+02, 7.077210e+02, 6.761060e+02, 6.459306e+02, 6.174111e+02, 5.906939e+02, 5.658425e+02, 5.428404e+02, 5.328608e+02 },
-    { 1.183596e+03, 1.181960e+03, 1.179448e+03, 1.176904e+03, 1.174341e+03, 1.171769e+03, 1.169194e+03, 1.166621e+03, 1.164051e+03, 1.161486e+03, 1.158924e+03, 1.156367e+03, 1.153812e+03, 1.151259e+03, 1.148705e+03, 1.146151e+03, 1.143594e+03, 1.141033e+03, 1.138467e+03, 1.135896e+03, 1.133317e+03, 1.130732e+03, 1.128138e+03, 1.125535e+03, 1.122924e+03, 1.120302e+03, 1.117672e+03, 1.112381e+03, 1.107050e+03, 1.101679e+03, 1.096270e+03, 1.090823e+03, 1.085340e+03, 1.079823e+03, 1.074274e+03, 1.068695e+03, 1.063089e+03, 1.057456e+03, 1.051799e+03, 1.046121e+03, 1.040423e+03, 1.034707e+03, 1.028975e+03, 1.023229e+03, 1.017470e+03, 1.011701e+03, 1.005923e+03, 1.000137e+03, 9.943452e+02, 9.885493e+02, 9.827506e+02, 9.769505e+02, 9.624531e+02, 9.479778e+02, 9.335450e+02, 9.191742e+02, 9.048842e+02, 8.906924e+02, 8.766153e+02, 8.626680e+02, 8.352177e+02, 8.084381e+02, 7.824085e+02, 7.571939e+02, 7.328543e+02, 7.094426e+02, 6.870068e+02, 6.655873e+02, 6.560838e+02 },
-    { 1.212689e+03, 1.210985e+03, 1.208384e+03, 1.205789e+03, 1.203201e+03, 1.200623e+03, 1.198054e+03, 1.195496e+03, 1.192948e+03, 1.190409e+03, 1.187879e+03, 1.185356e+03, 1.182839e+03, 1.180327e+03, 1.177818e+03, 1.175313e+03, 1.172809e+03, 1.170306e+03, 1.167803e+03, 1.165300e+03, 1.162795e+03, 1.160288e+03, 1.157779e+03, 1.155267e+03, 1.150233e+03, 1.145185e+03, 1.140122e+03, 1.135043e+03, 1.129948e+03, 1.124838e+03, 1.119714e+03, 1.114576e+03, 1.109426e+03, 1.104265e+03, 1.099095e+03, 1.093916e+03, 1.088731e+03, 1.083539e+03, 1.078344e+03, 1.073145e+03, 1.067944e+03, 1.062743e+03, 1.057543e+03, 1.052344e+03, 1.047148e+03, 1.041955e+03, 1.036768e+03, 1.031587e+03, 1.026412e+03, 1.013512e+03, 1.000675e+03, 9.879137e+02, 9.752405e+02, 9.626667e+02, 9.502029e+02, 9.378588e+02, 9.256426e+02, 9.016275e+02, 8.782105e+02, 8.554302e+02, 8.333125e+02, 8.118729e+02, 7.911193e+02, 7.710556e+02, 7.516838e+02, 7.430055e+02 },
-    { 1.237391e+03, 1.234940e+03, 1.232378e+03, 1.229829e+03, 1.227295e+03, 1.224773e+03, 1.222265e+03, 1.219768e+03, 1.217282e+03, 1.214806e+03, 1.212339e+03, 1.209879e+03, 1.207427e+03, 1.204981e+03, 1.202540e+03, 1.200104e+03, 1.197672e+03, 1.195242e+03, 1.192815e+03, 1.190390e+03, 1.187967e+03, 1.183123e+03, 1.178281e+03, 1.173440e+03, 1.168598e+03, 1.163755e+03, 1.158910e+03, 1.154064e+03, 1.149216e+03, 1.144368e+03, 1.139520e+03, 1.134673e+03, 1.129827e+03, 1.124984e+03, 1.120143e+03, 1.115307e+03, 1.110475e+03, 1.105649e+03, 1.100829e+03, 1.096017e+03, 1.091213e+03, 1.086416e+03, 1.081630e+03, 1.076854e+03, 1.072088e+03, 1.067334e+03, 1.055502e+03, 1.043755e+03, 1.032099e+03, 1.020544e+03, 1.009096e+03, 9.977616e+02, 9.865465e+02, 9.754563e+02, 9.536690e+02, 9.324316e+02, 9.117668e+02, 8.916883e+02, 8.722007e+02, 8.533039e+02, 8.349908e+02, 8.172512e+02, 8.092803e+02 },
+    T const* first; ///< The pointer to the first entry in the row.
+    Index count;    ///< The number of entries in the row.
+
+    auto begin() const { return first; }
+    auto end() const { return first + count; }
+    auto size() const { return count; }
+    auto back() const -> T const& { return first[count - 1]; }
+    auto operator[](Index i) const -> T const& { return first[i]; }
 };
 
-/// The density of water (tentatively at the vapor state even when water is stable as liquid) at the temperatures and pressures used for interpolation (in kg/m3).
-/// Density values obtained from running the script generate-water-liquid-vapor-density-for-interpolation-wagner-pruss.py and copying its liquid density and pasting below.
-const Vec<Vec<double>> densities_vapor =
+/// Return the entries of a flattened interpolation table along the row of the pressure with index `iP`.
+template<typename T>
+auto row(T const* table, Index iP) -> Row<T>
 {
-    { 9.643203e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 3.722587e-01, 3.560796e-01, 3.467036e-01, 3.396070e-01, 3.334991e-01, 3.279102e-01, 3.226479e-01, 3.176261e-01, 3.128021e-01, 3.086393e-01, 3.086393e-01, 3.081512e-01, 3.036578e-01, 2.993099e-01, 2.950983e-01, 2.910148e-01, 2.870523e-01, 2.832046e-01, 2.794658e-01, 2.758306e-01, 2.722942e-01, 2.655003e-01, 2.590517e-01, 2.529204e-01, 2.470818e-01, 2.415140e-01, 2.361976e-01, 2.311151e-01, 2.262507e-01, 2.215902e-01, 2.171207e-01, 2.128302e-01, 2.087080e-01, 2.047441e-01, 2.009294e-01, 1.972556e-01, 1.937147e-01, 1.902997e-01, 1.870038e-01, 1.838208e-01, 1.807450e-01, 1.777710e-01, 1.748938e-01, 1.721086e-01, 1.694111e-01, 1.667973e-01, 1.606036e-01, 1.548548e-01, 1.495044e-01, 1.445123e-01, 1.398434e-01, 1.354673e-01, 1.313572e-01, 1.274895e-01, 1.204002e-01, 1.140585e-01, 1.083519e-01, 1.031896e-01, 9.849703e-02, 9.421292e-02, 9.028610e-02, 8.667365e-02, 8.510727e-02 },
-    { 9.641478e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 7.034598e-01, 6.746542e-01, 6.576878e-01, 6.446624e-01, 6.333829e-01, 6.230439e-01, 6.133101e-01, 6.040269e-01, 5.951150e-01, 5.903439e-01, 5.903439e-01, 5.865280e-01, 5.782353e-01, 5.702138e-01, 5.624452e-01, 5.549136e-01, 5.476054e-01, 5.336113e-01, 5.203780e-01, 5.078347e-01, 4.959207e-01, 4.845841e-01, 4.737793e-01, 4.634662e-01, 4.536093e-01, 4.441768e-01, 4.351401e-01, 4.264734e-01, 4.181534e-01, 4.101588e-01, 4.024700e-01, 3.950693e-01, 3.879402e-01, 3.810676e-01, 3.744376e-01, 3.680373e-01, 3.618546e-01, 3.558784e-01, 3.500984e-01, 3.445048e-01, 3.390888e-01, 3.338417e-01, 3.214130e-01, 3.098821e-01, 2.991542e-01, 2.891477e-01, 2.797915e-01, 2.710240e-01, 2.627910e-01, 2.550448e-01, 2.408493e-01, 2.281536e-01, 2.167315e-01, 2.063999e-01, 1.970097e-01, 1.884375e-01, 1.805809e-01, 1.733536e-01, 1.702199e-01 },
-    { 9.641478e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 7.158796e-01, 6.846696e-01, 6.669484e-01, 6.535480e-01, 6.420268e-01, 6.315024e-01, 6.216101e-01, 6.121836e-01, 6.031381e-01, 5.976573e-01, 5.976573e-01, 5.944247e-01, 5.860113e-01, 5.778742e-01, 5.699943e-01, 5.623555e-01, 5.549439e-01, 5.407530e-01, 5.273351e-01, 5.146177e-01, 5.025394e-01, 4.910471e-01, 4.800944e-01, 4.696406e-01, 4.596496e-01, 4.500890e-01, 4.409300e-01, 4.321461e-01, 4.237138e-01, 4.156114e-01, 4.078192e-01, 4.003190e-01, 3.930942e-01, 3.861294e-01, 3.794105e-01, 3.729244e-01, 3.666590e-01, 3.606028e-01, 3.547455e-01, 3.490773e-01, 3.435889e-01, 3.382718e-01, 3.256773e-01, 3.139927e-01, 3.031219e-01, 2.929822e-01, 2.835016e-01, 2.746175e-01, 2.662750e-01, 2.584259e-01, 2.440418e-01, 2.311776e-01, 2.196039e-01, 2.091353e-01, 1.996205e-01, 1.909347e-01, 1.829738e-01, 1.756507e-01, 1.724755e-01 },
-    { 9.635155e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.730628e+00, 1.597375e+00, 1.545910e+00, 1.511319e+00, 1.483336e+00, 1.458605e+00, 1.435780e+00, 1.414256e+00, 1.393731e+00, 1.391482e+00, 1.391482e+00, 1.355080e+00, 1.319089e+00, 1.285357e+00, 1.253604e+00, 1.223613e+00, 1.195206e+00, 1.168233e+00, 1.142569e+00, 1.118104e+00, 1.094744e+00, 1.072406e+00, 1.051016e+00, 1.030510e+00, 1.010828e+00, 9.919167e-01, 9.737292e-01, 9.562215e-01, 9.393538e-01, 9.230895e-01, 9.073953e-01, 8.922401e-01, 8.775955e-01, 8.634349e-01, 8.497340e-01, 8.364699e-01, 8.050845e-01, 7.760048e-01, 7.489799e-01, 7.237954e-01, 7.002662e-01, 6.782321e-01, 6.575531e-01, 6.381065e-01, 6.024909e-01, 5.706594e-01, 5.420359e-01, 5.161560e-01, 4.926418e-01, 4.711817e-01, 4.515172e-01, 4.334313e-01, 4.255903e-01 },
-    { 9.624243e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.160772e+00, 2.995788e+00, 2.910289e+00, 2.796735e+00, 2.708054e+00, 2.668049e+00, 2.668049e+00, 2.629677e+00, 2.557902e+00, 2.491282e+00, 2.429003e+00, 2.370491e+00, 2.315304e+00, 2.263086e+00, 2.213541e+00, 2.166422e+00, 2.121517e+00, 2.078643e+00, 2.037643e+00, 1.998375e+00, 1.960719e+00, 1.924562e+00, 1.889807e+00, 1.856364e+00, 1.824154e+00, 1.793103e+00, 1.763145e+00, 1.734217e+00, 1.706265e+00, 1.679236e+00, 1.615397e+00, 1.556380e+00, 1.501635e+00, 1.450698e+00, 1.403172e+00, 1.358716e+00, 1.317033e+00, 1.277868e+00, 1.206211e+00, 1.142239e+00, 1.084764e+00, 1.032833e+00, 9.856754e-01, 9.426565e-01, 9.032512e-01, 8.670200e-01, 8.513154e-01 },
-    { 9.613914e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 4.496590e+00, 4.210763e+00, 4.052196e+00, 3.924348e+00, 3.913667e+00, 3.913667e+00, 3.810941e+00, 3.707260e+00, 3.611252e+00, 3.521687e+00, 3.437685e+00, 3.358570e+00, 3.283796e+00, 3.212914e+00, 3.145552e+00, 3.081390e+00, 3.020156e+00, 2.961616e+00, 2.905561e+00, 2.851812e+00, 2.800206e+00, 2.750600e+00, 2.702864e+00, 2.656882e+00, 2.612548e+00, 2.569765e+00, 2.528446e+00, 2.431040e+00, 2.341198e+00, 2.258019e+00, 2.180747e+00, 2.108746e+00, 2.041471e+00, 1.978456e+00, 1.919295e+00, 1.811166e+00, 1.714742e+00, 1.628186e+00, 1.550033e+00, 1.479102e+00, 1.414425e+00, 1.355202e+00, 1.300766e+00, 1.277175e+00 },
-    { 9.603023e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.288643e+00, 5.619888e+00, 5.376223e+00, 5.194523e+00, 5.145038e+00, 5.145038e+00, 5.037634e+00, 4.895984e+00, 4.765814e+00, 4.645054e+00, 4.532294e+00, 4.426478e+00, 4.326770e+00, 4.232495e+00, 4.143093e+00, 4.058099e+00, 3.977113e+00, 3.899795e+00, 3.825849e+00, 3.755018e+00, 3.687072e+00, 3.621810e+00, 3.559051e+00, 3.498634e+00, 3.440413e+00, 3.384255e+00, 3.252120e+00, 3.130535e+00, 3.018184e+00, 2.913980e+00, 2.817015e+00, 2.726519e+00, 2.641836e+00, 2.562399e+00, 2.417364e+00, 2.288173e+00, 2.172304e+00, 2.067756e+00, 1.972921e+00, 1.886486e+00, 1.807370e+00, 1.734670e+00, 1.703170e+00 },
-    { 9.560707e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.142081e+01, 1.069025e+01, 1.024615e+01, 1.004168e+01, 1.004168e+01, 9.889017e+00, 9.578059e+00, 9.298997e+00, 9.044662e+00, 8.810524e+00, 8.593373e+00, 8.390767e+00, 8.200801e+00, 8.021947e+00, 7.852958e+00, 7.692802e+00, 7.540614e+00, 7.395656e+00, 7.257300e+00, 7.124998e+00, 6.998274e+00, 6.876710e+00, 6.593041e+00, 6.334623e+00, 6.097765e+00, 5.879552e+00, 5.677628e+00, 5.490063e+00, 5.315248e+00, 5.151827e+00, 4.854707e+00, 4.591245e+00, 4.355779e+00, 4.143907e+00, 3.952143e+00, 3.777677e+00, 3.618215e+00, 3.471862e+00, 3.408497e+00 },
-    { 9.518557e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 1.795674e+01, 1.625885e+01, 1.544460e+01, 1.500052e+01, 1.500052e+01, 1.482836e+01, 1.430857e+01, 1.385195e+01, 1.344248e+01, 1.307038e+01, 1.272894e+01, 1.241323e+01, 1.211947e+01, 1.184471e+01, 1.158660e+01, 1.134318e+01, 1.111289e+01, 1.089438e+01, 1.068653e+01, 1.048838e+01, 1.003023e+01, 9.617438e+00, 9.242389e+00, 8.899319e+00, 8.583723e+00, 8.292008e+00, 8.021249e+00, 7.769032e+00, 7.312447e+00, 6.909452e+00, 6.550558e+00, 6.228527e+00, 5.937704e+00, 5.673588e+00, 5.432540e+00, 5.211576e+00, 5.115980e+00 },
-    { 9.476005e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.345840e+01, 2.151971e+01, 2.041049e+01, 2.008995e+01, 2.008995e+01, 1.955280e+01, 1.883130e+01, 1.820210e+01, 1.764201e+01, 1.713638e+01, 1.667503e+01, 1.625053e+01, 1.585721e+01, 1.549070e+01, 1.514749e+01, 1.482475e+01, 1.452019e+01, 1.423186e+01, 1.357203e+01, 1.298463e+01, 1.245597e+01, 1.197604e+01, 1.153727e+01, 1.113378e+01, 1.076088e+01, 1.041478e+01, 9.791003e+00, 9.243024e+00, 8.756768e+00, 8.321683e+00, 7.929638e+00, 7.574237e+00, 7.250352e+00, 6.953811e+00, 6.825614e+00 },
-    { 9.433622e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 2.819669e+01, 2.631333e+01, 2.535112e+01, 2.535112e+01, 2.500357e+01, 2.395107e+01, 2.305828e+01, 2.227910e+01, 2.158632e+01, 2.096192e+01, 2.039317e+01, 1.987068e+01, 1.938731e+01, 1.893750e+01, 1.851683e+01, 1.812173e+01, 1.722777e+01, 1.644240e+01, 1.574273e+01, 1.511265e+01, 1.454034e+01, 1.401685e+01, 1.353520e+01, 1.308985e+01, 1.229079e+01, 1.159219e+01, 1.097453e+01, 1.042344e+01, 9.927978e+00, 9.479636e+00, 9.071651e+00, 8.698561e+00, 8.537396e+00 },
-    { 9.391406e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 3.552054e+01, 3.248816e+01, 3.081844e+01, 3.081844e+01, 3.061085e+01, 2.916581e+01, 2.797096e+01, 2.694664e+01, 2.604822e+01, 2.524720e+01, 2.452403e+01, 2.386457e+01, 2.325832e+01, 2.269720e+01, 2.217488e+01, 2.100799e+01, 1.999756e+01, 1.910720e+01, 1.831224e+01, 1.759509e+01, 1.694275e+01, 1.634532e+01, 1.579502e+01, 1.481224e+01, 1.395717e+01, 1.320397e+01, 1.253386e+01, 1.193275e+01, 1.138979e+01, 1.089644e+01, 1.044582e+01, 1.025132e+01 },
-    { 9.349359e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 4.343613e+01, 3.884294e+01, 3.652505e+01, 3.652505e+01, 3.630381e+01, 3.441891e+01, 3.289368e+01, 3.160604e+01, 3.048965e+01, 2.950337e+01, 2.861954e+01, 2.781857e+01, 2.708609e+01, 2.641118e+01, 2.492459e+01, 2.365762e+01, 2.255430e+01, 2.157812e+01, 2.070378e+01, 1.991307e+01, 1.919234e+01, 1.853110e+01, 1.735575e+01, 1.633820e+01, 1.544519e+01, 1.465299e+01, 1.394398e+01, 1.330472e+01, 1.272471e+01, 1.219559e+01, 1.196737e+01 },
-    { 9.306921e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.165864e+01, 4.524712e+01, 4.250674e+01, 4.250674e+01, 4.199660e+01, 3.964672e+01, 3.777701e+01, 3.621777e+01, 3.487832e+01, 3.370359e+01, 3.265714e+01, 3.171349e+01, 3.085415e+01, 2.899114e+01, 2.743087e+01, 2.608935e+01, 2.491378e+01, 2.386880e+01, 2.292944e+01, 2.207742e+01, 2.129891e+01, 1.992175e+01, 1.873547e+01, 1.769831e+01, 1.678090e+01, 1.596168e+01, 1.522441e+01, 1.455646e+01, 1.394785e+01, 1.368554e+01 },
-    { 9.222559e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 6.672203e+01, 5.760496e+01, 5.546294e+01, 5.546294e+01, 5.301851e+01, 4.977258e+01, 4.723653e+01, 4.515102e+01, 4.337971e+01, 4.184014e+01, 4.047887e+01, 3.763857e+01, 3.535487e+01, 3.344674e+01, 3.180969e+01, 3.037789e+01, 2.910718e+01, 2.796647e+01, 2.693300e+01, 2.512288e+01, 2.357961e+01, 2.224065e+01, 2.106319e+01, 2.001659e+01, 1.907811e+01, 1.823037e+01, 1.745981e+01, 1.712821e+01 },
-    { 9.116970e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 9.269212e+01, 7.495014e+01, 7.409722e+01, 7.409722e+01, 6.791117e+01, 6.318829e+01, 5.961163e+01, 5.673285e+01, 5.432569e+01, 4.962471e+01, 4.608487e+01, 4.325173e+01, 4.089396e+01, 3.887801e+01, 3.711991e+01, 3.556338e+01, 3.416896e+01, 3.175810e+01, 2.972984e+01, 2.798722e+01, 2.646614e+01, 2.512189e+01, 2.392202e+01, 2.284216e+01, 2.186357e+01, 2.144324e+01 },
-    { 9.011918e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.095163e+02, 9.672252e+01, 9.672252e+01, 9.036233e+01, 8.155192e+01, 7.564007e+01, 7.118580e+01, 6.333709e+01, 5.794180e+01, 5.384969e+01, 5.056406e+01, 4.782595e+01, 4.548363e+01, 4.344073e+01, 4.163231e+01, 3.854786e+01, 3.598840e+01, 3.381126e+01, 3.192515e+01, 3.026797e+01, 2.879555e+01, 2.747529e+01, 2.628241e+01, 2.577100e+01 },
-    { 8.906876e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.261091e+02, 1.261091e+02, 1.195595e+02, 1.026708e+02, 9.322313e+01, 7.947183e+01, 7.123001e+01, 6.539625e+01, 6.090735e+01, 5.727385e+01, 5.423083e+01, 5.161932e+01, 4.933668e+01, 4.549818e+01, 4.235792e+01, 3.971381e+01, 3.744048e+01, 3.545473e+01, 3.369844e+01, 3.212941e+01, 3.071600e+01, 3.011116e+01 },
-    { 8.801870e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 1.704959e+02, 1.704959e+02, 1.604910e+02, 1.264833e+02, 9.922053e+01, 8.638009e+01, 7.808827e+01, 7.202670e+01, 6.728001e+01, 6.339638e+01, 6.012079e+01, 5.729581e+01, 5.261480e+01, 4.884071e+01, 4.569563e+01, 4.301221e+01, 4.068191e+01, 3.863030e+01, 3.680412e+01, 3.516393e+01, 3.446335e+01 },
-    { 8.697450e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496711e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 2.120814e+02, 2.180843e+02, 1.248678e+02, 1.040182e+02, 9.217763e+01, 8.404303e+01, 7.790913e+01, 7.301728e+01, 6.896722e+01, 6.552324e+01, 5.990292e+01, 5.543866e+01, 5.175720e+01, 4.864018e+01, 4.594910e+01, 4.359064e+01, 4.149893e+01, 3.962574e+01, 3.882710e+01 },
-    { 8.593104e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496711e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 2.120807e+02, 4.888569e+02, 1.615916e+02, 1.250914e+02, 1.079863e+02, 9.709792e+01, 8.923220e+01, 8.313225e+01, 7.818087e+01, 7.403213e+01, 6.736725e+01, 6.215329e+01, 5.789867e+01, 5.432402e+01, 5.125575e+01, 4.857886e+01, 4.621325e+01, 4.410090e+01, 4.320192e+01 },
-    { 8.384736e-02, 1.075623e-01, 1.433844e-01, 1.878941e-01, 2.406048e-01, 3.001147e-01, 3.652466e-01, 4.357790e-01, 5.123120e-01, 5.958823e-01, 6.877107e-01, 7.890949e-01, 9.013791e-01, 1.025954e+00, 1.164268e+00, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 2.120816e+02, 5.496396e+02, 3.325120e+02, 1.842364e+02, 1.465143e+02, 1.269952e+02, 1.142706e+02, 1.050031e+02, 9.779601e+01, 9.194265e+01, 8.283961e+01, 7.593573e+01, 7.042023e+01, 6.585664e+01, 6.198437e+01, 5.863598e+01, 5.569772e+01, 5.308891e+01, 5.198255e+01 },
-    { 1.019382e+03, 1.019381e+03, 1.019085e+03, 1.018490e+03, 1.878941e-01, 1.016543e+03, 1.015242e+03, 1.013750e+03, 1.012080e+03, 1.010247e+03, 1.008261e+03, 1.006130e+03, 1.003863e+03, 1.001465e+03, 9.989448e+02, 8.118511e+02, 1.317842e+00, 1.488285e+00, 1.677303e+00, 1.886713e+00, 2.118456e+00, 2.374604e+00, 2.657371e+00, 2.969119e+00, 3.312371e+00, 3.689815e+00, 4.104313e+00, 4.558908e+00, 5.601497e+00, 6.845757e+00, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 2.120816e+02, 6.039681e+02, 5.154816e+02, 3.830216e+02, 2.646496e+02, 2.069820e+02, 1.760340e+02, 1.562968e+02, 1.422659e+02, 1.315795e+02, 1.160083e+02, 1.049029e+02, 9.638941e+01, 8.954986e+01, 8.387274e+01, 7.904615e+01, 7.486698e+01, 7.119602e+01, 6.964959e+01 },
-    { 1.024113e+03, 1.024067e+03, 1.023621e+03, 1.022901e+03, 1.021941e+03, 1.020765e+03, 1.019395e+03, 8.568299e+02, 4.357790e-01, 8.452750e+02, 1.012253e+03, 1.010106e+03, 1.007829e+03, 1.005429e+03, 1.002913e+03, 1.000283e+03, 9.975455e+02, 3.220000e+02, 3.220000e+02, 1.886713e+00, 2.792723e+02, 9.823511e+02, 9.790303e+02, 9.756205e+02, 9.721236e+02, 9.685410e+02, 9.648739e+02, 9.611236e+02, 9.533765e+02, 9.453052e+02, 8.323071e+00, 1.006811e+01, 1.211880e+01, 1.451623e+01, 1.730438e+01, 2.052982e+01, 2.424119e+01, 2.848879e+01, 3.332405e+01, 3.879915e+01, 4.496710e+01, 5.188292e+01, 5.960745e+01, 6.821542e+01, 7.780847e+01, 8.853383e+01, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 2.120816e+02, 6.369397e+02, 5.724986e+02, 4.910329e+02, 3.948506e+02, 3.099346e+02, 2.537562e+02, 2.180703e+02, 1.938883e+02, 1.763136e+02, 1.520343e+02, 1.356158e+02, 1.234808e+02, 1.139850e+02, 1.062569e+02, 9.978590e+01, 9.424991e+01, 8.943402e+01, 8.741749e+01 },
-    { 8.953265e+02, 8.914262e+02, 8.853085e+02, 8.792579e+02, 8.732677e+02, 8.673318e+02, 8.614440e+02, 8.555989e+02, 8.497910e+02, 8.440152e+02, 8.382668e+02, 8.325411e+02, 8.268335e+02, 8.211398e+02, 8.154557e+02, 8.097772e+02, 8.041003e+02, 7.984210e+02, 7.927352e+02, 7.870391e+02, 7.813288e+02, 7.756001e+02, 7.698490e+02, 7.640714e+02, 7.582628e+02, 7.524189e+02, 7.465350e+02, 7.406063e+02, 9.643607e+02, 9.566447e+02, 9.486492e+02, 9.403770e+02, 6.775178e+02, 9.230061e+02, 3.220230e+02, 3.223187e+02, 3.245625e+02, 3.318334e+02, 3.332405e+01, 3.006904e+02, 3.016625e+02, 3.020157e+02, 3.021493e+02, 3.021839e+02, 3.441326e+02, 6.108897e+02, 1.006111e+02, 1.143767e+02, 1.303755e+02, 1.495947e+02, 1.742462e+02, 2.120807e+02, 6.901647e+02, 6.460069e+02, 5.970437e+02, 5.431698e+02, 4.859275e+02, 4.291793e+02, 3.775647e+02, 3.342221e+02, 2.994707e+02, 2.500002e+02, 2.174557e+02, 1.944393e+02, 1.771357e+02, 1.635139e+02, 1.524136e+02, 1.431262e+02, 1.351940e+02, 1.319110e+02 },
-    { 8.972144e+02, 8.964058e+02, 8.902515e+02, 8.841602e+02, 8.781269e+02, 8.721464e+02, 8.662135e+02, 8.603231e+02, 8.544702e+02, 8.486499e+02, 8.428575e+02, 8.370883e+02, 8.313380e+02, 8.256022e+02, 8.198766e+02, 8.141572e+02, 8.084399e+02, 8.027205e+02, 7.969951e+02, 7.912596e+02, 7.855100e+02, 7.797421e+02, 7.739519e+02, 7.681349e+02, 7.622869e+02, 7.564032e+02, 7.504791e+02, 7.445096e+02, 7.384894e+02, 7.262743e+02, 7.137846e+02, 7.009626e+02, 6.877399e+02, 6.740326e+02, 6.597361e+02, 6.447189e+02, 6.289229e+02, 6.139811e+02, 6.060230e+02, 6.035214e+02, 6.013613e+02, 3.993695e+02, 3.997873e+02, 3.999468e+02, 3.999891e+02, 3.999530e+02, 6.108897e+02, 3.018248e+02, 3.460542e+02, 3.570470e+02, 5.303403e+02, 1.742462e+02, 2.120795e+02, 7.262117e+02, 6.901849e+02, 6.517738e+02, 6.110747e+02, 5.685166e+02, 5.250601e+02, 4.822256e+02, 4.416603e+02, 4.046582e+02, 3.436142e+02, 2.986055e+02, 2.654456e+02, 2.403167e+02, 2.206230e+02, 2.047124e+02, 1.915258e+02, 1.803659e+02, 1.757761e+02 },
-    { 1.087977e+03, 1.087461e+03, 1.086210e+03, 1.084721e+03, 1.083060e+03, 1.081269e+03, 1.079378e+03, 1.077407e+03, 1.075366e+03, 1.073263e+03, 1.071102e+03, 1.068887e+03, 1.066619e+03, 1.064298e+03, 1.061925e+03, 1.059499e+03, 1.057022e+03, 1.054494e+03, 1.051913e+03, 1.049282e+03, 1.046600e+03, 1.043868e+03, 1.041086e+03, 1.038255e+03, 1.035376e+03, 1.032448e+03, 1.029474e+03, 1.026454e+03, 1.023388e+03, 1.020277e+03, 1.017122e+03, 1.010684e+03, 1.004079e+03, 9.973122e+02, 9.903898e+02, 9.833164e+02, 9.760964e+02, 9.687341e+02, 9.612330e+02, 9.535965e+02, 9.458276e+02, 9.379289e+02, 3.879915e+01, 5.910107e+02, 5.850534e+02, 5.765475e+02, 6.821543e+01, 6.251988e+02, 6.108897e+02, 5.950220e+02, 5.770596e+02, 5.561307e+02, 5.303403e+02, 4.945548e+02, 4.425148e+02, 8.148830e+02, 7.907183e+02, 7.660104e+02, 7.408368e+02, 7.152972e+02, 6.895182e+02, 6.636541e+02, 6.378931e+02, 6.124468e+02, 5.633760e+02, 5.180302e+02, 4.773775e+02, 4.416588e+02, 4.106034e+02, 3.836958e+02, 3.603498e+02, 3.400057e+02, 3.315167e+02 },
-    { 1.144464e+03, 1.144394e+03, 1.142346e+03, 1.140147e+03, 1.137845e+03, 1.135473e+03, 1.133056e+03, 1.130609e+03, 1.128142e+03, 1.125662e+03, 1.123170e+03, 1.120670e+03, 1.118160e+03, 1.115640e+03, 1.113109e+03, 1.110565e+03, 1.108008e+03, 1.105436e+03, 1.102847e+03, 1.100241e+03, 1.097616e+03, 1.094972e+03, 1.092308e+03, 1.089623e+03, 1.086917e+03, 1.084191e+03, 1.081442e+03, 1.078673e+03, 1.075882e+03, 1.073069e+03, 1.067382e+03, 1.061611e+03, 1.055760e+03, 1.049832e+03, 1.043830e+03, 1.037757e+03, 1.031616e+03, 1.025410e+03, 1.019143e+03, 1.012818e+03, 1.006438e+03, 1.000005e+03, 9.935232e+02, 9.869944e+02, 9.804214e+02, 9.738070e+02, 9.671533e+02, 9.604629e+02, 9.537382e+02, 9.469816e+02, 9.401953e+02, 9.333815e+02, 9.265425e+02, 9.196806e+02, 9.127981e+02, 8.955158e+02, 8.781527e+02, 8.607440e+02, 8.433248e+02, 8.259298e+02, 8.085937e+02, 7.913511e+02, 7.742352e+02, 7.405206e+02, 7.077209e+02, 6.761056e+02, 6.459309e+02, 6.174111e+02, 5.906939e+02, 5.658425e+02, 5.428404e+02, 5.328608e+02 },
-    { 1.183596e+03, 1.181960e+03, 1.179448e+03, 1.176904e+03, 1.174341e+03, 1.171769e+03, 1.169194e+03, 1.166621e+03, 1.164051e+03, 1.161486e+03, 1.158924e+03, 1.156367e+03, 1.153812e+03, 1.151259e+03, 1.148705e+03, 1.146151e+03, 1.143594e+03, 1.141033e+03, 1.138467e+03, 1.135896e+03, 1.133317e+03, 1.130732e+03, 1.128138e+03, 1.125535e+03, 1.122924e+03, 1.120302e+03, 1.117672e+03, 1.112381e+03, 1.107050e+03, 1.101679e+03, 1.096270e+03, 1.090823e+03, 1.085340e+03, 1.079823e+03, 1.074274e+03, 1.068696e+03, 1.063089e+03, 1.057456e+03, 1.051799e+03, 1.046121e+03, 1.040423e+03, 1.034707e+03, 1.028975e+03, 1.023229e+03, 1.017470e+03, 1.011701e+03, 1.005923e+03, 1.000137e+03, 9.943451e+02, 9.885492e+02, 9.827504e+02, 9.769502e+02, 9.624531e+02, 9.479778e+02, 9.335454e+02, 9.191744e+02, 9.048842e+02, 8.906924e+02, 8.766153e+02, 8.626680e+02, 8.352181e+02, 8.084379e+02, 7.824078e+02, 7.571939e+02, 7.328547e+02, 7.094426e+02, 6.870068e+02, 6.655873e+02, 6.560838e+02 },
-    { 1.212689e+03, 1.210985e+03, 1.208384e+03, 1.205789e+03, 1.203201e+03, 1.200623e+03, 1.198054e+03, 1.195496e+03, 1.192948e+03, 1.190409e+03, 1.187879e+03, 1.185356e+03, 1.182839e+03, 1.180327e+03, 1.177818e+03, 1.175313e+03, 1.172809e+03, 1.170306e+03, 1.167803e+03, 1.165300e+03, 1.162795e+03, 1.160288e+03, 1.157779e+03, 1.155267e+03, 1.150233e+03, 1.145185e+03, 1.140122e+03, 1.135042e+03, 1.129948e+03, 1.124838e+03, 1.119714e+03, 1.114576e+03, 1.109426e+03, 1.104265e+03, 1.099095e+03, 1.093916e+03, 1.088731e+03, 1.083539e+03, 1.078344e+03, 1.073145e+03, 1.067944e+03, 1.062744e+03, 1.057543e+03, 1.052344e+03, 1.047148e+03, 1.041955e+03, 1.036768e+03, 1.031587e+03, 1.026412e+03, 1.013512e+03, 1.000675e+03, 9.879137e+02, 9.752404e+02, 9.626668e+02, 9.502027e+02, 9.378584e+02, 9.256426e+02, 9.016275e+02, 8.782105e+02, 8.554304e+02, 8.333125e+02, 8.118729e+02, 7.911193e+02, 7.710561e+02, 7.516838e+02, 7.430054e+02 },
-    { 1.237391e+03, 1.234940e+03, 1.232378e+03, 1.229829e+03, 1.227295e+03, 1.224773e+03, 1.222265e+03, 1.219768e+03, 1.217282e+03, 1.214806e+03, 1.212339e+03, 1.209879e+03, 1.207427e+03, 1.204981e+03, 1.202540e+03, 1.200104e+03, 1.197672e+03, 1.195242e+03, 1.192815e+03, 1.190390e+03, 1.187967e+03, 1.183123e+03, 1.178281e+03, 1.173440e+03, 1.168598e+03, 1.163755e+03, 1.158910e+03, 1.154064e+03, 1.149216e+03, 1.144368e+03, 1.139520e+03, 1.134673e+03, 1.129827e+03, 1.124984e+03, 1.120143e+03, 1.115307e+03, 1.110475e+03, 1.105649e+03, 1.100829e+03, 1.096017e+03, 1.091213e+03, 1.086416e+03, 1.081630e+03, 1.076854e+03, 1.072088e+03, 1.067334e+03, 1.055502e+03, 1.043755e+03, 1.032100e+03, 1.020544e+03, 1.009096e+03, 9.977622e+02, 9.865466e+02, 9.754563e+02, 9.536690e+02, 9.324319e+02, 9.117666e+02, 8.916878e+02, 8.722007e+02, 8.533039e+02, 8.349913e+02, 8.172513e+02, 8.092803e+02 },
-};
+    return { table + waterInterpOffsets[iP], waterInterpOffsets[iP + 1] - waterInterpOffsets[iP] };
+}
+
+/// Return the temperatures along the row of the pressure with index `iP`.
+auto temperatures(Index iP) -> Row<double>
+{
+    return row(waterInterpTemperatures, iP);
+}
+
+/// Return the first temperature index, for the pressure with index `iP`, at which water has changed its state of matter from liquid to gas.
+auto transitions(Index iP) -> Index
+{
+    return waterInterpTransitions[iP];
+}
+
+/// Return the tabulated densities of water with given state of matter.
+auto densities(StateOfMatter som) -> double const*
+{
+    return (som == StateOfMatter::Liquid) ? densities_liquid : densities_vapor;
+}
+
+/// Return the tabulated thermodynamic properties of water with given state of matter.
+auto thermoprops(StateOfMatter som) -> double const*
+{
+    return (som == StateOfMatter::Liquid) ? waterInterpThermoPropsLiquid : waterInterpThermoPropsVapor;
+}
+
+/// Return the thermodynamic properties of water at the interpolation point with given index (in the flattened tables).
+auto thermopropsAt(double const* table, Index ipoint) -> WaterThermoProps
+{
+    auto const* x = table + ipoint * waterInterpNumThermoProps;
+
+    WaterThermoProps props;
+    props.T   = x[0];
+    props.V   = x[1];
+    props.S   = x[2];
+    props.A   = x[3];
+    props.U   = x[4];
+    props.H   = x[5];
+    props.G   = x[6];
+    props.Cv  = x[7];
+    props.Cp  = x[8];
+    props.D   = x[9];
+    props.DT  = x[10];
+    props.DP  = x[11];
+    props.DTT = x[12];
+    props.DTP = x[13];
+    props.DPP = x[14];
+    props.P   = x[15];
+    props.PT  = x[16];
+    props.PD  = x[17];
+    props.PTT = x[18];
+    props.PTD = x[19];
+    props.PDD = x[20];
+    return props;
+}
+
+/// Return the tabulated thermodynamic properties of water with given state of matter organized by pressure rows.
+auto createWaterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>>
+{
+    auto const* table = thermoprops(som);
+
+    Vec<Vec<WaterThermoProps>> data(numpressures);
+
+    for(auto iP = 0; iP < numpressures; ++iP)
+        for(auto ipoint = waterInterpOffsets[iP]; ipoint < waterInterpOffsets[iP + 1]; ++ipoint)
+            data[iP].push_back(thermopropsAt(table, ipoint));
+
+    return data;
+}
+
+} // namespace
 
 auto waterDensityWagnerPrussInterp(real const& T, real const& P, StateOfMatter som) -> real
 {
@@ -195,23 +287,25 @@ auto waterDensityWagnerPrussInterp(real const& T, real const& P, StateOfMatter s
 
     const auto PMPa = P * 1e-6; // from Pa to MPa
 
-    errorif(PMPa > pressures.back(), "Unable to interpolate water density at ", T, " K and ", PMPa, " MPa because interpolation over pressure is limited to ", pressures.back(), " MPa.");
+    const auto Pmax = pressures[numpressures - 1];
 
-    const Index iP = std::lower_bound(pressures.begin(), pressures.end(), PMPa) - pressures.begin();
+    errorif(PMPa > Pmax, "Unable to interpolate water density at ", T, " K and ", PMPa, " MPa because interpolation over pressure is limited to ", Pmax, " MPa.");
 
-    const Index iPmax = pressures.size() - 1;
+    const Index iP = std::lower_bound(std::begin(pressures), std::end(pressures), PMPa) - std::begin(pressures);
+
+    const Index iPmax = numpressures - 1;
 
     // Set indices of pressure so that iP sits on the middle, unless iP is 0 or iPmax
     const Index iP0 = iP == 0 ? 0 : iP == iPmax ? iPmax - 2 : iP - 1;
     const Index iP1 = iP0 + 1;
     const Index iP2 = iP0 + 2;
 
-    auto const& densities = (som == StateOfMatter::Liquid) ? densities_liquid : densities_vapor;
+    auto const* table = densities(som);
 
     auto interpolateAtT = [&](Index indexP)
     {
-        auto const& Ts = temperatures[indexP];
-        auto const& Ds = densities[indexP];
+        const auto Ts = temperatures(indexP);
+        const auto Ds = row(table, indexP);
 
         errorif(T > Ts.back(), "Unable to interpolate water density at ", T, " K and ", PMPa, " MPa because interpolation over temperature is limited to ", Ts.back(), " K along the interpolation data row corresponding to ", pressures[indexP], " MPa.");
 
@@ -238,103 +332,62 @@ auto waterDensityWagnerPrussInterp(real const& T, real const& P, StateOfMatter s
     return interpolateQuadratic(PMPa, P0, P1, P2, D0, D1, D2);
 }
 
-auto parseWaterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>>
-{
-    // TODO: Use som here to distinguish different data files to fetch interpolation data. This data must be regenerated for liquid and vapor states.
-    const auto text = Embedded::get("interpolation/WaterThermoPropsWagnerPruss.txt");
-    std::istringstream file(text);
-    String line;
-
-    Vec<Vec<WaterThermoProps>> data;
-
-    while(std::getline(file, line))
-    {
-        if(line[0] == 'P')
-        {
-            data.push_back(Vec<WaterThermoProps>());
-        }
-        else
-        {
-            std::istringstream ss(line);
-
-            WaterThermoProps props;
-
-            ss >> props.T.val()
-               >> props.V.val()
-               >> props.S.val()
-               >> props.A.val()
-               >> props.U.val()
-               >> props.H.val()
-               >> props.G.val()
-               >> props.Cv.val()
-               >> props.Cp.val()
-               >> props.D.val()
-               >> props.DT.val()
-               >> props.DP.val()
-               >> props.DTT.val()
-               >> props.DTP.val()
-               >> props.DPP.val()
-               >> props.P.val()
-               >> props.PT.val()
-               >> props.PD.val()
-               >> props.PTT.val()
-               >> props.PTD.val()
-               >> props.PDD.val();
-
-            data.back().push_back(props);
-        }
-    }
-
-    return data;
-}
-
-auto waterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>> const&
+auto waterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>>
 {
-    thread_local Vec<Vec<WaterThermoProps>> data = parseWaterThermoPropsWagnerPrussInterpData(som);
-    return data;
+    return createWaterThermoPropsWagnerPrussInterpData(som);
 }
 
 auto waterThermoPropsWagnerPrussInterp(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
     const auto PMPa = P * 1e-6; // from Pa to MPa
 
-    const Index iP = std::lower_bound(pressures.begin(), pressures.end(), PMPa) - pressures.begin();
-    const Index iT = std::lower_bound(temperatures[iP].begin(), temperatures[iP].end(), T) - temperatures[iP].begin();
+    const auto Pmax = pressures[numpressures - 1];
 
-    const Index iPmax = iT < transitions[iP] ? pressures.size() : iP; // check if (T, P) is within liquid/supercritical state
+    errorif(PMPa > Pmax, "Unable to interpolate water properties at ", T, " K and ", PMPa, " MPa because interpolation over pressure is limited to ", Pmax, " MPa.");
+
+    const Index iP = std::lower_bound(std::begin(pressures), std::end(pressures), PMPa) - std::begin(pressures);
+    const Index iT = std::lower_bound(temperatures(iP).begin(), temperatures(iP).end(), T) - temperatures(iP).begin();
+
+    const Index iPmax = iT < transitions(iP) ? numpressures : iP; // check if (T, P) is within liquid/supercritical state
 
     // Set indices of pressures so that if there is phase transition along pressure, pressures below that value are used
     const Index iP0 = iPmax > 2 ? std::min(iPmax - 3, iP) : 0;
     const Index iP1 = iPmax > 1 ? iP0 + 1 : 0;
     const Index iP2 = iPmax > 0 ? iP1 + 1 : 0;
 
-    auto const& data = waterThermoPropsWagnerPrussInterpData(som);
+    // The properties of water in liquid (vapor) state are used even when water is stable as vapor (liquid), so that the desired branch is
+    // followed near saturation. This is consistent with the interpolation of the densities used as initial guesses in waterDensityWagnerPruss.
+    auto const* table = thermoprops(som);
 
     auto interpolateAtT = [&](Index indexP)
     {
-        auto const& Ts = temperatures[indexP];
-        auto const& Ds = data[indexP];
+        const auto Ts = temperatures(indexP);
 
         const Index iT = std::lower_bound(Ts.begin(), Ts.end(), T) - Ts.begin();
 
-        const auto iTtran = std::min(transitions[indexP], Ts.size()); // use min in case transitions[indexP] == 99
-        const auto iTmax = iT < transitions[indexP] ? iTtran : Ts.size(); // used for ensuring that interpolation is performed within same state of matter
+        const auto iTtran = std::min(transitions(indexP), Ts.size()); // use min in case transitions(indexP) == 99
+        const auto iTmax = iT < transitions(indexP) ? iTtran : Ts.size(); // used for ensuring that interpolation is performed within same state of matter
 
         // Set indices of temperature so that if there is phase transition along temperature, temperatures below that value are used
         const Index iT0 = std::min(iTmax - 3, iT);
         const Index iT1 = iT0 + 1;
         const Index iT2 = iT0 + 2;
 
-        return interpolateQuadratic(T, Ts[iT0], Ts[iT1], Ts[iT2], Ds[iT0], Ds[iT1], Ds[iT2]);
+        const auto offset = waterInterpOffsets[indexP];
+
+        return interpolateQuadratic(T, Ts[iT0], Ts[iT1], Ts[iT2],
+            thermopropsAt(table, offset + iT0),
+            thermopropsAt(table, offset + iT1),
+            thermopropsAt(table, offset + iT2));
     };
 
     const auto P0 = pressures[iP0];
     const auto P1 = pressures[iP1];
     const auto P2 = pressures[iP2];
 
-    const auto D0 = interpolateAtT(iP0); // density at T and P=P0
-    const auto D1 = interpolateAtT(iP1); // density at T and P=P1
-    const auto D2 = interpolateAtT(iP2); // density at T and P=P2
+    const auto D0 = interpolateAtT(iP0); // water properties at T and P=P0
+    const auto D1 = interpolateAtT(iP1); // water properties at T and P=P1
+    const auto D2 = interpolateAtT(iP2); // water properties at T and P=P2
 
     return interpolateQuadratic(PMPa, P0, P1, P2, D0, D1, D2);
 }
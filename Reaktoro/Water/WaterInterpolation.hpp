@@ -51,8 +51,11 @@ auto waterThermoPropsWagnerPrussInterp(real const& T, real const& P, StateOfMatt
 /// shown in Table 13.2 of *Wagner, W., Pruss, A. (2002). The IAPWS Formulation 1995 for the
 /// Thermodynamic Properties of Ordinary Water Substance for General and Scientific Use. Journal of
 /// Physical and Chemical Reference Data, 31(2), 387. https://doi.org/10.1063/1.1461829*.
-/// @note The first call to this function will trigger a parsing operation of embedded text data.
+/// The properties are tabulated for water in liquid state (even when water is stable as vapor)
+/// and for water in vapor state (even when water is stable as liquid) in constexpr arrays, so that
+/// no parsing is needed. The interpolation methods above read these arrays directly. This function
+/// only returns a copy of them organized in pressure rows for inspection, and nothing is cached.
 /// @param som The desired state of matter for water (the actual state of matter may end up being different!)
-auto waterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>> const&;
+auto waterThermoPropsWagnerPrussInterpData(StateOfMatter som) -> Vec<Vec<WaterThermoProps>>;
 
 } // namespace Reaktoro
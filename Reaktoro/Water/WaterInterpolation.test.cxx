@@ -39,6 +39,13 @@ using namespace Reaktoro;
         CHECK( actual == Approx(expected).epsilon(reltol) );                        \
     }
 
+#define CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP_FALLBACK(T, PMPa, reltol, som, fallback)  \
+    {                                                                                          \
+        auto expected = waterThermoPropsWagnerPruss(T, PMPa*1e6, fallback).D.val();            \
+        auto actual = waterThermoPropsWagnerPrussInterp(T, PMPa*1e6, som).D.val();             \
+        CHECK( actual == Approx(expected).epsilon(reltol) );                                   \
+    }
+
 TEST_CASE("Testing water interpolation methods", "[WaterInterpolation]")
 {
     CHECK_WATER_DENSITY_WAGNER_PRUSS_INTERP( 300.000,    0.05, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
@@ -67,38 +74,36 @@ TEST_CASE("Testing water interpolation methods", "[WaterInterpolation]")
     CHECK_WATER_DENSITY_WAGNER_PRUSS_INTERP( 723.000,  125.00, 0.05, StateOfMatter::Gas); // permit 5% error deviation
     CHECK_WATER_DENSITY_WAGNER_PRUSS_INTERP( 834.000,  345.00, 0.02, StateOfMatter::Gas); // permit 2% error deviation
 
-    // TODO: Uncomment the tests below once waterThermoPropsWagnerPrussInterp
-    // uses dedicated data for liquid-state and vapor-state. Currently, it
-    // contains just one data set that mixes both states (values corresponding
-    // to stable conditions). However, it is important in some cases to enforce
-    // liquid-like props even when water is in stable gas condition (an
-    // vice-versa).
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 300.000,    0.05, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 354.467,    0.05, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 354.468,    0.05, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 400.000,    0.05, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP(1273.000,    0.05, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP(1273.000, 1000.00, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 353.000,    2.00, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 423.000,    8.00, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 566.000,   14.00, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 690.000,   87.00, 0.02, StateOfMatter::Liquid); // permit 2% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 723.000,  125.00, 0.05, StateOfMatter::Liquid); // permit 5% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 834.000,  345.00, 0.02, StateOfMatter::Liquid); // permit 2% error deviation
+
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 354.467,    0.05, 0.01, StateOfMatter::Gas); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 354.468,    0.05, 0.01, StateOfMatter::Gas); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 400.000,    0.05, 0.01, StateOfMatter::Gas); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP(1273.000,    0.05, 0.01, StateOfMatter::Gas); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP(1273.000, 1000.00, 0.01, StateOfMatter::Gas); // permit 1% error deviation
 
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 300.000,    0.05, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 354.467,    0.05, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 354.468,    0.05, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 400.000,    0.05, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP(1273.000,    0.05, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP(1273.000, 1000.00, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 353.000,    2.00, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 423.000,    8.00, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 566.000,   14.00, 0.01, StateOfMatter::Liquid); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 690.000,   87.00, 0.02, StateOfMatter::Liquid); // permit 2% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 723.000,  125.00, 0.05, StateOfMatter::Liquid); // permit 5% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 834.000,  345.00, 0.02, StateOfMatter::Liquid); // permit 2% error deviation
+    // Water cannot exist as vapor (not even as a metastable state) at the conditions below, at which the density
+    // calculation with vapor state stops at a value that does not reproduce the given pressure. The interpolation
+    // data then contains the properties of water in liquid state instead.
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP_FALLBACK( 300.000,  0.05, 0.01, StateOfMatter::Gas, StateOfMatter::Liquid); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP_FALLBACK( 353.000,  2.00, 0.01, StateOfMatter::Gas, StateOfMatter::Liquid); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP_FALLBACK( 423.000,  8.00, 0.01, StateOfMatter::Gas, StateOfMatter::Liquid); // permit 1% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP_FALLBACK( 566.000, 14.00, 0.01, StateOfMatter::Gas, StateOfMatter::Liquid); // permit 1% error deviation
 
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 300.000,    0.05, 0.01, StateOfMatter::Gas); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 354.467,    0.05, 0.01, StateOfMatter::Gas); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 354.468,    0.05, 0.01, StateOfMatter::Gas); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 400.000,    0.05, 0.01, StateOfMatter::Gas); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP(1273.000,    0.05, 0.01, StateOfMatter::Gas); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP(1273.000, 1000.00, 0.01, StateOfMatter::Gas); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 353.000,    2.00, 0.01, StateOfMatter::Gas); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 423.000,    8.00, 0.01, StateOfMatter::Gas); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 566.000,   14.00, 0.01, StateOfMatter::Gas); // permit 1% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 690.000,   87.00, 0.02, StateOfMatter::Gas); // permit 2% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 723.000,  125.00, 0.05, StateOfMatter::Gas); // permit 5% error deviation
-    // CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 834.000,  345.00, 0.02, StateOfMatter::Gas); // permit 2% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 690.000,   87.00, 0.02, StateOfMatter::Gas); // permit 2% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 723.000,  125.00, 0.05, StateOfMatter::Gas); // permit 5% error deviation
+    CHECK_WATER_THERMO_PROPS_WAGNER_PRUSS_INTERP( 834.000,  345.00, 0.02, StateOfMatter::Gas); // permit 2% error deviation
 
     // TODO: To reduce errors above (note the 4.17% error at 723K and 125MPa), more refinement in the interpolation grid is needed.
 }
@@ -23,7 +23,6 @@ using std::sqrt;
 
 // Reaktoro includes
 #include <Reaktoro/Common/Exception.hpp>
-#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Water/WaterHelmholtzProps.hpp>
 #include <Reaktoro/Water/WaterHelmholtzPropsHGK.hpp>
 #include <Reaktoro/Water/WaterHelmholtzPropsWagnerPruss.hpp>
@@ -32,39 +31,6 @@ using std::sqrt;
 #include <Reaktoro/Water/WaterUtils.hpp>
 
 namespace Reaktoro {
-namespace {
-
-/// Return a memoized function that computes thermodynamic properties of water using HGK (1984) model.
-auto createMemoizedWaterThermoPropsFnHGK()
-{
-    Fn<WaterThermoProps(real const&, real const&, StateOfMatter)> fn = [](real const& T, real const& P, StateOfMatter som)
-    {
-        return waterThermoPropsHGK(T, P, som);
-    };
-    return memoizeLast(fn);
-}
-
-/// Return a memoized function that computes thermodynamic properties of water using Wagner & Pruss (1999) model.
-auto createMemoizedWaterThermoPropsFnWagnerPruss()
-{
-    Fn<WaterThermoProps(real const&, real const&, StateOfMatter)> fn = [](real const& T, real const& P, StateOfMatter som)
-    {
-        return waterThermoPropsWagnerPruss(T, P, som);
-    };
-    return memoizeLast(fn);
-}
-
-/// Return a memoized function that computes thermodynamic properties of water using interpolation on Wagner & Pruss (1999) pre-computed properties.
-auto createMemoizedWaterThermoPropsFnWagnerPrussInterp()
-{
-    Fn<WaterThermoProps(real const&, real const&, StateOfMatter)> fn = [](real const& T, real const& P, StateOfMatter som)
-    {
-        return waterThermoPropsWagnerPrussInterp(T, P, som);
-    };
-    return memoizeLast(fn);
-}
-
-} // namespace
 
 auto waterThermoPropsHGK(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
@@ -75,8 +41,13 @@ auto waterThermoPropsHGK(real const& T, real const& P, StateOfMatter som) -> Wat
 
 auto waterThermoPropsHGKMemoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
-    static thread_local auto fn = createMemoizedWaterThermoPropsFnHGK();
-    return fn(T, P, som);
+    return waterThermoPropsHGKMemoizedFn()(T, P, som);
+}
+
+auto waterThermoPropsHGKMemoizedFn() -> WaterThermoPropsMemoizedFn&
+{
+    static thread_local WaterThermoPropsMemoizedFn fn(waterThermoPropsHGK);
+    return fn;
 }
 
 auto waterThermoPropsWagnerPruss(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
@@ -88,14 +59,24 @@ auto waterThermoPropsWagnerPruss(real const& T, real const& P, StateOfMatter som
 
 auto waterThermoPropsWagnerPrussMemoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
-    static thread_local auto fn = createMemoizedWaterThermoPropsFnWagnerPruss();
-    return fn(T, P, som);
+    return waterThermoPropsWagnerPrussMemoizedFn()(T, P, som);
+}
+
+auto waterThermoPropsWagnerPrussMemoizedFn() -> WaterThermoPropsMemoizedFn&
+{
+    static thread_local WaterThermoPropsMemoizedFn fn(waterThermoPropsWagnerPruss);
+    return fn;
 }
 
 auto waterThermoPropsWagnerPrussInterpMemoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps
 {
-    static thread_local auto fn = createMemoizedWaterThermoPropsFnWagnerPrussInterp();
-    return fn(T, P, som);
+    return waterThermoPropsWagnerPrussInterpMemoizedFn()(T, P, som);
+}
+
+auto waterThermoPropsWagnerPrussInterpMemoizedFn() -> WaterThermoPropsMemoizedFn&
+{
+    static thread_local WaterThermoPropsMemoizedFn fn(waterThermoPropsWagnerPrussInterp);
+    return fn;
 }
 
 auto waterThermoProps(real const& T, real const& P, WaterHelmholtzProps const& whp) -> WaterThermoProps
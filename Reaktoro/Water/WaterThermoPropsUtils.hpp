@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Memoization.hpp>
 #include <Reaktoro/Common/Real.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
 
@@ -27,6 +28,9 @@ namespace Reaktoro {
 struct WaterThermoProps;
 struct WaterHelmholtzProps;
 
+/// The type of the memoized functions that calculate the thermodynamic properties of water.
+using WaterThermoPropsMemoizedFn = MemoizedFn<WaterThermoProps(real const&, real const&, StateOfMatter)>;
+
 /// Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.
 /// **References:**
 /// - Haar, L., Gallagher, J. S., Kell, G. S. (1984). NBS/NRC Steam Tables: Thermodynamic and
@@ -41,9 +45,15 @@ auto waterThermoPropsHGK(real const& T, real const& P, StateOfMatter som) -> Wat
 
 /// Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.
 /// @note This function will skip the computation if given arguments are the same as
-/// in its last invocation. The cached result will be returned, thus improving performance.
+/// in a recent invocation. The cached result will be returned, thus improving performance.
+/// By default, only the last invocation is cached. Use @ref waterThermoPropsHGKMemoizedFn to select a larger cache.
 auto waterThermoPropsHGKMemoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps;
 
+/// Return the memoized function used in @ref waterThermoPropsHGKMemoized (of the calling thread).
+/// Use it to select the capacity of its cache (e.g., to remember the states at
+/// the temperatures of many cells) and to inspect its cache hits and misses.
+auto waterThermoPropsHGKMemoizedFn() -> WaterThermoPropsMemoizedFn&;
+
 /// Calculate the thermodynamic properties of water using the Wagner and Pruss (1995) equation of state.
 /// **References:**
 /// - Wagner, W., Pruss, A. (1999). The IAPWS Formulation 1995 for the Thermodynamic Properties of
@@ -58,14 +68,26 @@ auto waterThermoPropsWagnerPruss(real const& T, real const& P, StateOfMatter som
 
 /// Calculate the thermodynamic properties of water using the Wagner and Pruss (1995) equation of state.
 /// @note This function will skip the computation if given arguments are the same as
-/// in its last invocation. The cached result will be returned, thus improving performance.
+/// in a recent invocation. The cached result will be returned, thus improving performance.
+/// By default, only the last invocation is cached. Use @ref waterThermoPropsWagnerPrussMemoizedFn to select a larger cache.
 auto waterThermoPropsWagnerPrussMemoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps;
 
+/// Return the memoized function used in @ref waterThermoPropsWagnerPrussMemoized (of the calling thread).
+/// Use it to select the capacity of its cache (e.g., to remember the states at
+/// the temperatures of many cells) and to inspect its cache hits and misses.
+auto waterThermoPropsWagnerPrussMemoizedFn() -> WaterThermoPropsMemoizedFn&;
+
 /// Calculate the thermodynamic properties of water using interpolation of pre-computed properties using the Wagner and Pruss (1995) equation of state.
 /// @note This function will skip the computation if given arguments are the same as
-/// in its last invocation. The cached result will be returned, thus improving performance.
+/// in a recent invocation. The cached result will be returned, thus improving performance.
+/// By default, only the last invocation is cached. Use @ref waterThermoPropsWagnerPrussInterpMemoizedFn to select a larger cache.
 auto waterThermoPropsWagnerPrussInterpMemoized(real const& T, real const& P, StateOfMatter som) -> WaterThermoProps;
 
+/// Return the memoized function used in @ref waterThermoPropsWagnerPrussInterpMemoized (of the calling thread).
+/// Use it to select the capacity of its cache (e.g., to remember the states at
+/// the temperatures of many cells) and to inspect its cache hits and misses.
+auto waterThermoPropsWagnerPrussInterpMemoizedFn() -> WaterThermoPropsMemoizedFn&;
+
 /// Calculate the thermodynamic properties of water.
 /// This is a general method that uses the Helmholtz free energy state
 /// of water, as an instance of WaterHelmholtzProps, to completely
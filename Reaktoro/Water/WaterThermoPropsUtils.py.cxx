@@ -26,10 +26,21 @@ using namespace Reaktoro;
 
 void exportWaterThermoPropsUtils(py::module& m)
 {
+    py::class_<WaterThermoPropsMemoizedFn>(m, "WaterThermoPropsMemoizedFn")
+        .def("setCapacity", &WaterThermoPropsMemoizedFn::setCapacity, "Set the maximum number of calls cached (the current cache is discarded).")
+        .def("capacity", &WaterThermoPropsMemoizedFn::capacity, "Return the maximum number of calls cached.")
+        .def("stats", &WaterThermoPropsMemoizedFn::stats, return_internal_ref, "Return the counters of cache hits and misses.")
+        .def("resetStats", &WaterThermoPropsMemoizedFn::resetStats, "Reset the counters of cache hits and misses.")
+        .def("__call__", &WaterThermoPropsMemoizedFn::operator())
+        ;
+
     m.def("waterThermoPropsHGK", waterThermoPropsHGK, "Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.");
     m.def("waterThermoPropsWagnerPruss", waterThermoPropsWagnerPruss, "Calculate the thermodynamic properties of water using the Haar-Gallagher-Kell (1984) equation of state.");
     m.def("waterThermoPropsHGKMemoized", waterThermoPropsHGKMemoized, "Calculate the thermodynamic properties of water using the Wagner and Pruss (1995) equation of state.");
     m.def("waterThermoPropsWagnerPrussMemoized", waterThermoPropsWagnerPrussMemoized, "Calculate the thermodynamic properties of water using the Wagner and Pruss (1995) equation of state.");
     m.def("waterThermoPropsWagnerPrussInterpMemoized", waterThermoPropsWagnerPrussInterpMemoized, "Calculate the thermodynamic properties of water using interpolation of pre-computed properties using the Wagner and Pruss (1995) equation of state.");
+    m.def("waterThermoPropsHGKMemoizedFn", waterThermoPropsHGKMemoizedFn, py::return_value_policy::reference, "Return the memoized function used in waterThermoPropsHGKMemoized (of the calling thread).");
+    m.def("waterThermoPropsWagnerPrussMemoizedFn", waterThermoPropsWagnerPrussMemoizedFn, py::return_value_policy::reference, "Return the memoized function used in waterThermoPropsWagnerPrussMemoized (of the calling thread).");
+    m.def("waterThermoPropsWagnerPrussInterpMemoizedFn", waterThermoPropsWagnerPrussInterpMemoizedFn, py::return_value_policy::reference, "Return the memoized function used in waterThermoPropsWagnerPrussInterpMemoized (of the calling thread).");
     m.def("waterThermoProps", waterThermoProps, "Calculate the thermodynamic properties of water.");
 }
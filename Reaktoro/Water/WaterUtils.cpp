@@ -26,6 +26,7 @@ using std::pow;
 // Reaktoro includes
 #include <Reaktoro/Common/Constants.hpp>
 #include <Reaktoro/Common/Exception.hpp>
+#include <Reaktoro/Common/Index.hpp>
 #include <Reaktoro/Water/WaterConstants.hpp>
 #include <Reaktoro/Water/WaterHelmholtzProps.hpp>
 #include <Reaktoro/Water/WaterHelmholtzPropsHGK.hpp>
@@ -95,6 +96,81 @@ auto waterDensityWagnerPruss(real const& T, real const& P, StateOfMatter stateof
     return waterDensity(T, P, waterHelmholtzPropsWagnerPruss, stateofmatter);
 }
 
+auto waterDensityWagnerPrussBatch(ArrayXdConstRef T, ArrayXdConstRef P, StateOfMatter stateofmatter) -> ArrayXd
+{
+    // Auxiliary constants for the Newton's iterations (the same as in waterDensity)
+    const auto max_iters = 100;
+    const auto tolerance = 1.0e-06;
+
+    const Index N = T.size();
+
+    errorif(P.size() != T.size(), "Expecting temperature and pressure arrays with the same size in waterDensityWagnerPrussBatch, but got sizes ", N, " and ", P.size(), ".");
+
+    // Determine an adequate initial guess for density of each pair based on the desired physical state of water
+    ArrayXd D(N);
+    for(Index k = 0; k < N; ++k)
+        D[k] = waterDensityWagnerPrussInterp(T[k], P[k], stateofmatter).val();
+
+    // The indices of the pairs whose Newton iterations have not converged yet
+    Indices active(N);
+    for(Index k = 0; k < N; ++k)
+        active[k] = k;
+
+    ArrayXd Ta, Pa, Da, F, FD, FDD;
+    WaterHelmholtzPropsArrays h;
+
+    for(int i = 1; i <= max_iters && !active.empty(); ++i)
+    {
+        const auto M = active.size();
+
+        Ta.resize(M);
+        Pa.resize(M);
+        Da.resize(M);
+
+        for(Index k = 0; k < M; ++k)
+        {
+            Ta[k] = T[active[k]];
+            Pa[k] = P[active[k]];
+            Da[k] = D[active[k]];
+        }
+
+        waterHelmholtzPropsWagnerPrussBatch(Ta, Da, h);
+
+        const auto& AD = h.helmholtzD;
+        const auto& ADD = h.helmholtzDD;
+        const auto& ADDD = h.helmholtzDDD;
+
+        F = Da*Da*AD/Pa - 1;
+        FD = (2*Da*AD + Da*Da*ADD)/Pa;
+        FDD = (2*AD + 4*Da*ADD + Da*Da*ADDD)/Pa;
+
+        Index j = 0; // the number of pairs still active after this iteration
+
+        for(Index k = 0; k < M; ++k)
+        {
+            const auto g = F[k]*FD[k];
+            const auto H = FD[k]*FD[k] + F[k]*FDD[k];
+
+            auto& Dk = D[active[k]];
+
+            if(Dk > g/H)
+                Dk -= g/H;
+            else if(Dk > F[k]/FD[k])
+                Dk -= F[k]/FD[k];
+            else Dk *= 0.1;
+
+            if(!(std::abs(F[k]) < tolerance || std::abs(g) < tolerance))
+                active[j++] = active[k];
+        }
+
+        active.resize(j);
+    }
+
+    errorif(!active.empty(), "Unable to calculate the density of water because the calculations did not converge at temperature ", T[active.front()], " K and pressure ", P[active.front()], " Pa.");
+
+    return D;
+}
+
 auto waterLiquidDensityWagnerPruss(real const& T, real const& P) -> real
 {
     return waterDensityWagnerPruss(T, P, StateOfMatter::Liquid);
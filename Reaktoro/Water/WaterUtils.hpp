@@ -18,6 +18,7 @@
 #pragma once
 
 // Reaktoro includes
+#include <Reaktoro/Common/Matrix.hpp>
 #include <Reaktoro/Common/Real.hpp>
 #include <Reaktoro/Core/StateOfMatter.hpp>
 
@@ -37,6 +38,19 @@ auto waterDensityHGK(real const& T, real const& P, StateOfMatter stateofmatter)
 /// @return The density of liquid water (in kg/m3)
 auto waterDensityWagnerPruss(real const& T, real const& P, StateOfMatter stateofmatter) -> real;
 
+/// Calculate the densities of water at many temperature-pressure pairs using the Wagner and Pruss (1995) equation of state
+/// The Newton iterations of all pairs are performed together, with the
+/// Helmholtz free energy states of the pairs not yet converged evaluated all at
+/// once with @ref waterHelmholtzPropsWagnerPrussBatch. This is appropriate
+/// when water is evaluated at a different temperature and pressure in every
+/// cell of a reactive transport simulation. The calculations are performed in
+/// `double`, so no derivatives with respect to temperature or pressure are produced.
+/// @param T The temperatures of water (in K)
+/// @param P The pressures of water (in Pa)
+/// @param stateofmatter The state of matter of water
+/// @return The densities of water at each temperature-pressure pair (in kg/m3)
+auto waterDensityWagnerPrussBatch(ArrayXdConstRef T, ArrayXdConstRef P, StateOfMatter stateofmatter) -> ArrayXd;
+
 /// Calculate the density of liquid water using the Haar--Gallagher--Kell (1984) equation of state
 /// @param T The temperature of water (in K)
 /// @param P The pressure of water (in Pa)
@@ -41,3 +41,28 @@ TEST_CASE("Testing water utility methods", "[WaterUtils]")
     CHECK( waterDensityWagnerPruss(T + 400, P, StateOfMatter::Liquid) == Approx(0.322301) );
     CHECK( waterDensityWagnerPruss(T + 500, P, StateOfMatter::Liquid) == Approx(0.280463) );
 }
+
+TEST_CASE("Testing waterDensityWagnerPrussBatch", "[WaterUtils]")
+{
+    ArrayXd T = ArrayXd::LinSpaced(40, 273.16, 1073.15);
+    ArrayXd P = ArrayXd::LinSpaced(40, 1.0e5, 500.0e5);
+
+    T.tail(4) << 298.15, 373.15, 473.15, 573.15;
+    P.tail(4) << 1.0e5, 1.0e5, 1.0e5, 1.0e5;
+
+    for(auto som : { StateOfMatter::Liquid, StateOfMatter::Gas })
+    {
+        const ArrayXd D = waterDensityWagnerPrussBatch(T, P, som);
+
+        REQUIRE( D.size() == T.size() );
+
+        for(auto i = 0; i < T.size(); ++i)
+        {
+            INFO("T = " << T[i] << " K, P = " << P[i] << " Pa");
+            CHECK( D[i] == Approx(waterDensityWagnerPruss(T[i], P[i], som).val()).epsilon(1e-10) );
+        }
+    }
+
+    CHECK( waterDensityWagnerPrussBatch(ArrayXd(), ArrayXd(), StateOfMatter::Liquid).size() == 0 );
+    CHECK_THROWS( waterDensityWagnerPrussBatch(T, P.head(3), StateOfMatter::Liquid) );
+}
@@ -0,0 +1,21 @@
+# Compress a single file into a zstd frame with this cmake script.
+#
+# This script is used to compress the embedded resources of Reaktoro (e.g.,
+# databases, parameter files) before they are compiled into the library. The
+# compressed file contains only the zstd frame (no archive headers) and it can
+# be decompressed with the zstd library or the `zstd -d` command.
+#
+# *** IMPORTANT *** To use this script, execute:
+#
+#     cmake -DINPUT=<input-file> -DOUTPUT=<output-file> -P CompressFile.cmake
+#
+# This script requires CMake 3.19 or newer.
+
+get_filename_component(OUTPUT_DIR ${OUTPUT} DIRECTORY)
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+file(ARCHIVE_CREATE
+    OUTPUT ${OUTPUT}
+    PATHS ${INPUT}
+    FORMAT raw
+    COMPRESSION Zstd
+    COMPRESSION_LEVEL 9)
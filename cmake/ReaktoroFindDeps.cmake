@@ -14,6 +14,7 @@ set(REAKTORO_USE_tabulate        "" CACHE PATH "Specify this option in case a sp
 set(REAKTORO_USE_ThermoFun       "" CACHE PATH "Specify this option in case a specific ThermoFun library should be used.")
 set(REAKTORO_USE_tsl-ordered-map "" CACHE PATH "Specify this option in case a specific tsl-ordered-map library should be used.")
 set(REAKTORO_USE_yaml-cpp        "" CACHE PATH "Specify this option in case a specific yaml-cpp library should be used.")
+set(REAKTORO_USE_zstd            "" CACHE PATH "Specify this option in case a specific zstd library should be used.")
 
 function(ReaktoroFindPackage name)
     if(DEFINED REAKTORO_USE_${ARGV0} AND NOT REAKTORO_USE_${ARGV0} STREQUAL "")
@@ -41,6 +42,7 @@ ReaktoroFindPackage(tabulate 1.4.0 REQUIRED)
 ReaktoroFindPackage(ThermoFun 0.4.5 REQUIRED)
 ReaktoroFindPackage(tsl-ordered-map 1.0.0 REQUIRED)
 ReaktoroFindPackage(yaml-cpp 0.6.3 REQUIRED)
+find_package(Threads REQUIRED)
 
 # Optional dependencies
 ReaktoroFindPackage(Catch2 2.6.2)
@@ -48,6 +50,18 @@ ReaktoroFindPackage(Python COMPONENTS Interpreter Development)
 ReaktoroFindPackage(pybind11 2.10.0)
 ReaktoroFindPackage(reaktplot 0.4.1)
 
+if(REAKTORO_ENABLE_ZSTD)
+    ReaktoroFindPackage(zstd 1.4.0)
+    if(NOT zstd_FOUND)
+        message(WARNING "Could not find zstd. The embedded resource files of Reaktoro will not be compressed and checkpoint files cannot have compressed chunks!")
+        set(REAKTORO_ENABLE_ZSTD OFF)
+    endif()
+endif()
+
+if(REAKTORO_COMPRESS_EMBEDDED AND NOT REAKTORO_ENABLE_ZSTD)
+    set(REAKTORO_COMPRESS_EMBEDDED OFF)  # the compressed embedded resource files could not be decompressed without zstd
+endif()
+
 if(REAKTORO_BUILD_TESTS)
     if(NOT Catch2_FOUND)
         message(WARNING "Could not find Catch2. The C++ tests of Reaktoro will not be built!")
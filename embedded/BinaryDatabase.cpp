@@ -0,0 +1,52 @@
+// Reaktoro is a unified framework for modeling chemically reactive phases.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// C++ includes
+#include <exception>
+#include <iostream>
+
+// Reaktoro includes
+#include <Reaktoro/Core/Data.hpp>
+using namespace Reaktoro;
+
+// Execute:
+//
+//   ReaktoroBinaryDatabase supcrtbl.json supcrtbl.rkdb
+//
+// to convert a YAML or JSON database file into a binary database file (see
+// Data::dumpBinary). This is used at build time to embed the binary database
+// files into the library, which are then loaded by Database::fromEmbeddedFile.
+int main(int argc, char** argv)
+{
+    if(argc != 3)
+    {
+        std::cerr << "Usage: ReaktoroBinaryDatabase <input yaml or json file> <output binary file>" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        Data::load(argv[1]).saveBinary(argv[2]);
+    }
+    catch(std::exception const& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -18,9 +18,15 @@
 # ---------------------------------------------------------------------------------------------------------------------------
 # Execute this script using:
 #
-# python /path/to/scripts/generate-water-properties-for-interpolation-wagner-pruss.py > WaterThermoPropsWagnerPruss.txt
+# python /path/to/scripts/generate-water-properties-for-interpolation-wagner-pruss.py > /path/to/Reaktoro/Water/WaterInterpolationData.hpp
+#
+# The generated C++ header file contains the interpolation data of water used in Reaktoro/Water/WaterInterpolation.cpp as
+# constexpr arrays, so that no parsing is needed at runtime. The thermodynamic properties of water are tabulated twice,
+# once with water tentatively in liquid state and once with water tentatively in vapor state.
 # ---------------------------------------------------------------------------------------------------------------------------
 
+import math
+
 from reaktoro import *
 
 
@@ -72,7 +78,8 @@ temperatures = [
 ]
 
 
-props = [[None for _ in temperatures[i]] for i, _ in enumerate(pressures)]
+# The first temperature index, for each pressure row, at which water has changed its state of matter from liquid to gas. The index 99 is used for pressures above supercritical value.
+transitions = [ 18, 22, 22, 28, 30, 32, 33, 36, 38, 40, 41, 42, 43, 44, 46, 48, 49, 50, 51, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99 ]
 
 
 def tolist(props: WaterThermoProps):
@@ -101,16 +108,112 @@ def tolist(props: WaterThermoProps):
     ]
 
 
-def printprops(props: WaterThermoProps):
-    props = tolist(props)
-    s = ""
-    for x in props:
-        s += f"{x:+.6e} "
-    print(s)
+def isvalid(props, T, P):
+    if not all(math.isfinite(x) for x in props) or props[9] <= 0.0:  # props[9] is density
+        return False
+    # The density must reproduce the given pressure. Near the critical point and where water cannot exist with the given state of matter
+    # (not even as a metastable state), the Newton iterations for density may stop at a stationary point of the residual instead of a root.
+    D = props[9]
+    Pcalc = D * D * waterHelmholtzPropsWagnerPruss(T, D).helmholtzD.val()
+    return abs(Pcalc/(P * 1e6) - 1.0) < 1e-4  # from MPa to Pa
+
+
+def computeWaterThermoProps(T, P, som, othersom):
+    try:  # try using the given state of matter first
+        props = tolist(waterThermoPropsWagnerPruss(T, P * 1e6, som))  # from MPa to Pa
+        if isvalid(props, T, P):
+            return props
+    except:
+        pass
+    # water cannot exist (even as a metastable state) with the given state of matter, so use the other one
+    return tolist(waterThermoPropsWagnerPruss(T, P * 1e6, othersom))  # from MPa to Pa
+
+
+def printArray(ctype, name, rows, fmt, comment):
+    print(f"/// {comment}")
+    print(f"constexpr {ctype} {name}[] =")
+    print("{")
+    for [label, values] in rows:
+        if label:
+            print(f"    // {label}")
+        print("    " + ", ".join(fmt(x) for x in values) + ",")
+    print("};")
+    print()
+
+
+offsets = [0]
+for Ts in temperatures:
+    offsets.append(offsets[-1] + len(Ts))
+
+liquid, vapor = StateOfMatter.Liquid, StateOfMatter.Gas
+
+# Above the critical pressure (transition index 99), water exists as a single fluid state, and both tables must contain it. Starting the
+# Newton iterations for density from a vapor-like guess at these pressures can converge to spurious roots of the equation of state that
+# are mechanically unstable (negative pressure-density derivative), so the liquid-like guess is tried first in both tables.
+supercritical = lambda i: transitions[i] == 99
+
+props_liquid = [[computeWaterThermoProps(T, P, liquid, vapor) for T in temperatures[i]] for [i, P] in enumerate(pressures)]
+props_vapor  = [[computeWaterThermoProps(T, P, liquid, vapor) if supercritical(i) else computeWaterThermoProps(T, P, vapor, liquid) for T in temperatures[i]] for [i, P] in enumerate(pressures)]
+
+fmtfloat = lambda x: f"{x:.6g}"
+fmttemp  = lambda x: f"{x:.3f}"
+fmtprops = lambda x: f"{x:+.6e}"
+fmtindex = lambda x: f"{x}"
+
+print("""// Reaktoro is a unified framework for modeling chemically reactive systems.
+//
+// Copyright © 2014-2024 Allan Leal
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// -------------------------------------------------------------------------------------------------
+// THIS FILE WAS GENERATED BY scripts/generate-water-properties-for-interpolation-wagner-pruss.py
+// DO NOT EDIT IT MANUALLY! CHANGE THE SCRIPT ABOVE AND RUN IT AGAIN INSTEAD.
+// -------------------------------------------------------------------------------------------------
+
+#pragma once
+
+// Reaktoro includes
+#include <Reaktoro/Common/Types.hpp>
+
+// This header is meant to be included only in Reaktoro/Water/WaterInterpolation.cpp.
+
+namespace Reaktoro {
+namespace detail {
+""")
+
+print("/// The number of thermodynamic properties of water per interpolation point in the tables below.")
+print("constexpr auto waterInterpNumThermoProps = 21;")
+print()
+
+printArray("double", "waterInterpPressures", [[None, pressures]], fmtfloat,
+    "The pressures for interpolation of water properties (in MPa).")
+
+printArray("Index", "waterInterpOffsets", [[None, offsets]], fmtindex,
+    "The offsets of the temperature rows for each pressure in the flattened interpolation tables.")
+
+printArray("Index", "waterInterpTransitions", [[None, transitions]], fmtindex,
+    "The first temperature index, for each pressure row, at which water has changed its state of matter from liquid to gas (99 for pressures above supercritical value).")
+
+printArray("double", "waterInterpTemperatures", [[f"P = {P} MPa", temperatures[i]] for [i, P] in enumerate(pressures)], fmttemp,
+    "The temperatures for interpolation of water properties for each pressure (in K).")
+
+printArray("double", "waterInterpThermoPropsLiquid", [[f"P = {P} MPa" if j == 0 else None, row] for [i, P] in enumerate(pressures) for [j, row] in enumerate(props_liquid[i])], fmtprops,
+    "The thermodynamic properties of water tentatively at liquid state, even when water is stable as vapor (T, V, S, A, U, H, G, Cv, Cp, D, DT, DP, DTT, DTP, DPP, P, PT, PD, PTT, PTD, PDD per point).")
 
+printArray("double", "waterInterpThermoPropsVapor", [[f"P = {P} MPa" if j == 0 else None, row] for [i, P] in enumerate(pressures) for [j, row] in enumerate(props_vapor[i])], fmtprops,
+    "The thermodynamic properties of water tentatively at vapor state, even when water is stable as liquid (T, V, S, A, U, H, G, Cv, Cp, D, DT, DP, DTT, DTP, DPP, P, PT, PD, PTT, PTD, PDD per point).")
 
-for [i, P] in enumerate(pressures):
-    print(f"P = {P} MPa")
-    for [j, T] in enumerate(temperatures[i]):
-        props = waterThermoPropsWagnerPruss(T, P * 1e6)  # from MPa to Pa
-        printprops(props)
+print("""} // namespace detail
+} // namespace Reaktoro""")